@@ -7,7 +7,9 @@ BenchmarkConfig::BenchmarkConfig(const BenchmarkMode benchmark_mode, const Chunk
                                  const Duration& max_duration, const Duration& warmup_duration, const UseMvcc use_mvcc,
                                  const std::optional<std::string>& output_file_path, const bool enable_scheduler,
                                  const uint32_t cores, const uint32_t clients, const bool enable_visualization,
-                                 const bool verify, const bool cache_binary_tables, const bool enable_jit)
+                                 const bool verify, const bool cache_binary_tables, const bool enable_jit,
+                                 const bool enable_pipelining, const Duration& scheduler_statistics_interval,
+                                 const double arrival_rate)
     : benchmark_mode(benchmark_mode),
       chunk_size(chunk_size),
       encoding_config(encoding_config),
@@ -22,7 +24,10 @@ BenchmarkConfig::BenchmarkConfig(const BenchmarkMode benchmark_mode, const Chunk
       enable_visualization(enable_visualization),
       verify(verify),
       cache_binary_tables(cache_binary_tables),
-      enable_jit(enable_jit) {}
+      enable_jit(enable_jit),
+      enable_pipelining(enable_pipelining),
+      scheduler_statistics_interval(scheduler_statistics_interval),
+      arrival_rate(arrival_rate) {}
 
 BenchmarkConfig BenchmarkConfig::get_default_config() { return BenchmarkConfig(); }
 
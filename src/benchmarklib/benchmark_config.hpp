@@ -10,8 +10,11 @@ namespace opossum {
 /**
  * IndividualQueries runs each query a number of times and then the next one
  * PermutedQuerySet runs the queries as set permuting their order after each run (this exercises caches)
+ * OpenLoop issues randomly chosen queries at a target rate, independent of when earlier queries finish. The clients
+ * issue queries with exponentially distributed gaps, so that the arrivals form a Poisson process. Unlike the other
+ * modes, this shows how the latency develops under load and which throughput the scheduler sustains.
  */
-enum class BenchmarkMode { IndividualQueries, PermutedQuerySet };
+enum class BenchmarkMode { IndividualQueries, PermutedQuerySet, OpenLoop };
 
 using Duration = std::chrono::high_resolution_clock::duration;
 using TimePoint = std::chrono::high_resolution_clock::time_point;
@@ -24,7 +27,8 @@ class BenchmarkConfig {
                   const Duration& warmup_duration, const UseMvcc use_mvcc,
                   const std::optional<std::string>& output_file_path, const bool enable_scheduler, const uint32_t cores,
                   const uint32_t clients, const bool enable_visualization, const bool verify,
-                  const bool cache_binary_tables, const bool enable_jit);
+                  const bool cache_binary_tables, const bool enable_jit, const bool enable_pipelining,
+                  const Duration& scheduler_statistics_interval, const double arrival_rate);
 
   static BenchmarkConfig get_default_config();
 
@@ -43,6 +47,11 @@ class BenchmarkConfig {
   bool verify = false;
   bool cache_binary_tables = false;
   bool enable_jit = false;
+  bool enable_pipelining = false;
+  // Zero disables printing the statistics of the scheduler while the benchmark runs
+  Duration scheduler_statistics_interval = Duration{0};
+  // Queries per second issued by all clients together in BenchmarkMode::OpenLoop
+  double arrival_rate = 0.0;
 
   static const char* description;
 
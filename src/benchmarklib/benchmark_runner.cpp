@@ -1,7 +1,11 @@
 #include <json.hpp>
 
 #include <boost/range/adaptors.hpp>
+#include <cmath>
+#include <condition_variable>
+#include <mutex>
 #include <random>
+#include <thread>
 
 #include "cxxopts.hpp"
 
@@ -10,15 +14,19 @@
 #include "benchmark_state.hpp"
 #include "constant_mappings.hpp"
 #include "logical_query_plan/jit_aware_lqp_translator.hpp"
+#include "logical_query_plan/pipeline_aware_lqp_translator.hpp"
+#include "operators/print.hpp"
 #include "scheduler/current_scheduler.hpp"
 #include "sql/create_sql_parser_error_message.hpp"
 #include "sql/sql_pipeline_builder.hpp"
 #include "storage/chunk.hpp"
 #include "storage/chunk_encoder.hpp"
+#include "storage/meta_table_manager.hpp"
 #include "storage/storage_manager.hpp"
 #include "tpch/tpch_table_generator.hpp"
 #include "utils/check_table_equal.hpp"
 #include "utils/format_duration.hpp"
+#include "utils/pausable_loop_thread.hpp"
 #include "utils/sqlite_wrapper.hpp"
 #include "utils/timer.hpp"
 #include "version.hpp"
@@ -97,6 +105,17 @@ void BenchmarkRunner::run() {
   _query_plans.resize(available_queries_count);
   _query_results.resize(available_queries_count);
 
+  // Periodically print the statistics of the scheduler, e.g., to spot workers that are idle while others are busy
+  auto scheduler_statistics_thread = std::unique_ptr<PausableLoopThread>{};
+  if (_config.enable_scheduler && _config.scheduler_statistics_interval > Duration{0}) {
+    const auto interval = std::chrono::duration_cast<std::chrono::milliseconds>(_config.scheduler_statistics_interval);
+    scheduler_statistics_thread = std::make_unique<PausableLoopThread>(interval, [](size_t) {
+      std::cout << "- Scheduler statistics:" << std::endl;
+      Print::print(MetaTableManager::generate_workers_table(), PrintFlags::IgnoreChunkBoundaries);
+      Print::print(MetaTableManager::generate_task_queues_table(), PrintFlags::IgnoreChunkBoundaries);
+    });
+  }
+
   auto benchmark_start = std::chrono::steady_clock::now();
 
   // Run the queries in the selected mode
@@ -109,10 +128,15 @@ void BenchmarkRunner::run() {
       _benchmark_permuted_query_set();
       break;
     }
+    case BenchmarkMode::OpenLoop: {
+      _benchmark_open_loop();
+      break;
+    }
   }
 
   auto benchmark_end = std::chrono::steady_clock::now();
   _total_run_duration = benchmark_end - benchmark_start;
+  scheduler_statistics_thread = nullptr;
 
   // Create report
   if (_config.output_file_path) {
@@ -281,6 +305,180 @@ void BenchmarkRunner::_benchmark_individual_queries() {
   }
 }
 
+void BenchmarkRunner::_benchmark_open_loop() {
+  Assert(_config.enable_scheduler, "OpenLoop mode requires the scheduler");
+  Assert(_config.arrival_rate > 0.0, "OpenLoop mode requires a positive arrival rate");
+
+  const auto query_ids = _query_generator->selected_queries();
+  for (const auto& query_id : query_ids) {
+    _warmup_query(query_id);
+  }
+
+  std::cout << "- Issuing " << _config.arrival_rate << " queries per second from " << _config.clients << " clients"
+            << std::endl;
+
+  const auto window_count = static_cast<size_t>(std::ceil(std::chrono::duration<double>{_config.max_duration} /
+                                                          std::chrono::duration<double>{OPEN_LOOP_WINDOW}));
+  _open_loop_windows = std::vector<OpenLoopWindow>(window_count);
+
+  const auto benchmark_begin = std::chrono::steady_clock::now();
+  const auto window_of = [&](const std::chrono::steady_clock::time_point time_point) -> OpenLoopWindow* {
+    const auto window_idx = static_cast<size_t>((time_point - benchmark_begin) / OPEN_LOOP_WINDOW);
+    return window_idx < _open_loop_windows.size() ? &_open_loop_windows[window_idx] : nullptr;
+  };
+
+  // Once the time is up or enough queries finished, the clients stop issuing queries, even if they wait for the arrival
+  // of their next one
+  auto stop = std::atomic_bool{false};
+  auto stop_mutex = std::mutex{};
+  auto stop_condition = std::condition_variable{};
+
+  auto issued_query_count = std::atomic<size_t>{0};
+  auto finished_query_count = std::atomic<size_t>{0};
+
+  // Each client issues its share of the arrival rate with exponentially distributed gaps. As the arrivals do not depend
+  // on when earlier queries finish, the latency of a query is measured from its planned arrival. This includes the time
+  // it waited because its client was still busy building the plan of the previous query.
+  const auto run_client = [&](const size_t client_id) {
+    auto random_engine = std::mt19937{std::random_device{}() + static_cast<unsigned>(client_id)};
+    auto gap_distribution = std::exponential_distribution<double>{_config.arrival_rate / _config.clients};
+    auto query_distribution = std::uniform_int_distribution<size_t>{0, query_ids.size() - 1};
+
+    auto tasks = std::vector<std::shared_ptr<AbstractTask>>{};
+    auto arrival = benchmark_begin;
+    while (true) {
+      arrival += std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+          std::chrono::duration<double>{gap_distribution(random_engine)});
+      {
+        auto lock = std::unique_lock<std::mutex>{stop_mutex};
+        if (stop_condition.wait_until(lock, arrival, [&]() { return stop.load(); })) break;
+      }
+
+      auto* const arrival_window = window_of(arrival);
+      if (!arrival_window || issued_query_count++ >= _config.max_num_query_runs) break;
+      ++arrival_window->arrival_count;
+
+      const auto query_id = query_ids[query_distribution(random_engine)];
+      const auto pipeline = _build_sql_pipeline(query_id);
+
+      auto on_query_done = [pipeline, query_id, arrival, &window_of, &stop, &finished_query_count, this]() {
+        const auto now = std::chrono::steady_clock::now();
+        auto* const window = window_of(now);
+        if (stop || !window) return;  // To prevent queries to add their results after the time is up
+
+        const auto latency = now - arrival;
+        window->latencies.record(latency);
+        ++finished_query_count;
+
+        auto& result = _query_results[query_id];
+        result.duration_ns.fetch_add(std::chrono::duration_cast<std::chrono::nanoseconds>(latency).count());
+        result.metrics.push_back(pipeline->metrics());
+        result.num_iterations++;
+      };
+
+      const auto query_tasks = _schedule_query(query_id, pipeline, on_query_done);
+      tasks.insert(tasks.end(), query_tasks.begin(), query_tasks.end());
+    }
+
+    // Wait for the rest of the tasks that didn't make it in time - they will not count toward the results
+    CurrentScheduler::wait_for_tasks(tasks);
+  };
+
+  auto clients = std::vector<std::thread>{};
+  clients.reserve(_config.clients);
+  for (auto client_id = size_t{0}; client_id < _config.clients; ++client_id) {
+    clients.emplace_back(run_client, client_id);
+  }
+
+  // Print each window once it is over
+  auto next_window_idx = size_t{0};
+  while (next_window_idx < _open_loop_windows.size() &&
+         finished_query_count.load(std::memory_order_relaxed) < _config.max_num_query_runs) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    while (next_window_idx < _open_loop_windows.size() &&
+           std::chrono::steady_clock::now() >= benchmark_begin + (next_window_idx + 1) * OPEN_LOOP_WINDOW) {
+      _print_open_loop_window(next_window_idx++);
+    }
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(stop_mutex);
+    stop = true;
+  }
+  stop_condition.notify_all();
+  _open_loop_duration = std::min(std::chrono::steady_clock::now() - benchmark_begin,
+                                 std::chrono::steady_clock::duration{_open_loop_windows.size() * OPEN_LOOP_WINDOW});
+
+  // The last window is incomplete if enough queries finished before the time was up
+  if (next_window_idx < _open_loop_windows.size()) _print_open_loop_window(next_window_idx);
+
+  for (auto& client : clients) {
+    client.join();
+  }
+
+  const auto report = _open_loop_report();
+  const auto& summary = report["summary"];
+  std::cout << "  -> Issued " << summary["issued_queries_per_second"].get<double>() << " and finished "
+            << summary["finished_queries_per_second"].get<double>() << " queries per second" << std::endl;
+  if (summary["saturated"].get<bool>()) {
+    std::cout << "  -> The scheduler cannot keep up with the arrival rate. Its saturation throughput for this query "
+              << "mix is " << summary["finished_queries_per_second"].get<double>() << " queries per second" << std::endl;
+  } else {
+    std::cout << "  -> The scheduler kept up with the arrival rate. Increase '--arrival_rate' to find its saturation "
+              << "throughput" << std::endl;
+  }
+}
+
+void BenchmarkRunner::_print_open_loop_window(const size_t window_idx) const {
+  const auto& window = _open_loop_windows[window_idx];
+  const auto window_begin = std::chrono::duration_cast<std::chrono::seconds>(window_idx * OPEN_LOOP_WINDOW);
+  std::cout << "  -> [" << window_begin.count() << " s] " << window.arrival_count.load() << " queries issued, "
+            << window.latencies.count() << " finished, latency p50: "
+            << format_duration(window.latencies.percentile(50)) << ", p95: " << format_duration(window.latencies.percentile(95))
+            << ", p99: " << format_duration(window.latencies.percentile(99))
+            << ", p999: " << format_duration(window.latencies.percentile(99.9)) << std::endl;
+}
+
+nlohmann::json BenchmarkRunner::_open_loop_report() const {
+  const auto percentiles_json = [](const DurationHistogram& latencies) {
+    return nlohmann::json{{"p50", latencies.percentile(50).count()},
+                          {"p95", latencies.percentile(95).count()},
+                          {"p99", latencies.percentile(99).count()},
+                          {"p999", latencies.percentile(99.9).count()}};
+  };
+
+  auto windows_json = nlohmann::json::array();
+  auto latencies = DurationHistogram{};
+  auto arrival_count = uint64_t{0};
+  for (auto window_idx = size_t{0}; window_idx < _open_loop_windows.size(); ++window_idx) {
+    const auto& window = _open_loop_windows[window_idx];
+    latencies.merge(window.latencies);
+    arrival_count += window.arrival_count.load();
+
+    const auto window_begin = std::chrono::duration_cast<std::chrono::nanoseconds>(window_idx * OPEN_LOOP_WINDOW);
+    windows_json.push_back({{"begin", window_begin.count()},
+                            {"issued_queries", window.arrival_count.load()},
+                            {"finished_queries", window.latencies.count()},
+                            {"latency", percentiles_json(window.latencies)}});
+  }
+
+  const auto duration_seconds = std::chrono::duration<double>{_open_loop_duration}.count();
+  const auto issued_queries_per_second = duration_seconds > 0 ? static_cast<double>(arrival_count) / duration_seconds
+                                                              : 0.0;
+  const auto finished_queries_per_second =
+      duration_seconds > 0 ? static_cast<double>(latencies.count()) / duration_seconds : 0.0;
+
+  const auto summary = nlohmann::json{
+      {"arrival_rate", _config.arrival_rate},
+      {"duration", std::chrono::duration_cast<std::chrono::nanoseconds>(_open_loop_duration).count()},
+      {"issued_queries_per_second", issued_queries_per_second},
+      {"finished_queries_per_second", finished_queries_per_second},
+      {"saturated", finished_queries_per_second < OPEN_LOOP_SATURATION_THRESHOLD * issued_queries_per_second},
+      {"latency", percentiles_json(latencies)}};
+
+  return nlohmann::json{{"summary", summary}, {"windows", windows_json}};
+}
+
 void BenchmarkRunner::_warmup_query(const QueryID query_id) {
   if (_config.warmup_duration == Duration{0}) {
     return;
@@ -401,6 +599,8 @@ void BenchmarkRunner::_execute_query(const QueryID query_id, const std::shared_p
 
 void BenchmarkRunner::_store_plan(const QueryID query_id, SQLPipeline& pipeline) {
   if (_config.enable_visualization) {
+    // In OpenLoop mode, multiple clients schedule queries
+    std::lock_guard<std::mutex> lock(_query_plans_mutex);
     if (_query_plans[query_id].lqps.empty()) {
       QueryPlans plans{pipeline.get_optimized_logical_plans(), pipeline.get_physical_plans()};
       _query_plans[query_id] = plans;
@@ -478,6 +678,10 @@ void BenchmarkRunner::_create_report(std::ostream& stream) const {
                         {"summary", summary},
                         {"table_generation", _table_generator->metrics}};
 
+  if (_config.benchmark_mode == BenchmarkMode::OpenLoop) {
+    report["open_loop"] = _open_loop_report();
+  }
+
   stream << std::setw(2) << report << std::endl;
 }
 
@@ -488,6 +692,9 @@ std::shared_ptr<SQLPipeline> BenchmarkRunner::_build_sql_pipeline(const QueryID
   if (_config.enable_jit) {
     pipeline_builder.with_lqp_translator(std::make_shared<JitAwareLQPTranslator>());
   }
+  if (_config.enable_pipelining) {
+    pipeline_builder.with_lqp_translator(std::make_shared<PipelineAwareLQPTranslator>());
+  }
   if (_config.enable_visualization) {
     pipeline_builder.dont_cleanup_temporaries();
   }
@@ -515,7 +722,7 @@ cxxopts::Options BenchmarkRunner::get_basic_cli_options(const std::string& bench
     ("t,time", "Maximum seconds that a query (set) is run", cxxopts::value<size_t>()->default_value("60")) // NOLINT
     ("w,warmup", "Number of seconds that each query is run for warm up", cxxopts::value<size_t>()->default_value("0")) // NOLINT
     ("o,output", "File to output results to, don't specify for stdout", cxxopts::value<std::string>()->default_value("")) // NOLINT
-    ("m,mode", "IndividualQueries or PermutedQuerySet, default is IndividualQueries", cxxopts::value<std::string>()->default_value("IndividualQueries")) // NOLINT
+    ("m,mode", "IndividualQueries, PermutedQuerySet or OpenLoop, default is IndividualQueries", cxxopts::value<std::string>()->default_value("IndividualQueries")) // NOLINT
     ("e,encoding", "Specify Chunk encoding as a string or as a JSON config file (for more detailed configuration, see --full_help). String options: " + encoding_strings_option, cxxopts::value<std::string>()->default_value("Dictionary"))  // NOLINT
     ("compression", "Specify vector compression as a string. Options: " + compression_strings_option, cxxopts::value<std::string>()->default_value(""))  // NOLINT
     ("scheduler", "Enable or disable the scheduler", cxxopts::value<bool>()->default_value("false")) // NOLINT
@@ -524,7 +731,10 @@ cxxopts::Options BenchmarkRunner::get_basic_cli_options(const std::string& bench
     ("mvcc", "Enable MVCC", cxxopts::value<bool>()->default_value("false")) // NOLINT
     ("visualize", "Create a visualization image of one LQP and PQP for each query", cxxopts::value<bool>()->default_value("false")) // NOLINT
     ("verify", "Verify each query by comparing it with the SQLite result", cxxopts::value<bool>()->default_value("false")) // NOLINT
-    ("cache_binary_tables", "Cache tables as binary files for faster loading on subsequent runs", cxxopts::value<bool>()->default_value("false")); // NOLINT
+    ("cache_binary_tables", "Cache tables as binary files for faster loading on subsequent runs", cxxopts::value<bool>()->default_value("false")) // NOLINT
+    ("pipelining", "Execute chains of scans and validates morsel by morsel", cxxopts::value<bool>()->default_value("false")) // NOLINT
+    ("scheduler_statistics", "Print the statistics of the scheduler's workers and queues every N seconds while the benchmark runs. 0 disables it", cxxopts::value<size_t>()->default_value("0")) // NOLINT
+    ("arrival_rate", "Queries per second issued by all clients together in OpenLoop mode", cxxopts::value<double>()->default_value("0")); // NOLINT
 
   if constexpr (HYRISE_JIT_SUPPORT) {
     cli_options.add_options()
@@ -553,14 +763,17 @@ nlohmann::json BenchmarkRunner::create_context(const BenchmarkConfig& config) {
   #endif
   // clang-format on
 
+  auto benchmark_mode = "IndividualQueries";
+  if (config.benchmark_mode == BenchmarkMode::PermutedQuerySet) benchmark_mode = "PermutedQuerySet";
+  if (config.benchmark_mode == BenchmarkMode::OpenLoop) benchmark_mode = "OpenLoop";
+
   return nlohmann::json{
       {"date", timestamp_stream.str()},
       {"chunk_size", config.chunk_size},
       {"compiler", compiler.str()},
       {"build_type", HYRISE_DEBUG ? "debug" : "release"},
       {"encoding", config.encoding_config.to_json()},
-      {"benchmark_mode",
-       config.benchmark_mode == BenchmarkMode::IndividualQueries ? "IndividualQueries" : "PermutedQuerySet"},
+      {"benchmark_mode", benchmark_mode},
       {"max_runs", config.max_num_query_runs},
       {"max_duration", std::chrono::duration_cast<std::chrono::nanoseconds>(config.max_duration).count()},
       {"warmup_duration", std::chrono::duration_cast<std::chrono::nanoseconds>(config.warmup_duration).count()},
@@ -568,6 +781,10 @@ nlohmann::json BenchmarkRunner::create_context(const BenchmarkConfig& config) {
       {"using_visualization", config.enable_visualization},
       {"using_scheduler", config.enable_scheduler},
       {"using_jit", config.enable_jit},
+      {"using_pipelining", config.enable_pipelining},
+      {"scheduler_statistics_interval",
+       std::chrono::duration_cast<std::chrono::nanoseconds>(config.scheduler_statistics_interval).count()},
+      {"arrival_rate", config.arrival_rate},
       {"cores", config.cores},
       {"clients", config.clients},
       {"verify", config.verify},
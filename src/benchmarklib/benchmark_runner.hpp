@@ -5,6 +5,7 @@
 #include <atomic>
 #include <chrono>
 #include <iostream>
+#include <mutex>
 #include <optional>
 #include <unordered_map>
 #include <vector>
@@ -21,6 +22,7 @@
 #include "sql/sql_pipeline_statement.hpp"
 #include "storage/chunk.hpp"
 #include "storage/encoding_type.hpp"
+#include "utils/duration_histogram.hpp"
 #include "utils/performance_warning.hpp"
 
 namespace opossum {
@@ -51,6 +53,15 @@ class BenchmarkRunner {
   // Run benchmark in BenchmarkMode::IndividualQueries mode
   void _benchmark_individual_queries();
 
+  // Run benchmark in BenchmarkMode::OpenLoop mode
+  void _benchmark_open_loop();
+
+  // Print the number of queries and the latency percentiles of an OpenLoopWindow
+  void _print_open_loop_window(const size_t window_idx) const;
+
+  // Summarize the windows of BenchmarkMode::OpenLoop for the report
+  nlohmann::json _open_loop_report() const;
+
   // Execute warmup run of a query
   void _warmup_query(const QueryID query_id);
 
@@ -85,6 +96,7 @@ class BenchmarkRunner {
   // If visualization is enabled, this stores the LQP and PQP for each query. Its length is defined by the number of
   // available queries.
   std::vector<QueryPlans> _query_plans;
+  std::mutex _query_plans_mutex;
 
   const BenchmarkConfig _config;
 
@@ -99,6 +111,24 @@ class BenchmarkRunner {
   std::optional<PerformanceWarningDisabler> _performance_warning_disabler;
 
   Duration _total_run_duration{};
+
+  // In BenchmarkMode::OpenLoop, latencies are reported per OPEN_LOOP_WINDOW to show how they develop over time
+  static constexpr auto OPEN_LOOP_WINDOW = std::chrono::seconds{1};
+
+  // If the queries finished per second fall below this share of the queries issued per second, the scheduler cannot
+  // keep up with the arrival rate and the queries finished per second are its saturation throughput
+  static constexpr auto OPEN_LOOP_SATURATION_THRESHOLD = 0.95;
+
+  struct OpenLoopWindow final {
+    // Queries planned to arrive within the window
+    std::atomic<uint64_t> arrival_count{0};
+
+    // Latencies of the queries that finished within the window, measured from their planned arrival
+    DurationHistogram latencies;
+  };
+
+  std::vector<OpenLoopWindow> _open_loop_windows;
+  Duration _open_loop_duration{};
 };
 
 }  // namespace opossum
@@ -72,6 +72,8 @@ BenchmarkConfig CLIConfigParser::parse_basic_options_json_config(const nlohmann:
     benchmark_mode = BenchmarkMode::IndividualQueries;
   } else if (benchmark_mode_str == "PermutedQuerySet") {
     benchmark_mode = BenchmarkMode::PermutedQuerySet;
+  } else if (benchmark_mode_str == "OpenLoop") {
+    benchmark_mode = BenchmarkMode::OpenLoop;
   } else {
     throw std::runtime_error("Invalid benchmark mode: '" + benchmark_mode_str + "'");
   }
@@ -136,10 +138,39 @@ BenchmarkConfig CLIConfigParser::parse_basic_options_json_config(const nlohmann:
   }
   std::cout << "- JIT is " << (enable_jit ? "enabled" : "disabled") << std::endl;
 
+  const auto enable_pipelining = json_config.value("pipelining", default_config.enable_pipelining);
+  Assert(!enable_jit || !enable_pipelining, "JIT and pipelining cannot be combined");
+  std::cout << "- Pipelining is " << (enable_pipelining ? "enabled" : "disabled") << std::endl;
+
+  const auto default_scheduler_statistics_seconds =
+      std::chrono::duration_cast<std::chrono::seconds>(default_config.scheduler_statistics_interval);
+  const auto scheduler_statistics_seconds =
+      json_config.value("scheduler_statistics", default_scheduler_statistics_seconds.count());
+  if (scheduler_statistics_seconds > 0) {
+    std::cout << "- Printing the scheduler statistics every " << scheduler_statistics_seconds << " seconds"
+              << std::endl;
+    if (!enable_scheduler) {
+      PerformanceWarning("'--scheduler_statistics' specified but ignored, because '--scheduler' is false")
+    }
+  }
+  const Duration scheduler_statistics_interval =
+      std::chrono::duration_cast<opossum::Duration>(std::chrono::seconds{scheduler_statistics_seconds});
+
+  const auto arrival_rate = json_config.value("arrival_rate", default_config.arrival_rate);
+  if (benchmark_mode == BenchmarkMode::OpenLoop) {
+    // Without the scheduler, each client would wait for its query to finish before issuing the next one
+    if (!enable_scheduler) throw std::runtime_error("'OpenLoop' mode requires '--scheduler'");
+    if (arrival_rate <= 0.0) throw std::runtime_error("'OpenLoop' mode requires a positive '--arrival_rate'");
+    std::cout << "- Issuing " << arrival_rate << " queries per second" << std::endl;
+  } else if (arrival_rate != default_config.arrival_rate) {
+    PerformanceWarning("'--arrival_rate' specified but ignored, because '--mode' is not 'OpenLoop'")
+  }
+
   return BenchmarkConfig{
-      benchmark_mode, chunk_size,          *encoding_config, max_runs, timeout_duration, warmup_duration,
-      use_mvcc,       output_file_path,    enable_scheduler, cores,    clients,          enable_visualization,
-      verify,         cache_binary_tables, enable_jit};
+      benchmark_mode,    chunk_size,                    *encoding_config, max_runs,            timeout_duration,
+      warmup_duration,   use_mvcc,                      output_file_path, enable_scheduler,    cores,
+      clients,           enable_visualization,          verify,           cache_binary_tables, enable_jit,
+      enable_pipelining, scheduler_statistics_interval, arrival_rate};
 }
 
 BenchmarkConfig CLIConfigParser::parse_basic_cli_options(const cxxopts::ParseResult& parse_result) {
@@ -164,6 +195,9 @@ nlohmann::json CLIConfigParser::basic_cli_options_to_json(const cxxopts::ParseRe
   json_config.emplace("output", parse_result["output"].as<std::string>());
   json_config.emplace("verify", parse_result["verify"].as<bool>());
   json_config.emplace("cache_binary_tables", parse_result["cache_binary_tables"].as<bool>());
+  json_config.emplace("pipelining", parse_result["pipelining"].as<bool>());
+  json_config.emplace("scheduler_statistics", parse_result["scheduler_statistics"].as<size_t>());
+  json_config.emplace("arrival_rate", parse_result["arrival_rate"].as<double>());
   if constexpr (HYRISE_JIT_SUPPORT) {
     json_config.emplace("jit", parse_result["jit"].as<bool>());
   }
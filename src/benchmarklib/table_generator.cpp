@@ -185,6 +185,13 @@ std::shared_ptr<Table> TableGenerator::generate_table(
       // add full chunk to table
       if (column_index == num_columns - 1) {
         table->append_chunk(segments, nullptr, allocator_chunk);
+#if HYRISE_NUMA_SUPPORT
+        // Record the node so that NUMAPlacement keeps the chunk where it is
+        if (numa_distribute_chunks) {
+          const auto chunk_node_id = chunk_index % Topology::get().nodes().size();
+          table->get_chunk(chunk_index)->set_node_id(NodeID{static_cast<NodeID::base_type>(chunk_node_id)});
+        }
+#endif
       }
     }
   }
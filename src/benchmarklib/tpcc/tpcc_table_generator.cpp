@@ -65,6 +65,8 @@ std::shared_ptr<Table> TpccTableGenerator::generate_items_table() {
     table->append_chunk(segments, mvcc_data);
   }
 
+  table->add_unique_constraint({table->column_id_by_name("I_ID")}, IsPrimaryKey::Yes);
+
   _encode_table("ITEM", table);
   return table;
 }
@@ -105,6 +107,8 @@ std::shared_ptr<Table> TpccTableGenerator::generate_warehouse_table() {
     table->append_chunk(segments, mvcc_data);
   }
 
+  table->add_unique_constraint({table->column_id_by_name("W_ID")}, IsPrimaryKey::Yes);
+
   _encode_table("WAREHOUSE", table);
   return table;
 }
@@ -158,6 +162,9 @@ std::shared_ptr<Table> TpccTableGenerator::generate_stock_table() {
     table->append_chunk(segments, mvcc_data);
   }
 
+  table->add_unique_constraint({table->column_id_by_name("S_W_ID"), table->column_id_by_name("S_I_ID")},
+                               IsPrimaryKey::Yes);
+
   _encode_table("STOCK", table);
   return table;
 }
@@ -203,6 +210,9 @@ std::shared_ptr<Table> TpccTableGenerator::generate_district_table() {
     table->append_chunk(segments, mvcc_data);
   }
 
+  table->add_unique_constraint({table->column_id_by_name("D_W_ID"), table->column_id_by_name("D_ID")},
+                               IsPrimaryKey::Yes);
+
   _encode_table("DISTRICT", table);
   return table;
 }
@@ -273,6 +283,10 @@ std::shared_ptr<Table> TpccTableGenerator::generate_customer_table() {
     table->append_chunk(segments, mvcc_data);
   }
 
+  table->add_unique_constraint({table->column_id_by_name("C_W_ID"), table->column_id_by_name("C_D_ID"),
+                                table->column_id_by_name("C_ID")},
+                               IsPrimaryKey::Yes);
+
   _encode_table("CUSTOMER", table);
   return table;
 }
@@ -357,6 +371,10 @@ std::shared_ptr<Table> TpccTableGenerator::generate_order_table(
     table->append_chunk(segments, mvcc_data);
   }
 
+  table->add_unique_constraint({table->column_id_by_name("O_W_ID"), table->column_id_by_name("O_D_ID"),
+                                table->column_id_by_name("O_ID")},
+                               IsPrimaryKey::Yes);
+
   _encode_table("ORDER", table);
   return table;
 }
@@ -463,6 +481,10 @@ std::shared_ptr<Table> TpccTableGenerator::generate_order_line_table(
     table->append_chunk(segments, mvcc_data);
   }
 
+  table->add_unique_constraint({table->column_id_by_name("OL_W_ID"), table->column_id_by_name("OL_D_ID"),
+                                table->column_id_by_name("OL_O_ID"), table->column_id_by_name("OL_NUMBER")},
+                               IsPrimaryKey::Yes);
+
   _encode_table("ORDER_LINE", table);
   return table;
 }
@@ -492,6 +514,10 @@ std::shared_ptr<Table> TpccTableGenerator::generate_new_order_table() {
     table->append_chunk(segments, mvcc_data);
   }
 
+  table->add_unique_constraint({table->column_id_by_name("NO_W_ID"), table->column_id_by_name("NO_D_ID"),
+                                table->column_id_by_name("NO_O_ID")},
+                               IsPrimaryKey::Yes);
+
   _encode_table("NEW_ORDER", table);
   return table;
 }
@@ -6,7 +6,9 @@ extern "C" {
 #include <rnd.h>
 }
 
+#include <string>
 #include <utility>
+#include <vector>
 
 #include "boost/hana/for_each.hpp"
 #include "boost/hana/integral_constant.hpp"
@@ -356,6 +358,25 @@ std::unordered_map<std::string, BenchmarkTableInfo> TpchTableGenerator::generate
   table_info_by_name["nation"].table = nation_builder.finish_table();
   table_info_by_name["region"].table = region_builder.finish_table();
 
+  // Primary keys as defined by the TPC-H specification
+  const auto add_primary_key = [&](const std::string& table_name, const std::vector<std::string>& column_names) {
+    const auto& table = table_info_by_name[table_name].table;
+    auto column_ids = std::vector<ColumnID>{};
+    for (const auto& column_name : column_names) {
+      column_ids.emplace_back(table->column_id_by_name(column_name));
+    }
+    table->add_unique_constraint(column_ids, IsPrimaryKey::Yes);
+  };
+
+  add_primary_key("customer", {"c_custkey"});
+  add_primary_key("orders", {"o_orderkey"});
+  add_primary_key("lineitem", {"l_orderkey", "l_linenumber"});
+  add_primary_key("part", {"p_partkey"});
+  add_primary_key("partsupp", {"ps_partkey", "ps_suppkey"});
+  add_primary_key("supplier", {"s_suppkey"});
+  add_primary_key("nation", {"n_nationkey"});
+  add_primary_key("region", {"r_regionkey"});
+
   return table_info_by_name;
 }
 
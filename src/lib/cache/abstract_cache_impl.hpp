@@ -52,6 +52,10 @@ class AbstractCacheImpl {
   // Returns true if the cache holds an item at the given key.
   virtual bool has(const Key& key) const = 0;
 
+  // Returns how often the item at the given key was set or requested. Strategies that do not track this return 1.
+  // Causes undefined behavior if the item is not in the cache.
+  virtual size_t frequency(const Key& /*key*/) const { return 1; }
+
   // Returns the number of elements currently held in the cache.
   virtual size_t size() const = 0;
 
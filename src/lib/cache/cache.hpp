@@ -4,6 +4,7 @@
 #include <mutex>
 #include <optional>
 #include <string>
+#include <tuple>
 #include <utility>
 #include <vector>
 
@@ -56,10 +57,28 @@ class Cache : public Singleton<Cache<Value, Key>> {
     return _impl->get(query);
   }
 
+  // Returns a copy of all entries with their frequency (see AbstractCacheImpl::frequency). Unlike iterating over the
+  // cache, this can be used while other threads access the cache.
+  std::vector<std::tuple<Key, Value, size_t>> snapshot() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto entries = std::vector<std::tuple<Key, Value, size_t>>{};
+    entries.reserve(_impl->size());
+    for (auto entry_iter = _impl->begin(); entry_iter != _impl->end(); ++entry_iter) {
+      entries.emplace_back(entry_iter->first, entry_iter->second, _impl->frequency(entry_iter->first));
+    }
+    return entries;
+  }
+
   // Purges all entries from the cache.
-  void clear() { _impl->clear(); }
+  void clear() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _impl->clear();
+  }
 
-  void resize(size_t capacity) { _impl->resize(capacity); }
+  void resize(size_t capacity) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _impl->resize(capacity);
+  }
 
   size_t size() const { return _impl->size(); }
 
@@ -128,6 +128,11 @@ class GDFSCache : public AbstractCacheImpl<Key, Value> {
     return (*it->second).priority;
   }
 
+  size_t frequency(const Key& key) const final {
+    auto it = _map.find(key);
+    return (*it->second).frequency;
+  }
+
   ErasedIterator begin() { return ErasedIterator{std::make_unique<Iterator>(_map.begin())}; }
 
   ErasedIterator end() { return ErasedIterator{std::make_unique<Iterator>(_map.end())}; }
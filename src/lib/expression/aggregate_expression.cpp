@@ -82,6 +82,9 @@ DataType AggregateExpression::data_type() const {
       case AggregateFunction::Sum:
         aggregate_data_type = AggregateTraits<AggregateDataType, AggregateFunction::Sum>::AGGREGATE_DATA_TYPE;
         break;
+      case AggregateFunction::Any:
+        aggregate_data_type = AggregateTraits<AggregateDataType, AggregateFunction::Any>::AGGREGATE_DATA_TYPE;
+        break;
     }
   });
 
@@ -95,6 +98,9 @@ bool AggregateExpression::_shallow_equals(const AbstractExpression& expression)
 size_t AggregateExpression::_on_hash() const { return boost::hash_value(static_cast<size_t>(aggregate_function)); }
 
 bool AggregateExpression::_on_is_nullable_on_lqp(const AbstractLQPNode& lqp) const {
+  // ANY() is only NULL if its argument is - groups are never empty
+  if (aggregate_function == AggregateFunction::Any) return argument()->is_nullable_on_lqp(lqp);
+
   // Aggregates (except COUNT and COUNT DISTINCT) will return NULL when executed on an
   // empty group - thus they are always nullable
   return aggregate_function != AggregateFunction::Count && aggregate_function != AggregateFunction::CountDistinct;
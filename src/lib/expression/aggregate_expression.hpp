@@ -4,7 +4,12 @@
 
 namespace opossum {
 
-enum class AggregateFunction { Min, Max, Sum, Avg, Count, CountDistinct };
+/**
+ * Any is not available in SQL. It returns an arbitrary value of its argument for each group and is added by the
+ * DependentGroupByReductionRule for columns that are the same within each group. In the output of an AggregateNode,
+ * ANY(a) is represented by `a` itself, so that the nodes above do not notice the difference.
+ */
+enum class AggregateFunction { Min, Max, Sum, Avg, Count, CountDistinct, Any };
 
 class AggregateExpression : public AbstractExpression {
  public:
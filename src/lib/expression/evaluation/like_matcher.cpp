@@ -1,12 +1,55 @@
 #include "like_matcher.hpp"
 
+#include <array>
+#include <cstring>
+#include <optional>
+#include <utility>
+
 #include "boost/algorithm/string/replace.hpp"
 
 #include "utils/assert.hpp"
 
+namespace {
+
+// GCC/clang vector extension, which is compiled to SSE/AVX/NEON instructions where available
+using ByteVector = char __attribute__((vector_size(16)));
+constexpr auto BYTE_VECTOR_SIZE = sizeof(ByteVector);
+
+// Checks whether `block`, which may contain '_' wildcards, matches the characters starting at `data`
+bool block_matches_at(const char* data, const opossum::pmr_string& block) {
+  for (auto index = size_t{0}; index < block.size(); ++index) {
+    if (block[index] != '_' && block[index] != data[index]) return false;
+  }
+  return true;
+}
+
+// Returns the leftmost position in [begin, end] at which `block` matches, or pmr_string::npos
+size_t find_block(const std::string_view& string, const opossum::LikeMatcher::GeneralPattern::Block& block,
+                  const size_t begin, const size_t end) {
+  if (block.search_length == 0) {
+    // The block consists of '_' only, so it matches anywhere
+    return begin <= end ? begin : opossum::pmr_string::npos;
+  }
+
+  const auto search_string = std::string_view{block.string}.substr(block.search_offset, block.search_length);
+
+  for (auto position = begin; position <= end; ++position) {
+    const auto search_position =
+        opossum::LikeMatcher::find_substring(string, search_string, position + block.search_offset);
+    if (search_position == opossum::pmr_string::npos || search_position - block.search_offset > end) break;
+
+    position = search_position - block.search_offset;
+    if (block_matches_at(string.data() + position, block.string)) return position;
+  }
+
+  return opossum::pmr_string::npos;
+}
+
+}  // namespace
+
 namespace opossum {
 
-LikeMatcher::LikeMatcher(const pmr_string& pattern) { _pattern_variant = pattern_string_to_pattern_variant(pattern); }
+LikeMatcher::LikeMatcher(const pmr_string& pattern) : _pattern_variant(pattern_string_to_pattern_variant(pattern)) {}
 
 size_t LikeMatcher::get_index_of_next_wildcard(const pmr_string& pattern, const size_t offset) {
   return pattern.find_first_of("_%", offset);
@@ -88,14 +131,165 @@ LikeMatcher::AllPatternVariant LikeMatcher::pattern_string_to_pattern_variant(co
       expect_any_chars = !expect_any_chars;
     }
 
-    if (pattern_is_contains_multiple) {
+    // The pattern also has to end with '%' (and must not be empty), otherwise its end would not be checked
+    if (pattern_is_contains_multiple && !expect_any_chars) {
       return MultipleContainsPattern{strings};
-    } else {
-      return std::regex(sql_like_to_regex(pattern));
     }
+
+    auto general_pattern = GeneralPattern{};
+    general_pattern.leading_any_chars = !tokens.empty() && tokens.front() == PatternToken{Wildcard::AnyChars};
+    general_pattern.trailing_any_chars = !tokens.empty() && tokens.back() == PatternToken{Wildcard::AnyChars};
+
+    auto block_string = pmr_string{};
+    const auto finish_block = [&]() {
+      if (block_string.empty()) return;
+
+      auto block = GeneralPattern::Block{block_string};
+      auto run_begin = size_t{0};
+      for (auto index = size_t{0}; index <= block_string.size(); ++index) {
+        if (index < block_string.size() && block_string[index] != '_') continue;
+        if (index - run_begin > block.search_length) {
+          block.search_offset = run_begin;
+          block.search_length = index - run_begin;
+        }
+        run_begin = index + 1;
+      }
+
+      general_pattern.blocks.emplace_back(std::move(block));
+      block_string.clear();
+    };
+
+    for (const auto& token : tokens) {
+      if (token == PatternToken{Wildcard::AnyChars}) {
+        finish_block();
+      } else if (token == PatternToken{Wildcard::SingleChar}) {
+        block_string += '_';
+      } else {
+        block_string += std::get<pmr_string>(token);
+      }
+    }
+    finish_block();
+
+    return general_pattern;
   }
 }
 
+std::optional<std::pair<pmr_string, std::optional<pmr_string>>> LikeMatcher::prefix_bounds(const pmr_string& pattern) {
+  const auto pattern_variant = pattern_string_to_pattern_variant(pattern);
+  if (!std::holds_alternative<StartsWithPattern>(pattern_variant)) return std::nullopt;
+
+  const auto& prefix = std::get<StartsWithPattern>(pattern_variant).string;
+  if (prefix.empty()) return std::nullopt;
+
+  // The smallest string greater than all strings starting with the prefix: increment the last character that can be
+  // incremented and drop all following ones, e.g., "ab\xff" becomes "ac"
+  auto upper_bound = prefix;
+  while (!upper_bound.empty() && static_cast<unsigned char>(upper_bound.back()) == 0xFF) {
+    upper_bound.pop_back();
+  }
+  if (upper_bound.empty()) return std::make_pair(prefix, std::nullopt);
+
+  upper_bound.back() = static_cast<char>(static_cast<unsigned char>(upper_bound.back()) + 1);
+  return std::make_pair(prefix, std::optional<pmr_string>{upper_bound});
+}
+
+bool LikeMatcher::matches_general_pattern(const GeneralPattern& pattern, const std::string_view& string) {
+  const auto& blocks = pattern.blocks;
+
+  auto first_unmatched_block = size_t{0};
+  auto end_block = blocks.size();
+
+  // Position in `string` up to which characters were consumed by blocks
+  auto begin = size_t{0};
+  // Position in `string` up to which the remaining blocks may match
+  auto end = string.size();
+
+  if (!pattern.leading_any_chars) {
+    if (blocks.empty()) return string.empty();
+
+    const auto& first_block = blocks.front().string;
+    if (string.size() < first_block.size() || !block_matches_at(string.data(), first_block)) return false;
+
+    begin = first_block.size();
+    ++first_unmatched_block;
+  }
+
+  if (!pattern.trailing_any_chars) {
+    if (first_unmatched_block == end_block) return begin == string.size();
+
+    const auto& last_block = blocks.back().string;
+    if (string.size() - begin < last_block.size() ||
+        !block_matches_at(string.data() + string.size() - last_block.size(), last_block)) {
+      return false;
+    }
+
+    end = string.size() - last_block.size();
+    --end_block;
+  }
+
+  for (auto block_index = first_unmatched_block; block_index < end_block; ++block_index) {
+    const auto& block = blocks[block_index];
+    if (end - begin < block.string.size()) return false;
+
+    const auto position = find_block(string, block, begin, end - block.string.size());
+    if (position == pmr_string::npos) return false;
+
+    begin = position + block.string.size();
+  }
+
+  return true;
+}
+
+size_t LikeMatcher::find_substring(const std::string_view& haystack, const std::string_view& needle,
+                                   const size_t offset) {
+  const auto needle_size = needle.size();
+  if (offset > haystack.size() || haystack.size() - offset < needle_size) return pmr_string::npos;
+  if (needle_size < 2) return haystack.find(needle, offset);
+
+  const auto* const data = haystack.data();
+  const auto last_position = haystack.size() - needle_size;
+
+  ByteVector first_chars;
+  ByteVector last_chars;
+  for (auto index = size_t{0}; index < BYTE_VECTOR_SIZE; ++index) {
+    first_chars[index] = needle.front();
+    last_chars[index] = needle.back();
+  }
+
+  auto position = offset;
+
+  // Each iteration checks BYTE_VECTOR_SIZE candidate positions. The reads of the last characters end at
+  // position + needle_size - 1 + BYTE_VECTOR_SIZE - 1, which is within the bounds of haystack.
+  for (; position <= last_position && last_position - position + 1 >= BYTE_VECTOR_SIZE; position += BYTE_VECTOR_SIZE) {
+    ByteVector block_first_chars;
+    ByteVector block_last_chars;
+    std::memcpy(&block_first_chars, data + position, BYTE_VECTOR_SIZE);
+    std::memcpy(&block_last_chars, data + position + needle_size - 1, BYTE_VECTOR_SIZE);
+
+    const auto candidates = (block_first_chars == first_chars) & (block_last_chars == last_chars);
+
+    auto candidate_words = std::array<uint64_t, 2>{};
+    std::memcpy(candidate_words.data(), &candidates, BYTE_VECTOR_SIZE);
+    if ((candidate_words[0] | candidate_words[1]) == 0) continue;
+
+    for (auto index = size_t{0}; index < BYTE_VECTOR_SIZE; ++index) {
+      if (candidates[index] &&
+          std::memcmp(data + position + index + 1, needle.data() + 1, needle_size - 2) == 0) {
+        return position + index;
+      }
+    }
+  }
+
+  // Check the remaining positions one by one
+  for (; position <= last_position; ++position) {
+    if (data[position] == needle.front() && std::memcmp(data + position + 1, needle.data() + 1, needle_size - 1) == 0) {
+      return position;
+    }
+  }
+
+  return pmr_string::npos;
+}
+
 std::string LikeMatcher::sql_like_to_regex(pmr_string sql_like) {
   // Do substitution of <backslash> with <backslash><backslash> FIRST, because otherwise it will also replace
   // backslashes introduced by the other substitutions
@@ -1,7 +1,9 @@
 #pragma once
 
-#include <regex>
+#include <optional>
 #include <string>
+#include <string_view>
+#include <utility>
 #include <variant>
 #include <vector>
 
@@ -14,7 +16,8 @@ namespace opossum {
  * Wraps an SQL LIKE pattern (e.g. "Hello%Wo_ld") which strings can be tested against.
  *
  * Performance optimizations exist for several simple patterns, such as "Hello%" - which is really just a starts_with()
- * check.
+ * check. All other patterns are matched by GeneralPattern, which does not need to backtrack (and thus avoids the
+ * costs of std::regex).
  */
 class LikeMatcher {
  public:
@@ -23,6 +26,14 @@ class LikeMatcher {
    */
   static std::string sql_like_to_regex(pmr_string sql_like);
 
+  /**
+   * Returns the position of the first occurrence of `needle` in `haystack` at or after `offset`, or pmr_string::npos.
+   * Candidates are identified by comparing the first and the last character of `needle` to 16 positions of `haystack`
+   * at once, only those candidates are compared in full.
+   */
+  static size_t find_substring(const std::string_view& haystack, const std::string_view& needle,
+                               const size_t offset = 0);
+
   static size_t get_index_of_next_wildcard(const pmr_string& pattern, const size_t offset = 0);
   static bool contains_wildcard(const pmr_string& pattern);
 
@@ -40,7 +51,7 @@ class LikeMatcher {
 
   /**
    * To speed up LIKE there are special implementations available for simple, common patterns.
-   * Any other pattern will fall back to regex.
+   * Any other pattern is handled by the GeneralPattern.
    */
   // 'hello%'
   struct StartsWithPattern final {
@@ -58,16 +69,40 @@ class LikeMatcher {
   struct MultipleContainsPattern final {
     std::vector<pmr_string> strings;
   };
+  // Everything else, e.g., 'H_llo%W%d'. The pattern is split at the '%' wildcards into blocks of characters and '_'
+  // wildcards. The first block (unless the pattern starts with '%') has to match at the beginning of the string, the
+  // last block (unless the pattern ends with '%') at the end. All other blocks are matched at their leftmost
+  // occurrence after the previous block. As '%' can consume any number of characters, this never needs to backtrack.
+  struct GeneralPattern final {
+    struct Block final {
+      pmr_string string;
+      // Position and length of the longest run of characters without '_' in `string`. Used to find candidates.
+      size_t search_offset{0};
+      size_t search_length{0};
+    };
+
+    std::vector<Block> blocks;
+    bool leading_any_chars{false};
+    bool trailing_any_chars{false};
+  };
 
   /**
-   * Contains one of the specialised patterns from above (StartsWithPattern, ...) or falls back to std::regex for a
-   * general pattern.
+   * Contains one of the specialised patterns from above (StartsWithPattern, ...) or the GeneralPattern.
    */
   using AllPatternVariant =
-      std::variant<std::regex, StartsWithPattern, EndsWithPattern, ContainsPattern, MultipleContainsPattern>;
+      std::variant<GeneralPattern, StartsWithPattern, EndsWithPattern, ContainsPattern, MultipleContainsPattern>;
 
   static AllPatternVariant pattern_string_to_pattern_variant(const pmr_string& pattern);
 
+  /**
+   * For patterns of the form 'hello%', returns the bounds [lower, upper) of the strings that match, i.e.,
+   * ["hello", "hellp"). upper is std::nullopt if all strings greater than lower match (e.g., for '\xff%'). For all
+   * other patterns, as well as for '%', std::nullopt is returned.
+   */
+  static std::optional<std::pair<pmr_string, std::optional<pmr_string>>> prefix_bounds(const pmr_string& pattern);
+
+  static bool matches_general_pattern(const GeneralPattern& pattern, const std::string_view& string);
+
   /**
    * The functor will be called with a concrete matcher.
    * Usage example:
@@ -94,7 +129,7 @@ class LikeMatcher {
     } else if (std::holds_alternative<ContainsPattern>(_pattern_variant)) {
       const auto& contains_str = std::get<ContainsPattern>(_pattern_variant).string;
       functor([&](const pmr_string& string) -> bool {
-        return (string.find(contains_str) != pmr_string::npos) ^ invert_results;
+        return (find_substring(string, contains_str) != pmr_string::npos) ^ invert_results;
       });
 
     } else if (std::holds_alternative<MultipleContainsPattern>(_pattern_variant)) {
@@ -103,17 +138,19 @@ class LikeMatcher {
       functor([&](const pmr_string& string) -> bool {
         auto current_position = size_t{0};
         for (const auto& contains_str : contains_strs) {
-          current_position = string.find(contains_str, current_position);
+          current_position = find_substring(string, contains_str, current_position);
           if (current_position == pmr_string::npos) return invert_results;
           current_position += contains_str.size();
         }
         return !invert_results;
       });
 
-    } else if (std::holds_alternative<std::regex>(_pattern_variant)) {
-      const auto& regex = std::get<std::regex>(_pattern_variant);
+    } else if (std::holds_alternative<GeneralPattern>(_pattern_variant)) {
+      const auto& general_pattern = std::get<GeneralPattern>(_pattern_variant);
 
-      functor([&](const pmr_string& string) -> bool { return std::regex_match(string, regex) ^ invert_results; });
+      functor([&](const pmr_string& string) -> bool {
+        return matches_general_pattern(general_pattern, string) ^ invert_results;
+      });
 
     } else {
       Fail("Pattern not implemented. Probably a bug.");
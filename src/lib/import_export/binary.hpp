@@ -4,6 +4,18 @@ namespace opossum {
 
 enum class BinarySegmentType : uint8_t { value_segment = 0, dictionary_segment = 1 };
 
+// How the index of a chunk is stored: not at all (the chunk has no index), rebuilt on import (only the IndexInfo is
+// stored), with its structures (GroupKeyIndex, BTreeIndex, AdaptiveRadixTreeIndex), or as a delta index of a mutable
+// chunk (also rebuilt on import).
+enum class BinaryIndexType : uint8_t {
+  none = 0,
+  rebuilt = 1,
+  group_key = 2,
+  delta = 3,
+  b_tree = 4,
+  adaptive_radix_tree = 5
+};
+
 using BoolAsByteType = uint8_t;
 
 }  // namespace opossum
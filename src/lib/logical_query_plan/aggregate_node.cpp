@@ -7,6 +7,7 @@
 #include <string>
 #include <vector>
 
+#include "expression/aggregate_expression.hpp"
 #include "expression/expression_utils.hpp"
 #include "expression/lqp_column_expression.hpp"
 #include "resolve_type.hpp"
@@ -67,7 +68,8 @@ std::shared_ptr<TableStatistics> AggregateNode::derive_statistics_from(
   std::vector<std::shared_ptr<const BaseColumnStatistics>> column_statistics;
   column_statistics.reserve(node_expressions.size());
 
-  for (const auto& expression : node_expressions) {
+  // ANY(a) has the statistics of a
+  for (const auto& expression : column_expressions()) {
     const auto column_id = left_input->find_column_id(*expression);
     if (column_id) {
       column_statistics.emplace_back(input_statistics->column_statistics()[*column_id]);
@@ -85,7 +87,17 @@ std::shared_ptr<TableStatistics> AggregateNode::derive_statistics_from(
 }
 
 const std::vector<std::shared_ptr<AbstractExpression>>& AggregateNode::column_expressions() const {
-  return node_expressions;
+  _column_expressions = node_expressions;
+
+  for (auto expression_idx = aggregate_expressions_begin_idx; expression_idx < _column_expressions.size();
+       ++expression_idx) {
+    const auto& aggregate_expression = static_cast<const AggregateExpression&>(*node_expressions[expression_idx]);
+    if (aggregate_expression.aggregate_function == AggregateFunction::Any) {
+      _column_expressions[expression_idx] = aggregate_expression.argument();
+    }
+  }
+
+  return _column_expressions;
 }
 
 bool AggregateNode::is_column_nullable(const ColumnID column_id) const {
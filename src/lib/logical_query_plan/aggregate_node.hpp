@@ -16,7 +16,8 @@ namespace opossum {
  *  - one or more aggregate functions in their SELECT list
  *  - a GROUP BY clause
  *
- *  The order of the output columns is groupby columns followed by aggregate columns
+ *  The order of the output columns is groupby columns followed by aggregate columns. ANY(a) aggregates are output as
+ *  `a` (see AggregateFunction::Any).
  */
 class AggregateNode : public EnableMakeForLQPNode<AggregateNode>, public AbstractLQPNode {
  public:
@@ -37,6 +38,9 @@ class AggregateNode : public EnableMakeForLQPNode<AggregateNode>, public Abstrac
  protected:
   std::shared_ptr<AbstractLQPNode> _on_shallow_copy(LQPNodeMapping& node_mapping) const override;
   bool _on_shallow_equals(const AbstractLQPNode& rhs, const LQPNodeMapping& node_mapping) const override;
+
+  // Rebuilt on every call to column_expressions(), as rules might have changed the node_expressions in the meantime
+  mutable std::vector<std::shared_ptr<AbstractExpression>> _column_expressions;
 };
 
 }  // namespace opossum
@@ -439,8 +439,9 @@ bool JitAwareLQPTranslator::_expression_is_jittable(const std::shared_ptr<Abstra
     }
     case ExpressionType::Aggregate: {
       const auto aggregate_expression = std::dynamic_pointer_cast<AggregateExpression>(expression);
-      // We do not support the count distinct function yet.
-      return aggregate_expression->aggregate_function != AggregateFunction::CountDistinct;
+      // We do not support the count distinct and any functions yet.
+      return aggregate_expression->aggregate_function != AggregateFunction::CountDistinct &&
+             aggregate_expression->aggregate_function != AggregateFunction::Any;
     }
     case ExpressionType::Arithmetic:
     case ExpressionType::Logical:
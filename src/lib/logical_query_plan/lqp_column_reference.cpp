@@ -4,7 +4,6 @@
 
 #include "abstract_lqp_node.hpp"
 #include "logical_query_plan/stored_table_node.hpp"
-#include "storage/storage_manager.hpp"
 #include "storage/table.hpp"
 #include "utils/assert.hpp"
 
@@ -27,7 +26,7 @@ std::ostream& operator<<(std::ostream& os, const LQPColumnReference& column_refe
   Assert(original_node, "OriginalNode has expired");
 
   const auto stored_table_node = std::static_pointer_cast<const StoredTableNode>(column_reference.original_node());
-  const auto table = StorageManager::get().get_table(stored_table_node->table_name);
+  const auto table = stored_table_node->table();
   os << table->column_name(column_reference.original_column_id());
 
   return os;
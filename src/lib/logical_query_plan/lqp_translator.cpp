@@ -19,17 +19,22 @@
 #include "expression/abstract_predicate_expression.hpp"
 #include "expression/between_expression.hpp"
 #include "expression/binary_predicate_expression.hpp"
+#include "expression/correlated_parameter_expression.hpp"
+#include "expression/evaluation/like_matcher.hpp"
 #include "expression/expression_utils.hpp"
 #include "expression/is_null_expression.hpp"
 #include "expression/list_expression.hpp"
+#include "expression/logical_expression.hpp"
 #include "expression/lqp_column_expression.hpp"
 #include "expression/lqp_subquery_expression.hpp"
+#include "expression/placeholder_expression.hpp"
 #include "expression/pqp_column_expression.hpp"
 #include "expression/pqp_subquery_expression.hpp"
 #include "expression/value_expression.hpp"
 #include "insert_node.hpp"
 #include "join_node.hpp"
 #include "limit_node.hpp"
+#include "lossless_cast.hpp"
 #include "operators/aggregate_hash.hpp"
 #include "operators/alias_operator.hpp"
 #include "operators/delete.hpp"
@@ -60,7 +65,7 @@
 #include "projection_node.hpp"
 #include "show_columns_node.hpp"
 #include "sort_node.hpp"
-#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
 #include "stored_table_node.hpp"
 #include "union_node.hpp"
 #include "update_node.hpp"
@@ -160,55 +165,117 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_predicate_node_to_in
     const std::shared_ptr<PredicateNode>& node, const std::shared_ptr<AbstractOperator>& input_operator) const {
   /**
    * Not using OperatorScanPredicate, since it splits up BETWEEN into two scans for some cases that TableScan cannot handle
+   *
+   * Conjunctions of Equals predicates (as merged by the IndexScanRule) are searched on a CompositeGroupKeyIndex.
+   * The TableScan for chunks without an index keeps the original predicate, which matters for LIKE.
    */
 
-  auto column_id = ColumnID{0};
-  auto value_variant = AllTypeVariant{NullValue{}};
-  auto value2_variant = std::optional<AllTypeVariant>{};
-
-  // Currently, we will only use IndexScans if the predicate node directly follows a StoredTableNode.
-  // Our IndexScan implementation does not work on reference segments yet.
-  Assert(node->left_input()->type == LQPNodeType::StoredTable, "IndexScan must follow a StoredTableNode.");
+  // Values are either literals or parameters that are set before the IndexScan is executed
+  const auto to_parameter_variant = [](const AbstractExpression& expression) {
+    auto value = AllParameterVariant{};
+    if (const auto value_expression = dynamic_cast<const ValueExpression*>(&expression)) {
+      value = value_expression->value;
+    } else if (const auto placeholder_expression = dynamic_cast<const PlaceholderExpression*>(&expression)) {
+      value = placeholder_expression->parameter_id;
+    } else if (const auto parameter_expression = dynamic_cast<const CorrelatedParameterExpression*>(&expression)) {
+      value = parameter_expression->parameter_id;
+    } else {
+      Fail("Expected value, placeholder, or correlated parameter as value for IndexScan");
+    }
+    return value;
+  };
+
+  auto column_ids = std::vector<ColumnID>{};
+  auto predicate_condition = PredicateCondition::Equals;
+  auto right_values = std::vector<AllParameterVariant>{};
+  auto right_values2 = std::vector<AllParameterVariant>{};
+
+  const auto predicates = flatten_logical_expressions(node->predicate(), LogicalOperator::And);
+  for (const auto& expression : predicates) {
+    const auto predicate = std::dynamic_pointer_cast<AbstractPredicateExpression>(expression);
+    Assert(predicate, "Expected predicate");
+    Assert(predicate->arguments.size() > 1, "Expected column and value as arguments");
+
+    auto column_argument = predicate->arguments[0];
+    auto value_argument = predicate->arguments[1];
+    predicate_condition = predicate->predicate_condition;
+
+    // `5 > a` is searched as `a < 5`
+    if (predicate->arguments.size() == 2 && !node->left_input()->find_column_id(*column_argument)) {
+      std::swap(column_argument, value_argument);
+      predicate_condition = flip_predicate_condition(predicate_condition);
+    }
 
-  const auto predicate = std::dynamic_pointer_cast<AbstractPredicateExpression>(node->predicate());
-  Assert(predicate, "Expected predicate");
-  Assert(!predicate->arguments.empty(), "Expected arguments");
+    column_ids.emplace_back(node->left_input()->get_column_id(*column_argument));
+    right_values.emplace_back(to_parameter_variant(*value_argument));
+    if (predicate->arguments.size() > 2) {
+      right_values2.emplace_back(to_parameter_variant(*predicate->arguments[2]));
+    }
 
-  column_id = node->left_input()->get_column_id(*predicate->arguments[0]);
-  if (predicate->arguments.size() > 1) {
-    const auto value_expression = std::dynamic_pointer_cast<ValueExpression>(predicate->arguments[1]);
-    // This is necessary because we currently support single column indexes only
-    Assert(value_expression, "Expected value as second argument for IndexScan");
-    value_variant = value_expression->value;
+    // The IndexScan casts the values to the column type. Literals for which this is not possible without loss (e.g.,
+    // 3.5 for an int column) are left to the TableScan, which evaluates the predicate as an expression instead.
+    // Parameters are only known at execution time, the IndexScan then evaluates the predicate without the indexes.
+    const auto is_castable = [&](const AllParameterVariant& value) {
+      if (!is_variant(value)) return true;
+      const auto& variant = boost::get<AllTypeVariant>(value);
+      return variant_is_null(variant) || lossless_variant_cast(variant, column_argument->data_type()).has_value();
+    };
+    if (!is_castable(right_values.back()) || (!right_values2.empty() && !is_castable(right_values2.back()))) {
+      return _translate_predicate_node_to_table_scan(node, input_operator);
+    }
   }
-  if (predicate->arguments.size() > 2) {
-    const auto value_expression = std::dynamic_pointer_cast<ValueExpression>(predicate->arguments[2]);
-    // This is necessary because we currently support single column indexes only
-    Assert(value_expression, "Expected value as third argument for IndexScan");
-    value2_variant = value_expression->value;
+
+  Assert(column_ids.size() == 1 || predicate_condition == PredicateCondition::Equals,
+         "Multi-column IndexScans are only supported for Equals predicates");
+
+  auto index_type = column_ids.size() == 1 ? SegmentIndexType::GroupKey : SegmentIndexType::CompositeGroupKey;
+
+  // `a LIKE 'abc%'` is searched as the range ["abc", "abd") on a StringAdaptiveRadixTreeIndex (see IndexScanRule)
+  if (predicate_condition == PredicateCondition::Like) {
+    const auto& pattern = boost::get<pmr_string>(boost::get<AllTypeVariant>(right_values[0]));
+    const auto bounds = LikeMatcher::prefix_bounds(pattern);
+    Assert(bounds, "Expected LIKE pattern with a constant prefix for IndexScan");
+
+    index_type = SegmentIndexType::StringAdaptiveRadixTree;
+    right_values = {AllTypeVariant{bounds->first}};
+    if (bounds->second) {
+      predicate_condition = PredicateCondition::BetweenUpperExclusive;
+      right_values2 = {AllTypeVariant{*bounds->second}};
+    } else {
+      predicate_condition = PredicateCondition::GreaterThanEquals;
+    }
   }
 
-  const std::vector<ColumnID> column_ids = {column_id};
-  const std::vector<AllTypeVariant> right_values = {value_variant};
-  std::vector<AllTypeVariant> right_values2 = {};
-  if (value2_variant) right_values2.emplace_back(*value2_variant);
+  // Further up in the plan (e.g., after a join), the IndexScan gets a reference table as input. It then searches the
+  // indexes of the referenced chunks and scans chunks without an index itself.
+  if (node->left_input()->type != LQPNodeType::StoredTable) {
+    return std::make_shared<IndexScan>(input_operator, index_type, column_ids, predicate_condition, right_values,
+                                       right_values2);
+  }
 
   auto stored_table_node = std::dynamic_pointer_cast<StoredTableNode>(node->left_input());
-  const auto table_name = stored_table_node->table_name;
-  const auto table = StorageManager::get().get_table(table_name);
+  const auto table = stored_table_node->table();
+
+  // A table-wide hash index covers all chunks, including the mutable one, so no TableScan is needed for point lookups
+  if (column_ids.size() == 1 && predicate_condition == PredicateCondition::Equals &&
+      table->get_table_hash_index(column_ids[0])) {
+    return std::make_shared<IndexScan>(input_operator, SegmentIndexType::TableHash, column_ids, predicate_condition,
+                                       right_values, right_values2);
+  }
+
   std::vector<ChunkID> indexed_chunks;
 
   for (ChunkID chunk_id{0u}; chunk_id < table->chunk_count(); ++chunk_id) {
     const auto chunk = table->get_chunk(chunk_id);
-    if (chunk->get_index(SegmentIndexType::GroupKey, column_ids)) {
+    if (chunk->get_index(index_type, column_ids) || (column_ids.size() == 1 && chunk->get_delta_index(column_ids[0]))) {
       indexed_chunks.emplace_back(chunk_id);
     }
   }
 
   // All chunks that have an index on column_ids are handled by an IndexScan. All other chunks are handled by
   // TableScan(s).
-  auto index_scan = std::make_shared<IndexScan>(input_operator, SegmentIndexType::GroupKey, column_ids,
-                                                predicate->predicate_condition, right_values, right_values2);
+  auto index_scan = std::make_shared<IndexScan>(input_operator, index_type, column_ids, predicate_condition,
+                                                right_values, right_values2);
 
   const auto table_scan = _translate_predicate_node_to_table_scan(node, input_operator);
 
@@ -60,6 +60,7 @@ class LQPTranslator {
   std::shared_ptr<AbstractOperator> _translate_create_prepared_plan_node(
       const std::shared_ptr<AbstractLQPNode>& node) const;
 
+ protected:
   // Translate LQP- to PQPExpressions
   std::shared_ptr<AbstractExpression> _translate_expression(const std::shared_ptr<AbstractExpression>& lqp_expression,
                                                             const std::shared_ptr<AbstractLQPNode>& node) const;
@@ -67,6 +68,7 @@ class LQPTranslator {
       const std::vector<std::shared_ptr<AbstractExpression>>& lqp_expressions,
       const std::shared_ptr<AbstractLQPNode>& node) const;
 
+ private:
   // Cache operator subtrees by LQP node to avoid executing operators below a diamond shape multiple times
   mutable std::unordered_map<std::shared_ptr<const AbstractLQPNode>, std::shared_ptr<AbstractOperator>>
       _operator_by_lqp_node;
@@ -1,9 +1,12 @@
 #include "lqp_utils.hpp"
 
+#include <algorithm>
 #include <set>
 
+#include "expression/binary_predicate_expression.hpp"
 #include "expression/expression_functional.hpp"
 #include "expression/expression_utils.hpp"
+#include "expression/lqp_column_expression.hpp"
 #include "logical_query_plan/abstract_lqp_node.hpp"
 #include "logical_query_plan/delete_node.hpp"
 #include "logical_query_plan/insert_node.hpp"
@@ -12,6 +15,7 @@
 #include "logical_query_plan/stored_table_node.hpp"
 #include "logical_query_plan/union_node.hpp"
 #include "logical_query_plan/update_node.hpp"
+#include "storage/table.hpp"
 #include "utils/assert.hpp"
 
 using namespace opossum::expression_functional;  // NOLINT
@@ -137,6 +141,24 @@ void lqp_replace_node(const std::shared_ptr<AbstractLQPNode>& original_node,
   original_node->set_right_input(nullptr);
 }
 
+void lqp_replace_node_preserving_columns(const std::shared_ptr<AbstractLQPNode>& original_node,
+                                         const std::shared_ptr<AbstractLQPNode>& replacement_node) {
+  const auto original_column_expressions = original_node->column_expressions();
+
+  lqp_replace_node(original_node, replacement_node);
+
+  if (expressions_equal(original_column_expressions, replacement_node->column_expressions())) return;
+
+  const auto projection_node = ProjectionNode::make(original_column_expressions);
+
+  const auto outputs = replacement_node->outputs();
+  const auto input_sides = replacement_node->get_input_sides();
+  for (auto output_idx = size_t{0}; output_idx < outputs.size(); ++output_idx) {
+    outputs[output_idx]->set_input(input_sides[output_idx], projection_node);
+  }
+  projection_node->set_left_input(replacement_node);
+}
+
 void lqp_remove_node(const std::shared_ptr<AbstractLQPNode>& node) {
   Assert(!node->right_input(), "Can only remove nodes that only have a left input or no inputs");
 
@@ -280,6 +302,52 @@ std::shared_ptr<AbstractExpression> lqp_subplan_to_boolean_expression_impl(
       return nullptr;
   }
 }
+
+bool lqp_is_unique_on_impl(const std::shared_ptr<AbstractLQPNode>& lqp, const ExpressionUnorderedSet& expressions,
+                           const bool validated) {
+  switch (lqp->type) {
+    case LQPNodeType::StoredTable: {
+      const auto stored_table_node = std::static_pointer_cast<StoredTableNode>(lqp);
+      const auto table = stored_table_node->table();
+
+      // Deleted rows and rows of uncommitted transactions might share their values with visible rows
+      if (!validated && table->has_mvcc() == UseMvcc::Yes) return false;
+
+      return lqp_find_unique_constraint(stored_table_node, expressions).has_value();
+    }
+
+    case LQPNodeType::Aggregate: {
+      const auto& aggregate_node = static_cast<const AggregateNode&>(*lqp);
+      return std::all_of(aggregate_node.node_expressions.cbegin(),
+                         aggregate_node.node_expressions.cbegin() + aggregate_node.aggregate_expressions_begin_idx,
+                         [&](const auto& group_by_expression) { return expressions.count(group_by_expression) > 0; });
+    }
+
+    case LQPNodeType::Validate:
+      return lqp_is_unique_on_impl(lqp->left_input(), expressions, true);
+
+    case LQPNodeType::Predicate:
+    case LQPNodeType::Projection:
+    case LQPNodeType::Alias:
+    case LQPNodeType::Sort:
+    case LQPNodeType::Limit:
+      return lqp_is_unique_on_impl(lqp->left_input(), expressions, validated);
+
+    case LQPNodeType::Join: {
+      // Semi and Anti Joins only filter their left input
+      const auto join_mode = static_cast<const JoinNode&>(*lqp).join_mode;
+      if (join_mode != JoinMode::Semi && join_mode != JoinMode::AntiNullAsTrue &&
+          join_mode != JoinMode::AntiNullAsFalse) {
+        return false;
+      }
+      return lqp_is_unique_on_impl(lqp->left_input(), expressions, validated);
+    }
+
+    default:
+      return false;
+  }
+}
+
 }  // namespace
 
 // Function wraps the call to the lqp_subplan_to_boolean_expression_impl() function to hide its third parameter,
@@ -296,4 +364,54 @@ std::vector<std::shared_ptr<AbstractLQPNode>> lqp_find_subplan_roots(const std::
   return root_nodes;
 }
 
+std::optional<TableConstraintDefinition> lqp_find_unique_constraint(
+    const std::shared_ptr<const StoredTableNode>& stored_table_node, const ExpressionUnorderedSet& expressions) {
+  const auto table = stored_table_node->table();
+
+  auto smallest_constraint = std::optional<TableConstraintDefinition>{};
+  for (const auto& constraint : table->get_unique_constraints()) {
+    if (smallest_constraint && smallest_constraint->column_ids.size() <= constraint.column_ids.size()) continue;
+
+    // Unique constraints allow for multiple NULLs
+    const auto& column_ids = constraint.column_ids;
+    const auto covered = std::all_of(column_ids.cbegin(), column_ids.cend(), [&](const auto column_id) {
+      if (table->column_is_nullable(column_id)) return false;
+      const auto column_expression =
+          std::make_shared<LQPColumnExpression>(LQPColumnReference{stored_table_node, column_id});
+      return expressions.count(column_expression) > 0;
+    });
+    if (covered) smallest_constraint = constraint;
+  }
+
+  return smallest_constraint;
+}
+
+bool lqp_is_unique_on(const std::shared_ptr<AbstractLQPNode>& lqp, const ExpressionUnorderedSet& expressions) {
+  return lqp_is_unique_on_impl(lqp, expressions, false);
+}
+
+bool lqp_join_matches_at_most_one_right_row(const std::shared_ptr<JoinNode>& join_node) {
+  const auto& left_input = join_node->left_input();
+  const auto& right_input = join_node->right_input();
+
+  auto right_operands = ExpressionUnorderedSet{};
+  for (const auto& join_predicate : join_node->join_predicates()) {
+    const auto binary_predicate = std::dynamic_pointer_cast<BinaryPredicateExpression>(join_predicate);
+    if (!binary_predicate || binary_predicate->predicate_condition != PredicateCondition::Equals) continue;
+
+    const auto& left_operand = binary_predicate->left_operand();
+    const auto& right_operand = binary_predicate->right_operand();
+    if (left_input->find_column_id(*left_operand) && right_input->find_column_id(*right_operand)) {
+      right_operands.emplace(right_operand);
+    } else if (left_input->find_column_id(*right_operand) && right_input->find_column_id(*left_operand)) {
+      right_operands.emplace(left_operand);
+    }
+  }
+
+  // Also covers Cross Joins
+  if (right_operands.empty()) return false;
+
+  return lqp_is_unique_on(right_input, right_operands);
+}
+
 }  // namespace opossum
@@ -15,10 +15,12 @@
 #include "logical_query_plan/projection_node.hpp"
 #include "logical_query_plan/sort_node.hpp"
 #include "logical_query_plan/update_node.hpp"
+#include "storage/table_constraint_definition.hpp"
 
 namespace opossum {
 
 class AbstractExpression;
+class StoredTableNode;
 enum class LQPInputSide;
 
 using LQPMismatch = std::pair<std::shared_ptr<const AbstractLQPNode>, std::shared_ptr<const AbstractLQPNode>>;
@@ -40,6 +42,14 @@ std::optional<LQPMismatch> lqp_find_subplan_mismatch(const std::shared_ptr<const
 void lqp_replace_node(const std::shared_ptr<AbstractLQPNode>& original_node,
                       const std::shared_ptr<AbstractLQPNode>& replacement_node);
 
+/**
+ * Like lqp_replace_node(), but if @param replacement_node outputs other columns or the columns in a different order,
+ * a ProjectionNode is placed on top of it that restores the columns of @param original_node. The replacement has to
+ * output all of them.
+ */
+void lqp_replace_node_preserving_columns(const std::shared_ptr<AbstractLQPNode>& original_node,
+                                         const std::shared_ptr<AbstractLQPNode>& replacement_node);
+
 void lqp_remove_node(const std::shared_ptr<AbstractLQPNode>& node);
 
 void lqp_insert_node(const std::shared_ptr<AbstractLQPNode>& parent_node, const LQPInputSide input_side,
@@ -50,6 +60,29 @@ void lqp_insert_node(const std::shared_ptr<AbstractLQPNode>& parent_node, const
  */
 bool lqp_is_validated(const std::shared_ptr<AbstractLQPNode>& lqp);
 
+/**
+ * @return the unique constraint (see Table::add_unique_constraint) with the fewest columns that only has non-nullable
+ *         columns and whose columns of @param stored_table_node are all contained in @param expressions. std::nullopt
+ *         if there is none. Note that only the visible rows of a table are unique - the caller has to make sure that
+ *         the StoredTableNode is validated if the table uses MVCC.
+ */
+std::optional<TableConstraintDefinition> lqp_find_unique_constraint(
+    const std::shared_ptr<const StoredTableNode>& stored_table_node, const ExpressionUnorderedSet& expressions);
+
+/**
+ * @return whether no two rows of @param lqp have the same values in @param expressions (with NULLs considered equal,
+ *         as in a GROUP BY). This is the case if the expressions cover a unique constraint of a validated stored table
+ *         or all GROUP BY expressions of an AggregateNode, and only Predicate, Validate, Projection, Alias, Sort, Limit
+ *         or Semi/Anti Join nodes (on their left input) lie in between. Conservative, i.e., false if in doubt.
+ */
+bool lqp_is_unique_on(const std::shared_ptr<AbstractLQPNode>& lqp, const ExpressionUnorderedSet& expressions);
+
+/**
+ * @return whether each row of the left input of @param join_node matches at most one row of its right input, i.e.,
+ *         whether the right input is unique on the right operands of the equality predicates of the join
+ */
+bool lqp_join_matches_at_most_one_right_row(const std::shared_ptr<JoinNode>& join_node);
+
 /**
  * @return all names of tables that have been accessed in modifying nodes (e.g., InsertNode, UpdateNode)
  */
@@ -0,0 +1,66 @@
+#include "pipeline_aware_lqp_translator.hpp"
+
+#include <memory>
+#include <vector>
+
+#include "logical_query_plan/predicate_node.hpp"
+#include "operators/pipeline.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/validate.hpp"
+
+namespace opossum {
+
+std::shared_ptr<AbstractOperator> PipelineAwareLQPTranslator::translate_node(
+    const std::shared_ptr<AbstractLQPNode>& node) const {
+  const auto pipeline_iter = _pipeline_by_lqp_node.find(node);
+  if (pipeline_iter != _pipeline_by_lqp_node.end()) {
+    return pipeline_iter->second;
+  }
+
+  if (const auto pipeline = _try_translate_to_pipeline(node)) {
+    _pipeline_by_lqp_node.emplace(node, pipeline);
+    return pipeline;
+  }
+
+  return LQPTranslator::translate_node(node);
+}
+
+std::shared_ptr<Pipeline> PipelineAwareLQPTranslator::_try_translate_to_pipeline(
+    const std::shared_ptr<AbstractLQPNode>& node) const {
+  // Collect the stages from the top of the chain down to its input
+  auto stage_nodes = std::vector<std::shared_ptr<AbstractLQPNode>>{};
+  auto input_node = node;
+  while (input_node->type == LQPNodeType::Validate || input_node->type == LQPNodeType::Predicate) {
+    if (input_node->type == LQPNodeType::Predicate &&
+        static_cast<const PredicateNode&>(*input_node).scan_type != ScanType::TableScan) {
+      break;
+    }
+    if (input_node != node && input_node->output_count() > 1) break;
+
+    stage_nodes.emplace_back(input_node);
+    input_node = input_node->left_input();
+  }
+
+  if (stage_nodes.size() < 2 || input_node->type != LQPNodeType::StoredTable) return nullptr;
+
+  // All stages operate on the output of the GetTable. As PredicateNodes and ValidateNodes do not change the columns,
+  // the predicates can be translated against the input of their own node.
+  const auto input_operator = translate_node(input_node);
+
+  auto stages = std::vector<std::shared_ptr<AbstractOperator>>{};
+  stages.reserve(stage_nodes.size());
+  for (auto stage_node_iter = stage_nodes.rbegin(); stage_node_iter != stage_nodes.rend(); ++stage_node_iter) {
+    const auto& stage_node = *stage_node_iter;
+    if (stage_node->type == LQPNodeType::Validate) {
+      stages.emplace_back(std::make_shared<Validate>(input_operator));
+    } else {
+      const auto& predicate_node = static_cast<const PredicateNode&>(*stage_node);
+      stages.emplace_back(std::make_shared<TableScan>(
+          input_operator, _translate_expression(predicate_node.predicate(), stage_node->left_input())));
+    }
+  }
+
+  return std::make_shared<Pipeline>(input_operator, stages);
+}
+
+}  // namespace opossum
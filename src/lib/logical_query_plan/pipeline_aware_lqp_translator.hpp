@@ -0,0 +1,33 @@
+#pragma once
+
+#include <memory>
+#include <unordered_map>
+
+#include "logical_query_plan/lqp_translator.hpp"
+
+namespace opossum {
+
+class Pipeline;
+
+/**
+ * This class can be used as a drop-in specialization for the LQPTranslator. It translates chains of PredicateNodes
+ * and ValidateNodes on top of a StoredTableNode into a single Pipeline operator, which executes the entire chain
+ * morsel by morsel instead of materializing the result of every operator (see pipeline.hpp).
+ *
+ * The chain ends at the first node that is neither a ValidateNode nor a PredicateNode that would be translated into a
+ * TableScan. Joins, aggregates, sorts, and all other nodes are pipeline breakers and are translated by the
+ * LQPTranslator. A node within the chain must not have other outputs, as its result would have to be materialized for
+ * them anyway. Chains with a single node are not pipelined, as there is no intermediate result to avoid.
+ */
+class PipelineAwareLQPTranslator final : public LQPTranslator {
+ public:
+  std::shared_ptr<AbstractOperator> translate_node(const std::shared_ptr<AbstractLQPNode>& node) const final;
+
+ private:
+  std::shared_ptr<Pipeline> _try_translate_to_pipeline(const std::shared_ptr<AbstractLQPNode>& node) const;
+
+  mutable std::unordered_map<std::shared_ptr<const AbstractLQPNode>, std::shared_ptr<AbstractOperator>>
+      _pipeline_by_lqp_node;
+};
+
+}  // namespace opossum
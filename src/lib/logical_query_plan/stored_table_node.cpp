@@ -1,6 +1,9 @@
 #include "stored_table_node.hpp"
 
 #include "expression/lqp_column_expression.hpp"
+#include "statistics/generate_table_statistics.hpp"
+#include "statistics/table_statistics.hpp"
+#include "storage/meta_table_manager.hpp"
 #include "storage/storage_manager.hpp"
 #include "storage/table.hpp"
 
@@ -10,11 +13,20 @@ StoredTableNode::StoredTableNode(const std::string& table_name)
     : AbstractLQPNode(LQPNodeType::StoredTable), table_name(table_name) {}
 
 LQPColumnReference StoredTableNode::get_column(const std::string& name) const {
-  const auto table = StorageManager::get().get_table(table_name);
-  const auto column_id = table->column_id_by_name(name);
+  const auto column_id = table()->column_id_by_name(name);
   return {shared_from_this(), column_id};
 }
 
+std::shared_ptr<Table> StoredTableNode::table() const {
+  if (!MetaTableManager::is_meta_table_name(table_name)) return StorageManager::get().get_table(table_name);
+
+  if (!_meta_table) {
+    _meta_table = StorageManager::get().get_table(table_name);
+    _meta_table->set_table_statistics(std::make_shared<TableStatistics>(generate_table_statistics(*_meta_table)));
+  }
+  return _meta_table;
+}
+
 void StoredTableNode::set_excluded_chunk_ids(const std::vector<ChunkID>& chunks) { _excluded_chunk_ids = chunks; }
 
 const std::vector<ChunkID>& StoredTableNode::excluded_chunk_ids() const { return _excluded_chunk_ids; }
@@ -25,10 +37,10 @@ const std::vector<std::shared_ptr<AbstractExpression>>& StoredTableNode::column_
   // Need to initialize the expressions lazily because they will have a weak_ptr to this node and we can't obtain that
   // in the constructor
   if (!_expressions) {
-    const auto table = StorageManager::get().get_table(table_name);
+    const auto column_count = table()->column_count();
 
-    _expressions.emplace(table->column_count());
-    for (auto column_id = ColumnID{0}; column_id < table->column_count(); ++column_id) {
+    _expressions.emplace(column_count);
+    for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
       (*_expressions)[column_id] =
           std::make_shared<LQPColumnExpression>(LQPColumnReference{shared_from_this(), column_id});
     }
@@ -38,19 +50,19 @@ const std::vector<std::shared_ptr<AbstractExpression>>& StoredTableNode::column_
 }
 
 bool StoredTableNode::is_column_nullable(const ColumnID column_id) const {
-  const auto table = StorageManager::get().get_table(table_name);
-  return table->column_is_nullable(column_id);
+  return table()->column_is_nullable(column_id);
 }
 
 std::shared_ptr<TableStatistics> StoredTableNode::derive_statistics_from(
     const std::shared_ptr<AbstractLQPNode>& left_input, const std::shared_ptr<AbstractLQPNode>& right_input) const {
   DebugAssert(!left_input && !right_input, "StoredTableNode must be leaf");
-  return StorageManager::get().get_table(table_name)->table_statistics();
+  return table()->table_statistics();
 }
 
 std::shared_ptr<AbstractLQPNode> StoredTableNode::_on_shallow_copy(LQPNodeMapping& node_mapping) const {
   const auto copy = make(table_name);
   copy->set_excluded_chunk_ids(_excluded_chunk_ids);
+  copy->_meta_table = _meta_table;
   return copy;
 }
 
@@ -10,6 +10,7 @@
 namespace opossum {
 
 class LQPColumnExpression;
+class Table;
 
 class StoredTableNode : public EnableMakeForLQPNode<StoredTableNode>, public AbstractLQPNode {
  public:
@@ -17,6 +18,13 @@ class StoredTableNode : public EnableMakeForLQPNode<StoredTableNode>, public Abs
 
   LQPColumnReference get_column(const std::string& name) const;
 
+  /**
+   * Returns the table from the StorageManager. A meta table (see MetaTableManager) is generated, together with its
+   * statistics, on the first call only and shared with copies of this node. Thus, the translator and the optimizer work
+   * on a single snapshot instead of generating a new one on each access. GetTable generates its own snapshot.
+   */
+  std::shared_ptr<Table> table() const;
+
   void set_excluded_chunk_ids(const std::vector<ChunkID>& chunks);
   const std::vector<ChunkID>& excluded_chunk_ids() const;
 
@@ -35,6 +43,7 @@ class StoredTableNode : public EnableMakeForLQPNode<StoredTableNode>, public Abs
 
  private:
   mutable std::optional<std::vector<std::shared_ptr<AbstractExpression>>> _expressions;
+  mutable std::shared_ptr<Table> _meta_table;
   std::vector<ChunkID> _excluded_chunk_ids;
 };
 
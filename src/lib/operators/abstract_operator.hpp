@@ -35,6 +35,7 @@ enum class OperatorType {
   JoinSortMerge,
   JoinVerification,
   Limit,
+  Pipeline,
   Print,
   Product,
   Projection,
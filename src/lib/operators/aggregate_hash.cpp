@@ -205,7 +205,7 @@ void AggregateHash::_aggregate() {
   jobs.reserve(_groupby_column_ids.size());
 
   for (size_t group_column_index = 0; group_column_index < _groupby_column_ids.size(); ++group_column_index) {
-    jobs.emplace_back(std::make_shared<JobTask>([&input_table, group_column_index, &keys_per_chunk, this]() {
+    jobs.emplace_back(JobTask::make([&input_table, group_column_index, &keys_per_chunk, this]() {
       const auto column_id = _groupby_column_ids.at(group_column_index);
       const auto data_type = input_table->column_data_type(column_id);
 
@@ -257,10 +257,9 @@ void AggregateHash::_aggregate() {
         }
       });
     }));
-    jobs.back()->schedule();
   }
 
-  CurrentScheduler::wait_for_tasks(jobs);
+  CurrentScheduler::schedule_and_wait_for_tasks(jobs);
 
   /*
   AGGREGATION PHASE
@@ -401,6 +400,10 @@ void AggregateHash::_aggregate() {
               _aggregate_segment<ColumnDataType, AggregateFunction::CountDistinct, AggregateKey>(
                   chunk_id, column_index, *base_segment, keys_per_chunk);
               break;
+            case AggregateFunction::Any:
+              _aggregate_segment<ColumnDataType, AggregateFunction::Any, AggregateKey>(chunk_id, column_index,
+                                                                                       *base_segment, keys_per_chunk);
+              break;
           }
         });
 
@@ -478,9 +481,10 @@ std::shared_ptr<const Table> AggregateHash::_on_execute() {
 The following template functions write the aggregated values for the different aggregate functions.
 They are separate and templated to avoid compiler errors for invalid type/function combinations.
 */
-// MIN, MAX, SUM write the current aggregated value
+// MIN, MAX, SUM, ANY write the current aggregated value
 template <typename ColumnDataType, typename AggregateType, AggregateFunction func>
-std::enable_if_t<func == AggregateFunction::Min || func == AggregateFunction::Max || func == AggregateFunction::Sum,
+std::enable_if_t<func == AggregateFunction::Min || func == AggregateFunction::Max || func == AggregateFunction::Sum ||
+                     func == AggregateFunction::Any,
                  void>
 write_aggregate_values(std::shared_ptr<ValueSegment<AggregateType>> segment,
                        const AggregateResults<ColumnDataType, AggregateType>& results) {
@@ -634,6 +638,9 @@ void AggregateHash::_write_aggregate_output(boost::hana::basic_type<ColumnDataTy
     case AggregateFunction::CountDistinct:
       write_aggregate_output<ColumnDataType, AggregateFunction::CountDistinct>(column_index);
       break;
+    case AggregateFunction::Any:
+      write_aggregate_output<ColumnDataType, AggregateFunction::Any>(column_index);
+      break;
   }
 }
 
@@ -652,19 +659,24 @@ void AggregateHash::write_aggregate_output(ColumnID column_index) {
 
   // Generate column name, TODO(anybody), actually, the AggregateExpression can do this, but the Aggregate operator
   // doesn't use Expressions, yet
+  // ANY() stands in for a GROUP BY column (see AggregateFunction::Any) and keeps its name.
   std::stringstream column_name_stream;
-  if (aggregate.function == AggregateFunction::CountDistinct) {
-    column_name_stream << "COUNT(DISTINCT ";
-  } else {
-    column_name_stream << aggregate.function << "(";
-  }
-
-  if (aggregate.column) {
+  if (aggregate.function == AggregateFunction::Any) {
     column_name_stream << input_table_left()->column_name(*aggregate.column);
   } else {
-    column_name_stream << "*";
+    if (aggregate.function == AggregateFunction::CountDistinct) {
+      column_name_stream << "COUNT(DISTINCT ";
+    } else {
+      column_name_stream << aggregate.function << "(";
+    }
+
+    if (aggregate.column) {
+      column_name_stream << input_table_left()->column_name(*aggregate.column);
+    } else {
+      column_name_stream << "*";
+    }
+    column_name_stream << ")";
   }
-  column_name_stream << ")";
 
   auto context = std::static_pointer_cast<AggregateResultContext<ColumnDataType, decltype(aggregate_type)>>(
       _contexts_per_column[column_index]);
@@ -738,6 +750,11 @@ std::shared_ptr<SegmentVisitorContext> AggregateHash::_create_aggregate_context(
             ColumnDataType, typename AggregateTraits<ColumnDataType, AggregateFunction::CountDistinct>::AggregateType,
             AggregateKey>>();
         break;
+      case AggregateFunction::Any:
+        context = std::make_shared<AggregateContext<
+            ColumnDataType, typename AggregateTraits<ColumnDataType, AggregateFunction::Any>::AggregateType,
+            AggregateKey>>();
+        break;
     }
   });
   return context;
@@ -531,6 +531,12 @@ std::shared_ptr<const Table> AggregateSort::_on_execute() {
               group_boundaries, aggregate_index, sorted_table);
           break;
         }
+        case AggregateFunction::Any: {
+          using AggregateType = typename AggregateTraits<ColumnDataType, AggregateFunction::Any>::AggregateType;
+          _aggregate_values<ColumnDataType, AggregateType, AggregateFunction::Any>(group_boundaries, aggregate_index,
+                                                                                   sorted_table);
+          break;
+        }
       }
     });
 
@@ -580,6 +586,9 @@ void AggregateSort::_create_aggregate_column_definitions(boost::hana::basic_type
     case AggregateFunction::CountDistinct:
       create_aggregate_column_definitions<ColumnType, AggregateFunction::CountDistinct>(column_index);
       break;
+    case AggregateFunction::Any:
+      create_aggregate_column_definitions<ColumnType, AggregateFunction::Any>(column_index);
+      break;
   }
 }
 
@@ -608,19 +617,24 @@ void AggregateSort::create_aggregate_column_definitions(ColumnID column_index) {
 
   // Generate column name, TODO(anybody), actually, the AggregateExpression can do this, but the Aggregate operator
   // doesn't use Expressions, yet
+  // ANY() stands in for a GROUP BY column (see AggregateFunction::Any) and keeps its name.
   std::stringstream column_name_stream;
-  if (aggregate.function == AggregateFunction::CountDistinct) {
-    column_name_stream << "COUNT(DISTINCT ";
-  } else {
-    column_name_stream << aggregate.function << "(";
-  }
-
-  if (aggregate.column) {
+  if (aggregate.function == AggregateFunction::Any) {
     column_name_stream << input_table_left()->column_name(*aggregate.column);
   } else {
-    column_name_stream << "*";
+    if (aggregate.function == AggregateFunction::CountDistinct) {
+      column_name_stream << "COUNT(DISTINCT ";
+    } else {
+      column_name_stream << aggregate.function << "(";
+    }
+
+    if (aggregate.column) {
+      column_name_stream << input_table_left()->column_name(*aggregate.column);
+    } else {
+      column_name_stream << "*";
+    }
+    column_name_stream << ")";
   }
-  column_name_stream << ")";
 
   constexpr bool NEEDS_NULL = (function != AggregateFunction::Count && function != AggregateFunction::CountDistinct);
   _output_column_definitions.emplace_back(column_name_stream.str(), aggregate_data_type, NEEDS_NULL);
@@ -1,5 +1,6 @@
 #include "export_binary.hpp"
 
+#include <algorithm>
 #include <cstring>
 #include <fstream>
 #include <memory>
@@ -8,6 +9,10 @@
 
 #include "import_export/binary.hpp"
 #include "storage/dictionary_segment.hpp"
+#include "storage/index/adaptive_radix_tree/adaptive_radix_tree_index.hpp"
+#include "storage/index/b_tree/b_tree_index.hpp"
+#include "storage/index/delta/delta_index.hpp"
+#include "storage/index/group_key/group_key_index.hpp"
 #include "storage/reference_segment.hpp"
 #include "storage/segment_iterate.hpp"
 #include "storage/vector_compression/compressed_vector_type.hpp"
@@ -128,6 +133,11 @@ void ExportBinary::write_binary(const Table& table, const std::string& filename)
   for (ChunkID chunk_id{0}; chunk_id < table.chunk_count(); chunk_id++) {
     _write_chunk(table, ofstream, chunk_id);
   }
+
+  // Files of tables without indexes end after the chunks, as they did before indexes were exported
+  if (!table.get_indexes().empty()) {
+    _write_indexes(table, ofstream);
+  }
 }
 
 const std::string ExportBinary::name() const { return "ExportBinary"; }
@@ -182,6 +192,61 @@ void ExportBinary::_write_chunk(const Table& table, std::ofstream& ofstream, con
   }
 }
 
+void ExportBinary::_write_indexes(const Table& table, std::ofstream& ofstream) {
+  const auto index_infos = table.get_indexes();
+  export_value(ofstream, static_cast<uint32_t>(index_infos.size()));
+
+  for (const auto& index_info : index_infos) {
+    export_value(ofstream, index_info.type);
+    export_string_values(ofstream, std::vector<pmr_string>{pmr_string{index_info.name}});
+    export_value(ofstream, static_cast<ColumnID::base_type>(index_info.column_ids.size()));
+    export_values(ofstream, std::vector<ColumnID::base_type>(index_info.column_ids.cbegin(),
+                                                             index_info.column_ids.cend()));
+
+    if (index_info.type == SegmentIndexType::TableHash) continue;
+
+    for (ChunkID chunk_id{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+      const auto chunk = table.get_chunk(chunk_id);
+
+      // get_indices() also returns indexes on more columns, of which column_ids are a prefix
+      const auto indices = chunk->get_indices(index_info.column_ids);
+      const auto index_iter = std::find_if(indices.cbegin(), indices.cend(), [&](const auto& index) {
+        return index->type() == index_info.type &&
+               index->get_indexed_segments().size() == index_info.column_ids.size();
+      });
+      const auto index = index_iter != indices.cend() ? *index_iter : nullptr;
+
+      if (const auto group_key_index = std::dynamic_pointer_cast<const GroupKeyIndex>(index)) {
+        export_value(ofstream, BinaryIndexType::group_key);
+        export_values(ofstream, group_key_index->index_offsets());
+        export_values(ofstream, group_key_index->index_postings());
+      } else if (const auto b_tree_index = std::dynamic_pointer_cast<const BTreeIndex>(index)) {
+        export_value(ofstream, BinaryIndexType::b_tree);
+        const auto key_positions = b_tree_index->key_positions();
+        export_value(ofstream, key_positions.size());
+        export_values(ofstream, key_positions);
+        export_value(ofstream, b_tree_index->chunk_offsets().size());
+        export_values(ofstream, b_tree_index->chunk_offsets());
+      } else if (const auto art_index = std::dynamic_pointer_cast<const AdaptiveRadixTreeIndex>(index)) {
+        export_value(ofstream, BinaryIndexType::adaptive_radix_tree);
+        const auto flat_tree = art_index->flat_tree();
+        export_value(ofstream, flat_tree.child_counts.size());
+        export_values(ofstream, flat_tree.child_counts);
+        export_values(ofstream, flat_tree.partial_keys);
+        export_values(ofstream, flat_tree.leaf_ends);
+        export_values(ofstream, art_index->chunk_offsets());
+      } else if (index) {
+        export_value(ofstream, BinaryIndexType::rebuilt);
+      } else if (index_info.column_ids.size() == 1 && chunk->get_delta_index(index_info.column_ids[0]) &&
+                 chunk->get_delta_index(index_info.column_ids[0])->target_index_type() == index_info.type) {
+        export_value(ofstream, BinaryIndexType::delta);
+      } else {
+        export_value(ofstream, BinaryIndexType::none);
+      }
+    }
+  }
+}
+
 template <typename T>
 void ExportBinary::ExportBinaryVisitor<T>::handle_segment(const BaseValueSegment& base_segment,
                                                           std::shared_ptr<SegmentVisitorContext> base_context) {
@@ -82,6 +82,53 @@ class ExportBinary : public AbstractReadOnlyOperator {
    */
   static void _write_chunk(const Table& table, std::ofstream& ofstream, const ChunkID& chunk_id);
 
+  /**
+   * Writes the indexes of the table (see Table::get_indexes) after the chunks. Nothing is written if there are none.
+   *
+   * Description           | Type                                  | Size in bytes
+   * -----------------------------------------------------------------------------------------
+   * Index count           | uint32_t                              |   4
+   *
+   * Then, for every index:
+   *
+   * Description           | Type                                  | Size in bytes
+   * -----------------------------------------------------------------------------------------
+   * Index type            | SegmentIndexType                      |   1
+   * Name length           | size_t                                |   8
+   * Name                  | std::string                           |   Name length
+   * Column count          | ColumnID                              |   2
+   * Column IDs            | ColumnID array                        |   Column count * 2
+   * Chunk index types*    | BinaryIndexType                       |   1 per chunk
+   * Index structures°     | see below                             |
+   *
+   * *: Not written for table-wide hash indexes, which are rebuilt on import.
+   * °: Written directly after the chunk index type, depending on it. The sizes that are not written follow from the
+   *    dictionary segment or from the preceding structures.
+   *
+   * BinaryIndexType::group_key (GroupKeyIndex):
+   *
+   * Index offsets         | size_t array                          |   (dict. size + 1) * 8
+   * Index postings        | ChunkOffset array                     |   rows * 4
+   *
+   * BinaryIndexType::b_tree (BTreeIndex, the inner nodes and keys are restored from the positions and the segment):
+   *
+   * Key count             | size_t                                |   8
+   * Key positions         | ChunkOffset array                     |   Key count * 4
+   * Indexed row count     | size_t                                |   8
+   * Chunk offsets         | ChunkOffset array                     |   Indexed row count * 4
+   *
+   * BinaryIndexType::adaptive_radix_tree (AdaptiveRadixTreeIndex, see AdaptiveRadixTreeIndex::FlatTree):
+   *
+   * Node count            | size_t                                |   8
+   * Child counts          | uint16_t array                        |   Node count * 2
+   * Partial keys          | uint8_t array                         |   Node count - 1
+   * Leaf ends             | ChunkOffset array                     |   Leaf count * 4
+   * Chunk offsets         | ChunkOffset array                     |   rows * 4
+   *
+   * The CompositeGroupKeyIndex (with its variable-length key store) and the StringAdaptiveRadixTreeIndex are rebuilt.
+   */
+  static void _write_indexes(const Table& table, std::ofstream& ofstream);
+
   template <typename T>
   class ExportBinaryVisitor;
 
@@ -2,6 +2,7 @@
 
 #include <boost/hana/for_each.hpp>
 
+#include <algorithm>
 #include <cstdint>
 #include <fstream>
 #include <memory>
@@ -15,6 +16,9 @@
 #include "import_export/binary.hpp"
 #include "resolve_type.hpp"
 #include "storage/chunk.hpp"
+#include "storage/index/adaptive_radix_tree/adaptive_radix_tree_index.hpp"
+#include "storage/index/b_tree/b_tree_index.hpp"
+#include "storage/index/group_key/group_key_index.hpp"
 #include "storage/storage_manager.hpp"
 #include "storage/vector_compression/fixed_size_byte_aligned/fixed_size_byte_aligned_vector.hpp"
 #include "utils/assert.hpp"
@@ -41,6 +45,10 @@ std::shared_ptr<Table> ImportBinary::read_binary(const std::string& filename) {
     _import_chunk(file, table);
   }
 
+  if (file.peek() != std::ifstream::traits_type::eof()) {
+    _import_indexes(file, *table);
+  }
+
   return table;
 }
 
@@ -143,6 +151,83 @@ void ImportBinary::_import_chunk(std::ifstream& file, std::shared_ptr<Table>& ta
   table->append_chunk(output_segments, mvcc_data);
 }
 
+void ImportBinary::_import_indexes(std::ifstream& file, Table& table) {
+  const auto index_count = _read_value<uint32_t>(file);
+
+  for (auto index_id = uint32_t{0}; index_id < index_count; ++index_id) {
+    const auto index_type = _read_value<SegmentIndexType>(file);
+    const auto name = std::string{_read_string_values(file, 1)[0]};
+    const auto column_count = _read_value<ColumnID::base_type>(file);
+    const auto column_id_values = _read_values<ColumnID::base_type>(file, column_count);
+    const auto column_ids = std::vector<ColumnID>(column_id_values.cbegin(), column_id_values.cend());
+
+    if (index_type == SegmentIndexType::TableHash) {
+      table.create_table_hash_index(column_ids[0], name);
+      continue;
+    }
+
+    for (ChunkID chunk_id{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+      const auto chunk = table.get_chunk(chunk_id);
+
+      switch (_read_value<BinaryIndexType>(file)) {
+        case BinaryIndexType::none:
+          break;
+        case BinaryIndexType::rebuilt:
+          chunk->create_index(index_type, column_ids);
+          break;
+        case BinaryIndexType::group_key: {
+          const auto segment =
+              std::dynamic_pointer_cast<const BaseDictionarySegment>(chunk->get_segment(column_ids[0]));
+          Assert(segment, "GroupKeyIndex requires a dictionary segment");
+
+          auto index_offsets = _read_values<size_t>(file, segment->unique_values_count() + 1u);
+          auto index_postings = _read_values<ChunkOffset>(file, segment->size());
+          chunk->add_index(std::make_shared<GroupKeyIndex>(
+              std::vector<std::shared_ptr<const BaseSegment>>{segment},
+              std::vector<size_t>(index_offsets.begin(), index_offsets.end()),
+              std::vector<ChunkOffset>(index_postings.begin(), index_postings.end())));
+        } break;
+        case BinaryIndexType::b_tree: {
+          const auto segment = chunk->get_segment(column_ids[0]);
+          const auto key_count = _read_value<size_t>(file);
+          auto key_positions = _read_values<ChunkOffset>(file, key_count);
+          const auto indexed_row_count = _read_value<size_t>(file);
+          auto chunk_offsets = _read_values<ChunkOffset>(file, indexed_row_count);
+          chunk->add_index(std::make_shared<BTreeIndex>(
+              std::vector<std::shared_ptr<const BaseSegment>>{segment},
+              std::vector<ChunkOffset>(chunk_offsets.begin(), chunk_offsets.end()),
+              std::vector<ChunkOffset>(key_positions.begin(), key_positions.end())));
+        } break;
+        case BinaryIndexType::adaptive_radix_tree: {
+          const auto segment = chunk->get_segment(column_ids[0]);
+          const auto node_count = _read_value<size_t>(file);
+          auto flat_tree = AdaptiveRadixTreeIndex::FlatTree{};
+          const auto child_counts = _read_values<uint16_t>(file, node_count);
+          flat_tree.child_counts.assign(child_counts.cbegin(), child_counts.cend());
+          // Every node but the root is the child of another node
+          const auto partial_keys = _read_values<uint8_t>(file, node_count - 1);
+          flat_tree.partial_keys.assign(partial_keys.cbegin(), partial_keys.cend());
+          const auto leaf_ends = _read_values<ChunkOffset>(
+              file, std::count(flat_tree.child_counts.cbegin(), flat_tree.child_counts.cend(), uint16_t{0}));
+          flat_tree.leaf_ends.assign(leaf_ends.cbegin(), leaf_ends.cend());
+          auto chunk_offsets = _read_values<ChunkOffset>(file, segment->size());
+          chunk->add_index(std::make_shared<AdaptiveRadixTreeIndex>(
+              std::vector<std::shared_ptr<const BaseSegment>>{segment},
+              std::vector<ChunkOffset>(chunk_offsets.begin(), chunk_offsets.end()), flat_tree));
+        } break;
+        case BinaryIndexType::delta: {
+          const auto delta_index = chunk->create_delta_index(column_ids[0], index_type);
+          Assert(delta_index, "Delta indexes can only be imported for mutable chunks");
+        } break;
+        default:
+          Fail("Cannot import index: invalid index type");
+      }
+    }
+
+    table.add_index_info(IndexInfo{column_ids, name, index_type});
+  }
+}
+
 std::shared_ptr<BaseSegment> ImportBinary::_import_segment(std::ifstream& file, ChunkOffset row_count,
                                                            DataType data_type, bool is_nullable) {
   std::shared_ptr<BaseSegment> result;
@@ -35,9 +35,12 @@ class ImportBinary : public AbstractReadOnlyOperator {
    * |   Header   |
    * |------------|
    * |   Chunks¹  |
+   * |------------|
+   * |  Indexes²  |
    * --------------
    *
    * ¹ Zero or more chunks
+   * ² Optional, see ExportBinary::_write_indexes
    */
   std::shared_ptr<const Table> _on_execute() final;
 
@@ -83,6 +86,13 @@ class ImportBinary : public AbstractReadOnlyOperator {
    */
   static void _import_chunk(std::ifstream& file, std::shared_ptr<Table>& table);
 
+  /*
+   * Restores the indexes written by ExportBinary::_write_indexes. GroupKeyIndexes, BTreeIndexes, and
+   * AdaptiveRadixTreeIndexes are restored from their structures, all other indexes are rebuilt. Files of tables
+   * without indexes end after the chunks.
+   */
+  static void _import_indexes(std::ifstream& file, Table& table);
+
   // Calls the right _import_column<ColumnDataType> depending on the given data_type.
   static std::shared_ptr<BaseSegment> _import_segment(std::ifstream& file, ChunkOffset row_count, DataType data_type,
                                                       bool is_nullable);
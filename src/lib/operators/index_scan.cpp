@@ -1,15 +1,27 @@
 #include "index_scan.hpp"
 
 #include <algorithm>
+#include <map>
+#include <unordered_map>
 
 #include "expression/between_expression.hpp"
-
-#include "scheduler/abstract_task.hpp"
-#include "scheduler/current_scheduler.hpp"
-#include "scheduler/job_task.hpp"
-
+#include "expression/binary_predicate_expression.hpp"
+#include "expression/logical_expression.hpp"
+#include "expression/pqp_column_expression.hpp"
+#include "expression/value_expression.hpp"
+#include "lossless_cast.hpp"
+
+#include "operators/get_table.hpp"
+#include "operators/morsel.hpp"
+#include "operators/table_scan/expression_evaluator_table_scan_impl.hpp"
 #include "storage/index/base_index.hpp"
+#include "storage/index/delta/delta_index.hpp"
+#include "storage/index/table_hash/table_hash_index.hpp"
+#include "resolve_type.hpp"
 #include "storage/reference_segment.hpp"
+#include "storage/segment_accessor.hpp"
+#include "storage/storage_manager.hpp"
+#include "type_comparison.hpp"
 
 #include "utils/assert.hpp"
 
@@ -18,6 +30,17 @@ namespace opossum {
 IndexScan::IndexScan(const std::shared_ptr<const AbstractOperator>& in, const SegmentIndexType index_type,
                      const std::vector<ColumnID>& left_column_ids, const PredicateCondition predicate_condition,
                      const std::vector<AllTypeVariant>& right_values, const std::vector<AllTypeVariant>& right_values2)
+    : IndexScan{in,
+                index_type,
+                left_column_ids,
+                predicate_condition,
+                std::vector<AllParameterVariant>(right_values.cbegin(), right_values.cend()),
+                std::vector<AllParameterVariant>(right_values2.cbegin(), right_values2.cend())} {}
+
+IndexScan::IndexScan(const std::shared_ptr<const AbstractOperator>& in, const SegmentIndexType index_type,
+                     const std::vector<ColumnID>& left_column_ids, const PredicateCondition predicate_condition,
+                     const std::vector<AllParameterVariant>& right_values,
+                     const std::vector<AllParameterVariant>& right_values2)
     : AbstractReadOnlyOperator{OperatorType::IndexScan, in},
       _index_type{index_type},
       _left_column_ids{left_column_ids},
@@ -27,6 +50,12 @@ IndexScan::IndexScan(const std::shared_ptr<const AbstractOperator>& in, const Se
 
 const std::string IndexScan::name() const { return "IndexScan"; }
 
+SegmentIndexType IndexScan::index_type() const { return _index_type; }
+
+const std::vector<ColumnID>& IndexScan::left_column_ids() const { return _left_column_ids; }
+
+PredicateCondition IndexScan::predicate_condition() const { return _predicate_condition; }
+
 void IndexScan::set_included_chunk_ids(const std::vector<ChunkID>& chunk_ids) { _included_chunk_ids = chunk_ids; }
 
 std::shared_ptr<const Table> IndexScan::_on_execute() {
@@ -34,24 +63,78 @@ std::shared_ptr<const Table> IndexScan::_on_execute() {
 
   _validate_input();
 
+  const auto resolve_values = [](const std::vector<AllParameterVariant>& values) {
+    auto resolved_values = std::vector<AllTypeVariant>{};
+    resolved_values.reserve(values.size());
+    for (const auto& value : values) {
+      Assert(is_variant(value), "IndexScan parameters have not been set.");
+      resolved_values.emplace_back(boost::get<AllTypeVariant>(value));
+    }
+    return resolved_values;
+  };
+  _search_values = resolve_values(_right_values);
+  _search_values2 = resolve_values(_right_values2);
+
   _out_table = std::make_shared<Table>(_in_table->column_definitions(), TableType::References);
 
+  // Comparisons with NULL never match
+  const auto is_null = [](const auto& value) { return variant_is_null(value); };
+  if (std::any_of(_search_values.cbegin(), _search_values.cend(), is_null) ||
+      std::any_of(_search_values2.cbegin(), _search_values2.cend(), is_null)) {
+    return _out_table;
+  }
+
+  // As in the TableScan, the search values are cast to the type of the indexed columns (e.g., an int literal for a
+  // long column), which the indexes and _filter_without_index() expect. The LQPTranslator only creates IndexScans for
+  // literals that can be cast without loss, but parameters are only known now. For those that cannot be cast (e.g.,
+  // 3.5 for an int column), the predicate is evaluated on the original values without the indexes.
+  const auto cast_values = [&](std::vector<AllTypeVariant>& values) {
+    auto all_cast = true;
+    for (auto column_index = size_t{0}; column_index < values.size(); ++column_index) {
+      const auto column_data_type = _in_table->column_data_type(_left_column_ids[column_index]);
+      const auto cast_value = lossless_variant_cast(values[column_index], column_data_type);
+      if (cast_value) {
+        values[column_index] = *cast_value;
+      } else {
+        all_cast = false;
+      }
+    }
+    return all_cast;
+  };
+  const auto search_values_cast = cast_values(_search_values);
+  const auto search_values2_cast = cast_values(_search_values2);
+  if (!search_values_cast || !search_values2_cast) {
+    _scan_impl_without_index =
+        std::make_unique<ExpressionEvaluatorTableScanImpl>(_in_table, _predicate_without_index());
+  }
+
+  if (_index_type == SegmentIndexType::TableHash && !_scan_impl_without_index) {
+    const auto matches_out = std::make_shared<PosList>(_scan_table_hash_index());
+    if (matches_out->empty()) return _out_table;
+
+    Segments segments;
+    for (ColumnID column_id{0u}; column_id < _in_table->column_count(); ++column_id) {
+      segments.push_back(std::make_shared<ReferenceSegment>(_in_table, column_id, matches_out));
+    }
+    _out_table->append_chunk(segments);
+    return _out_table;
+  }
+
   std::mutex output_mutex;
 
-  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
-  if (_included_chunk_ids.empty()) {
-    jobs.reserve(_in_table->chunk_count());
+  auto chunk_ids = _included_chunk_ids;
+  if (chunk_ids.empty()) {
+    chunk_ids.reserve(_in_table->chunk_count());
     for (auto chunk_id = ChunkID{0u}; chunk_id < _in_table->chunk_count(); ++chunk_id) {
-      jobs.push_back(_create_job_and_schedule(chunk_id, output_mutex));
-    }
-  } else {
-    jobs.reserve(_included_chunk_ids.size());
-    for (auto chunk_id : _included_chunk_ids) {
-      jobs.push_back(_create_job_and_schedule(chunk_id, output_mutex));
+      chunk_ids.emplace_back(chunk_id);
     }
   }
 
-  CurrentScheduler::wait_for_tasks(jobs);
+  // Index lookups cannot be restricted to parts of a chunk, so the chunks are not split
+  const auto morsels = split_into_morsels(*_in_table, chunk_ids);
+  process_morsels(morsels, [&](const size_t morsel_idx) {
+    _scan_chunk_into_output(morsels[morsel_idx].chunk_id, output_mutex);
+  });
 
   return _out_table;
 }
@@ -59,31 +142,77 @@ std::shared_ptr<const Table> IndexScan::_on_execute() {
 std::shared_ptr<AbstractOperator> IndexScan::_on_deep_copy(
     const std::shared_ptr<AbstractOperator>& copied_input_left,
     const std::shared_ptr<AbstractOperator>& copied_input_right) const {
-  return std::make_shared<IndexScan>(copied_input_left, _index_type, _left_column_ids, _predicate_condition,
-                                     _right_values, _right_values2);
+  const auto copy = std::make_shared<IndexScan>(copied_input_left, _index_type, _left_column_ids,
+                                                _predicate_condition, _right_values, _right_values2);
+  copy->set_included_chunk_ids(_included_chunk_ids);
+  return copy;
 }
 
-void IndexScan::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {}
+void IndexScan::_on_cleanup() { _scan_impl_without_index.reset(); }
 
-std::shared_ptr<AbstractTask> IndexScan::_create_job_and_schedule(const ChunkID chunk_id, std::mutex& output_mutex) {
-  auto job_task = std::make_shared<JobTask>([=, &output_mutex]() {
-    const auto matches_out = std::make_shared<PosList>(_scan_chunk(chunk_id));
+void IndexScan::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {
+  const auto set_parameters = [&](std::vector<AllParameterVariant>& values) {
+    for (auto& value : values) {
+      if (!is_parameter_id(value)) continue;
 
-    // The output chunk is allocated on the same NUMA node as the input chunk.
-    const auto chunk = _in_table->get_chunk(chunk_id);
-    Segments segments;
+      const auto parameter_iter = parameters.find(boost::get<ParameterID>(value));
+      if (parameter_iter != parameters.end()) value = parameter_iter->second;
+    }
+  };
+
+  set_parameters(_right_values);
+  set_parameters(_right_values2);
+}
+
+void IndexScan::_scan_chunk_into_output(const ChunkID chunk_id, std::mutex& output_mutex) {
+  // The output chunk is allocated on the same NUMA node as the input chunk.
+  const auto chunk = _in_table->get_chunk(chunk_id);
+  Segments segments;
+
+  if (_in_table->type() == TableType::References) {
+    const auto matches_out = _scan_impl_without_index ? _scan_impl_without_index->scan_chunk(chunk_id)
+                                                      : std::make_shared<PosList>(_scan_reference_chunk(chunk_id));
+    if (matches_out->empty()) return;
+
+    // As in the TableScan, the output references the physical segments and position lists are shared between
+    // segments that shared them in the input.
+    auto filtered_pos_lists = std::map<std::shared_ptr<const PosList>, std::shared_ptr<PosList>>{};
+
+    for (ColumnID column_id{0u}; column_id < _in_table->column_count(); ++column_id) {
+      const auto ref_segment_in = std::dynamic_pointer_cast<const ReferenceSegment>(chunk->get_segment(column_id));
+      DebugAssert(ref_segment_in, "All segments should be of type ReferenceSegment.");
+
+      const auto pos_list_in = ref_segment_in->pos_list();
+      auto& filtered_pos_list = filtered_pos_lists[pos_list_in];
+
+      if (!filtered_pos_list) {
+        filtered_pos_list = std::make_shared<PosList>();
+        filtered_pos_list->reserve(matches_out->size());
+        if (pos_list_in->references_single_chunk()) {
+          filtered_pos_list->guarantee_single_chunk();
+        }
+
+        for (const auto& match : *matches_out) {
+          filtered_pos_list->emplace_back((*pos_list_in)[match.chunk_offset]);
+        }
+      }
+
+      segments.push_back(std::make_shared<ReferenceSegment>(ref_segment_in->referenced_table(),
+                                                            ref_segment_in->referenced_column_id(),
+                                                            filtered_pos_list));
+    }
+  } else {
+    const auto matches_out = _scan_impl_without_index ? _scan_impl_without_index->scan_chunk(chunk_id)
+                                                      : std::make_shared<PosList>(_scan_chunk(chunk_id));
 
     for (ColumnID column_id{0u}; column_id < _in_table->column_count(); ++column_id) {
       auto ref_segment_out = std::make_shared<ReferenceSegment>(_in_table, column_id, matches_out);
       segments.push_back(ref_segment_out);
     }
+  }
 
-    std::lock_guard<std::mutex> lock(output_mutex);
-    _out_table->append_chunk(segments, nullptr, chunk->get_allocator());
-  });
-
-  job_task->schedule();
-  return job_task;
+  std::lock_guard<std::mutex> lock(output_mutex);
+  _out_table->append_chunk(segments, nullptr, chunk->get_allocator());
 }
 
 void IndexScan::_validate_input() {
@@ -97,88 +226,299 @@ void IndexScan::_validate_input() {
            "Count mismatch: left column IDs and right values don’t have same size.");
   }
 
-  Assert(_in_table->type() == TableType::Data, "IndexScan only supports persistent tables right now.");
+  if (_index_type == SegmentIndexType::TableHash) {
+    Assert(_in_table->type() == TableType::Data, "Table-wide hash indexes can only be scanned on persistent tables.");
+    Assert(_left_column_ids.size() == 1, "Table-wide hash indexes span a single column only.");
+    Assert(_predicate_condition == PredicateCondition::Equals, "Table-wide hash indexes only support Equals.");
+  }
+}
+
+std::shared_ptr<AbstractExpression> IndexScan::_predicate_without_index() const {
+  auto predicate = std::shared_ptr<AbstractExpression>{};
+
+  // For multiple columns (Equals only), the predicate is the conjunction of the single-column predicates
+  for (auto column_index = size_t{0}; column_index < _left_column_ids.size(); ++column_index) {
+    const auto column = PQPColumnExpression::from_table(*_in_table, _left_column_ids[column_index]);
+    const auto value = std::make_shared<ValueExpression>(_search_values[column_index]);
+
+    auto column_predicate = std::shared_ptr<AbstractExpression>{};
+    if (is_between_predicate_condition(_predicate_condition)) {
+      const auto value2 = std::make_shared<ValueExpression>(_search_values2[column_index]);
+      column_predicate = std::make_shared<BetweenExpression>(_predicate_condition, column, value, value2);
+    } else {
+      column_predicate = std::make_shared<BinaryPredicateExpression>(_predicate_condition, column, value);
+    }
+
+    predicate = predicate ? std::make_shared<LogicalExpression>(LogicalOperator::And, predicate, column_predicate)
+                          : column_predicate;
+  }
+
+  return predicate;
+}
+
+PosList IndexScan::_scan_table_hash_index() {
+  const auto column_id = _left_column_ids[0];
+
+  // The index belongs to the stored table. If GetTable omitted chunks (e.g., pruned or physically deleted ones), its
+  // output is a new Table with renumbered chunks. In that case, the index is taken from the stored table and its
+  // RowIDs are mapped to the input table via the (shared) chunks.
+  auto indexed_table = _in_table;
+  if (!indexed_table->get_table_hash_index(column_id)) {
+    const auto get_table = std::dynamic_pointer_cast<const GetTable>(input_left());
+    Assert(get_table, "Table-wide hash index not found on the input table.");
+    indexed_table = StorageManager::get().get_table(get_table->table_name());
+  }
+
+  const auto index = indexed_table->get_table_hash_index(column_id);
+  Assert(index, "Table-wide hash index not found for column.");
+
+  auto matches_out = index->lookup(_search_values[0]);
+
+  if (indexed_table != _in_table) {
+    auto input_chunk_ids = std::unordered_map<const Chunk*, ChunkID>{};
+    for (auto chunk_id = ChunkID{0}; chunk_id < _in_table->chunk_count(); ++chunk_id) {
+      input_chunk_ids.emplace(_in_table->get_chunk(chunk_id).get(), chunk_id);
+    }
+
+    auto mapped_matches = PosList{};
+    mapped_matches.reserve(matches_out.size());
+    for (const auto& row_id : matches_out) {
+      const auto chunk = indexed_table->get_chunk(row_id.chunk_id);
+      if (!chunk) continue;
+
+      const auto input_chunk_id_iter = input_chunk_ids.find(chunk.get());
+      if (input_chunk_id_iter == input_chunk_ids.end()) continue;
+      mapped_matches.emplace_back(RowID{input_chunk_id_iter->second, row_id.chunk_offset});
+    }
+    matches_out = std::move(mapped_matches);
+  }
+
+  if (!_included_chunk_ids.empty()) {
+    auto included_chunk_ids = _included_chunk_ids;
+    std::sort(included_chunk_ids.begin(), included_chunk_ids.end());
+    matches_out.erase(std::remove_if(matches_out.begin(), matches_out.end(),
+                                     [&](const auto& row_id) {
+                                       return !std::binary_search(included_chunk_ids.begin(),
+                                                                  included_chunk_ids.end(), row_id.chunk_id);
+                                     }),
+                      matches_out.end());
+  }
+
+  // Keep the order of the input table, as a scan over the chunk indexes would
+  std::sort(matches_out.begin(), matches_out.end());
+
+  return matches_out;
 }
 
 PosList IndexScan::_scan_chunk(const ChunkID chunk_id) {
   const auto to_row_id = [chunk_id](ChunkOffset chunk_offset) { return RowID{chunk_id, chunk_offset}; };
 
-  auto range_begin = BaseIndex::Iterator{};
-  auto range_end = BaseIndex::Iterator{};
+  const auto chunk = _in_table->get_chunk(chunk_id);
+  auto matches_out = PosList{};
+
+  const auto index_found =
+      _for_each_index_range(*chunk, _left_column_ids, [&](const auto range_begin, const auto range_end) {
+        matches_out.reserve(matches_out.size() + std::distance(range_begin, range_end));
+        std::transform(range_begin, range_end, std::back_inserter(matches_out), to_row_id);
+      });
+  Assert(index_found, "Index of specified type not found for segment (vector).");
+
+  return matches_out;
+}
 
+PosList IndexScan::_scan_reference_chunk(const ChunkID chunk_id) {
   const auto chunk = _in_table->get_chunk(chunk_id);
+
+  // The indexed columns have to reference the same rows of the same table. This is the case for all columns that
+  // originate from the same input of a join.
+  auto pos_list = std::shared_ptr<const PosList>{};
+  auto referenced_table = std::shared_ptr<const Table>{};
+  auto referenced_column_ids = std::vector<ColumnID>{};
+  for (const auto column_id : _left_column_ids) {
+    const auto ref_segment = std::dynamic_pointer_cast<const ReferenceSegment>(chunk->get_segment(column_id));
+    Assert(ref_segment, "All segments of a reference table should be of type ReferenceSegment.");
+
+    if (!pos_list) {
+      pos_list = ref_segment->pos_list();
+      referenced_table = ref_segment->referenced_table();
+    } else {
+      Assert(ref_segment->referenced_table() == referenced_table &&
+                 (ref_segment->pos_list() == pos_list || *ref_segment->pos_list() == *pos_list),
+             "Indexed columns have to reference the same rows of the same table.");
+    }
+    referenced_column_ids.emplace_back(ref_segment->referenced_column_id());
+  }
+
+  // Group the input positions by the chunk they reference, so that each referenced chunk's index is searched once.
+  // NULL positions (e.g., from outer joins) never match.
+  auto input_offsets_by_referenced_chunk = std::map<ChunkID, std::vector<ChunkOffset>>{};
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < pos_list->size(); ++chunk_offset) {
+    const auto& row_id = (*pos_list)[chunk_offset];
+    if (row_id.is_null()) continue;
+    input_offsets_by_referenced_chunk[row_id.chunk_id].emplace_back(chunk_offset);
+  }
+
+  // Searching an index walks all matches of the referenced chunk, no matter how few of its rows are referenced. If the
+  // input references several chunks (e.g., after a join), this would be repeated for each input chunk. The indexes
+  // are thus only used if the input references a single chunk, otherwise the referenced values are compared directly,
+  // which costs no more than a TableScan.
+  const auto use_indexes = input_offsets_by_referenced_chunk.size() == 1;
+
   auto matches_out = PosList{};
+  for (auto& [referenced_chunk_id, input_offsets] : input_offsets_by_referenced_chunk) {
+    const auto referenced_chunk = referenced_table->get_chunk(referenced_chunk_id);
+
+    if (use_indexes) {
+      // Delta indexes may already contain rows appended after the size was read, those cannot be referenced
+      auto matches = std::vector<bool>(referenced_chunk->size());
+      const auto index_found =
+          _for_each_index_range(*referenced_chunk, referenced_column_ids, [&](auto range_begin, const auto range_end) {
+            for (; range_begin != range_end; ++range_begin) {
+              if (*range_begin < matches.size()) matches[*range_begin] = true;
+            }
+          });
+
+      if (index_found) {
+        for (const auto input_offset : input_offsets) {
+          if (matches[(*pos_list)[input_offset].chunk_offset]) matches_out.emplace_back(RowID{chunk_id, input_offset});
+        }
+        continue;
+      }
+    }
 
-  const auto index = chunk->get_index(_index_type, _left_column_ids);
-  Assert(index, "Index of specified type not found for segment (vector).");
+    _filter_without_index(*referenced_chunk, referenced_column_ids, *pos_list, input_offsets);
+    for (const auto input_offset : input_offsets) {
+      matches_out.emplace_back(RowID{chunk_id, input_offset});
+    }
+  }
+
+  // Keep the order of the input rows
+  std::sort(matches_out.begin(), matches_out.end());
+
+  return matches_out;
+}
+
+template <typename Functor>
+bool IndexScan::_for_each_index_range(const Chunk& chunk, const std::vector<ColumnID>& column_ids,
+                                      const Functor& functor) const {
+  const auto index = chunk.get_index(_index_type, column_ids);
+
+  // Mutable chunks are covered by a delta index instead (see BaseDeltaIndex)
+  if (!index) {
+    if (column_ids.size() != 1) return false;
+
+    const auto delta_index = chunk.get_delta_index(column_ids[0]);
+    if (!delta_index) return false;
+
+    const auto value2 = !_search_values2.empty() ? std::optional<AllTypeVariant>{_search_values2[0]} : std::nullopt;
+    const auto chunk_offsets = delta_index->scan(_predicate_condition, _search_values[0], value2);
+    functor(chunk_offsets.cbegin(), chunk_offsets.cend());
+    return true;
+  }
+
+  // Every row that is not in one of the ranges was skipped thanks to the index
+  auto matched_row_count = size_t{0};
+  const auto count_and_call_functor = [&](const auto range_begin, const auto range_end) {
+    matched_row_count += std::distance(range_begin, range_end);
+    functor(range_begin, range_end);
+  };
 
   switch (_predicate_condition) {
     case PredicateCondition::Equals: {
-      range_begin = index->lower_bound(_right_values);
-      range_end = index->upper_bound(_right_values);
+      count_and_call_functor(index->lower_bound(_search_values), index->upper_bound(_search_values));
       break;
     }
     case PredicateCondition::NotEquals: {
-      // first, get all values less than the search value
-      range_begin = index->cbegin();
-      range_end = index->lower_bound(_right_values);
-
-      matches_out.reserve(std::distance(range_begin, range_end));
-      std::transform(range_begin, range_end, std::back_inserter(matches_out), to_row_id);
-
-      // set range for second half to all values greater than the search value
-      range_begin = index->upper_bound(_right_values);
-      range_end = index->cend();
+      // all values less than the search value and all values greater than the search value
+      count_and_call_functor(index->cbegin(), index->lower_bound(_search_values));
+      count_and_call_functor(index->upper_bound(_search_values), index->cend());
       break;
     }
     case PredicateCondition::LessThan: {
-      range_begin = index->cbegin();
-      range_end = index->lower_bound(_right_values);
+      count_and_call_functor(index->cbegin(), index->lower_bound(_search_values));
       break;
     }
     case PredicateCondition::LessThanEquals: {
-      range_begin = index->cbegin();
-      range_end = index->upper_bound(_right_values);
+      count_and_call_functor(index->cbegin(), index->upper_bound(_search_values));
       break;
     }
     case PredicateCondition::GreaterThan: {
-      range_begin = index->upper_bound(_right_values);
-      range_end = index->cend();
+      count_and_call_functor(index->upper_bound(_search_values), index->cend());
       break;
     }
     case PredicateCondition::GreaterThanEquals: {
-      range_begin = index->lower_bound(_right_values);
-      range_end = index->cend();
+      count_and_call_functor(index->lower_bound(_search_values), index->cend());
       break;
     }
     case PredicateCondition::BetweenInclusive: {
-      range_begin = index->lower_bound(_right_values);
-      range_end = index->upper_bound(_right_values2);
+      count_and_call_functor(index->lower_bound(_search_values), index->upper_bound(_search_values2));
       break;
     }
     case PredicateCondition::BetweenLowerExclusive: {
-      range_begin = index->upper_bound(_right_values);
-      range_end = index->upper_bound(_right_values2);
+      count_and_call_functor(index->upper_bound(_search_values), index->upper_bound(_search_values2));
       break;
     }
     case PredicateCondition::BetweenUpperExclusive: {
-      range_begin = index->lower_bound(_right_values);
-      range_end = index->lower_bound(_right_values2);
+      count_and_call_functor(index->lower_bound(_search_values), index->lower_bound(_search_values2));
       break;
     }
     case PredicateCondition::BetweenExclusive: {
-      range_begin = index->upper_bound(_right_values);
-      range_end = index->lower_bound(_right_values2);
+      count_and_call_functor(index->upper_bound(_search_values), index->lower_bound(_search_values2));
       break;
     }
     default:
       Fail("Unsupported comparison type encountered");
   }
 
-  matches_out.reserve(matches_out.size() + std::distance(range_begin, range_end));
-  std::transform(range_begin, range_end, std::back_inserter(matches_out), to_row_id);
+  index->record_lookups(1, chunk.size() - matched_row_count);
 
-  return matches_out;
+  return true;
+}
+
+void IndexScan::_filter_without_index(const Chunk& referenced_chunk, const std::vector<ColumnID>& column_ids,
+                                      const PosList& pos_list, std::vector<ChunkOffset>& input_offsets) const {
+  Assert(column_ids.size() == 1 || _predicate_condition == PredicateCondition::Equals,
+         "Referenced chunks can only be scanned without an index for single-column or Equals predicates.");
+
+  for (auto column_index = size_t{0}; column_index < column_ids.size(); ++column_index) {
+    if (variant_is_null(_search_values[column_index]) ||
+        (!_search_values2.empty() && variant_is_null(_search_values2[column_index]))) {
+      input_offsets.clear();
+      return;
+    }
+  }
+
+  // For multiple columns (Equals only), a row matches if all of its values match
+  for (auto column_index = size_t{0}; column_index < column_ids.size(); ++column_index) {
+    const auto segment = referenced_chunk.get_segment(column_ids[column_index]);
+
+    resolve_data_type(segment->data_type(), [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+
+      const auto accessor = create_segment_accessor<ColumnDataType>(segment);
+      const auto search_value = boost::get<ColumnDataType>(_search_values[column_index]);
+
+      const auto remove_non_matching = [&](const auto& matches_value) {
+        input_offsets.erase(std::remove_if(input_offsets.begin(), input_offsets.end(),
+                                           [&](const auto input_offset) {
+                                             const auto value = accessor->access(pos_list[input_offset].chunk_offset);
+                                             return !value || !matches_value(*value);
+                                           }),
+                            input_offsets.end());
+      };
+
+      if (is_between_predicate_condition(_predicate_condition)) {
+        const auto search_value2 = boost::get<ColumnDataType>(_search_values2[column_index]);
+        with_between_comparator(_predicate_condition, [&](const auto comparator) {
+          remove_non_matching([&](const auto& value) { return comparator(value, search_value, search_value2); });
+        });
+      } else {
+        with_comparator(_predicate_condition, [&](const auto comparator) {
+          remove_non_matching([&](const auto& value) { return comparator(value, search_value); });
+        });
+      }
+    });
+  }
 }
 
 }  // namespace opossum
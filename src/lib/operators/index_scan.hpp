@@ -4,20 +4,39 @@
 
 #include "abstract_read_only_operator.hpp"
 
+#include "all_parameter_variant.hpp"
 #include "all_type_variant.hpp"
+#include "operators/table_scan/abstract_table_scan_impl.hpp"
 #include "storage/index/segment_index_type.hpp"
 #include "storage/pos_list.hpp"
 #include "types.hpp"
 
 namespace opossum {
 
+class AbstractExpression;
+class Chunk;
 class Table;
-class AbstractTask;
 
 /**
  * Operator that performs a predicate search using indices
  *
  * Note: Scans only the set of chunks passed to the constructor
+ *
+ * For multiple columns (i.e., on a CompositeGroupKeyIndex), the predicate is applied to the columns as a whole. For
+ * Equals, this is the conjunction of the single-column predicates.
+ *
+ * The input can also be a reference table (e.g., the output of a join or Validate). If an input chunk references a
+ * single chunk, the index of that chunk is searched and the result is intersected with the input's PosList. Otherwise,
+ * and for referenced chunks without an index, the referenced values are compared directly (single-column or Equals
+ * predicates only). The output keeps the order of the input rows.
+ *
+ * The search values can be ParameterIDs (placeholders or correlated parameters), which are resolved by
+ * set_parameters() before the execution. The search values are cast to the types of the indexed columns. If a value
+ * is NULL, no row matches. If a value cannot be cast without loss (e.g., 3.5 for an int column), the indexes cannot
+ * be searched and the predicate is evaluated by the ExpressionEvaluator instead, as in the TableScan.
+ *
+ * With SegmentIndexType::TableHash, the table-wide hash index of the stored table (see BaseTableHashIndex) is used
+ * instead of the chunk indexes. Only single-column Equals predicates are supported in that case.
  */
 class IndexScan : public AbstractReadOnlyOperator {
   friend class LQPTranslatorTest;
@@ -27,8 +46,17 @@ class IndexScan : public AbstractReadOnlyOperator {
             const std::vector<ColumnID>& left_column_ids, const PredicateCondition predicate_condition,
             const std::vector<AllTypeVariant>& right_values, const std::vector<AllTypeVariant>& right_values2 = {});
 
+  IndexScan(const std::shared_ptr<const AbstractOperator>& in, const SegmentIndexType index_type,
+            const std::vector<ColumnID>& left_column_ids, const PredicateCondition predicate_condition,
+            const std::vector<AllParameterVariant>& right_values,
+            const std::vector<AllParameterVariant>& right_values2 = {});
+
   const std::string name() const final;
 
+  SegmentIndexType index_type() const;
+  const std::vector<ColumnID>& left_column_ids() const;
+  PredicateCondition predicate_condition() const;
+
   /**
    * @brief If set, only the specified chunks will be scanned.
    *
@@ -44,19 +72,44 @@ class IndexScan : public AbstractReadOnlyOperator {
       const std::shared_ptr<AbstractOperator>& copied_input_right) const override;
   void _on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) override;
 
+  void _on_cleanup() override;
+
   void _validate_input();
-  std::shared_ptr<AbstractTask> _create_job_and_schedule(const ChunkID chunk_id, std::mutex& output_mutex);
+  void _scan_chunk_into_output(const ChunkID chunk_id, std::mutex& output_mutex);
   PosList _scan_chunk(const ChunkID chunk_id);
+  PosList _scan_reference_chunk(const ChunkID chunk_id);
+  PosList _scan_table_hash_index();
+
+  // The predicate as an expression on the input table, for _scan_impl_without_index
+  std::shared_ptr<AbstractExpression> _predicate_without_index() const;
+
+  // Calls functor(range_begin, range_end) for the matching ranges of the chunk's index on column_ids. Returns false if
+  // the chunk has neither a regular index of _index_type nor (for a single column) a delta index.
+  template <typename Functor>
+  bool _for_each_index_range(const Chunk& chunk, const std::vector<ColumnID>& column_ids,
+                             const Functor& functor) const;
+
+  // Fallback for referenced chunks that are not searched on an index: removes the offsets of the input PosList whose
+  // referenced values do not satisfy the predicate
+  void _filter_without_index(const Chunk& referenced_chunk, const std::vector<ColumnID>& column_ids,
+                             const PosList& pos_list, std::vector<ChunkOffset>& input_offsets) const;
 
  private:
   const SegmentIndexType _index_type;
   const std::vector<ColumnID> _left_column_ids;
   const PredicateCondition _predicate_condition;
-  const std::vector<AllTypeVariant> _right_values;
-  const std::vector<AllTypeVariant> _right_values2;
+  std::vector<AllParameterVariant> _right_values;
+  std::vector<AllParameterVariant> _right_values2;
+
+  // _right_values and _right_values2 with all parameters resolved, set in _on_execute()
+  std::vector<AllTypeVariant> _search_values;
+  std::vector<AllTypeVariant> _search_values2;
 
   std::vector<ChunkID> _included_chunk_ids;
 
+  // Set in _on_execute() if the search values cannot be cast to the column types, used instead of the indexes
+  std::unique_ptr<AbstractTableScanImpl> _scan_impl_without_index;
+
   std::shared_ptr<const Table> _in_table;
   std::shared_ptr<Table> _out_table;
 };
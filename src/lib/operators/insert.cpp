@@ -8,6 +8,8 @@
 #include "concurrency/transaction_context.hpp"
 #include "resolve_type.hpp"
 #include "storage/base_encoded_segment.hpp"
+#include "storage/index/delta/delta_index.hpp"
+#include "storage/index/table_hash/table_hash_index.hpp"
 #include "storage/segment_iterate.hpp"
 #include "storage/storage_manager.hpp"
 #include "storage/value_segment.hpp"
@@ -91,6 +93,9 @@ std::shared_ptr<const Table> Insert::_on_execute(std::shared_ptr<TransactionCont
            "Cannot handle inserts into column of different type");
   }
 
+  // Delta indexes must not be created while new rows are still being written (see Table::create_index())
+  auto index_creation_lock = _target_table->acquire_index_creation_mutex();
+
   /**
    * 1. Allocate the required rows in the target Table, without actually copying data to them.
    *    Do so while locking the table to prevent multiple threads modifying the table's size simultaneously.
@@ -121,7 +126,7 @@ std::shared_ptr<const Table> Insert::_on_execute(std::shared_ptr<TransactionCont
           std::min<size_t>(_target_table->max_chunk_size() - target_chunk->size(), remaining_rows);
 
       _target_chunk_ranges.emplace_back(
-          ChunkRange{target_chunk_id, target_chunk->size(),
+          ChunkOffsetRange{target_chunk_id, target_chunk->size(),
                      static_cast<ChunkOffset>(target_chunk->size() + num_rows_for_target_chunk)});
 
       // Grow MVCC vectors and mark new (but still empty) rows as being under modification by current transaction.
@@ -205,6 +210,41 @@ std::shared_ptr<const Table> Insert::_on_execute(std::shared_ptr<TransactionCont
     }
   }
 
+  /**
+   * 3. Add the new rows to the delta indexes of the target chunks and to the table-wide hash indexes. This happens
+   *    only after the data was written so that a concurrent lookup never returns a row that still has to be filled.
+   *    Until the commit, the rows are invisible to other transactions anyway.
+   */
+  for (const auto& target_chunk_range : _target_chunk_ranges) {
+    const auto target_chunk = _target_table->get_chunk(target_chunk_range.chunk_id);
+    for (const auto& delta_index : target_chunk->delta_indexes()) {
+      delta_index->insert(*target_chunk->get_segment(delta_index->column_id()), target_chunk_range.begin_chunk_offset,
+                          target_chunk_range.end_chunk_offset);
+    }
+  }
+
+  for (const auto& table_hash_index : _target_table->table_hash_indexes()) {
+    for (const auto& target_chunk_range : _target_chunk_ranges) {
+      const auto target_chunk = _target_table->get_chunk(target_chunk_range.chunk_id);
+      table_hash_index->insert(target_chunk_range.chunk_id, *target_chunk->get_segment(table_hash_index->column_id()),
+                               target_chunk_range.begin_chunk_offset, target_chunk_range.end_chunk_offset);
+    }
+  }
+
+  index_creation_lock.unlock();
+
+  /**
+   * 4. Check the UNIQUE and PRIMARY KEY constraints. The new rows are already in place, so that a concurrent Insert of
+   *    the same key finds them, even before this transaction commits. If a constraint is violated, the transaction
+   *    has to be rolled back, which also invalidates the new rows.
+   */
+  for (const auto& constraint : _target_table->get_unique_constraints()) {
+    if (!unique_constraint_satisfied(*_target_table, constraint, _target_chunk_ranges, context->transaction_id())) {
+      _mark_as_failed();
+      return nullptr;
+    }
+  }
+
   return nullptr;
 }
 
@@ -254,6 +294,16 @@ void Insert::_on_rollback_records() {
       mvcc_data->tids[chunk_offset] = 0u;
     }
   }
+
+  // The rolled-back rows will never become visible, so there is no need to keep them in the table-wide hash indexes.
+  // Delta indexes keep them, just like chunk indexes keep invalidated rows.
+  for (const auto& table_hash_index : _target_table->table_hash_indexes()) {
+    for (const auto& target_chunk_range : _target_chunk_ranges) {
+      const auto target_chunk = _target_table->get_chunk(target_chunk_range.chunk_id);
+      table_hash_index->erase(target_chunk_range.chunk_id, *target_chunk->get_segment(table_hash_index->column_id()),
+                              target_chunk_range.begin_chunk_offset, target_chunk_range.end_chunk_offset);
+    }
+  }
 }
 
 std::shared_ptr<AbstractOperator> Insert::_on_deep_copy(
@@ -6,6 +6,7 @@
 
 #include "abstract_read_write_operator.hpp"
 #include "storage/pos_list.hpp"
+#include "storage/unique_constraint_checker.hpp"
 #include "utils/assert.hpp"
 
 namespace opossum {
@@ -18,6 +19,9 @@ class TransactionContext;
  * the values to insert in a separate table using the same column layout.
  *
  * Assumption: The input has been validated before.
+ *
+ * The execution fails if the new rows violate a UNIQUE or PRIMARY KEY constraint of the table (see
+ * Table::add_unique_constraint).
  */
 class Insert : public AbstractReadWriteOperator {
  public:
@@ -39,12 +43,7 @@ class Insert : public AbstractReadWriteOperator {
   const std::string _target_table_name;
 
   // Ranges of rows to which the inserted values are written
-  struct ChunkRange {
-    ChunkID chunk_id{};
-    ChunkOffset begin_chunk_offset{};
-    ChunkOffset end_chunk_offset{};
-  };
-  std::vector<ChunkRange> _target_chunk_ranges;
+  std::vector<ChunkOffsetRange> _target_chunk_ranges;
 
   std::shared_ptr<Table> _target_table;
 };
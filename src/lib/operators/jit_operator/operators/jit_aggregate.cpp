@@ -219,6 +219,8 @@ void JitAggregate::add_aggregate_column(const std::string& column_name, const Ji
       break;
     case AggregateFunction::CountDistinct:
       Fail("Aggregate function count distinct not supported");
+    case AggregateFunction::Any:
+      Fail("Aggregate function any not supported");
   }
 }
 
@@ -315,6 +317,9 @@ void JitAggregate::_consume(JitRuntimeContext& context) const {
         case AggregateFunction::CountDistinct: {
           Fail("Aggregate function count distinct not supported");
         }
+        case AggregateFunction::Any: {
+          Fail("Aggregate function any not supported");
+        }
       }
     }
 
@@ -352,6 +357,9 @@ void JitAggregate::_consume(JitRuntimeContext& context) const {
       case AggregateFunction::CountDistinct: {
         Fail("Aggregate function count distinct not supported");
       }
+      case AggregateFunction::Any: {
+        Fail("Aggregate function any not supported");
+      }
     }
   }
 }
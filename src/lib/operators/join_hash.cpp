@@ -15,6 +15,7 @@
 #include "scheduler/abstract_task.hpp"
 #include "scheduler/current_scheduler.hpp"
 #include "scheduler/job_task.hpp"
+#include "scheduler/topology.hpp"
 #include "type_comparison.hpp"
 #include "utils/assert.hpp"
 #include "utils/timer.hpp"
@@ -201,8 +202,7 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
       Setting number of bits for radix clustering:
       The number of bits is used to create probe partitions with a size that can
       be expected to fit into the L2 cache.
-      This should incorporate hardware knowledge, once available in Hyrise.
-      As of now, we assume a L2 cache size of 256 KB.
+      The L2 cache size is read from the Topology, which assumes 256 KB if the size is unknown.
       We estimate the size the following way:
         - we assume each key appears once (that is an overestimation space-wise, but we
         aim rather for a hash map that is slightly smaller than L2 than slightly larger)
@@ -221,7 +221,7 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
       PerformanceWarning("Build relation larger than probe relation in hash join");
     }
 
-    const auto l2_cache_size = 256'000;  // bytes
+    const auto l2_cache_size = static_cast<double>(Topology::get().l2_cache_size());  // bytes
 
     // To get a pessimistic estimation (ensure that the hash table fits within the cache), we assume
     // that each value maps to a PosList with a single RowID. For the used small_vector's, we assume a
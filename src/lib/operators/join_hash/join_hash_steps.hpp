@@ -3,7 +3,10 @@
 #include <boost/container/small_vector.hpp>
 #include <boost/lexical_cast.hpp>
 
+#include <numeric>
+
 #include "bytell_hash_map.hpp"
+#include "operators/morsel.hpp"
 #include "operators/multi_predicate_join/multi_predicate_join_evaluator.hpp"
 #include "resolve_type.hpp"
 #include "scheduler/abstract_task.hpp"
@@ -109,81 +112,81 @@ RadixContainer<T> materialize_input(const std::shared_ptr<const Table>& in_table
   // create histograms per chunk
   histograms.resize(chunk_offsets.size());
 
-  std::vector<std::shared_ptr<AbstractTask>> jobs;
-  jobs.reserve(in_table->chunk_count());
+  auto chunk_ids = std::vector<ChunkID>(in_table->chunk_count());
+  std::iota(chunk_ids.begin(), chunk_ids.end(), ChunkID{0});
 
-  for (ChunkID chunk_id{0}; chunk_id < in_table->chunk_count(); ++chunk_id) {
-    jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id]() {
-      // Get information from work queue
-      auto output_offset = chunk_offsets[chunk_id];
-      auto output_iterator = elements->begin() + output_offset;
-      auto segment = in_table->get_chunk(chunk_id)->get_segment(column_id);
+  // Small chunks are materialized by the same job. The histograms are still created per chunk.
+  const auto morsels = split_into_morsels(*in_table, chunk_ids);
+  process_morsels(morsels, [&](const size_t morsel_idx) {
+    const auto chunk_id = morsels[morsel_idx].chunk_id;
 
-      [[maybe_unused]] auto null_value_bitvector_iterator = null_value_bitvector->begin();
-      if constexpr (retain_null_values) {
-        null_value_bitvector_iterator += output_offset;
-      }
+    // Get information from work queue
+    auto output_offset = chunk_offsets[chunk_id];
+    auto output_iterator = elements->begin() + output_offset;
+    auto segment = in_table->get_chunk(chunk_id)->get_segment(column_id);
 
-      // prepare histogram
-      auto histogram = std::vector<size_t>(num_partitions);
+    [[maybe_unused]] auto null_value_bitvector_iterator = null_value_bitvector->begin();
+    if constexpr (retain_null_values) {
+      null_value_bitvector_iterator += output_offset;
+    }
 
-      auto reference_chunk_offset = ChunkOffset{0};
+    // prepare histogram
+    auto histogram = std::vector<size_t>(num_partitions);
 
-      segment_with_iterators<T>(*segment, [&](auto it, const auto end) {
-        using IterableType = typename decltype(it)::IterableType;
+    auto reference_chunk_offset = ChunkOffset{0};
 
-        while (it != end) {
-          const auto& value = *it;
-          ++it;
+    segment_with_iterators<T>(*segment, [&](auto it, const auto end) {
+      using IterableType = typename decltype(it)::IterableType;
 
-          if (!value.is_null() || retain_null_values) {
-            // TODO(anyone): static_cast is almost always safe, since HashType is big enough. Only for double-vs-long
-            // joins an information loss is possible when joining with longs that cannot be losslessly converted to
-            // double
-            const Hash hashed_value = hash_function(static_cast<HashedType>(value.value()));
+      while (it != end) {
+        const auto& value = *it;
+        ++it;
 
-            /*
-            For ReferenceSegments we do not use the RowIDs from the referenced tables.
-            Instead, we use the index in the ReferenceSegment itself. This way we can later correctly dereference
-            values from different inputs (important for Multi Joins).
-            */
-            if constexpr (is_reference_segment_iterable_v<IterableType>) {
-              *(output_iterator++) = PartitionedElement<T>{RowID{chunk_id, reference_chunk_offset}, value.value()};
-            } else {
-              *(output_iterator++) = PartitionedElement<T>{RowID{chunk_id, value.chunk_offset()}, value.value()};
-            }
+        if (!value.is_null() || retain_null_values) {
+          // TODO(anyone): static_cast is almost always safe, since HashType is big enough. Only for double-vs-long
+          // joins an information loss is possible when joining with longs that cannot be losslessly converted to
+          // double
+          const Hash hashed_value = hash_function(static_cast<HashedType>(value.value()));
 
-            // In case we care about NULL values, store the NULL flag
-            if constexpr (retain_null_values) {
-              if (value.is_null()) {
-                *null_value_bitvector_iterator = true;
-              }
-            }
-
-            const Hash radix = hashed_value & mask;
-            ++histogram[radix];
-            ++null_value_bitvector_iterator;
-          }
-          // reference_chunk_offset is only used for ReferenceSegments
+          /*
+          For ReferenceSegments we do not use the RowIDs from the referenced tables.
+          Instead, we use the index in the ReferenceSegment itself. This way we can later correctly dereference
+          values from different inputs (important for Multi Joins).
+          */
           if constexpr (is_reference_segment_iterable_v<IterableType>) {
-            ++reference_chunk_offset;
+            *(output_iterator++) = PartitionedElement<T>{RowID{chunk_id, reference_chunk_offset}, value.value()};
+          } else {
+            *(output_iterator++) = PartitionedElement<T>{RowID{chunk_id, value.chunk_offset()}, value.value()};
+          }
+
+          // In case we care about NULL values, store the NULL flag
+          if constexpr (retain_null_values) {
+            if (value.is_null()) {
+              *null_value_bitvector_iterator = true;
+            }
           }
-        }
-      });
 
-      if constexpr (std::is_same_v<Partition<T>, uninitialized_vector<PartitionedElement<T>>>) {  // NOLINT
-        // Because the vector is uninitialized, we need to manually fill up all slots that we did not use
-        auto output_offset_end = chunk_id < chunk_offsets.size() - 1 ? chunk_offsets[chunk_id + 1] : elements->size();
-        while (output_iterator != elements->begin() + output_offset_end) {
-          *(output_iterator++) = PartitionedElement<T>{};
+          const Hash radix = hashed_value & mask;
+          ++histogram[radix];
+          ++null_value_bitvector_iterator;
+        }
+        // reference_chunk_offset is only used for ReferenceSegments
+        if constexpr (is_reference_segment_iterable_v<IterableType>) {
+          ++reference_chunk_offset;
         }
       }
+    });
 
-      histograms[chunk_id] = std::move(histogram);
-    }));
-    jobs.back()->schedule();
-  }
-  CurrentScheduler::wait_for_tasks(jobs);
+    if constexpr (std::is_same_v<Partition<T>, uninitialized_vector<PartitionedElement<T>>>) {  // NOLINT
+      // Because the vector is uninitialized, we need to manually fill up all slots that we did not use
+      auto output_offset_end = chunk_id < chunk_offsets.size() - 1 ? chunk_offsets[chunk_id + 1] : elements->size();
+      while (output_iterator != elements->begin() + output_offset_end) {
+        *(output_iterator++) = PartitionedElement<T>{};
+      }
+    }
+
+    histograms[chunk_id] = std::move(histogram);
+  });
 
   return RadixContainer<T>{elements, std::vector<size_t>{elements->size()}, null_value_bitvector};
 }
@@ -221,7 +224,7 @@ std::vector<std::optional<HashTable<HashedType>>> build(const RadixContainer<Bui
       continue;
     }
 
-    jobs.emplace_back(std::make_shared<JobTask>(
+    jobs.emplace_back(JobTask::make(
         [&, build_partition_begin, build_partition_end, current_partition_id, build_partition_size]() {
           auto& build_partition = static_cast<Partition<BuildColumnType>&>(*radix_container.elements);
 
@@ -250,10 +253,9 @@ std::vector<std::optional<HashTable<HashedType>>> build(const RadixContainer<Bui
 
           hashtables[current_partition_id] = std::move(hashtable);
         }));
-    jobs.back()->schedule();
   }
 
-  CurrentScheduler::wait_for_tasks(jobs);
+  CurrentScheduler::schedule_and_wait_for_tasks(jobs);
 
   return hashtables;
 }
@@ -310,7 +312,7 @@ RadixContainer<T> partition_radix_parallel(const RadixContainer<T>& radix_contai
   jobs.reserve(chunk_offsets.size());
 
   for (ChunkID chunk_id{0}; chunk_id < chunk_offsets.size(); ++chunk_id) {
-    jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id]() {
+    jobs.emplace_back(JobTask::make([&, chunk_id]() {
       size_t input_offset = chunk_offsets[chunk_id];
       auto& output_offsets = output_offsets_by_chunk[chunk_id];
 
@@ -345,10 +347,9 @@ RadixContainer<T> partition_radix_parallel(const RadixContainer<T>& radix_contai
         ++output_offsets[radix];
       }
     }));
-    jobs.back()->schedule();
   }
 
-  CurrentScheduler::wait_for_tasks(jobs);
+  CurrentScheduler::schedule_and_wait_for_tasks(jobs);
 
   return radix_output;
 }
@@ -385,7 +386,7 @@ void probe(const RadixContainer<ProbeColumnType>& probe_radix_container,
       continue;
     }
 
-    jobs.emplace_back(std::make_shared<JobTask>([&, partition_begin, partition_end, current_partition_id]() {
+    jobs.emplace_back(JobTask::make([&, partition_begin, partition_end, current_partition_id]() {
       // Get information from work queue
       auto& partition = static_cast<Partition<ProbeColumnType>&>(*probe_radix_container.elements);
       PosList pos_list_build_side_local;
@@ -503,10 +504,9 @@ void probe(const RadixContainer<ProbeColumnType>& probe_radix_container,
       pos_lists_build_side[current_partition_id] = std::move(pos_list_build_side_local);
       pos_lists_probe_side[current_partition_id] = std::move(pos_list_probe_local);
     }));
-    jobs.back()->schedule();
   }
 
-  CurrentScheduler::wait_for_tasks(jobs);
+  CurrentScheduler::schedule_and_wait_for_tasks(jobs);
 }
 
 template <typename ProbeColumnType, typename HashedType, JoinMode mode>
@@ -531,7 +531,7 @@ void probe_semi_anti(const RadixContainer<ProbeColumnType>& radix_probe_column,
       continue;
     }
 
-    jobs.emplace_back(std::make_shared<JobTask>([&, partition_begin, partition_end, current_partition_id]() {
+    jobs.emplace_back(JobTask::make([&, partition_begin, partition_end, current_partition_id]() {
       // Get information from work queue
       auto& partition = static_cast<Partition<ProbeColumnType>&>(*radix_probe_column.elements);
 
@@ -613,10 +613,9 @@ void probe_semi_anti(const RadixContainer<ProbeColumnType>& radix_probe_column,
 
       pos_lists[current_partition_id] = std::move(pos_list_local);
     }));
-    jobs.back()->schedule();
   }
 
-  CurrentScheduler::wait_for_tasks(jobs);
+  CurrentScheduler::schedule_and_wait_for_tasks(jobs);
 }
 
 using PosLists = std::vector<std::shared_ptr<const PosList>>;
@@ -1,10 +1,14 @@
 #include "join_index.hpp"
 
+#include <algorithm>
+#include <cmath>
+#include <iterator>
 #include <map>
 #include <memory>
 #include <numeric>
 #include <set>
 #include <string>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -12,12 +16,29 @@
 #include "join_nested_loop.hpp"
 #include "multi_predicate_join/multi_predicate_join_evaluator.hpp"
 #include "resolve_type.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
 #include "storage/index/base_index.hpp"
 #include "storage/segment_iterate.hpp"
 #include "type_comparison.hpp"
 #include "utils/assert.hpp"
 #include "utils/performance_warning.hpp"
 
+namespace {
+
+// NaN is neither equal to, less than, nor greater than any value, so it cannot be sorted or searched in an index
+template <typename T>
+bool is_nan(const T& value) {
+  if constexpr (std::is_floating_point_v<T>) {
+    return std::isnan(value);
+  } else {
+    return false;
+  }
+}
+
+}  // namespace
+
 namespace opossum {
 
 /*
@@ -79,7 +100,7 @@ std::shared_ptr<const Table> JoinIndex::_on_execute() {
   _pos_list_left = std::make_shared<PosList>();
   _pos_list_right = std::make_shared<PosList>();
 
-  auto pos_list_size_to_reserve =
+  const auto pos_list_size_to_reserve =
       std::max(uint64_t{100}, std::min(input_table_left()->row_count(), input_table_right()->row_count()));
 
   _pos_list_left->reserve(pos_list_size_to_reserve);
@@ -87,56 +108,43 @@ std::shared_ptr<const Table> JoinIndex::_on_execute() {
 
   auto& performance_data = static_cast<PerformanceData&>(*_performance_data);
 
-  auto secondary_predicate_evaluator =
-      MultiPredicateJoinEvaluator{*input_table_left(), *input_table_right(), _mode, {}};
-
-  // Scan all chunks for right input
+  // Look up the index of each right chunk once, the jobs share them
+  auto right_indexes = std::vector<std::shared_ptr<BaseIndex>>(input_table_right()->chunk_count());
   for (ChunkID chunk_id_right = ChunkID{0}; chunk_id_right < input_table_right()->chunk_count(); ++chunk_id_right) {
     const auto chunk_right = input_table_right()->get_chunk(chunk_id_right);
     const auto indices = chunk_right->get_indices(std::vector<ColumnID>{_primary_predicate.column_ids.second});
-    std::shared_ptr<BaseIndex> index = nullptr;
 
     if (!indices.empty()) {
       // We assume the first index to be efficient for our join
       // as we do not want to spend time on evaluating the best index inside of this join loop
-      index = indices.front();
-    }
-
-    // Scan all chunks from left input
-    if (index) {
-      for (ChunkID chunk_id_left = ChunkID{0}; chunk_id_left < input_table_left()->chunk_count(); ++chunk_id_left) {
-        const auto segment_left =
-            input_table_left()->get_chunk(chunk_id_left)->get_segment(_primary_predicate.column_ids.first);
-
-        segment_with_iterators(*segment_left, [&](auto it, const auto end) {
-          _join_two_segments_using_index(it, end, chunk_id_left, chunk_id_right, index);
-        });
-      }
+      right_indexes[chunk_id_right] = indices.front();
       performance_data.chunks_scanned_with_index++;
     } else {
-      // Fall back to NestedLoopJoin
-      const auto segment_right =
-          input_table_right()->get_chunk(chunk_id_right)->get_segment(_primary_predicate.column_ids.second);
-      for (ChunkID chunk_id_left = ChunkID{0}; chunk_id_left < input_table_left()->chunk_count(); ++chunk_id_left) {
-        const auto segment_left =
-            input_table_left()->get_chunk(chunk_id_left)->get_segment(_primary_predicate.column_ids.first);
-        JoinNestedLoop::JoinParams params{*_pos_list_left,
-                                          *_pos_list_right,
-                                          _left_matches[chunk_id_left],
-                                          _right_matches[chunk_id_right],
-                                          track_left_matches,
-                                          track_right_matches,
-                                          _mode,
-                                          _primary_predicate.predicate_condition,
-                                          secondary_predicate_evaluator,
-                                          !is_semi_or_anti_join};
-        JoinNestedLoop::_join_two_untyped_segments(*segment_left, *segment_right, chunk_id_left, chunk_id_right,
-                                                   params);
-      }
       performance_data.chunks_scanned_without_index++;
     }
   }
 
+  // Join each left chunk with all right chunks in its own job
+  auto results = std::vector<LeftChunkJoinResult>(input_table_left()->chunk_count());
+  std::mutex right_matches_mutex;
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(input_table_left()->chunk_count());
+  for (ChunkID chunk_id_left = ChunkID{0}; chunk_id_left < input_table_left()->chunk_count(); ++chunk_id_left) {
+    jobs.emplace_back(JobTask::make([&, chunk_id_left]() {
+      _join_left_chunk(chunk_id_left, right_indexes, results[chunk_id_left], right_matches_mutex);
+    }));
+  }
+
+  CurrentScheduler::schedule_and_wait_for_tasks(jobs);
+
+  for (const auto& result : results) {
+    _pos_list_left->insert(_pos_list_left->end(), result.pos_list_left.cbegin(), result.pos_list_left.cend());
+    _pos_list_right->insert(_pos_list_right->end(), result.pos_list_right.cbegin(), result.pos_list_right.cend());
+    performance_data.probe_values += result.probe_values;
+    performance_data.index_lookups += result.index_lookups;
+  }
+
   // For Full Outer and Left Join we need to add all unmatched rows for the left side
   if (_mode == JoinMode::Left || _mode == JoinMode::FullOuter) {
     for (ChunkID chunk_id_left = ChunkID{0}; chunk_id_left < input_table_left()->chunk_count(); ++chunk_id_left) {
@@ -197,89 +205,194 @@ std::shared_ptr<const Table> JoinIndex::_on_execute() {
   return _build_output_table({std::make_shared<Chunk>(output_segments)});
 }
 
-// join loop that joins two segments of two columns using an iterator for the left, and an index for the right
-template <typename LeftIterator>
-void JoinIndex::_join_two_segments_using_index(LeftIterator left_it, LeftIterator left_end, const ChunkID chunk_id_left,
-                                               const ChunkID chunk_id_right, const std::shared_ptr<BaseIndex>& index) {
-  for (; left_it != left_end; ++left_it) {
-    const auto left_value = *left_it;
-    if (left_value.is_null()) continue;
+void JoinIndex::_join_left_chunk(const ChunkID chunk_id_left,
+                                 const std::vector<std::shared_ptr<BaseIndex>>& right_indexes,
+                                 LeftChunkJoinResult& result, std::mutex& right_matches_mutex) {
+  const auto is_semi_or_anti_join =
+      _mode == JoinMode::Semi || _mode == JoinMode::AntiNullAsFalse || _mode == JoinMode::AntiNullAsTrue;
+
+  const auto track_left_matches = _mode == JoinMode::FullOuter || _mode == JoinMode::Left || is_semi_or_anti_join;
+  const auto track_right_matches = _mode == JoinMode::FullOuter || _mode == JoinMode::Right;
+
+  // Matches of the right side are collected per job and merged into _right_matches at the end
+  auto right_matches = std::vector<std::vector<bool>>(_right_matches.size());
+  if (track_right_matches) {
+    for (ChunkID chunk_id_right = ChunkID{0}; chunk_id_right < _right_matches.size(); ++chunk_id_right) {
+      right_matches[chunk_id_right].resize(_right_matches[chunk_id_right].size());
+    }
+  }
+
+  // Accessors are not thread-safe, so we create one evaluator per job
+  auto secondary_predicate_evaluator =
+      MultiPredicateJoinEvaluator{*input_table_left(), *input_table_right(), _mode, {}};
+
+  const auto segment_left =
+      input_table_left()->get_chunk(chunk_id_left)->get_segment(_primary_predicate.column_ids.first);
+  const auto has_index = std::any_of(right_indexes.cbegin(), right_indexes.cend(),
+                                     [](const auto& index) { return static_cast<bool>(index); });
+
+  resolve_data_type(segment_left->data_type(), [&](auto type) {
+    using ProbeValue = typename decltype(type)::type;
+
+    // Sorting the probe values lets equal values share one index lookup and makes consecutive lookups traverse
+    // neighboring parts of the index
+    auto probe_values = std::vector<std::pair<ProbeValue, ChunkOffset>>{};
+    if (has_index) {
+      probe_values.reserve(segment_left->size());
+      segment_with_iterators<ProbeValue>(*segment_left, [&](auto it, const auto end) {
+        for (; it != end; ++it) {
+          if (it->is_null()) continue;
+          probe_values.emplace_back(it->value(), it->chunk_offset());
+        }
+      });
+
+      // NaN values are moved behind the other values, which are sorted
+      const auto nan_begin = std::partition(probe_values.begin(), probe_values.end(),
+                                            [](const auto& probe_value) { return !is_nan(probe_value.first); });
+      std::sort(probe_values.begin(), nan_begin);
+    }
+
+    for (ChunkID chunk_id_right = ChunkID{0}; chunk_id_right < right_indexes.size(); ++chunk_id_right) {
+      if (right_indexes[chunk_id_right]) {
+        _join_probe_values_using_index(probe_values, chunk_id_left, chunk_id_right, *right_indexes[chunk_id_right],
+                                       result, right_matches[chunk_id_right]);
+      } else {
+        // Fall back to NestedLoopJoin
+        const auto segment_right =
+            input_table_right()->get_chunk(chunk_id_right)->get_segment(_primary_predicate.column_ids.second);
+        JoinNestedLoop::JoinParams params{result.pos_list_left,
+                                          result.pos_list_right,
+                                          _left_matches[chunk_id_left],
+                                          right_matches[chunk_id_right],
+                                          track_left_matches,
+                                          track_right_matches,
+                                          _mode,
+                                          _primary_predicate.predicate_condition,
+                                          secondary_predicate_evaluator,
+                                          !is_semi_or_anti_join};
+        JoinNestedLoop::_join_two_untyped_segments(*segment_left, *segment_right, chunk_id_left, chunk_id_right,
+                                                   params);
+      }
+    }
+  });
+
+  if (track_right_matches) {
+    std::lock_guard<std::mutex> lock(right_matches_mutex);
+    for (ChunkID chunk_id_right = ChunkID{0}; chunk_id_right < right_matches.size(); ++chunk_id_right) {
+      for (ChunkOffset chunk_offset{0}; chunk_offset < right_matches[chunk_id_right].size(); ++chunk_offset) {
+        if (right_matches[chunk_id_right][chunk_offset]) _right_matches[chunk_id_right][chunk_offset] = true;
+      }
+    }
+  }
+}
+
+template <typename ProbeValue>
+void JoinIndex::_join_probe_values_using_index(const std::vector<std::pair<ProbeValue, ChunkOffset>>& probe_values,
+                                               const ChunkID chunk_id_left, const ChunkID chunk_id_right,
+                                               const BaseIndex& index, LeftChunkJoinResult& result,
+                                               std::vector<bool>& right_matches) {
+  result.probe_values += probe_values.size();
+
+  // For the usage statistics of the index, see BaseIndex::record_lookups()
+  const auto indexed_row_count = index.get_indexed_segments()[0]->size();
+  auto lookup_count = size_t{0};
+  auto matched_row_count = size_t{0};
+
+  for (auto run_begin = probe_values.cbegin(); run_begin != probe_values.cend();) {
+    // All left rows with the same value share one index lookup. As NaN != NaN, each NaN forms a run of its own.
+    const auto& value = run_begin->first;
+    const auto run_end = std::find_if(std::next(run_begin), probe_values.cend(),
+                                      [&](const auto& probe_value) { return probe_value.first != value; });
+    ++result.index_lookups;
+    ++lookup_count;
+
+    const auto search_values = std::vector<AllTypeVariant>{AllTypeVariant{value}};
+
+    const auto append_matches = [&](const BaseIndex::Iterator& range_begin, const BaseIndex::Iterator& range_end) {
+      matched_row_count += std::distance(range_begin, range_end);
+      for (auto probe_iter = run_begin; probe_iter != run_end; ++probe_iter) {
+        _append_matches(range_begin, range_end, probe_iter->second, chunk_id_left, chunk_id_right, result,
+                        right_matches);
+      }
+    };
 
-    auto range_begin = BaseIndex::Iterator{};
-    auto range_end = BaseIndex::Iterator{};
+    // NaN is only unequal to all values
+    if (is_nan(value)) {
+      if (_primary_predicate.predicate_condition == PredicateCondition::NotEquals) {
+        append_matches(index.cbegin(), index.cend());
+      }
+      run_begin = run_end;
+      continue;
+    }
 
     switch (_primary_predicate.predicate_condition) {
       case PredicateCondition::Equals: {
-        range_begin = index->lower_bound({left_value.value()});
-        range_end = index->upper_bound({left_value.value()});
+        append_matches(index.lower_bound(search_values), index.upper_bound(search_values));
         break;
       }
       case PredicateCondition::NotEquals: {
-        // first, get all values less than the search value
-        range_begin = index->cbegin();
-        range_end = index->lower_bound({left_value.value()});
-
-        _append_matches(range_begin, range_end, left_value.chunk_offset(), chunk_id_left, chunk_id_right);
-
-        // set range for second half to all values greater than the search value
-        range_begin = index->upper_bound({left_value.value()});
-        range_end = index->cend();
+        // all values less than the search value and all values greater than the search value
+        append_matches(index.cbegin(), index.lower_bound(search_values));
+        append_matches(index.upper_bound(search_values), index.cend());
         break;
       }
       case PredicateCondition::GreaterThan: {
-        range_begin = index->cbegin();
-        range_end = index->lower_bound({left_value.value()});
+        append_matches(index.cbegin(), index.lower_bound(search_values));
         break;
       }
       case PredicateCondition::GreaterThanEquals: {
-        range_begin = index->cbegin();
-        range_end = index->upper_bound({left_value.value()});
+        append_matches(index.cbegin(), index.upper_bound(search_values));
         break;
       }
       case PredicateCondition::LessThan: {
-        range_begin = index->upper_bound({left_value.value()});
-        range_end = index->cend();
+        append_matches(index.upper_bound(search_values), index.cend());
         break;
       }
       case PredicateCondition::LessThanEquals: {
-        range_begin = index->lower_bound({left_value.value()});
-        range_end = index->cend();
+        append_matches(index.lower_bound(search_values), index.cend());
         break;
       }
       default:
         Fail("Unsupported comparison type encountered");
     }
 
-    _append_matches(range_begin, range_end, left_value.chunk_offset(), chunk_id_left, chunk_id_right);
+    run_begin = run_end;
   }
+
+  index.record_lookups(lookup_count, lookup_count * indexed_row_count - matched_row_count);
 }
 
 void JoinIndex::_append_matches(const BaseIndex::Iterator& range_begin, const BaseIndex::Iterator& range_end,
                                 const ChunkOffset chunk_offset_left, const ChunkID chunk_id_left,
-                                const ChunkID chunk_id_right) {
+                                const ChunkID chunk_id_right, LeftChunkJoinResult& result,
+                                std::vector<bool>& right_matches) {
   const auto num_right_matches = std::distance(range_begin, range_end);
 
   if (num_right_matches == 0) {
     return;
   }
 
-  // Remember the matches for outer joins
-  if (_mode == JoinMode::Left || _mode == JoinMode::FullOuter) {
+  const auto is_semi_or_anti_join =
+      _mode == JoinMode::Semi || _mode == JoinMode::AntiNullAsFalse || _mode == JoinMode::AntiNullAsTrue;
+
+  // Remember the matches for outer joins. Semi and anti joins write their output based on these matches only.
+  if (_mode == JoinMode::Left || _mode == JoinMode::FullOuter || is_semi_or_anti_join) {
     _left_matches[chunk_id_left][chunk_offset_left] = true;
   }
 
+  if (is_semi_or_anti_join) return;
+
   // we replicate the left value for each right value
-  std::fill_n(std::back_inserter(*_pos_list_left), num_right_matches, RowID{chunk_id_left, chunk_offset_left});
+  std::fill_n(std::back_inserter(result.pos_list_left), num_right_matches, RowID{chunk_id_left, chunk_offset_left});
 
-  std::transform(range_begin, range_end, std::back_inserter(*_pos_list_right),
+  std::transform(range_begin, range_end, std::back_inserter(result.pos_list_right),
                  [chunk_id_right](ChunkOffset chunk_offset_right) {
                    return RowID{chunk_id_right, chunk_offset_right};
                  });
 
   if (_mode == JoinMode::FullOuter || _mode == JoinMode::Right) {
-    std::for_each(range_begin, range_end, [this, chunk_id_right](ChunkOffset chunk_offset_right) {
-      _right_matches[chunk_id_right][chunk_offset_right] = true;
-    });
+    std::for_each(range_begin, range_end,
+                  [&right_matches](ChunkOffset chunk_offset_right) { right_matches[chunk_offset_right] = true; });
   }
 }
 
@@ -345,6 +458,8 @@ void JoinIndex::PerformanceData::output_to_stream(std::ostream& stream, Descript
   stream << (description_mode == DescriptionMode::SingleLine ? " / " : "\\n");
   stream << std::to_string(chunks_scanned_with_index) << " of "
          << std::to_string(chunks_scanned_with_index + chunks_scanned_without_index) << " chunks used an index";
+  stream << (description_mode == DescriptionMode::SingleLine ? " / " : "\\n");
+  stream << std::to_string(index_lookups) << " index lookups for " << std::to_string(probe_values) << " probe values";
 }
 
 }  // namespace opossum
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <mutex>
 #include <set>
 #include <string>
 #include <utility>
@@ -18,6 +19,10 @@ namespace opossum {
    * finding the right values utilizing the index.
    *
    * Note: An index needs to be present on the right table in order to execute an index join.
+   *
+   * Each chunk of the left input is joined by its own JobTask. Its values are sorted and deduplicated before probing
+   * the indexes, so that each distinct value is looked up only once per right chunk and consecutive lookups traverse
+   * neighboring parts of the index.
    */
 class JoinIndex : public AbstractJoinOperator {
  public:
@@ -34,6 +39,11 @@ class JoinIndex : public AbstractJoinOperator {
     size_t chunks_scanned_with_index{0};
     size_t chunks_scanned_without_index{0};
 
+    // Non-NULL left values probed against indexed right chunks, and the index lookups that were actually performed.
+    // The difference is saved by batching equal probe values.
+    size_t probe_values{0};
+    size_t index_lookups{0};
+
     void output_to_stream(std::ostream& stream, DescriptionMode description_mode) const override;
   };
 
@@ -45,19 +55,27 @@ class JoinIndex : public AbstractJoinOperator {
       const std::shared_ptr<AbstractOperator>& copied_input_right) const override;
   void _on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) override;
 
-  void _perform_join();
+  // Output of joining one chunk of the left input with all chunks of the right input
+  struct LeftChunkJoinResult {
+    PosList pos_list_left;
+    PosList pos_list_right;
+    size_t probe_values{0};
+    size_t index_lookups{0};
+  };
 
-  template <typename LeftIterator>
-  void _join_two_segments_using_index(LeftIterator left_it, LeftIterator left_end, const ChunkID chunk_id_left,
-                                      const ChunkID chunk_id_right, const std::shared_ptr<BaseIndex>& index);
+  void _join_left_chunk(const ChunkID chunk_id_left, const std::vector<std::shared_ptr<BaseIndex>>& right_indexes,
+                        LeftChunkJoinResult& result, std::mutex& right_matches_mutex);
 
-  template <typename BinaryFunctor, typename LeftIterator, typename RightIterator>
-  void _join_two_segments_nested_loop(const BinaryFunctor& func, LeftIterator left_it, LeftIterator left_end,
-                                      RightIterator right_begin, RightIterator right_end, const ChunkID chunk_id_left,
-                                      const ChunkID chunk_id_right);
+  // Joins the (sorted) non-NULL values of a left chunk with the indexed right chunk
+  template <typename ProbeValue>
+  void _join_probe_values_using_index(const std::vector<std::pair<ProbeValue, ChunkOffset>>& probe_values,
+                                      const ChunkID chunk_id_left, const ChunkID chunk_id_right,
+                                      const BaseIndex& index, LeftChunkJoinResult& result,
+                                      std::vector<bool>& right_matches);
 
   void _append_matches(const BaseIndex::Iterator& range_begin, const BaseIndex::Iterator& range_end,
-                       const ChunkOffset chunk_offset_left, const ChunkID chunk_id_left, const ChunkID chunk_id_right);
+                       const ChunkOffset chunk_offset_left, const ChunkID chunk_id_left, const ChunkID chunk_id_right,
+                       LeftChunkJoinResult& result, std::vector<bool>& right_matches);
 
   void _write_output_segments(Segments& output_segments, const std::shared_ptr<const Table>& input_table,
                               std::shared_ptr<PosList> pos_list);
@@ -70,7 +88,8 @@ class JoinIndex : public AbstractJoinOperator {
   std::shared_ptr<PosList> _pos_list_right;
 
   // for left/right/outer joins
-  // The outer vector enumerates chunks, the inner enumerates chunk_offsets
+  // The outer vector enumerates chunks, the inner enumerates chunk_offsets. _left_matches[chunk_id] is only written by
+  // the job of that left chunk, _right_matches is merged from the jobs' matches under a mutex.
   std::vector<std::vector<bool>> _left_matches;
   std::vector<std::vector<bool>> _right_matches;
 };
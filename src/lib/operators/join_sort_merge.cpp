@@ -773,7 +773,7 @@ class JoinSortMerge::JoinSortMergeImpl : public AbstractJoinOperatorImpl {
         }
       }
 
-      jobs.push_back(std::make_shared<JobTask>([this, cluster_number] {
+      jobs.push_back(JobTask::make([this, cluster_number] {
         // Accessors are not thread-safe, so we create one evaluator per job
         std::optional<MultiPredicateJoinEvaluator> multi_predicate_join_evaluator;
         if (!_secondary_join_predicates.empty()) {
@@ -784,10 +784,9 @@ class JoinSortMerge::JoinSortMergeImpl : public AbstractJoinOperatorImpl {
 
         this->_join_cluster(cluster_number, multi_predicate_join_evaluator);
       }));
-      jobs.back()->schedule();
     }
 
-    CurrentScheduler::wait_for_tasks(jobs);
+    CurrentScheduler::schedule_and_wait_for_tasks(jobs);
 
     // The outer joins for the non-equi cases
     // Note: Equi outer joins can be integrated into the main algorithm, while these can not.
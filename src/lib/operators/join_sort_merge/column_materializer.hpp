@@ -78,10 +78,9 @@ class ColumnMaterializer {
 
       jobs.push_back(
           _create_chunk_materialization_job(output, null_rows, chunk_id, input, column_id, subsamples.back()));
-      jobs.back()->schedule();
     }
 
-    CurrentScheduler::wait_for_tasks(jobs);
+    CurrentScheduler::schedule_and_wait_for_tasks(jobs);
 
     auto gathered_samples = std::vector<T>();
     gathered_samples.reserve(samples_per_chunk * chunk_count);
@@ -102,7 +101,7 @@ class ColumnMaterializer {
                                                                   const ChunkID chunk_id,
                                                                   std::shared_ptr<const Table> input,
                                                                   const ColumnID column_id, Subsample<T>& subsample) {
-    return std::make_shared<JobTask>([this, &output, &null_rows_output, input, column_id, chunk_id, &subsample] {
+    return JobTask::make([this, &output, &null_rows_output, input, column_id, chunk_id, &subsample] {
       auto segment = input->get_chunk(chunk_id)->get_segment(column_id);
 
       if (const auto dictionary_segment = std::dynamic_pointer_cast<DictionarySegment<T>>(segment)) {
@@ -182,7 +182,7 @@ class RadixClusterSort {
       auto input_chunk = (*input_chunks)[chunk_number];
 
       // Count the number of entries for each cluster to be able to reserve the appropriate output space later.
-      auto job = std::make_shared<JobTask>([input_chunk, &clusterer, &chunk_information] {
+      auto job = JobTask::make([input_chunk, &clusterer, &chunk_information] {
         for (auto& entry : *input_chunk) {
           auto cluster_id = clusterer(entry.value);
           ++chunk_information.cluster_histogram[cluster_id];
@@ -190,10 +190,9 @@ class RadixClusterSort {
       });
 
       histogram_jobs.push_back(job);
-      job->schedule();
     }
 
-    CurrentScheduler::wait_for_tasks(histogram_jobs);
+    CurrentScheduler::schedule_and_wait_for_tasks(histogram_jobs);
 
     // Aggregate the chunks histograms to a table histogram and initialize the insert positions for each chunk
     for (auto& chunk_information : table_information.chunk_information) {
@@ -212,22 +211,20 @@ class RadixClusterSort {
     // Move each entry into its appropriate cluster in parallel
     std::vector<std::shared_ptr<AbstractTask>> cluster_jobs;
     for (size_t chunk_number = 0; chunk_number < input_chunks->size(); ++chunk_number) {
-      auto job =
-          std::make_shared<JobTask>([chunk_number, &output_table, &input_chunks, &table_information, &clusterer] {
-            auto& chunk_information = table_information.chunk_information[chunk_number];
-            for (auto& entry : *(*input_chunks)[chunk_number]) {
-              auto cluster_id = clusterer(entry.value);
-              auto& output_cluster = *(*output_table)[cluster_id];
-              auto& insert_position = chunk_information.insert_position[cluster_id];
-              output_cluster[insert_position] = entry;
-              ++insert_position;
-            }
-          });
+      auto job = JobTask::make([chunk_number, &output_table, &input_chunks, &table_information, &clusterer] {
+        auto& chunk_information = table_information.chunk_information[chunk_number];
+        for (auto& entry : *(*input_chunks)[chunk_number]) {
+          auto cluster_id = clusterer(entry.value);
+          auto& output_cluster = *(*output_table)[cluster_id];
+          auto& insert_position = chunk_information.insert_position[cluster_id];
+          output_cluster[insert_position] = entry;
+          ++insert_position;
+        }
+      });
       cluster_jobs.push_back(job);
-      job->schedule();
     }
 
-    CurrentScheduler::wait_for_tasks(cluster_jobs);
+    CurrentScheduler::schedule_and_wait_for_tasks(cluster_jobs);
 
     return output_table;
   }
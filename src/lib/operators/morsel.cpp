@@ -0,0 +1,131 @@
+#include "morsel.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "scheduler/abstract_scheduler.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "storage/chunk.hpp"
+#include "storage/table.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// The indices of morsels that are processed by one job, all of which belong to the same node
+struct MorselJob {
+  NodeID node_id;
+  std::vector<size_t> morsel_indices;
+  size_t row_count;
+};
+
+}  // namespace
+
+namespace opossum {
+
+std::vector<Morsel> split_into_morsels(const Table& table, const std::vector<ChunkID>& chunk_ids,
+                                       const bool split_chunks) {
+  auto morsels = std::vector<Morsel>{};
+  morsels.reserve(chunk_ids.size());
+
+  for (const auto chunk_id : chunk_ids) {
+    const auto chunk = table.get_chunk(chunk_id);
+    const auto chunk_size = chunk->size();
+    const auto node_id = chunk->node_id();
+    if (!split_chunks || chunk_size <= MAX_ROWS_PER_MORSEL) {
+      morsels.emplace_back(Morsel{chunk_id, ChunkOffset{0}, chunk_size, node_id});
+      continue;
+    }
+
+    const auto morsel_count = (size_t{chunk_size} + MAX_ROWS_PER_MORSEL - 1) / MAX_ROWS_PER_MORSEL;
+    const auto morsel_size = size_t{(chunk_size + morsel_count - 1) / morsel_count};
+    for (auto begin_offset = size_t{0}; begin_offset < chunk_size; begin_offset += morsel_size) {
+      const auto end_offset = std::min(begin_offset + morsel_size, size_t{chunk_size});
+      morsels.emplace_back(
+          Morsel{chunk_id, static_cast<ChunkOffset>(begin_offset), static_cast<ChunkOffset>(end_offset), node_id});
+    }
+  }
+
+  return morsels;
+}
+
+void process_morsels(const std::vector<Morsel>& morsels, const std::function<void(const size_t)>& process_morsel) {
+  // Each job holds the indices of morsels that belong to the same node. A job is open until it covers at least
+  // MIN_ROWS_PER_JOB rows. Only one job per node is open at a time.
+  auto jobs = std::vector<MorselJob>{};
+  auto open_job_by_node = std::unordered_map<NodeID, size_t>{};
+  auto last_full_job_by_node = std::unordered_map<NodeID, size_t>{};
+  auto total_row_count = size_t{0};
+  for (auto morsel_idx = size_t{0}; morsel_idx < morsels.size(); ++morsel_idx) {
+    const auto node_id = morsels[morsel_idx].node_id;
+    auto open_job_iter = open_job_by_node.find(node_id);
+    if (open_job_iter == open_job_by_node.end()) {
+      open_job_iter = open_job_by_node.emplace(node_id, jobs.size()).first;
+      jobs.emplace_back(MorselJob{node_id, {}, 0});
+    }
+
+    auto& job = jobs[open_job_iter->second];
+    job.morsel_indices.emplace_back(morsel_idx);
+    job.row_count += morsels[morsel_idx].size();
+    total_row_count += morsels[morsel_idx].size();
+    if (job.row_count >= MIN_ROWS_PER_JOB) {
+      last_full_job_by_node[node_id] = open_job_iter->second;
+      open_job_by_node.erase(open_job_iter);
+    }
+  }
+
+  // A remainder with less than MIN_ROWS_PER_JOB rows is added to the last job of its node, if there is one
+  auto job_count = jobs.size();
+  for (const auto& [node_id, job_idx] : open_job_by_node) {
+    const auto full_job_iter = last_full_job_by_node.find(node_id);
+    if (full_job_iter == last_full_job_by_node.end()) continue;
+
+    auto& remainder = jobs[job_idx].morsel_indices;
+    auto& full_job = jobs[full_job_iter->second].morsel_indices;
+    full_job.insert(full_job.end(), remainder.begin(), remainder.end());
+    remainder.clear();
+    --job_count;
+  }
+
+  // Scheduling a single job would only add overhead, as the calling thread waits for it anyway. The same holds for
+  // inputs that are too small for more than one job, even if they are spread across several nodes.
+  if (job_count <= 1 || total_row_count < 2 * MIN_ROWS_PER_JOB) {
+    for (auto morsel_idx = size_t{0}; morsel_idx < morsels.size(); ++morsel_idx) {
+      process_morsel(morsel_idx);
+    }
+    return;
+  }
+
+  // Chunks that were placed on a node the current scheduler does not know (e.g., because the topology changed) are
+  // processed wherever the task is scheduled by default
+  const auto& scheduler = CurrentScheduler::get();
+  const auto node_count = scheduler ? scheduler->queues().size() : size_t{0};
+
+  auto tasks = std::vector<std::shared_ptr<AbstractTask>>{};
+  tasks.reserve(job_count);
+  auto tasks_by_node = std::unordered_map<NodeID, std::vector<std::shared_ptr<AbstractTask>>>{};
+  for (auto& job : jobs) {
+    if (job.morsel_indices.empty()) continue;
+
+    auto task = JobTask::make([&process_morsel, morsel_indices = std::move(job.morsel_indices)]() {
+      for (const auto morsel_idx : morsel_indices) {
+        process_morsel(morsel_idx);
+      }
+    });
+    const auto node_id = static_cast<size_t>(job.node_id) < node_count ? job.node_id : CURRENT_NODE_ID;
+    tasks_by_node[node_id].emplace_back(task);
+    tasks.emplace_back(std::move(task));
+  }
+
+  for (const auto& [node_id, node_tasks] : tasks_by_node) {
+    CurrentScheduler::schedule_tasks(node_tasks, node_id);
+  }
+  CurrentScheduler::wait_for_tasks(tasks);
+}
+
+}  // namespace opossum
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <functional>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class Table;
+
+/**
+ * A range of rows within a chunk that is processed as a unit of work. Unless a chunk is split, its morsel spans the
+ * entire chunk. node_id is the node that holds the chunk (see Chunk::node_id()).
+ */
+struct Morsel {
+  ChunkOffset size() const { return end_offset - begin_offset; }
+
+  ChunkID chunk_id;
+  ChunkOffset begin_offset;
+  ChunkOffset end_offset;
+  NodeID node_id{INVALID_NODE_ID};
+};
+
+/**
+ * Instead of spawning one JobTask per chunk regardless of its size, operators size their jobs by the number of rows.
+ * Consecutive morsels are combined into one job until it covers at least MIN_ROWS_PER_JOB rows, so that small inputs
+ * do not pay for creating and scheduling tasks. Chunks with more than MAX_ROWS_PER_MORSEL rows are split into
+ * multiple morsels, if the operator can process parts of a chunk.
+ */
+constexpr auto MIN_ROWS_PER_JOB = size_t{10'000};
+constexpr auto MAX_ROWS_PER_MORSEL = ChunkOffset{100'000};
+
+/**
+ * Returns one morsel per chunk in @param chunk_ids. If @param split_chunks is set, chunks with more than
+ * MAX_ROWS_PER_MORSEL rows are split into multiple morsels of roughly equal size.
+ */
+std::vector<Morsel> split_into_morsels(const Table& table, const std::vector<ChunkID>& chunk_ids,
+                                       const bool split_chunks = false);
+
+/**
+ * Calls @param process_morsel with the index of each morsel. The morsels are combined into jobs as described above,
+ * where a job only contains morsels of a single node and is scheduled on that node. If the morsels do not add up to
+ * more than one job, it is executed right away on the calling thread. Otherwise, the jobs are scheduled and this
+ * function returns once all of them are done. Within a job, the morsels are processed in order.
+ */
+void process_morsels(const std::vector<Morsel>& morsels, const std::function<void(const size_t)>& process_morsel);
+
+}  // namespace opossum
@@ -15,6 +15,9 @@ struct OperatorPerformanceData : public Noncopyable {
 
   std::chrono::nanoseconds walltime{0};
 
+  // Kept after the output is cleared, e.g., to determine the selectivity of a cached operator (see IndexAdvisorPlugin)
+  size_t output_row_count{0};
+
   virtual void output_to_stream(std::ostream& stream,
                                 DescriptionMode description_mode = DescriptionMode::SingleLine) const;
 };
@@ -0,0 +1,208 @@
+#include "pipeline.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "concurrency/transaction_context.hpp"
+#include "operators/morsel.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/validate.hpp"
+#include "storage/chunk.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+// Returns the positions that are visible to the transaction. If `positions` is nullptr, all rows of the chunk are
+// checked.
+std::shared_ptr<PosList> validate_positions(const Chunk& chunk, const ChunkID chunk_id,
+                                            const std::shared_ptr<const PosList>& positions,
+                                            const TransactionID our_tid, const CommitID snapshot_commit_id) {
+  DebugAssert(chunk.has_mvcc_data(), "Trying to use Validate on a table that has no MVCC data");
+  const auto mvcc_data = chunk.get_scoped_mvcc_data_lock();
+
+  const auto is_row_visible = [&](const ChunkOffset chunk_offset) {
+    return Validate::is_row_visible(our_tid, snapshot_commit_id, mvcc_data->tids[chunk_offset].load(),
+                                    mvcc_data->begin_cids[chunk_offset], mvcc_data->end_cids[chunk_offset]);
+  };
+
+  auto visible_positions = std::make_shared<PosList>();
+  if (positions) {
+    for (const auto& row_id : *positions) {
+      if (is_row_visible(row_id.chunk_offset)) visible_positions->emplace_back(row_id);
+    }
+  } else {
+    const auto chunk_size = chunk.size();
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+      if (is_row_visible(chunk_offset)) visible_positions->emplace_back(RowID{chunk_id, chunk_offset});
+    }
+  }
+
+  return visible_positions;
+}
+
+}  // namespace
+
+Pipeline::Pipeline(const std::shared_ptr<const AbstractOperator>& in,
+                   const std::vector<std::shared_ptr<AbstractOperator>>& stages)
+    : AbstractReadOnlyOperator{OperatorType::Pipeline, in}, _stages(stages) {
+  Assert(!_stages.empty(), "A Pipeline needs at least one stage");
+  for (const auto& stage : _stages) {
+    Assert(stage->type() == OperatorType::TableScan || stage->type() == OperatorType::Validate,
+           "Only TableScans and Validates can be pipelined");
+    Assert(stage->input_left() == in, "The stages have to operate on the input of the Pipeline");
+  }
+}
+
+const std::string Pipeline::name() const { return "Pipeline"; }
+
+const std::string Pipeline::description(DescriptionMode description_mode) const {
+  const auto separator = description_mode == DescriptionMode::MultiLine ? "\n" : " ";
+
+  std::stringstream stream;
+  stream << name();
+  for (const auto& stage : _stages) {
+    stream << separator << stage->name();
+    if (stage->type() == OperatorType::TableScan) {
+      stream << " " << static_cast<const TableScan&>(*stage).predicate()->as_column_name();
+    }
+  }
+
+  return stream.str();
+}
+
+const std::vector<std::shared_ptr<AbstractOperator>>& Pipeline::stages() const { return _stages; }
+
+std::shared_ptr<AbstractOperator> Pipeline::_on_deep_copy(
+    const std::shared_ptr<AbstractOperator>& copied_input_left,
+    const std::shared_ptr<AbstractOperator>& copied_input_right) const {
+  // Copying the stages with deep_copy() would also copy their input, so they are rebuilt on top of the copied input
+  auto copied_stages = std::vector<std::shared_ptr<AbstractOperator>>{};
+  copied_stages.reserve(_stages.size());
+  for (const auto& stage : _stages) {
+    if (stage->type() == OperatorType::TableScan) {
+      const auto& predicate = static_cast<const TableScan&>(*stage).predicate();
+      copied_stages.emplace_back(std::make_shared<TableScan>(copied_input_left, predicate->deep_copy()));
+    } else {
+      copied_stages.emplace_back(std::make_shared<Validate>(copied_input_left));
+    }
+  }
+
+  return std::make_shared<Pipeline>(copied_input_left, copied_stages);
+}
+
+void Pipeline::_on_set_transaction_context(const std::weak_ptr<TransactionContext>& transaction_context) {
+  for (const auto& stage : _stages) {
+    stage->set_transaction_context(transaction_context);
+  }
+}
+
+void Pipeline::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {
+  for (const auto& stage : _stages) {
+    stage->set_parameters(parameters);
+  }
+}
+
+std::shared_ptr<const Table> Pipeline::_on_execute() { return _on_execute(nullptr); }
+
+std::shared_ptr<const Table> Pipeline::_on_execute(std::shared_ptr<TransactionContext> transaction_context) {
+  const auto in_table = input_table_left();
+  Assert(in_table->type() == TableType::Data, "Pipelines can only be executed on data tables");
+
+  // The scan impls are shared by all jobs. Validate stages have no impl.
+  auto impls = std::vector<std::unique_ptr<AbstractTableScanImpl>>{};
+  impls.reserve(_stages.size());
+  for (const auto& stage : _stages) {
+    if (stage->type() == OperatorType::TableScan) {
+      impls.emplace_back(static_cast<const TableScan&>(*stage).create_impl());
+    } else {
+      Assert(transaction_context, "Validate can't be called without a transaction context.");
+      DebugAssert(transaction_context->phase() == TransactionPhase::Active, "Transaction is not active anymore.");
+      impls.emplace_back();
+    }
+  }
+
+  const auto our_tid = transaction_context ? transaction_context->transaction_id() : TransactionID{0};
+  const auto snapshot_commit_id = transaction_context ? transaction_context->snapshot_commit_id() : CommitID{0};
+
+  auto chunk_ids = std::vector<ChunkID>{};
+  chunk_ids.reserve(in_table->chunk_count());
+  for (ChunkID chunk_id{0u}; chunk_id < in_table->chunk_count(); ++chunk_id) {
+    const auto chunk_is_pruned = std::any_of(impls.cbegin(), impls.cend(), [&](const auto& impl) {
+      return impl && impl->can_prune_chunk(chunk_id);
+    });
+    if (!chunk_is_pruned) chunk_ids.emplace_back(chunk_id);
+  }
+
+  // Large chunks are only split into morsels if no stage has to scan the entire chunk anyway
+  const auto split_chunks = std::all_of(impls.cbegin(), impls.cend(), [](const auto& impl) {
+    return !impl || impl->scans_only_filtered_positions();
+  });
+  const auto morsels = split_into_morsels(*in_table, chunk_ids, split_chunks);
+
+  // As in the TableScan, each job writes its result into the slot of its morsel
+  auto output_chunks_by_morsel = std::vector<std::shared_ptr<Chunk>>(morsels.size());
+
+  process_morsels(morsels, [&](const size_t morsel_idx) {
+    const auto& morsel = morsels[morsel_idx];
+    const auto chunk_id = morsel.chunk_id;
+    const auto chunk = in_table->get_chunk(chunk_id);
+
+    // The positions that survived all previous stages. As long as it is nullptr, all rows of the chunk qualify.
+    auto positions = std::shared_ptr<PosList>{};
+    if (morsel.size() != chunk->size()) {
+      positions = std::make_shared<PosList>();
+      positions->reserve(morsel.size());
+      for (auto chunk_offset = morsel.begin_offset; chunk_offset < morsel.end_offset; ++chunk_offset) {
+        positions->emplace_back(RowID{chunk_id, chunk_offset});
+      }
+      positions->guarantee_single_chunk();
+    }
+
+    for (auto stage_idx = size_t{0}; stage_idx < _stages.size(); ++stage_idx) {
+      const auto& impl = impls[stage_idx];
+      if (!impl) {
+        positions = validate_positions(*chunk, chunk_id, positions, our_tid, snapshot_commit_id);
+      } else if (positions) {
+        positions = impl->scan_chunk_filtered(chunk_id, positions);
+      } else {
+        positions = impl->scan_chunk(chunk_id);
+      }
+
+      if (positions->empty()) return;
+      positions->guarantee_single_chunk();
+    }
+
+    // Only the result of the last stage is materialized. All stages keep the order of the positions within the
+    // chunk, so the sort order of the input chunk remains valid.
+    auto out_segments = Segments{};
+    out_segments.reserve(in_table->column_count());
+    for (ColumnID column_id{0u}; column_id < in_table->column_count(); ++column_id) {
+      out_segments.emplace_back(std::make_shared<ReferenceSegment>(in_table, column_id, positions));
+    }
+
+    const auto chunk_out = std::make_shared<Chunk>(out_segments, nullptr, chunk->get_allocator());
+    const auto& ordered_by = chunk->ordered_by();
+    if (ordered_by) chunk_out->set_ordered_by(*ordered_by);
+    chunk_out->set_node_id(chunk->node_id());
+
+    output_chunks_by_morsel[morsel_idx] = chunk_out;
+  });
+
+  auto output_chunks = std::vector<std::shared_ptr<Chunk>>{};
+  output_chunks.reserve(morsels.size());
+  for (auto& chunk : output_chunks_by_morsel) {
+    if (chunk) output_chunks.emplace_back(std::move(chunk));
+  }
+
+  return std::make_shared<Table>(in_table->column_definitions(), TableType::References, std::move(output_chunks));
+}
+
+}  // namespace opossum
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "abstract_read_only_operator.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractTableScanImpl;
+
+/**
+ * Executes a chain of non-blocking operators (currently TableScan and Validate) on a data table morsel by morsel.
+ *
+ * Without pipelining, every operator of such a chain waits until its input is fully materialized, writes its own
+ * reference table, and scans that table again in the next operator. The Pipeline instead runs all stages back to back
+ * on each morsel of its input (see morsel.hpp): The positions that survive one stage are handed to the next stage as a
+ * position filter (see AbstractTableScanImpl::scan_chunk_filtered()) while they are still in the cache of the
+ * worker. Only the positions that survive the last stage are turned into ReferenceSegments.
+ *
+ * The stages are regular TableScan and Validate operators whose input is the input of the Pipeline. They are never
+ * executed themselves, but provide the scan implementations and receive the parameters and the transaction context.
+ * Pipelines are created by the PipelineAwareLQPTranslator.
+ */
+class Pipeline : public AbstractReadOnlyOperator {
+ public:
+  Pipeline(const std::shared_ptr<const AbstractOperator>& in,
+           const std::vector<std::shared_ptr<AbstractOperator>>& stages);
+
+  const std::string name() const override;
+  const std::string description(DescriptionMode description_mode) const override;
+
+  const std::vector<std::shared_ptr<AbstractOperator>>& stages() const;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute(std::shared_ptr<TransactionContext> transaction_context) override;
+  std::shared_ptr<const Table> _on_execute() override;
+
+  std::shared_ptr<AbstractOperator> _on_deep_copy(
+      const std::shared_ptr<AbstractOperator>& copied_input_left,
+      const std::shared_ptr<AbstractOperator>& copied_input_right) const override;
+
+  void _on_set_transaction_context(const std::weak_ptr<TransactionContext>& transaction_context) override;
+  void _on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) override;
+
+ private:
+  const std::vector<std::shared_ptr<AbstractOperator>> _stages;
+};
+
+}  // namespace opossum
@@ -1,8 +1,8 @@
 #include "table_scan.hpp"
 
+#include <algorithm>
 #include <map>
 #include <memory>
-#include <mutex>
 #include <optional>
 #include <sstream>
 #include <string>
@@ -20,10 +20,8 @@
 #include "expression/pqp_column_expression.hpp"
 #include "expression/value_expression.hpp"
 #include "lossless_cast.hpp"
+#include "operators/morsel.hpp"
 #include "operators/operator_scan_predicate.hpp"
-#include "scheduler/abstract_task.hpp"
-#include "scheduler/current_scheduler.hpp"
-#include "scheduler/job_task.hpp"
 #include "storage/base_segment.hpp"
 #include "storage/chunk.hpp"
 #include "storage/reference_segment.hpp"
@@ -81,89 +79,130 @@ std::shared_ptr<const Table> TableScan::_on_execute() {
   _impl = create_impl();
   _impl_description = _impl->description();
 
-  std::mutex output_mutex;
-
   const auto excluded_chunk_set = std::unordered_set<ChunkID>{_excluded_chunk_ids.cbegin(), _excluded_chunk_ids.cend()};
 
-  auto output_chunks = std::vector<std::shared_ptr<Chunk>>{};
-  output_chunks.reserve(in_table->chunk_count() - excluded_chunk_set.size());
-
-  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
-  jobs.reserve(in_table->chunk_count() - excluded_chunk_set.size());
+  auto chunk_ids = std::vector<ChunkID>{};
+  chunk_ids.reserve(in_table->chunk_count() - excluded_chunk_set.size());
 
   for (ChunkID chunk_id{0u}; chunk_id < in_table->chunk_count(); ++chunk_id) {
     if (excluded_chunk_set.count(chunk_id)) continue;
 
-    auto job_task = std::make_shared<JobTask>([=, &output_mutex, &output_chunks]() {
-      const auto chunk_guard = in_table->get_chunk(chunk_id);
-      // The actual scan happens in the sub classes of BaseTableScanImpl
-      const auto matches_out = _impl->scan_chunk(chunk_id);
-      if (matches_out->empty()) return;
-
-      Segments out_segments;
-
-      /**
-       * matches_out contains a list of row IDs into this chunk. If this is not a reference table, we can
-       * directly use the matches to construct the reference segments of the output. If it is a reference segment,
-       * we need to resolve the row IDs so that they reference the physical data segments (value, dictionary) instead,
-       * since we don’t allow multi-level referencing. To save time and space, we want to share position lists
-       * between segments as much as possible. Position lists can be shared between two segments iff
-       * (a) they point to the same table and
-       * (b) the reference segments of the input table point to the same positions in the same order
-       *     (i.e. they share their position list).
-       */
-      if (in_table->type() == TableType::References) {
-        const auto chunk_in = in_table->get_chunk(chunk_id);
-
-        auto filtered_pos_lists = std::map<std::shared_ptr<const PosList>, std::shared_ptr<PosList>>{};
-
-        for (ColumnID column_id{0u}; column_id < in_table->column_count(); ++column_id) {
-          auto segment_in = chunk_in->get_segment(column_id);
-
-          auto ref_segment_in = std::dynamic_pointer_cast<const ReferenceSegment>(segment_in);
-          DebugAssert(ref_segment_in, "All segments should be of type ReferenceSegment.");
-
-          const auto pos_list_in = ref_segment_in->pos_list();
-
-          const auto table_out = ref_segment_in->referenced_table();
-          const auto column_id_out = ref_segment_in->referenced_column_id();
-
-          auto& filtered_pos_list = filtered_pos_lists[pos_list_in];
-
-          if (!filtered_pos_list) {
-            filtered_pos_list = std::make_shared<PosList>(matches_out->size());
-            if (pos_list_in->references_single_chunk()) {
-              filtered_pos_list->guarantee_single_chunk();
-            }
-
-            size_t offset = 0;
-            for (const auto& match : *matches_out) {
-              const auto row_id = (*pos_list_in)[match.chunk_offset];
-              (*filtered_pos_list)[offset] = row_id;
-              ++offset;
-            }
+    // Now that all parameters are set, the ChunkStatistics might rule out chunks that the ChunkPruningRule could not
+    // exclude, e.g., because the predicate compares against a placeholder or a correlated parameter.
+    if (_impl->can_prune_chunk(chunk_id)) continue;
+
+    chunk_ids.emplace_back(chunk_id);
+  }
+
+  // Large chunks are split into multiple morsels if the impl only scans the positions of a position filter. The output
+  // then contains one chunk per morsel.
+  const auto split_chunks = in_table->type() == TableType::Data && _impl->scans_only_filtered_positions();
+  const auto morsels = split_into_morsels(*in_table, chunk_ids, split_chunks);
+
+  // Each job writes its result into the slot of its morsel. This way, no synchronization between the jobs is needed
+  // and the output preserves the chunk order of the input. Empty slots are removed once all jobs are done.
+  auto output_chunks_by_morsel = std::vector<std::shared_ptr<Chunk>>(morsels.size());
+
+  process_morsels(morsels, [&](const size_t morsel_idx) {
+    const auto& morsel = morsels[morsel_idx];
+    const auto chunk_id = morsel.chunk_id;
+    const auto chunk_guard = in_table->get_chunk(chunk_id);
+
+    // The actual scan happens in the sub classes of BaseTableScanImpl
+    auto matches_out = std::shared_ptr<PosList>{};
+    if (morsel.size() == chunk_guard->size()) {
+      matches_out = _impl->scan_chunk(chunk_id);
+    } else {
+      const auto position_filter = std::make_shared<PosList>();
+      position_filter->reserve(morsel.size());
+      for (auto chunk_offset = morsel.begin_offset; chunk_offset < morsel.end_offset; ++chunk_offset) {
+        position_filter->emplace_back(RowID{chunk_id, chunk_offset});
+      }
+      position_filter->guarantee_single_chunk();
+      matches_out = _impl->scan_chunk_filtered(chunk_id, position_filter);
+    }
+    if (matches_out->empty()) return;
+
+    // Most scan impls emit their matches in the order of the positions within the chunk. Only scans on
+    // ReferenceSegments that point to multiple chunks group their matches by referenced chunk. If the input chunk is
+    // sorted, we restore the position order so that the output chunk retains that sort order.
+    const auto& ordered_by = chunk_guard->ordered_by();
+    if (ordered_by) {
+      const auto offset_less = [](const RowID& lhs, const RowID& rhs) { return lhs.chunk_offset < rhs.chunk_offset; };
+      if (!std::is_sorted(matches_out->begin(), matches_out->end(), offset_less)) {
+        std::sort(matches_out->begin(), matches_out->end(), offset_less);
+      }
+    }
+
+    Segments out_segments;
+
+    /**
+     * matches_out contains a list of row IDs into this chunk. If this is not a reference table, we can
+     * directly use the matches to construct the reference segments of the output. If it is a reference segment,
+     * we need to resolve the row IDs so that they reference the physical data segments (value, dictionary) instead,
+     * since we don’t allow multi-level referencing. To save time and space, we want to share position lists
+     * between segments as much as possible. Position lists can be shared between two segments iff
+     * (a) they point to the same table and
+     * (b) the reference segments of the input table point to the same positions in the same order
+     *     (i.e. they share their position list).
+     */
+    if (in_table->type() == TableType::References) {
+      const auto chunk_in = in_table->get_chunk(chunk_id);
+
+      auto filtered_pos_lists = std::map<std::shared_ptr<const PosList>, std::shared_ptr<PosList>>{};
+
+      for (ColumnID column_id{0u}; column_id < in_table->column_count(); ++column_id) {
+        auto segment_in = chunk_in->get_segment(column_id);
+
+        auto ref_segment_in = std::dynamic_pointer_cast<const ReferenceSegment>(segment_in);
+        DebugAssert(ref_segment_in, "All segments should be of type ReferenceSegment.");
+
+        const auto pos_list_in = ref_segment_in->pos_list();
+
+        const auto table_out = ref_segment_in->referenced_table();
+        const auto column_id_out = ref_segment_in->referenced_column_id();
+
+        auto& filtered_pos_list = filtered_pos_lists[pos_list_in];
+
+        if (!filtered_pos_list) {
+          filtered_pos_list = std::make_shared<PosList>(matches_out->size());
+          if (pos_list_in->references_single_chunk()) {
+            filtered_pos_list->guarantee_single_chunk();
           }
 
-          auto ref_segment_out = std::make_shared<ReferenceSegment>(table_out, column_id_out, filtered_pos_list);
-          out_segments.push_back(ref_segment_out);
-        }
-      } else {
-        matches_out->guarantee_single_chunk();
-        for (ColumnID column_id{0u}; column_id < in_table->column_count(); ++column_id) {
-          auto ref_segment_out = std::make_shared<ReferenceSegment>(in_table, column_id, matches_out);
-          out_segments.push_back(ref_segment_out);
+          size_t offset = 0;
+          for (const auto& match : *matches_out) {
+            const auto row_id = (*pos_list_in)[match.chunk_offset];
+            (*filtered_pos_list)[offset] = row_id;
+            ++offset;
+          }
         }
+
+        auto ref_segment_out = std::make_shared<ReferenceSegment>(table_out, column_id_out, filtered_pos_list);
+        out_segments.push_back(ref_segment_out);
       }
+    } else {
+      matches_out->guarantee_single_chunk();
+      for (ColumnID column_id{0u}; column_id < in_table->column_count(); ++column_id) {
+        auto ref_segment_out = std::make_shared<ReferenceSegment>(in_table, column_id, matches_out);
+        out_segments.push_back(ref_segment_out);
+      }
+    }
 
-      std::lock_guard<std::mutex> lock(output_mutex);
-      output_chunks.emplace_back(std::make_shared<Chunk>(out_segments, nullptr, chunk_guard->get_allocator()));
-    });
+    const auto chunk_out = std::make_shared<Chunk>(out_segments, nullptr, chunk_guard->get_allocator());
 
-    jobs.push_back(job_task);
-    job_task->schedule();
-  }
+    // The output has the same columns as the input, so the ColumnID of the sort order remains valid.
+    if (ordered_by) chunk_out->set_ordered_by(*ordered_by);
+    chunk_out->set_node_id(chunk_guard->node_id());
 
-  CurrentScheduler::wait_for_tasks(jobs);
+    output_chunks_by_morsel[morsel_idx] = chunk_out;
+  });
+
+  auto output_chunks = std::vector<std::shared_ptr<Chunk>>{};
+  output_chunks.reserve(morsels.size());
+  for (auto& chunk : output_chunks_by_morsel) {
+    if (chunk) output_chunks.emplace_back(std::move(chunk));
+  }
 
   return std::make_shared<Table>(in_table->column_definitions(), TableType::References, std::move(output_chunks));
 }
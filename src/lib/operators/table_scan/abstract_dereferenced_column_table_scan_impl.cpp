@@ -1,10 +1,12 @@
 #include "abstract_dereferenced_column_table_scan_impl.hpp"
 
+#include <algorithm>
 #include <memory>
 #include <unordered_map>
 #include <utility>
 
 #include "resolve_type.hpp"
+#include "statistics/chunk_statistics/chunk_statistics.hpp"
 #include "storage/chunk.hpp"
 #include "storage/dictionary_segment.hpp"
 #include "storage/reference_segment.hpp"
@@ -34,6 +36,27 @@ std::shared_ptr<PosList> AbstractDereferencedColumnTableScanImpl::scan_chunk(con
   return matches;
 }
 
+std::shared_ptr<PosList> AbstractDereferencedColumnTableScanImpl::scan_chunk_filtered(
+    const ChunkID chunk_id, const std::shared_ptr<const PosList>& position_filter) const {
+  DebugAssert(_in_table->type() == TableType::Data, "Filtered scans are only supported on data tables");
+
+  const auto& segment = _in_table->get_chunk(chunk_id)->get_segment(_column_id);
+
+  auto matches = std::make_shared<PosList>();
+  if (position_filter->empty()) return matches;
+
+  _scan_non_reference_segment(*segment, chunk_id, *matches, position_filter);
+
+  // As for ReferenceSegments, the scan reports the offsets within the filter. Map them back to the filtered rows.
+  for (auto& match : *matches) {
+    match = (*position_filter)[match.chunk_offset];
+  }
+
+  return matches;
+}
+
+bool AbstractDereferencedColumnTableScanImpl::scans_only_filtered_positions() const { return true; }
+
 void AbstractDereferencedColumnTableScanImpl::_scan_reference_segment(const ReferenceSegment& segment,
                                                                       const ChunkID chunk_id, PosList& matches) const {
   const auto& pos_list = segment.pos_list();
@@ -74,4 +97,39 @@ void AbstractDereferencedColumnTableScanImpl::_scan_reference_segment(const Refe
   }
 }
 
+bool AbstractDereferencedColumnTableScanImpl::_can_prune_chunk_with_statistics(
+    const ChunkID chunk_id, const AllTypeVariant& value, const std::optional<AllTypeVariant>& value2) const {
+  // ReferenceSegments have no statistics
+  if (_in_table->type() != TableType::Data) return false;
+
+  const auto chunk_statistics = _in_table->get_chunk(chunk_id)->statistics();
+  if (!chunk_statistics || static_cast<size_t>(_column_id) >= chunk_statistics->statistics().size()) return false;
+
+  return chunk_statistics->can_prune(_column_id, _predicate_condition, value, value2);
+}
+
+AbstractDereferencedColumnTableScanImpl::ZoneMapBlockMatches
+AbstractDereferencedColumnTableScanImpl::_evaluate_zone_map(const ChunkID chunk_id,
+                                                            const std::shared_ptr<const PosList>& position_filter,
+                                                            const AllTypeVariant& value,
+                                                            const std::optional<AllTypeVariant>& value2) const {
+  if (position_filter) return {};
+
+  const auto& chunk = _in_table->get_chunk(chunk_id);
+  const auto chunk_statistics = chunk->statistics();
+  if (!chunk_statistics || static_cast<size_t>(_column_id) >= chunk_statistics->statistics().size()) return {};
+
+  const auto& segment_statistics = chunk_statistics->statistics()[_column_id];
+  const auto zone_map = segment_statistics ? segment_statistics->zone_map() : nullptr;
+  if (!zone_map || zone_map->row_count() != chunk->size()) return {};
+
+  auto block_matches = zone_map->evaluate(_predicate_condition, value, value2);
+  const auto all_blocks_need_scan = std::all_of(block_matches.cbegin(), block_matches.cend(), [](const auto match) {
+    return match == ZoneMapBlockMatch::Some;
+  });
+  if (all_blocks_need_scan) return {};
+
+  return {zone_map->block_size(), std::move(block_matches)};
+}
+
 }  // namespace opossum
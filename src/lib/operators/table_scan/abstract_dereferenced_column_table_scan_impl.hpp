@@ -1,11 +1,15 @@
 #pragma once
 
+#include <algorithm>
 #include <memory>
+#include <optional>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include "abstract_table_scan_impl.hpp"
 
+#include "statistics/chunk_statistics/zone_map.hpp"
 #include "storage/abstract_segment_visitor.hpp"
 
 #include "types.hpp"
@@ -29,6 +33,11 @@ class AbstractDereferencedColumnTableScanImpl : public AbstractTableScanImpl {
 
   std::shared_ptr<PosList> scan_chunk(const ChunkID chunk_id) const override;
 
+  std::shared_ptr<PosList> scan_chunk_filtered(const ChunkID chunk_id,
+                                               const std::shared_ptr<const PosList>& position_filter) const override;
+
+  bool scans_only_filtered_positions() const override;
+
  protected:
   void _scan_reference_segment(const ReferenceSegment& segment, const ChunkID chunk_id, PosList& matches) const;
 
@@ -39,6 +48,66 @@ class AbstractDereferencedColumnTableScanImpl : public AbstractTableScanImpl {
   virtual void _scan_non_reference_segment(const BaseSegment& segment, const ChunkID chunk_id, PosList& matches,
                                            const std::shared_ptr<const PosList>& position_filter) const = 0;
 
+  // Checks the ChunkStatistics of the given chunk of a data table for `column <predicate_condition> value [AND value2]`
+  bool _can_prune_chunk_with_statistics(const ChunkID chunk_id, const AllTypeVariant& value,
+                                        const std::optional<AllTypeVariant>& value2 = std::nullopt) const;
+
+  // Result of evaluating the scan predicate on a zone map. Empty `block_matches` mean that the whole segment has to
+  // be scanned.
+  struct ZoneMapBlockMatches {
+    ChunkOffset block_size{0};
+    std::vector<ZoneMapBlockMatch> block_matches;
+  };
+
+  /**
+   * Evaluates the scan predicate on the zone map of the scanned column in the given chunk. No blocks are returned if
+   * there is no zone map, if the segment is scanned with a position filter (i.e., the data is referenced), or if
+   * the zone map can neither rule out nor confirm any block.
+   */
+  ZoneMapBlockMatches _evaluate_zone_map(const ChunkID chunk_id, const std::shared_ptr<const PosList>& position_filter,
+                                         const AllTypeVariant& value,
+                                         const std::optional<AllTypeVariant>& value2 = std::nullopt) const;
+
+  /**
+   * Wraps _scan_with_iterators() so that the predicate is only evaluated for blocks where the zone map reports
+   * ZoneMapBlockMatch::Some. Blocks that match entirely are added without looking at the data, blocks without matches
+   * are skipped. `it` and `end` have to span the entire segment.
+   */
+  template <bool CheckForNull, typename BinaryFunctor, typename Iterator>
+  static void _scan_with_zone_map(const ZoneMapBlockMatches& zone_map_block_matches, const BinaryFunctor& func,
+                                  Iterator it, const Iterator end, const ChunkID chunk_id, PosList& matches) {
+    if (zone_map_block_matches.block_matches.empty()) {
+      _scan_with_iterators<CheckForNull>(func, it, end, chunk_id, matches);
+      return;
+    }
+
+    const auto row_count = static_cast<ChunkOffset>(end - it);
+    const auto block_size = zone_map_block_matches.block_size;
+
+    auto block_begin = ChunkOffset{0};
+    for (const auto block_match : zone_map_block_matches.block_matches) {
+      const auto block_end = std::min(static_cast<ChunkOffset>(block_begin + block_size), row_count);
+      const auto block_row_count = block_end - block_begin;
+
+      if (block_match == ZoneMapBlockMatch::Some) {
+        const auto block_end_it = it + block_row_count;
+        _scan_with_iterators<CheckForNull>(func, it, block_end_it, chunk_id, matches);
+        it = block_end_it;
+      } else {
+        if (block_match == ZoneMapBlockMatch::All) {
+          // Blocks that contain NULLs are never reported as matching entirely, so no NULL check is needed here
+          matches.reserve(matches.size() + block_row_count);
+          for (auto chunk_offset = block_begin; chunk_offset < block_end; ++chunk_offset) {
+            matches.emplace_back(RowID{chunk_id, chunk_offset});
+          }
+        }
+        it += block_row_count;
+      }
+
+      block_begin = block_end;
+    }
+  }
+
   const std::shared_ptr<const Table> _in_table;
   const ColumnID _column_id;
   const PredicateCondition _predicate_condition;
@@ -4,7 +4,11 @@
 #include <x86intrin.h>
 #endif
 
+#include <algorithm>
 #include <array>
+#include <iterator>
+#include <memory>
+#include <string>
 
 #include "storage/pos_list.hpp"
 #include "storage/segment_iterables.hpp"
@@ -25,6 +29,39 @@ class AbstractTableScanImpl {
 
   virtual std::shared_ptr<PosList> scan_chunk(ChunkID chunk_id) const = 0;
 
+  /**
+   * Only scans those rows of the chunk `chunk_id` that are listed in `position_filter` and returns the matching ones,
+   * in the order of the filter. The input table has to be a data table. The filter has to be sorted and guaranteed
+   * to reference that single chunk. This is used by the Pipeline operator, which passes the matches of one scan on
+   * to the next one without creating ReferenceSegments in between.
+   *
+   * This default implementation scans the entire chunk and intersects the matches with the filter. Impls that can
+   * restrict their scan to a position filter override it.
+   */
+  virtual std::shared_ptr<PosList> scan_chunk_filtered(const ChunkID chunk_id,
+                                                       const std::shared_ptr<const PosList>& position_filter) const {
+    // The matches of a scan on a data table are ordered by their chunk offset
+    const auto chunk_matches = scan_chunk(chunk_id);
+
+    auto matches = std::make_shared<PosList>();
+    std::set_intersection(position_filter->cbegin(), position_filter->cend(), chunk_matches->cbegin(),
+                          chunk_matches->cend(), std::back_inserter(*matches));
+    return matches;
+  }
+
+  /**
+   * Returns true if scan_chunk_filtered() only looks at the positions in the filter. Only then, the TableScan splits
+   * large chunks into morsels that are scanned separately (see morsel.hpp).
+   */
+  virtual bool scans_only_filtered_positions() const { return false; }
+
+  /**
+   * Returns true if the ChunkStatistics of the chunk show that scanning it cannot yield any matches. This lets the
+   * TableScan prune chunks for values that are only known at execution time (e.g., placeholders of prepared statements
+   * or correlated parameters), which the ChunkPruningRule cannot handle.
+   */
+  virtual bool can_prune_chunk(const ChunkID chunk_id) const { return false; }
+
  protected:
   /**
    * @defgroup The hot loop of the table scan
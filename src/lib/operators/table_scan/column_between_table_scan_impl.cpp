@@ -32,6 +32,10 @@ ColumnBetweenTableScanImpl::ColumnBetweenTableScanImpl(const std::shared_ptr<con
 
 std::string ColumnBetweenTableScanImpl::description() const { return "ColumnBetween"; }
 
+bool ColumnBetweenTableScanImpl::can_prune_chunk(const ChunkID chunk_id) const {
+  return _can_prune_chunk_with_statistics(chunk_id, _left_value, _right_value);
+}
+
 void ColumnBetweenTableScanImpl::_scan_non_reference_segment(
     const BaseSegment& segment, const ChunkID chunk_id, PosList& matches,
     const std::shared_ptr<const PosList>& position_filter) const {
@@ -46,6 +50,8 @@ void ColumnBetweenTableScanImpl::_scan_non_reference_segment(
 void ColumnBetweenTableScanImpl::_scan_generic_segment(const BaseSegment& segment, const ChunkID chunk_id,
                                                        PosList& matches,
                                                        const std::shared_ptr<const PosList>& position_filter) const {
+  const auto zone_map_block_matches = _evaluate_zone_map(chunk_id, position_filter, _left_value, _right_value);
+
   segment_with_iterators_filtered(segment, position_filter, [&](auto it, [[maybe_unused]] const auto end) {
     using ColumnDataType = typename decltype(it)::ValueType;
 
@@ -61,7 +67,7 @@ void ColumnBetweenTableScanImpl::_scan_generic_segment(const BaseSegment& segmen
         auto between_comparator = [&](const auto& position) {
           return between_comparator_function(position.value(), typed_left_value, typed_right_value);
         };
-        _scan_with_iterators<true>(between_comparator, it, end, chunk_id, matches);
+        _scan_with_zone_map<true>(zone_map_block_matches, between_comparator, it, end, chunk_id, matches);
       });
     } else {
       Fail("Dictionary and Reference segments have their own code paths and should be handled there");
@@ -126,9 +132,11 @@ void ColumnBetweenTableScanImpl::_scan_dictionary_segment(const BaseDictionarySe
     return (position.value() - lower_bound_value_id) < value_id_diff;
   };
 
+  const auto zone_map_block_matches = _evaluate_zone_map(chunk_id, position_filter, _left_value, _right_value);
+
   attribute_vector_iterable.with_iterators(position_filter, [&](auto left_it, auto left_end) {
     // No need to check for NULL because NULL would be represented as a value ID outside of our range
-    _scan_with_iterators<false>(comparator, left_it, left_end, chunk_id, matches);
+    _scan_with_zone_map<false>(zone_map_block_matches, comparator, left_it, left_end, chunk_id, matches);
   });
 }
 
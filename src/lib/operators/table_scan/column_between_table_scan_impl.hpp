@@ -29,6 +29,8 @@ class ColumnBetweenTableScanImpl : public AbstractDereferencedColumnTableScanImp
 
   std::string description() const override;
 
+  bool can_prune_chunk(const ChunkID chunk_id) const override;
+
  protected:
   void _scan_non_reference_segment(const BaseSegment& segment, const ChunkID chunk_id, PosList& matches,
                                    const std::shared_ptr<const PosList>& position_filter) const override;
@@ -4,7 +4,6 @@
 #include <array>
 #include <map>
 #include <memory>
-#include <regex>
 #include <sstream>
 #include <string>
 #include <utility>
@@ -28,6 +28,10 @@ ColumnVsValueTableScanImpl::ColumnVsValueTableScanImpl(const std::shared_ptr<con
 
 std::string ColumnVsValueTableScanImpl::description() const { return "ColumnVsValue"; }
 
+bool ColumnVsValueTableScanImpl::can_prune_chunk(const ChunkID chunk_id) const {
+  return _can_prune_chunk_with_statistics(chunk_id, _value);
+}
+
 void ColumnVsValueTableScanImpl::_scan_non_reference_segment(
     const BaseSegment& segment, const ChunkID chunk_id, PosList& matches,
     const std::shared_ptr<const PosList>& position_filter) const {
@@ -47,6 +51,8 @@ void ColumnVsValueTableScanImpl::_scan_non_reference_segment(
 void ColumnVsValueTableScanImpl::_scan_generic_segment(const BaseSegment& segment, const ChunkID chunk_id,
                                                        PosList& matches,
                                                        const std::shared_ptr<const PosList>& position_filter) const {
+  const auto zone_map_block_matches = _evaluate_zone_map(chunk_id, position_filter, _value);
+
   segment_with_iterators_filtered(segment, position_filter, [&](auto it, [[maybe_unused]] const auto end) {
     // Don't instantiate this for this for DictionarySegments and ReferenceSegments to save compile time.
     // DictionarySegments are handled in _scan_dictionary_segment()
@@ -61,7 +67,7 @@ void ColumnVsValueTableScanImpl::_scan_generic_segment(const BaseSegment& segmen
         auto comparator = [predicate_comparator, typed_value](const auto& position) {
           return predicate_comparator(position.value(), typed_value);
         };
-        _scan_with_iterators<true>(comparator, it, end, chunk_id, matches);
+        _scan_with_zone_map<true>(zone_map_block_matches, comparator, it, end, chunk_id, matches);
       });
     } else {
       Fail("Dictionary- and ReferenceSegments have their own code paths and should be handled there");
@@ -118,6 +124,8 @@ void ColumnVsValueTableScanImpl::_scan_dictionary_segment(const BaseDictionarySe
     return;
   }
 
+  const auto zone_map_block_matches = _evaluate_zone_map(chunk_id, position_filter, _value);
+
   _with_operator_for_dict_segment_scan(_predicate_condition, [&](auto predicate_comparator) {
     auto comparator = [predicate_comparator, search_value_id](const auto& position) {
       return predicate_comparator(position.value(), search_value_id);
@@ -129,9 +137,9 @@ void ColumnVsValueTableScanImpl::_scan_dictionary_segment(const BaseDictionarySe
       if (_predicate_condition == PredicateCondition::Equals ||
           _predicate_condition == PredicateCondition::LessThanEquals ||
           _predicate_condition == PredicateCondition::LessThan) {
-        _scan_with_iterators<false>(comparator, it, end, chunk_id, matches);
+        _scan_with_zone_map<false>(zone_map_block_matches, comparator, it, end, chunk_id, matches);
       } else {
-        _scan_with_iterators<true>(comparator, it, end, chunk_id, matches);
+        _scan_with_zone_map<true>(zone_map_block_matches, comparator, it, end, chunk_id, matches);
       }
     });
   });
@@ -11,13 +11,16 @@
 #include "strategy/between_composition_rule.hpp"
 #include "strategy/chunk_pruning_rule.hpp"
 #include "strategy/column_pruning_rule.hpp"
+#include "strategy/dependent_group_by_reduction_rule.hpp"
 #include "strategy/expression_reduction_rule.hpp"
 #include "strategy/index_scan_rule.hpp"
 #include "strategy/insert_limit_in_exists_rule.hpp"
+#include "strategy/join_elimination_rule.hpp"
 #include "strategy/join_ordering_rule.hpp"
 #include "strategy/predicate_placement_rule.hpp"
 #include "strategy/predicate_reordering_rule.hpp"
 #include "strategy/predicate_split_up_rule.hpp"
+#include "strategy/semi_to_inner_join_rule.hpp"
 #include "strategy/subquery_to_join_rule.hpp"
 #include "utils/performance_warning.hpp"
 
@@ -94,6 +97,12 @@ std::shared_ptr<Optimizer> Optimizer::create_default_optimizer() {
 
   optimizer->add_rule(std::make_unique<ChunkPruningRule>());
 
+  // The following two rules use unique constraints. Run them before the JoinOrderingRule, so that it does not have to
+  // consider the removed joins.
+  optimizer->add_rule(std::make_unique<DependentGroupByReductionRule>());
+
+  optimizer->add_rule(std::make_unique<JoinEliminationRule>());
+
   // Run before SubqueryToJoinRule, since the Semi/Anti Joins it introduces are opaque to the JoinOrderingRule
   optimizer->add_rule(std::make_unique<JoinOrderingRule>(std::make_unique<CostModelLogical>()));
 
@@ -101,6 +110,9 @@ std::shared_ptr<Optimizer> Optimizer::create_default_optimizer() {
 
   optimizer->add_rule(std::make_unique<SubqueryToJoinRule>());
 
+  // Needs the Semi Joins introduced by the SubqueryToJoinRule
+  optimizer->add_rule(std::make_unique<SemiToInnerJoinRule>());
+
   optimizer->add_rule(std::make_unique<InsertLimitInExistsRule>());
 
   // Position the predicates after the JoinOrderingRule ran. The JOR manipulates predicate placement as well, but
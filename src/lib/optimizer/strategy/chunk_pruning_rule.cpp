@@ -11,7 +11,7 @@
 #include "lossless_cast.hpp"
 #include "operators/operator_scan_predicate.hpp"
 #include "statistics/chunk_statistics/chunk_statistics.hpp"
-#include "storage/storage_manager.hpp"
+#include "storage/meta_table_manager.hpp"
 #include "storage/table.hpp"
 #include "utils/assert.hpp"
 
@@ -53,10 +53,13 @@ void ChunkPruningRule::apply_to(const std::shared_ptr<AbstractLQPNode>& node) co
   auto stored_table = std::static_pointer_cast<StoredTableNode>(current_node);
   DebugAssert(stored_table->input_count() == 0, "Stored table nodes should not have inputs.");
 
+  // Meta tables are generated anew by GetTable, so ChunkIDs of the optimizer's snapshot would not match its chunks
+  if (MetaTableManager::is_meta_table_name(stored_table->table_name)) return;
+
   /**
    * A chain of predicates followed by a stored table node was found.
    */
-  auto table = StorageManager::get().get_table(stored_table->table_name);
+  auto table = stored_table->table();
   std::vector<std::shared_ptr<ChunkStatistics>> statistics;
   for (ChunkID chunk_id{0}; chunk_id < table->chunk_count(); ++chunk_id) {
     statistics.push_back(table->get_chunk(chunk_id)->statistics());
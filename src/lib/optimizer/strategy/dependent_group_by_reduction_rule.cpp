@@ -0,0 +1,112 @@
+#include "dependent_group_by_reduction_rule.hpp"
+
+#include <algorithm>
+#include <unordered_map>
+#include <vector>
+
+#include "expression/aggregate_expression.hpp"
+#include "expression/expression_functional.hpp"
+#include "expression/lqp_column_expression.hpp"
+#include "logical_query_plan/aggregate_node.hpp"
+#include "logical_query_plan/lqp_utils.hpp"
+#include "logical_query_plan/projection_node.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "storage/table.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+std::string DependentGroupByReductionRule::name() const { return "Dependent Group-by Reduction Rule"; }
+
+void DependentGroupByReductionRule::apply_to(const std::shared_ptr<AbstractLQPNode>& root) const {
+  // Collect the AggregateNodes first, visit_lqp() can't deal with nodes being replaced
+  auto aggregate_nodes = std::vector<std::shared_ptr<AggregateNode>>{};
+  visit_lqp(root, [&](const auto& node) {
+    if (node->type == LQPNodeType::Aggregate) {
+      aggregate_nodes.emplace_back(std::static_pointer_cast<AggregateNode>(node));
+    }
+    return LQPVisitation::VisitInputs;
+  });
+
+  for (const auto& aggregate_node : aggregate_nodes) {
+    _remove_if_input_is_unique(_reduce_group_by_columns(aggregate_node));
+  }
+}
+
+std::shared_ptr<AggregateNode> DependentGroupByReductionRule::_reduce_group_by_columns(
+    const std::shared_ptr<AggregateNode>& aggregate_node) {
+  const auto& node_expressions = aggregate_node->node_expressions;
+  const auto aggregates_begin = node_expressions.cbegin() + aggregate_node->aggregate_expressions_begin_idx;
+
+  // Group the GROUP BY columns by the StoredTableNode they originate from
+  auto group_by_columns_by_node = std::unordered_map<std::shared_ptr<const StoredTableNode>, ExpressionUnorderedSet>{};
+  for (auto expression_iter = node_expressions.cbegin(); expression_iter != aggregates_begin; ++expression_iter) {
+    if ((*expression_iter)->type != ExpressionType::LQPColumn) continue;
+
+    const auto& column_reference = static_cast<const LQPColumnExpression&>(**expression_iter).column_reference;
+    if (const auto stored_table_node =
+            std::dynamic_pointer_cast<const StoredTableNode>(column_reference.original_node())) {
+      group_by_columns_by_node[stored_table_node].emplace(*expression_iter);
+    }
+  }
+
+  const auto input_is_validated = lqp_is_validated(aggregate_node->left_input());
+
+  // Collect the GROUP BY columns that are determined by the columns of a unique constraint of the same table
+  auto dependent_columns = ExpressionUnorderedSet{};
+  for (const auto& [stored_table_node, group_by_columns] : group_by_columns_by_node) {
+    const auto table = stored_table_node->table();
+    if (!input_is_validated && table->has_mvcc() == UseMvcc::Yes) continue;
+
+    const auto constraint = lqp_find_unique_constraint(stored_table_node, group_by_columns);
+    if (!constraint) continue;
+
+    const auto& constraint_column_ids = constraint->column_ids;
+    for (const auto& group_by_column : group_by_columns) {
+      const auto column_id =
+          static_cast<const LQPColumnExpression&>(*group_by_column).column_reference.original_column_id();
+      if (std::find(constraint_column_ids.cbegin(), constraint_column_ids.cend(), column_id) ==
+          constraint_column_ids.cend()) {
+        dependent_columns.emplace(group_by_column);
+      }
+    }
+  }
+
+  if (dependent_columns.empty()) return aggregate_node;
+
+  auto group_by_expressions = std::vector<std::shared_ptr<AbstractExpression>>{};
+  auto aggregate_expressions = std::vector<std::shared_ptr<AbstractExpression>>{aggregates_begin,
+                                                                                 node_expressions.cend()};
+  for (auto expression_iter = node_expressions.cbegin(); expression_iter != aggregates_begin; ++expression_iter) {
+    if (dependent_columns.count(*expression_iter)) {
+      aggregate_expressions.emplace_back(any_(*expression_iter));
+    } else {
+      group_by_expressions.emplace_back(*expression_iter);
+    }
+  }
+
+  // ANY(a) is output as a, so that the nodes on top do not notice the change (see AggregateNode)
+  const auto reduced_aggregate_node = AggregateNode::make(group_by_expressions, aggregate_expressions);
+  lqp_replace_node_preserving_columns(aggregate_node, reduced_aggregate_node);
+
+  return reduced_aggregate_node;
+}
+
+void DependentGroupByReductionRule::_remove_if_input_is_unique(const std::shared_ptr<AggregateNode>& aggregate_node) {
+  const auto& node_expressions = aggregate_node->node_expressions;
+  const auto aggregates_begin = node_expressions.cbegin() + aggregate_node->aggregate_expressions_begin_idx;
+
+  const auto only_any_aggregates = std::all_of(aggregates_begin, node_expressions.cend(), [](const auto& expression) {
+    return static_cast<const AggregateExpression&>(*expression).aggregate_function == AggregateFunction::Any;
+  });
+  if (!only_any_aggregates) return;
+
+  const auto group_by_expressions = ExpressionUnorderedSet{node_expressions.cbegin(), aggregates_begin};
+  if (!lqp_is_unique_on(aggregate_node->left_input(), group_by_expressions)) return;
+
+  // Each group consists of a single row, so the group-by columns and the ANY() arguments can simply be forwarded
+  lqp_replace_node(aggregate_node, ProjectionNode::make(aggregate_node->column_expressions()));
+}
+
+}  // namespace opossum
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "abstract_rule.hpp"
+
+namespace opossum {
+
+class AbstractLQPNode;
+class AggregateNode;
+
+/**
+ * Uses unique constraints (see Table::add_unique_constraint) to simplify AggregateNodes:
+ *
+ * (1) If the GROUP BY list contains all columns of a unique constraint of a stored table, the other columns of that
+ *     table in the GROUP BY list are functionally dependent on them. Grouping by them is redundant, so they are moved
+ *     to the aggregates as ANY(column). E.g., `SELECT c_custkey, c_name, SUM(o_totalprice) FROM customer, orders
+ *     WHERE c_custkey = o_custkey GROUP BY c_custkey, c_name` only has to group by c_custkey. This holds regardless of
+ *     the joins between the table and the AggregateNode.
+ *
+ * (2) If the input of an AggregateNode is already unique on the GROUP BY columns (see lqp_is_unique_on()) and no
+ *     aggregates other than ANY() are computed, the AggregateNode is replaced by a ProjectionNode. This removes, e.g.,
+ *     the AggregateNode of a `SELECT DISTINCT` on a primary key.
+ *
+ * Only constraints with non-nullable columns are used, as a unique constraint allows for multiple NULLs, while a
+ * GROUP BY puts them into the same group.
+ */
+class DependentGroupByReductionRule : public AbstractRule {
+ public:
+  std::string name() const override;
+  void apply_to(const std::shared_ptr<AbstractLQPNode>& root) const override;
+
+ private:
+  // Returns the AggregateNode that replaced aggregate_node, or aggregate_node if nothing was reduced
+  static std::shared_ptr<AggregateNode> _reduce_group_by_columns(const std::shared_ptr<AggregateNode>& aggregate_node);
+
+  static void _remove_if_input_is_unique(const std::shared_ptr<AggregateNode>& aggregate_node);
+};
+
+}  // namespace opossum
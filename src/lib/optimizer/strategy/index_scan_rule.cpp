@@ -2,21 +2,106 @@
 
 #include <algorithm>
 #include <iostream>
+#include <iterator>
+#include <map>
 #include <memory>
+#include <optional>
 #include <string>
 #include <vector>
 
 #include "all_parameter_variant.hpp"
 #include "constant_mappings.hpp"
+#include "expression/evaluation/like_matcher.hpp"
+#include "expression/expression_utils.hpp"
+#include "expression/logical_expression.hpp"
+#include "expression/lqp_column_expression.hpp"
 #include "logical_query_plan/abstract_lqp_node.hpp"
+#include "logical_query_plan/lqp_utils.hpp"
 #include "logical_query_plan/predicate_node.hpp"
 #include "logical_query_plan/stored_table_node.hpp"
 #include "operators/operator_scan_predicate.hpp"
 #include "statistics/table_statistics.hpp"
-#include "storage/storage_manager.hpp"
+#include "storage/index/base_index.hpp"
 #include "storage/table.hpp"
 #include "utils/assert.hpp"
 
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// IndexScans on reference tables search the indexes of the referenced chunks. This requires all operators between the
+// StoredTableNode and the PredicateNode to forward references to the stored table.
+bool forwards_references_to(const std::shared_ptr<AbstractLQPNode>& node,
+                            const std::shared_ptr<const StoredTableNode>& stored_table_node) {
+  if (!node) return false;
+  if (node == stored_table_node) return true;
+
+  switch (node->type) {
+    case LQPNodeType::Alias:
+    case LQPNodeType::Join:
+    case LQPNodeType::Limit:
+    case LQPNodeType::Predicate:
+    case LQPNodeType::Validate:
+      return forwards_references_to(node->left_input(), stored_table_node) ||
+             forwards_references_to(node->right_input(), stored_table_node);
+    default:
+      return false;
+  }
+}
+
+struct IndexablePredicate {
+  OperatorScanPredicate operator_predicate;
+  std::shared_ptr<const StoredTableNode> stored_table_node;
+  ColumnID stored_column_id;
+};
+
+// Matches `<column> <condition> <value/placeholder/parameter>` predicates on a column whose stored table can be reached
+std::optional<IndexablePredicate> get_indexable_predicate(const PredicateNode& predicate_node) {
+  const auto operator_predicates = OperatorScanPredicate::from_expression(*predicate_node.predicate(), predicate_node);
+  if (!operator_predicates) return std::nullopt;
+  if (operator_predicates->size() != 1) return std::nullopt;
+
+  const auto& operator_predicate = (*operator_predicates)[0];
+
+  // Currently, we do not support two-column predicates
+  if (is_column_id(operator_predicate.value)) return std::nullopt;
+  if (operator_predicate.value2 && is_column_id(*operator_predicate.value2)) return std::nullopt;
+
+  switch (operator_predicate.predicate_condition) {
+    case PredicateCondition::Like: {
+      // Only patterns with a constant prefix (e.g., 'abc%') can be searched as a range of the indexed strings
+      if (!is_variant(operator_predicate.value)) return std::nullopt;
+      const auto& value = boost::get<AllTypeVariant>(operator_predicate.value);
+      if (value.type() != typeid(pmr_string) || !LikeMatcher::prefix_bounds(boost::get<pmr_string>(value))) {
+        return std::nullopt;
+      }
+      break;
+    }
+    case PredicateCondition::NotLike:
+    case PredicateCondition::In:
+    case PredicateCondition::NotIn:
+    case PredicateCondition::IsNull:
+    case PredicateCondition::IsNotNull:
+      return std::nullopt;
+    default:
+      break;
+  }
+
+  const auto column_expression = std::dynamic_pointer_cast<LQPColumnExpression>(
+      predicate_node.left_input()->column_expressions()[operator_predicate.column_id]);
+  if (!column_expression) return std::nullopt;
+
+  const auto& column_reference = column_expression->column_reference;
+  const auto stored_table_node = std::dynamic_pointer_cast<const StoredTableNode>(column_reference.original_node());
+  if (!stored_table_node || !forwards_references_to(predicate_node.left_input(), stored_table_node)) {
+    return std::nullopt;
+  }
+
+  return IndexablePredicate{operator_predicate, stored_table_node, column_reference.original_column_id()};
+}
+
+}  // namespace
+
 namespace opossum {
 
 // Only if we expect num_output_rows <= num_input_rows * selectivity_threshold, the ScanType can be set to IndexScan.
@@ -32,17 +117,37 @@ std::string IndexScanRule::name() const { return "Index Scan Rule"; }
 
 void IndexScanRule::apply_to(const std::shared_ptr<AbstractLQPNode>& node) const {
   if (node->type == LQPNodeType::Predicate) {
-    const auto& child = node->left_input();
-
-    if (child->type == LQPNodeType::StoredTable) {
-      const auto predicate_node = std::dynamic_pointer_cast<PredicateNode>(node);
-      const auto stored_table_node = std::dynamic_pointer_cast<StoredTableNode>(child);
-      const auto table = StorageManager::get().get_table(stored_table_node->table_name);
+    const auto predicate_node = std::static_pointer_cast<PredicateNode>(node);
+    const auto indexable_predicate = get_indexable_predicate(*predicate_node);
 
+    if (indexable_predicate) {
+      const auto table = indexable_predicate->stored_table_node->table();
       const auto index_infos = table->get_indexes();
+
+      // Composite indexes are preferred, as they answer several predicates at once
       for (const auto& index_info : index_infos) {
-        if (_is_index_scan_applicable(index_info, predicate_node)) {
+        if (_merge_composite_index_predicates(index_info, predicate_node, indexable_predicate->stored_table_node)) {
+          break;
+        }
+      }
+
+      if (predicate_node->scan_type != ScanType::IndexScan) {
+        for (const auto& index_info : index_infos) {
+          if (!_is_index_scan_applicable(index_info, predicate_node, *table, indexable_predicate->stored_column_id,
+                                         indexable_predicate->operator_predicate)) {
+            continue;
+          }
           predicate_node->scan_type = ScanType::IndexScan;
+
+          // The table-wide hash index is searched on the stored table. The SQLTranslator places a Validate directly on
+          // the StoredTableNode, so for transactional point lookups, the predicate is moved below it. Predicates and
+          // Validate commute, the output of the IndexScan is validated instead.
+          const auto input_node = predicate_node->left_input();
+          if (index_info.type == SegmentIndexType::TableHash && input_node->type == LQPNodeType::Validate) {
+            lqp_remove_node(predicate_node);
+            lqp_insert_node(input_node, LQPInputSide::Left, predicate_node);
+            break;
+          }
         }
       }
     }
@@ -52,30 +157,138 @@ void IndexScanRule::apply_to(const std::shared_ptr<AbstractLQPNode>& node) const
 }
 
 bool IndexScanRule::_is_index_scan_applicable(const IndexInfo& index_info,
-                                              const std::shared_ptr<PredicateNode>& predicate_node) const {
+                                              const std::shared_ptr<PredicateNode>& predicate_node,
+                                              const Table& table, const ColumnID stored_column_id,
+                                              const OperatorScanPredicate& operator_predicate) const {
   if (!_is_single_segment_index(index_info)) return false;
 
-  if (index_info.type != SegmentIndexType::GroupKey) return false;
+  const auto predicate_condition = operator_predicate.predicate_condition;
 
-  const auto operator_predicates =
-      OperatorScanPredicate::from_expression(*predicate_node->predicate(), *predicate_node);
-  if (!operator_predicates) return false;
-  if (operator_predicates->size() != 1) return false;
+  // LIKE predicates are answered by StringAdaptiveRadixTreeIndexes only. These are not used for other predicates.
+  if ((predicate_condition == PredicateCondition::Like) !=
+      (index_info.type == SegmentIndexType::StringAdaptiveRadixTree)) {
+    return false;
+  }
 
-  const auto& operator_predicate = (*operator_predicates)[0];
+  if (index_info.type != SegmentIndexType::GroupKey && index_info.type != SegmentIndexType::TableHash &&
+      index_info.type != SegmentIndexType::StringAdaptiveRadixTree) {
+    return false;
+  }
 
-  // Currently, we do not support two-column predicates
-  if (is_column_id(operator_predicate.value)) return false;
+  // Table-wide hash indexes only answer point lookups on the stored table, or on a Validate of it that the predicate
+  // can be moved below (see apply_to())
+  if (index_info.type == SegmentIndexType::TableHash) {
+    const auto& input_node = predicate_node->left_input();
+    const auto is_on_stored_table =
+        input_node->type == LQPNodeType::StoredTable ||
+        (input_node->type == LQPNodeType::Validate && input_node->output_count() == 1 &&
+         input_node->left_input()->type == LQPNodeType::StoredTable);
+    if (predicate_condition != PredicateCondition::Equals || !is_on_stored_table) return false;
+  }
 
-  if (index_info.column_ids[0] != operator_predicate.column_id) return false;
+  if (index_info.column_ids[0] != stored_column_id) return false;
 
-  const auto row_count_table = predicate_node->left_input()->derive_statistics_from(nullptr, nullptr)->row_count();
-  if (row_count_table < INDEX_SCAN_ROW_COUNT_THRESHOLD) return false;
+  const auto row_count_input = predicate_node->left_input()->get_statistics()->row_count();
+  if (predicate_condition == PredicateCondition::Like) {
+    const auto& pattern = boost::get<pmr_string>(boost::get<AllTypeVariant>(operator_predicate.value));
+    const auto selectivity = _indexed_prefix_selectivity(table, stored_column_id, pattern);
+    return _is_selective_enough(row_count_input, row_count_input * selectivity);
+  }
 
   const auto row_count_predicate =
       predicate_node->derive_statistics_from(predicate_node->left_input(), nullptr)->row_count();
-  const float selectivity = row_count_predicate / row_count_table;
 
+  return _is_selective_enough(row_count_input, row_count_predicate);
+}
+
+float IndexScanRule::_indexed_prefix_selectivity(const Table& table, const ColumnID stored_column_id,
+                                                 const pmr_string& pattern) const {
+  const auto bounds = LikeMatcher::prefix_bounds(pattern);
+  DebugAssert(bounds, "Expected LIKE pattern with a constant prefix");
+
+  // Each lookup is a descent of the tree per chunk, which is cheap compared to the scan it might save
+  auto indexed_row_count = size_t{0};
+  auto matching_row_count = size_t{0};
+  for (auto chunk_id = ChunkID{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+    const auto chunk = table.get_chunk(chunk_id);
+    const auto index = chunk->get_index(SegmentIndexType::StringAdaptiveRadixTree, std::vector{stored_column_id});
+    if (!index) continue;
+
+    const auto range_begin = index->lower_bound({bounds->first});
+    const auto range_end = bounds->second ? index->lower_bound({*bounds->second}) : index->cend();
+    indexed_row_count += chunk->size();
+    matching_row_count += std::distance(range_begin, range_end);
+  }
+
+  if (indexed_row_count == 0) return 1.0f;
+  return static_cast<float>(matching_row_count) / static_cast<float>(indexed_row_count);
+}
+
+bool IndexScanRule::_merge_composite_index_predicates(
+    const IndexInfo& index_info, const std::shared_ptr<PredicateNode>& predicate_node,
+    const std::shared_ptr<const StoredTableNode>& stored_table_node) const {
+  if (index_info.type != SegmentIndexType::CompositeGroupKey || _is_single_segment_index(index_info)) return false;
+
+  // Collect the Equals predicates on the stored table from the chain of PredicateNodes that starts with
+  // predicate_node. Predicates commute, so they can be merged regardless of their position in the chain.
+  auto equals_predicates = std::map<ColumnID, std::pair<std::shared_ptr<PredicateNode>, OperatorScanPredicate>>{};
+  auto chain_input = std::shared_ptr<AbstractLQPNode>{};
+  for (auto node = predicate_node;;) {
+    const auto indexable_predicate = get_indexable_predicate(*node);
+    if (indexable_predicate && indexable_predicate->stored_table_node == stored_table_node &&
+        indexable_predicate->operator_predicate.predicate_condition == PredicateCondition::Equals) {
+      equals_predicates.emplace(indexable_predicate->stored_column_id,
+                                std::make_pair(node, indexable_predicate->operator_predicate));
+    }
+
+    chain_input = node->left_input();
+    if (chain_input->type != LQPNodeType::Predicate || chain_input->output_count() != 1) break;
+    node = std::static_pointer_cast<PredicateNode>(chain_input);
+  }
+
+  // The IndexScan searches a prefix of the indexed columns. predicate_node itself has to be part of it, as it is the
+  // node that is replaced.
+  auto prefix_length = size_t{0};
+  while (prefix_length < index_info.column_ids.size() &&
+         equals_predicates.count(index_info.column_ids[prefix_length])) {
+    ++prefix_length;
+  }
+
+  // Single predicates are handled by single-column indexes
+  if (prefix_length < 2) return false;
+
+  const auto is_predicate_node_in_prefix =
+      std::any_of(index_info.column_ids.cbegin(), index_info.column_ids.cbegin() + prefix_length,
+                  [&](const auto column_id) { return equals_predicates.at(column_id).first == predicate_node; });
+  if (!is_predicate_node_in_prefix) return false;
+
+  auto statistics = chain_input->get_statistics();
+  const auto row_count_input = statistics->row_count();
+  for (auto column_index = size_t{0}; column_index < prefix_length; ++column_index) {
+    const auto& operator_predicate = equals_predicates.at(index_info.column_ids[column_index]).second;
+    statistics = std::make_shared<TableStatistics>(statistics->estimate_predicate(
+        operator_predicate.column_id, operator_predicate.predicate_condition, operator_predicate.value));
+  }
+  if (!_is_selective_enough(row_count_input, statistics->row_count())) return false;
+
+  // Merge the predicates into predicate_node, ordered like the indexed columns
+  auto predicates = std::vector<std::shared_ptr<AbstractExpression>>{};
+  for (auto column_index = size_t{0}; column_index < prefix_length; ++column_index) {
+    const auto& node = equals_predicates.at(index_info.column_ids[column_index]).first;
+    predicates.emplace_back(node->predicate());
+    if (node != predicate_node) lqp_remove_node(node);
+  }
+
+  predicate_node->node_expressions[0] = inflate_logical_expressions(predicates, LogicalOperator::And);
+  predicate_node->scan_type = ScanType::IndexScan;
+
+  return true;
+}
+
+bool IndexScanRule::_is_selective_enough(const float row_count_input, const float row_count_output) const {
+  if (row_count_input < INDEX_SCAN_ROW_COUNT_THRESHOLD) return false;
+
+  const float selectivity = row_count_output / row_count_input;
   return selectivity <= INDEX_SCAN_SELECTIVITY_THRESHOLD;
 }
 
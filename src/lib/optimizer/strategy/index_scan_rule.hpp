@@ -12,17 +12,27 @@ namespace opossum {
 
 class AbstractLQPNode;
 class PredicateNode;
+class StoredTableNode;
+class Table;
+struct OperatorScanPredicate;
 
 /**
- * This optimizer rule finds PredicateNodes whose inputs are StoredTableNodes. These PredicateNodes are candidates
- * for being executed by IndexScans. If the expected selectivity of the predicate falls below a certain threshold, the
- * ScanType of the PredicateNode is set to IndexScan.
+ * This optimizer rule finds PredicateNodes that are candidates for being executed by IndexScans. If the expected
+ * selectivity of the predicate falls below a certain threshold, the ScanType of the PredicateNode is set to IndexScan.
+ *
+ * The predicate's column has to originate from a StoredTableNode that is either the PredicateNode's input or is
+ * reached via nodes that forward references (e.g., joins and Validate). In the latter case, the IndexScan searches the
+ * indexes of the referenced chunks. The value can be a literal, a placeholder, or a correlated parameter.
+ *
+ * Chains of Equals predicates that cover a prefix (of at least two columns) of a CompositeGroupKeyIndex are merged into
+ * a single conjunctive PredicateNode that is executed by one IndexScan.
  *
  * Note:
- * For now this rule is only applicable to single-column indexes. Multi-column predicates (i.e. WHERE a < b) are also
- * not supported. We also assume that if chunks have an index, all of them are of the same type, we do not mix GroupKey
- * and ART indexes. In addition, chains of IndexScans are not possible since an IndexScan's input must be a GetTable.
- * Currently, only GroupKeyIndexes are supported.
+ * Multi-column predicates (i.e. WHERE a < b) are not supported. We also assume that if chunks have an index, all of
+ * them are of the same type, we do not mix GroupKey and ART indexes. Currently, only GroupKeyIndexes (and their
+ * composite variant) are supported, as well as StringAdaptiveRadixTreeIndexes for LIKE predicates with a constant
+ * prefix (e.g., LIKE 'abc%'). As the statistics do not estimate LIKE predicates, the selectivity of the latter is
+ * counted on the indexes themselves.
  */
 
 class IndexScanRule : public AbstractRule {
@@ -31,8 +41,19 @@ class IndexScanRule : public AbstractRule {
   void apply_to(const std::shared_ptr<AbstractLQPNode>& node) const override;
 
  protected:
-  bool _is_index_scan_applicable(const IndexInfo& index_info,
-                                 const std::shared_ptr<PredicateNode>& predicate_node) const;
+  bool _is_index_scan_applicable(const IndexInfo& index_info, const std::shared_ptr<PredicateNode>& predicate_node,
+                                 const Table& table, const ColumnID stored_column_id,
+                                 const OperatorScanPredicate& operator_predicate) const;
+
+  // Returns the share of the rows indexed by StringAdaptiveRadixTreeIndexes that match the prefix of the LIKE pattern
+  float _indexed_prefix_selectivity(const Table& table, const ColumnID stored_column_id,
+                                    const pmr_string& pattern) const;
+
+  // Returns true if predicates were merged into predicate_node, which is then executed as an IndexScan
+  bool _merge_composite_index_predicates(const IndexInfo& index_info,
+                                         const std::shared_ptr<PredicateNode>& predicate_node,
+                                         const std::shared_ptr<const StoredTableNode>& stored_table_node) const;
+  bool _is_selective_enough(const float row_count_input, const float row_count_output) const;
   inline bool _is_single_segment_index(const IndexInfo& index_info) const;
 };
 
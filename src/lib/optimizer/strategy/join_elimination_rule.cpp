@@ -0,0 +1,80 @@
+#include "join_elimination_rule.hpp"
+
+#include <algorithm>
+#include <unordered_set>
+#include <vector>
+
+#include "expression/expression_utils.hpp"
+#include "logical_query_plan/join_node.hpp"
+#include "logical_query_plan/lqp_utils.hpp"
+
+namespace opossum {
+
+std::string JoinEliminationRule::name() const { return "Join Elimination Rule"; }
+
+void JoinEliminationRule::apply_to(const std::shared_ptr<AbstractLQPNode>& root) const {
+  // Collect the JoinNodes first, visit_lqp() can't deal with nodes being removed
+  auto left_join_nodes = std::vector<std::shared_ptr<JoinNode>>{};
+  visit_lqp(root, [&](const auto& node) {
+    if (node->type == LQPNodeType::Join) {
+      const auto join_node = std::static_pointer_cast<JoinNode>(node);
+      if (join_node->join_mode == JoinMode::Left) left_join_nodes.emplace_back(join_node);
+    }
+    return LQPVisitation::VisitInputs;
+  });
+
+  for (const auto& join_node : left_join_nodes) {
+    if (!lqp_join_matches_at_most_one_right_row(join_node)) continue;
+    if (_right_input_is_used(root, join_node)) continue;
+
+    join_node->set_right_input(nullptr);
+    lqp_remove_node(join_node);
+  }
+}
+
+bool JoinEliminationRule::_right_input_is_used(const std::shared_ptr<AbstractLQPNode>& root,
+                                               const std::shared_ptr<JoinNode>& join_node) {
+  auto subplan_nodes = std::unordered_set<std::shared_ptr<AbstractLQPNode>>{};
+  visit_lqp(join_node, [&](const auto& node) {
+    subplan_nodes.emplace(node);
+    return LQPVisitation::VisitInputs;
+  });
+
+  // The output columns of the plan are always used
+  const auto& output_expressions = root->column_expressions();
+  auto used_expressions = ExpressionUnorderedSet{output_expressions.cbegin(), output_expressions.cend()};
+
+  const auto add_columns_of_inputs = [&](const auto& node) {
+    for (const auto& input : {node->left_input(), node->right_input()}) {
+      if (!input) continue;
+      const auto& input_expressions = input->column_expressions();
+      used_expressions.insert(input_expressions.cbegin(), input_expressions.cend());
+    }
+  };
+
+  // Collect the expressions used by all nodes outside of the subplan of the join
+  visit_lqp(root, [&](const auto& node) {
+    if (subplan_nodes.count(node)) return LQPVisitation::DoNotVisitInputs;
+
+    for (const auto& expression : node->node_expressions) {
+      visit_expression(expression, [&](const auto& sub_expression) {
+        used_expressions.emplace(sub_expression);
+        return ExpressionVisitation::VisitArguments;
+      });
+    }
+
+    // Unions match their input columns by position, Delete, Insert and Update need all input columns
+    if (node->type == LQPNodeType::Union || node->type == LQPNodeType::Delete || node->type == LQPNodeType::Insert ||
+        node->type == LQPNodeType::Update) {
+      add_columns_of_inputs(node);
+    }
+
+    return LQPVisitation::VisitInputs;
+  });
+
+  const auto& right_expressions = join_node->right_input()->column_expressions();
+  return std::any_of(right_expressions.cbegin(), right_expressions.cend(),
+                     [&](const auto& expression) { return used_expressions.count(expression) > 0; });
+}
+
+}  // namespace opossum
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "abstract_rule.hpp"
+
+namespace opossum {
+
+class AbstractLQPNode;
+class JoinNode;
+
+/**
+ * Removes Left (Outer) Joins whose right input contributes nothing to the result:
+ *   - each row of the left input matches at most one row of the right input, i.e., the right input is unique on the
+ *     right operands of the equality predicates (see lqp_is_unique_on()), and
+ *   - none of the columns of the right input is used outside of the join's subplan.
+ * As every left row is emitted exactly once by such a join, the join is replaced by its left input. E.g., in
+ * `SELECT o_orderkey FROM orders LEFT JOIN customer ON o_custkey = c_custkey`, customer is never read.
+ *
+ * Inner Joins cannot be removed the same way, as they also drop the left rows without a match - proving that every left
+ * row has a match requires foreign key constraints, which we do not have.
+ */
+class JoinEliminationRule : public AbstractRule {
+ public:
+  std::string name() const override;
+  void apply_to(const std::shared_ptr<AbstractLQPNode>& root) const override;
+
+ private:
+  static bool _right_input_is_used(const std::shared_ptr<AbstractLQPNode>& root,
+                                   const std::shared_ptr<JoinNode>& join_node);
+};
+
+}  // namespace opossum
@@ -0,0 +1,32 @@
+#include "semi_to_inner_join_rule.hpp"
+
+#include <vector>
+
+#include "logical_query_plan/join_node.hpp"
+#include "logical_query_plan/lqp_utils.hpp"
+
+namespace opossum {
+
+std::string SemiToInnerJoinRule::name() const { return "Semi to Inner Join Rule"; }
+
+void SemiToInnerJoinRule::apply_to(const std::shared_ptr<AbstractLQPNode>& root) const {
+  // Collect the JoinNodes first, visit_lqp() can't deal with nodes being replaced
+  auto semi_join_nodes = std::vector<std::shared_ptr<JoinNode>>{};
+  visit_lqp(root, [&](const auto& node) {
+    if (node->type == LQPNodeType::Join) {
+      const auto join_node = std::static_pointer_cast<JoinNode>(node);
+      if (join_node->join_mode == JoinMode::Semi) semi_join_nodes.emplace_back(join_node);
+    }
+    return LQPVisitation::VisitInputs;
+  });
+
+  for (const auto& semi_join_node : semi_join_nodes) {
+    if (!lqp_join_matches_at_most_one_right_row(semi_join_node)) continue;
+
+    // The Semi Join outputs the columns of its left input, which are restored by a ProjectionNode
+    const auto inner_join_node = JoinNode::make(JoinMode::Inner, semi_join_node->join_predicates());
+    lqp_replace_node_preserving_columns(semi_join_node, inner_join_node);
+  }
+}
+
+}  // namespace opossum
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "abstract_rule.hpp"
+
+namespace opossum {
+
+class AbstractLQPNode;
+
+/**
+ * Turns Semi Joins into Inner Joins if each row of the left input matches at most one row of the right input, i.e.,
+ * if the right input is unique on the right operands of the equality predicates (see lqp_is_unique_on()). As no left
+ * row can be duplicated by the Inner Join, only a ProjectionNode that removes the columns of the right input is
+ * needed on top. E.g., `SELECT * FROM orders WHERE o_custkey IN (SELECT c_custkey FROM customer WHERE ...)` becomes
+ * an Inner Join with customer, which, unlike the Semi Join, can be executed by all join implementations with either
+ * input as the build side.
+ *
+ * Runs after the SubqueryToJoinRule, which introduces most of the Semi Joins.
+ */
+class SemiToInnerJoinRule : public AbstractRule {
+ public:
+  std::string name() const override;
+  void apply_to(const std::shared_ptr<AbstractLQPNode>& root) const override;
+};
+
+}  // namespace opossum
@@ -9,12 +9,31 @@ namespace opossum {
 
 class AbstractTask;
 class CurrentScheduler;
+class TaskGroup;
 class TaskQueue;
+class Worker;
 
 class AbstractScheduler {
   friend class CurrentScheduler;
 
  public:
+  /**
+   * Requests the admission of a group when created and releases it when destroyed, also if the group's tasks throw
+   */
+  class Admission : private Noncopyable {
+   public:
+    Admission(const std::shared_ptr<AbstractScheduler>& scheduler, const std::shared_ptr<TaskGroup>& group)
+        : _scheduler(scheduler), _group(group) {
+      _scheduler->request_admission(_group);
+    }
+
+    ~Admission() { _scheduler->release_admission(_group); }
+
+   private:
+    const std::shared_ptr<AbstractScheduler> _scheduler;
+    const std::shared_ptr<TaskGroup> _group;
+  };
+
   virtual ~AbstractScheduler() = default;
 
   /**
@@ -36,8 +55,25 @@ class AbstractScheduler {
 
   virtual const std::vector<std::shared_ptr<TaskQueue>>& queues() const = 0;
 
+  virtual const std::vector<std::shared_ptr<Worker>>& workers() const = 0;
+
   virtual void schedule(std::shared_ptr<AbstractTask> task, NodeID preferred_node_id = CURRENT_NODE_ID,
                         SchedulePriority priority = SchedulePriority::Default) = 0;
+
+  /**
+   * Schedules @param tasks, which were already marked as scheduled by CurrentScheduler::schedule_tasks(), at once.
+   * Each task keeps its own priority.
+   */
+  virtual void schedule_tasks(const std::vector<std::shared_ptr<AbstractTask>>& tasks,
+                              NodeID preferred_node_id = CURRENT_NODE_ID) = 0;
+
+  /**
+   * Subjects @param group to admission control. The group's tasks are only executed once it is admitted, which might
+   * be right away. Does not block. release_admission() has to be called once all tasks of the group finished, see
+   * Admission.
+   */
+  virtual void request_admission(const std::shared_ptr<TaskGroup>& group) = 0;
+  virtual void release_admission(const std::shared_ptr<TaskGroup>& group) = 0;
 };
 
 }  // namespace opossum
@@ -1,18 +1,46 @@
 #include "abstract_task.hpp"
 
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <utility>
-#include <vector>
 
 #include "abstract_scheduler.hpp"
 #include "current_scheduler.hpp"
+#include "task_group.hpp"
 #include "task_queue.hpp"
 #include "utils/tracing/probes.hpp"
 #include "worker.hpp"
 
 #include "utils/assert.hpp"
 
+namespace {
+
+// Execution time of the tasks that this thread executed while the current task waited for other tasks
+thread_local std::chrono::nanoseconds nested_execution_duration{0};
+
+// Threads that join() a task wait on the shard of the task's address, so that a finished task only wakes the threads
+// joining it or a task of the same shard (see AbstractTask::_join())
+struct alignas(64) JoinShard {
+  std::mutex mutex;
+  std::condition_variable condition_variable;
+  std::atomic_uint joining_thread_count{0};
+};
+
+constexpr auto JOIN_SHARD_COUNT = size_t{64};
+std::array<JoinShard, JOIN_SHARD_COUNT> join_shards;
+
+JoinShard& join_shard(const void* task) {
+  // Tasks are heap-allocated, so the lowest bits of their addresses carry little information
+  return join_shards[(reinterpret_cast<uintptr_t>(task) >> 6) % JOIN_SHARD_COUNT];
+}
+
+}  // namespace
+
 namespace opossum {
 
 AbstractTask::AbstractTask(SchedulePriority priority, bool stealable) : _priority(priority), _stealable(stealable) {}
@@ -23,16 +51,30 @@ NodeID AbstractTask::node_id() const { return _node_id; }
 
 bool AbstractTask::is_ready() const { return _pending_predecessors == 0; }
 
+bool AbstractTask::is_started() const { return _started; }
+
 bool AbstractTask::is_done() const { return _done; }
 
 bool AbstractTask::is_stealable() const { return _stealable; }
 
-bool AbstractTask::is_scheduled() const { return _is_scheduled; }
+SchedulePriority AbstractTask::priority() const { return _priority; }
+
+const std::shared_ptr<TaskGroup>& AbstractTask::group() const {
+  return _group ? _group : TaskGroup::default_group();
+}
+
+void AbstractTask::set_group(const std::shared_ptr<TaskGroup>& group) {
+  DebugAssert((!_is_scheduled), "Possible race: Don't set the group after the Task was scheduled");
 
-std::string AbstractTask::description() const {
-  return _description.empty() ? "{Task with id: " + std::to_string(_id) + "}" : _description;
+  _group = group;
 }
 
+std::chrono::steady_clock::time_point AbstractTask::enqueue_time() const { return _enqueue_time; }
+
+bool AbstractTask::is_scheduled() const { return _is_scheduled; }
+
+std::string AbstractTask::description() const { return "{Task with id: " + std::to_string(_id) + "}"; }
+
 void AbstractTask::set_id(TaskID id) { _id = id; }
 
 void AbstractTask::set_as_predecessor_of(std::shared_ptr<AbstractTask> successor) {
@@ -43,13 +85,18 @@ void AbstractTask::set_as_predecessor_of(std::shared_ptr<AbstractTask> successor
   successor->_predecessors.emplace_back(shared_from_this());
 }
 
-const std::vector<std::weak_ptr<AbstractTask>>& AbstractTask::predecessors() const { return _predecessors; }
+const AbstractTask::Predecessors& AbstractTask::predecessors() const { return _predecessors; }
 
-const std::vector<std::shared_ptr<AbstractTask>>& AbstractTask::successors() const { return _successors; }
+const AbstractTask::Successors& AbstractTask::successors() const { return _successors; }
 
 void AbstractTask::set_node_id(NodeID node_id) { _node_id = node_id; }
 
-bool AbstractTask::try_mark_as_enqueued() { return !_is_enqueued.exchange(true); }
+bool AbstractTask::try_mark_as_enqueued() {
+  if (_is_enqueued.exchange(true)) return false;
+
+  _enqueue_time = std::chrono::steady_clock::now();
+  return true;
+}
 
 void AbstractTask::set_done_callback(const std::function<void()>& done_callback) {
   DebugAssert((!_is_scheduled), "Possible race: Don't set callback after the Task was scheduled");
@@ -71,16 +118,44 @@ void AbstractTask::schedule(NodeID preferred_node_id) {
 void AbstractTask::_join() {
   DebugAssert((_is_scheduled), "Task must be scheduled before it can be waited for");
 
-  std::unique_lock<std::mutex> lock(_done_mutex);
-  _done_condition_variable.wait(lock, [&]() { return static_cast<bool>(_done); });
+  if (_done) return;
+
+  // Pairs with the check in execute(): Either the executing thread sees this thread as joining, or this thread sees the
+  // task as done before it waits
+  auto& shard = ::join_shard(this);
+  ++shard.joining_thread_count;
+  {
+    std::unique_lock<std::mutex> lock(shard.mutex);
+    shard.condition_variable.wait(lock, [&]() { return static_cast<bool>(_done); });
+  }
+  --shard.joining_thread_count;
 }
 
 void AbstractTask::execute() {
-  DTRACE_PROBE3(HYRISE, JOB_START, _id.load(), _description.c_str(), reinterpret_cast<uintptr_t>(this));
-  DebugAssert(!(_started.exchange(true)), "Possible bug: Trying to execute the same task twice");
+  DTRACE_PROBE3(HYRISE, JOB_START, _id.load(), "", reinterpret_cast<uintptr_t>(this));
+  [[maybe_unused]] const auto already_started = _started.exchange(true);
+  DebugAssert(!already_started, "Possible bug: Trying to execute the same task twice");
   DebugAssert(is_ready(), "Task must not be executed before its dependencies are done");
 
-  _on_execute();
+  // The task's group is current while it executes, so that the tasks it schedules join the group. While the task waits
+  // for them, the thread might execute tasks of other groups, whose execution time is not accounted to this group.
+  const auto& group = this->group();
+  const auto outer_nested_execution_duration = ::nested_execution_duration;
+  ::nested_execution_duration = std::chrono::nanoseconds{0};
+
+  const auto started = std::chrono::steady_clock::now();
+  {
+    const auto task_group_scope = TaskGroup::Scope{group};
+    _on_execute();
+  }
+  const auto execution_duration =
+      std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - started);
+
+  const auto wait_duration = _is_enqueued
+                                 ? std::chrono::duration_cast<std::chrono::nanoseconds>(started - _enqueue_time)
+                                 : std::chrono::nanoseconds{0};
+  group->record_execution(wait_duration, execution_duration - ::nested_execution_duration);
+  ::nested_execution_duration = outer_nested_execution_duration + execution_duration;
 
   for (auto& successor : _successors) {
     successor->_on_predecessor_done();
@@ -88,18 +163,26 @@ void AbstractTask::execute() {
 
   if (_done_callback) _done_callback();
 
-  {
-    std::lock_guard<std::mutex> lock(_done_mutex);
-    _done = true;
-  }
-  _done_condition_variable.notify_all();
   DTRACE_PROBE2(HYRISE, JOB_END, _id, reinterpret_cast<uintptr_t>(this));
+
+  // A joining thread might destroy the task as soon as it is done, so only the shared state is accessed afterwards
+  auto& shard = ::join_shard(this);
+  _done = true;
+  if (shard.joining_thread_count > 0) {
+    {
+      // Joining threads check _done while holding the mutex, so they cannot miss the notification
+      std::lock_guard<std::mutex> lock(shard.mutex);
+    }
+    shard.condition_variable.notify_all();
+  }
 }
 
 void AbstractTask::_mark_as_scheduled() {
   [[maybe_unused]] auto already_scheduled = _is_scheduled.exchange(true);
 
   DebugAssert((!already_scheduled), "Task was already scheduled!");
+
+  if (!_group) _group = TaskGroup::current();
 }
 
 void AbstractTask::_on_predecessor_done() {
@@ -109,7 +192,12 @@ void AbstractTask::_on_predecessor_done() {
       auto worker = Worker::get_this_thread_worker();
       DebugAssert(static_cast<bool>(worker), "No worker");
 
-      worker->queue()->push(shared_from_this(), static_cast<uint32_t>(SchedulePriority::High));
+      // The successor likely works on the output of this task, so it is executed next by the same worker
+      if (_stealable) {
+        worker->push(shared_from_this());
+      } else {
+        worker->queue()->push(shared_from_this(), static_cast<uint32_t>(SchedulePriority::High));
+      }
     } else {
       if (_is_scheduled) execute();
       // Otherwise it will get execute()d once it is scheduled. It is entirely possible for Tasks to "become ready"
@@ -1,28 +1,38 @@
 #pragma once
 
+#include <boost/container/small_vector.hpp>
+
 #include <atomic>
-#include <condition_variable>
+#include <chrono>
 #include <functional>
 #include <memory>
-#include <mutex>
 #include <string>
-#include <vector>
 
 #include "types.hpp"
 
 namespace opossum {
 
+class TaskGroup;
 class Worker;
 
 /**
  * Base class for anything that can be scheduled by the Scheduler and gets executed by a Worker.
  *
  * Derive and implement logic in _on_execute()
+ *
+ * Operators create tasks in large numbers, so a task is kept small: It has no synchronization primitives of its own and
+ * stores its first predecessor and successor inline. Tasks that are created per chunk or per morsel should be
+ * allocated through JobTask::make(), which recycles their memory.
  */
 class AbstractTask : public std::enable_shared_from_this<AbstractTask> {
   friend class CurrentScheduler;
+  friend class WorkStealingDeque;
 
  public:
+  // Most tasks have at most one predecessor and one successor, which do not require a heap allocation
+  using Predecessors = boost::container::small_vector<std::weak_ptr<AbstractTask>, 1>;
+  using Successors = boost::container::small_vector<std::shared_ptr<AbstractTask>, 1>;
+
   explicit AbstractTask(SchedulePriority priority = SchedulePriority::Default, bool stealable = true);
   virtual ~AbstractTask() = default;
 
@@ -37,6 +47,11 @@ class AbstractTask : public std::enable_shared_from_this<AbstractTask> {
    */
   bool is_ready() const;
 
+  /**
+   * @return A thread began executing the task
+   */
+  bool is_started() const;
+
   /**
    * @return The task finished executing
    */
@@ -47,6 +62,20 @@ class AbstractTask : public std::enable_shared_from_this<AbstractTask> {
    */
   bool is_stealable() const;
 
+  SchedulePriority priority() const;
+
+  /**
+   * @return The group the task belongs to, see TaskGroup. Unless set explicitly, this is the group that was current
+   *         when the task was scheduled.
+   */
+  const std::shared_ptr<TaskGroup>& group() const;
+  void set_group(const std::shared_ptr<TaskGroup>& group);
+
+  /**
+   * @return The point in time the task was last pushed to a TaskQueue or to the deque of a Worker
+   */
+  std::chrono::steady_clock::time_point enqueue_time() const;
+
   /**
    * Description for debugging purposes
    */
@@ -67,12 +96,12 @@ class AbstractTask : public std::enable_shared_from_this<AbstractTask> {
   /**
    * @return the predecessors of this Task
    */
-  const std::vector<std::weak_ptr<AbstractTask>>& predecessors() const;
+  const Predecessors& predecessors() const;
 
   /**
    * @return the successors of this Task
    */
-  const std::vector<std::shared_ptr<AbstractTask>>& successors() const;
+  const Successors& successors() const;
 
   /**
    * Node ids are changed when moving the Task between nodes (e.g. during work stealing)
@@ -98,7 +127,7 @@ class AbstractTask : public std::enable_shared_from_this<AbstractTask> {
   /**
    * returns true whether the caller is atomically the first to try to enqueue this task into a TaskQueue,
    * false otherwise.
-   * Makes sure a task only gets put into a TaskQueue once
+   * Makes sure a task only gets put into a TaskQueue once and records the enqueue time
    */
   bool try_mark_as_enqueued();
 
@@ -112,7 +141,8 @@ class AbstractTask : public std::enable_shared_from_this<AbstractTask> {
 
  private:
   /**
-   * Atomically marks the Task as scheduled, thus making sure this happens only once
+   * Atomically marks the Task as scheduled, thus making sure this happens only once. Unless set explicitly, the task
+   * joins the current TaskGroup.
    */
   void _mark_as_scheduled();
 
@@ -123,7 +153,8 @@ class AbstractTask : public std::enable_shared_from_this<AbstractTask> {
 
   /**
    * Blocks the calling thread until the Task finished executing.
-   * This is only called from non-Worker threads and from CurrentScheduler::wait_for_tasks().
+   * This is only called from non-Worker threads and from CurrentScheduler::wait_for_tasks(). Joining threads wait on
+   * one of several condition variables, chosen by the Task's address, so that a finished Task does not wake them all.
    */
   void _join();
 
@@ -131,13 +162,15 @@ class AbstractTask : public std::enable_shared_from_this<AbstractTask> {
   std::atomic<NodeID> _node_id = INVALID_NODE_ID;
   SchedulePriority _priority;
   bool _stealable;
+  std::shared_ptr<TaskGroup> _group;
+  std::chrono::steady_clock::time_point _enqueue_time;
   std::atomic_bool _done{false};
   std::function<void()> _done_callback;
 
   // For dependencies
   std::atomic_uint _pending_predecessors{0};
-  std::vector<std::weak_ptr<AbstractTask>> _predecessors;
-  std::vector<std::shared_ptr<AbstractTask>> _successors;
+  Predecessors _predecessors;
+  Successors _successors;
 
   // For making sure a task gets only scheduled and enqueued once, respectively
   // A Task is scheduled once schedule() is called and enqueued, which is an internal process, once it has been added
@@ -145,12 +178,8 @@ class AbstractTask : public std::enable_shared_from_this<AbstractTask> {
   std::atomic_bool _is_enqueued{false};
   std::atomic_bool _is_scheduled{false};
 
-  // For making Tasks join()-able
-  std::condition_variable _done_condition_variable;
-  std::mutex _done_mutex;
-
-  // Purely for debugging purposes, in order to be able to identify tasks after they have been scheduled
-  std::string _description;
+  // Keeps the task alive while it is only referenced by the raw pointer in a WorkStealingDeque
+  std::shared_ptr<AbstractTask> _enqueued_self_reference;
 
   // To make sure a task is never executed twice
   std::atomic_bool _started{false};
@@ -4,6 +4,7 @@
 #include <vector>
 
 #include "abstract_scheduler.hpp"
+#include "abstract_task.hpp"
 
 namespace opossum {
 
@@ -17,4 +18,20 @@ void CurrentScheduler::set(const std::shared_ptr<AbstractScheduler>& instance) {
 
 bool CurrentScheduler::is_set() { return !!_instance; }
 
+void CurrentScheduler::_schedule_tasks(const std::vector<std::shared_ptr<AbstractTask>>& tasks,
+                                       const NodeID preferred_node_id) {
+  // Without a Scheduler, a task is executed when it is scheduled, so the order of the tasks matters
+  if (!_instance) {
+    for (const auto& task : tasks) {
+      task->schedule(preferred_node_id);
+    }
+    return;
+  }
+
+  for (const auto& task : tasks) {
+    task->_mark_as_scheduled();
+  }
+  _instance->schedule_tasks(tasks, preferred_node_id);
+}
+
 }  // namespace opossum
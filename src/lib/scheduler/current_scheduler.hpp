@@ -1,8 +1,10 @@
 #pragma once
 
 #include <memory>
+#include <type_traits>
 #include <vector>
 
+#include "abstract_task.hpp"
 #include "utils/assert.hpp"
 #include "utils/tracing/probes.hpp"
 #include "worker.hpp"
@@ -32,13 +34,30 @@ class CurrentScheduler {
   template <typename TaskType>
   static void wait_for_tasks(const std::vector<std::shared_ptr<TaskType>>& tasks);
 
+  /**
+   * Schedules all @param tasks at once, which is cheaper than calling schedule() on each of them, as they are pushed
+   * to the queues in one go and idle workers are only woken up once
+   */
   template <typename TaskType>
-  static void schedule_tasks(const std::vector<std::shared_ptr<TaskType>>& tasks);
+  static void schedule_tasks(const std::vector<std::shared_ptr<TaskType>>& tasks,
+                             const NodeID preferred_node_id = CURRENT_NODE_ID);
 
   template <typename TaskType>
   static void schedule_and_wait_for_tasks(const std::vector<std::shared_ptr<TaskType>>& tasks);
 
+  /**
+   * Schedules @param tasks and @param continuation, which is executed once all of the tasks are done. In contrast to
+   * schedule_and_wait_for_tasks(), this returns right away. A task that would only wait for the tasks it spawned to
+   * finish its work hands that work to the continuation instead, so that its worker is free to execute other tasks
+   * without nesting them on top of the waiting one. Neither the tasks nor the continuation must be scheduled yet.
+   */
+  template <typename TaskType>
+  static void schedule_tasks_with_continuation(const std::vector<std::shared_ptr<TaskType>>& tasks,
+                                               const std::shared_ptr<AbstractTask>& continuation);
+
  private:
+  static void _schedule_tasks(const std::vector<std::shared_ptr<AbstractTask>>& tasks, const NodeID preferred_node_id);
+
   static std::shared_ptr<AbstractScheduler> _instance;
 };
 
@@ -67,11 +86,17 @@ void CurrentScheduler::wait_for_tasks(const std::vector<std::shared_ptr<TaskType
 }
 
 template <typename TaskType>
-void CurrentScheduler::schedule_tasks(const std::vector<std::shared_ptr<TaskType>>& tasks) {
+void CurrentScheduler::schedule_tasks(const std::vector<std::shared_ptr<TaskType>>& tasks,
+                                      const NodeID preferred_node_id) {
   DTRACE_PROBE1(HYRISE, SCHEDULE_TASKS, tasks.size());
-  for (auto& task : tasks) {
+  for ([[maybe_unused]] const auto& task : tasks) {
     DTRACE_PROBE2(HYRISE, TASKS, reinterpret_cast<uintptr_t>(&tasks), reinterpret_cast<uintptr_t>(task.get()));
-    task->schedule();
+  }
+
+  if constexpr (std::is_same_v<TaskType, AbstractTask>) {
+    _schedule_tasks(tasks, preferred_node_id);
+  } else {
+    _schedule_tasks(std::vector<std::shared_ptr<AbstractTask>>(tasks.begin(), tasks.end()), preferred_node_id);
   }
 }
 
@@ -82,4 +107,17 @@ void CurrentScheduler::schedule_and_wait_for_tasks(const std::vector<std::shared
   wait_for_tasks(tasks);
 }
 
+template <typename TaskType>
+void CurrentScheduler::schedule_tasks_with_continuation(const std::vector<std::shared_ptr<TaskType>>& tasks,
+                                                        const std::shared_ptr<AbstractTask>& continuation) {
+  for (const auto& task : tasks) {
+    task->set_as_predecessor_of(continuation);
+  }
+
+  // The continuation is scheduled first. Otherwise, the tasks might finish before and it would be enqueued without
+  // being scheduled.
+  continuation->schedule();
+  schedule_tasks(tasks);
+}
+
 }  // namespace opossum
@@ -1,7 +1,17 @@
 #include "job_task.hpp"
 
+#include <functional>
+#include <memory>
+#include <utility>
+
+#include "task_allocator.hpp"
+
 namespace opossum {
 
+std::shared_ptr<JobTask> JobTask::make(std::function<void()> fn, SchedulePriority priority, bool stealable) {
+  return std::allocate_shared<JobTask>(TaskAllocator<JobTask>{}, std::move(fn), priority, stealable);
+}
+
 void JobTask::_on_execute() { _fn(); }
 
 }  // namespace opossum
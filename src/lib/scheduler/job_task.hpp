@@ -1,6 +1,8 @@
 #pragma once
 
 #include <functional>
+#include <memory>
+#include <utility>
 
 #include "abstract_task.hpp"
 
@@ -25,12 +27,20 @@ namespace opossum {
  *
  * // c == 2 now
  *
+ * Operators that create one JobTask per chunk or morsel use JobTask::make() instead of std::make_shared and schedule
+ * all of them at once with CurrentScheduler::schedule_tasks().
  */
 class JobTask : public AbstractTask {
  public:
-  explicit JobTask(const std::function<void()>& fn, SchedulePriority priority = SchedulePriority::Default,
+  explicit JobTask(std::function<void()> fn, SchedulePriority priority = SchedulePriority::Default,
                    bool stealable = true)
-      : AbstractTask(priority, stealable), _fn(fn) {}
+      : AbstractTask(priority, stealable), _fn(std::move(fn)) {}
+
+  /**
+   * Creates a JobTask whose memory is recycled once it is destroyed, see TaskAllocator
+   */
+  static std::shared_ptr<JobTask> make(std::function<void()> fn, SchedulePriority priority = SchedulePriority::Default,
+                                       bool stealable = true);
 
  protected:
   void _on_execute() override;
@@ -1,13 +1,16 @@
 #include "node_queue_scheduler.hpp"
 
+#include <algorithm>
 #include <cstdlib>
 #include <iostream>
 #include <memory>
+#include <mutex>
 #include <utility>
 #include <vector>
 
 #include "abstract_task.hpp"
 #include "current_scheduler.hpp"
+#include "task_group.hpp"
 #include "task_queue.hpp"
 #include "topology.hpp"
 #include "worker.hpp"
@@ -39,7 +42,8 @@ void NodeQueueScheduler::begin() {
     auto& topology_node = Topology::get().nodes()[node_id];
 
     for (auto& topology_cpu : topology_node.cpus) {
-      _workers.emplace_back(std::make_shared<Worker>(queue, _worker_id_allocator->allocate(), topology_cpu.cpu_id));
+      _workers.emplace_back(std::make_shared<Worker>(queue, _worker_id_allocator->allocate(), topology_cpu.cpu_id,
+                                                     topology_cpu.cache_domain_id));
     }
   }
 
@@ -75,6 +79,10 @@ void NodeQueueScheduler::finish() {
 
   _active = false;
 
+  for (auto& queue : _queues) {
+    queue->notify_all_workers();
+  }
+
   for (auto& worker : _workers) {
     worker->join();
   }
@@ -88,6 +96,8 @@ bool NodeQueueScheduler::active() const { return _active; }
 
 const std::vector<std::shared_ptr<TaskQueue>>& NodeQueueScheduler::queues() const { return _queues; }
 
+const std::vector<std::shared_ptr<Worker>>& NodeQueueScheduler::workers() const { return _workers; }
+
 void NodeQueueScheduler::schedule(std::shared_ptr<AbstractTask> task, NodeID preferred_node_id,
                                   SchedulePriority priority) {
   /**
@@ -101,9 +111,18 @@ void NodeQueueScheduler::schedule(std::shared_ptr<AbstractTask> task, NodeID pre
 
   if (!task->is_ready()) return;
 
+  // Tasks scheduled by a worker (e.g., JobTasks spawned by an operator) go to the worker's own deque, unless they are
+  // meant for another node, must not be stolen, or belong to a group that was not admitted yet. This avoids contention
+  // on the node's TaskQueue.
+  const auto worker = Worker::get_this_thread_worker();
+  if (worker && task->is_stealable() && task->group()->is_admitted() &&
+      (preferred_node_id == CURRENT_NODE_ID || preferred_node_id == worker->queue()->node_id())) {
+    worker->push(task);
+    return;
+  }
+
   // Lookup node id for current worker.
   if (preferred_node_id == CURRENT_NODE_ID) {
-    auto worker = Worker::get_this_thread_worker();
     if (worker) {
       preferred_node_id = worker->queue()->node_id();
     } else {
@@ -118,4 +137,120 @@ void NodeQueueScheduler::schedule(std::shared_ptr<AbstractTask> task, NodeID pre
   auto queue = _queues[preferred_node_id];
   queue->push(task, static_cast<uint32_t>(priority));
 }
+
+void NodeQueueScheduler::schedule_tasks(const std::vector<std::shared_ptr<AbstractTask>>& tasks,
+                                        NodeID preferred_node_id) {
+  DebugAssert(_active, "Can't schedule more tasks after the NodeQueueScheduler was shut down");
+
+  auto task_counter = _task_counter.fetch_add(static_cast<TaskID>(tasks.size()));
+
+  const auto worker = Worker::get_this_thread_worker();
+  if (preferred_node_id == CURRENT_NODE_ID) {
+    preferred_node_id = worker ? worker->queue()->node_id() : NodeID{0};
+  }
+
+  DebugAssert(!(static_cast<size_t>(preferred_node_id) >= _queues.size()),
+              "preferred_node_id is not within range of available nodes");
+
+  // The same rules as in schedule() decide whether a ready task goes to the worker's deque or to the node's TaskQueue
+  const auto is_worker_of_node = worker && preferred_node_id == worker->queue()->node_id();
+  auto deque_tasks = std::vector<std::shared_ptr<AbstractTask>>{};
+  auto queue_tasks = std::vector<std::shared_ptr<AbstractTask>>{};
+  for (const auto& task : tasks) {
+    DebugAssert(task->is_scheduled(), "Don't call NodeQueueScheduler::schedule_tasks(), call schedule_tasks() on the "
+                                      "CurrentScheduler");
+    task->set_id(task_counter++);
+    if (!task->is_ready()) continue;
+
+    if (is_worker_of_node && task->is_stealable() && task->group()->is_admitted()) {
+      deque_tasks.emplace_back(task);
+    } else {
+      queue_tasks.emplace_back(task);
+    }
+  }
+
+  if (!deque_tasks.empty()) worker->push(deque_tasks);
+  if (!queue_tasks.empty()) _queues[preferred_node_id]->push(queue_tasks);
+}
+
+void NodeQueueScheduler::request_admission(const std::shared_ptr<TaskGroup>& group) {
+  DebugAssert(group->admission_state() == TaskGroup::AdmissionState::Unrestricted,
+              "Group is already subject to admission control");
+
+  std::lock_guard<std::mutex> lock(_admission_mutex);
+  if (_pending_groups.empty() && (_max_admitted_groups == 0 || _admitted_group_count < _max_admitted_groups)) {
+    group->set_admission_state(TaskGroup::AdmissionState::Admitted);
+    ++_admitted_group_count;
+  } else {
+    group->set_admission_state(TaskGroup::AdmissionState::Pending);
+    _pending_groups.emplace_back(group);
+  }
+}
+
+void NodeQueueScheduler::release_admission(const std::shared_ptr<TaskGroup>& group) {
+  auto admitted_groups = std::vector<std::shared_ptr<TaskGroup>>{};
+  {
+    std::lock_guard<std::mutex> lock(_admission_mutex);
+    if (group->admission_state() == TaskGroup::AdmissionState::Pending) {
+      _pending_groups.erase(std::find(_pending_groups.begin(), _pending_groups.end(), group));
+    } else {
+      DebugAssert(group->admission_state() == TaskGroup::AdmissionState::Admitted, "Group was never admitted");
+      --_admitted_group_count;
+    }
+    group->set_admission_state(TaskGroup::AdmissionState::Unrestricted);
+
+    admitted_groups = _admit_pending_groups();
+  }
+
+  _notify_groups_admitted(admitted_groups);
+}
+
+void NodeQueueScheduler::set_max_admitted_groups(const size_t max_admitted_groups) {
+  auto admitted_groups = std::vector<std::shared_ptr<TaskGroup>>{};
+  {
+    std::lock_guard<std::mutex> lock(_admission_mutex);
+    _max_admitted_groups = max_admitted_groups;
+    admitted_groups = _admit_pending_groups();
+  }
+
+  _notify_groups_admitted(admitted_groups);
+}
+
+size_t NodeQueueScheduler::max_admitted_groups() const {
+  std::lock_guard<std::mutex> lock(_admission_mutex);
+  return _max_admitted_groups;
+}
+
+size_t NodeQueueScheduler::admitted_group_count() const {
+  std::lock_guard<std::mutex> lock(_admission_mutex);
+  return _admitted_group_count;
+}
+
+size_t NodeQueueScheduler::pending_group_count() const {
+  std::lock_guard<std::mutex> lock(_admission_mutex);
+  return _pending_groups.size();
+}
+
+std::vector<std::shared_ptr<TaskGroup>> NodeQueueScheduler::_admit_pending_groups() {
+  auto admitted_groups = std::vector<std::shared_ptr<TaskGroup>>{};
+  while (!_pending_groups.empty() && (_max_admitted_groups == 0 || _admitted_group_count < _max_admitted_groups)) {
+    auto& group = _pending_groups.front();
+    group->set_admission_state(TaskGroup::AdmissionState::Admitted);
+    ++_admitted_group_count;
+
+    admitted_groups.emplace_back(std::move(group));
+    _pending_groups.pop_front();
+  }
+  return admitted_groups;
+}
+
+void NodeQueueScheduler::_notify_groups_admitted(const std::vector<std::shared_ptr<TaskGroup>>& groups) {
+  if (groups.empty()) return;
+
+  // The tasks of the admitted groups might wait in any of the queues
+  for (const auto& queue : _queues) {
+    queue->notify_group_admitted();
+  }
+}
+
 }  // namespace opossum
@@ -1,7 +1,9 @@
 #pragma once
 
 #include <atomic>
+#include <deque>
 #include <memory>
+#include <mutex>
 #include <thread>
 #include <vector>
 
@@ -56,23 +58,37 @@ namespace opossum {
  *
  * WORK STEALING
  *
- * Currently, a simple work stealing is implemented. Work stealing is useful to avoid idle workers (and therefore
- * idle CPUs) while there are still tasks in the system that need to be processed. A worker gets idle if it can not
- * pull a ready task. This occurs in two cases:
- *  1) all tasks in the queue are not ready
- *  2) the queue is empty
- * In both cases the current worker is checking another queue for a ready task. Checking another queue means accessing
- * another node (remote node). As of the physical distance of nodes, accessing a remote nodes is ~1.6 times slower than
- * accessing a local node. [1]
- * Therefore, the current worker fetches a task from a remote queue (without removing it). Then, the current worker
- * is sleeping some milliseconds to give any local worker of the remote node the chance to pull that task. If no local
- * worker of the remote node pulled the task, the current worker is pulling the task and therefore steals it.
- * Afterwards, the current worker is checking its local queue gain.
+ * Each worker owns a WorkStealingDeque. Tasks that are scheduled by a worker's tasks (e.g., the JobTasks of an
+ * operator) and tasks that become ready when their predecessor finished are pushed to the deque of that worker, which
+ * executes them LIFO. Thus, the shared TaskQueue of a node is only used for tasks that are scheduled from outside the
+ * workers, for another node, or that must not be stolen.
+ *
+ * A worker that runs out of local work checks its node's TaskQueue and then steals the oldest task from the deque of
+ * another worker. It first tries the workers of its own node, starting at a random one so that thieves do not all
+ * target the same victim. Only then, it steals from the workers and TaskQueues of other nodes. Accessing a remote node
+ * is ~1.6 times slower than accessing a local node. [1]
+ *
+ * If no task is found anywhere, the worker parks on its node's TaskQueue. Pushing a task wakes up a parked worker of
+ * the same node or, if all of them are busy, of another node. Waiting for JobTasks (see CurrentScheduler::
+ * wait_for_tasks()) never parks, the waiting worker executes other tasks in the meantime.
  *
  * [1] http://frankdenneman.nl/2016/07/13/numa-deep-dive-4-local-memory-optimization/
+ *
+ *
+ * FAIRNESS AND ADMISSION CONTROL
+ *
+ * Each query executes its tasks in its own TaskGroup (see SQLPipelineStatement::get_result_table()). The TaskQueues
+ * pick the next task from the group with the lowest virtual runtime, i.e., the one that received the least CPU time
+ * relative to its weight. Before a worker executes a task from its own deque, it checks whether such a group waits in
+ * the TaskQueue. Thus, the thousands of JobTasks of a large analytical query do not starve a short query.
+ *
+ * The number of groups that are admitted at the same time can be limited with set_max_admitted_groups(). The tasks of
+ * further groups stay in the TaskQueue until an admitted group is released. Waiting for admission does not block
+ * any thread, so a query that is executed from within a task (e.g., by the server) does not deadlock the workers.
  */
 
 class Worker;
+class TaskGroup;
 class TaskQueue;
 class UidAllocator;
 
@@ -96,20 +112,54 @@ class NodeQueueScheduler : public AbstractScheduler {
 
   const std::vector<std::shared_ptr<TaskQueue>>& queues() const override;
 
+  const std::vector<std::shared_ptr<Worker>>& workers() const override;
+
   /**
    * @param task
    * @param preferred_node_id The Task will be initially added to this node, but might get stolen by other Nodes later
-   * @param priority Determines whether tasks are inserted at the beginning or end of the queue.
+   * @param priority Determines whether tasks are inserted at the beginning or end of the queue. Tasks scheduled by a
+   *                 worker for its own node are pushed to the worker's deque, which is always executed LIFO.
    */
   void schedule(std::shared_ptr<AbstractTask> task, NodeID preferred_node_id = CURRENT_NODE_ID,
                 SchedulePriority priority = SchedulePriority::Default) override;
 
+  /**
+   * Like schedule(), but the tasks are pushed to the worker's deque or the node's TaskQueue in one go
+   */
+  void schedule_tasks(const std::vector<std::shared_ptr<AbstractTask>>& tasks,
+                      NodeID preferred_node_id = CURRENT_NODE_ID) override;
+
+  /**
+   * Groups are admitted in FIFO order
+   */
+  void request_admission(const std::shared_ptr<TaskGroup>& group) override;
+  void release_admission(const std::shared_ptr<TaskGroup>& group) override;
+
+  /**
+   * Limits the number of groups that are admitted at the same time. 0, the default, disables the limit.
+   */
+  void set_max_admitted_groups(const size_t max_admitted_groups);
+  size_t max_admitted_groups() const;
+
+  size_t admitted_group_count() const;
+  size_t pending_group_count() const;
+
  private:
+  // Has to be called while holding _admission_mutex, returns the groups that were admitted
+  std::vector<std::shared_ptr<TaskGroup>> _admit_pending_groups();
+
+  void _notify_groups_admitted(const std::vector<std::shared_ptr<TaskGroup>>& groups);
+
   std::atomic<TaskID> _task_counter{TaskID{0}};
   std::shared_ptr<UidAllocator> _worker_id_allocator;
   std::vector<std::shared_ptr<TaskQueue>> _queues;
   std::vector<std::shared_ptr<Worker>> _workers;
   std::atomic_bool _active{false};
+
+  size_t _max_admitted_groups{0};
+  size_t _admitted_group_count{0};
+  std::deque<std::shared_ptr<TaskGroup>> _pending_groups;
+  mutable std::mutex _admission_mutex;
 };
 
 }  // namespace opossum
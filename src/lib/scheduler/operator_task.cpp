@@ -1,6 +1,9 @@
 #include "operator_task.hpp"
 
+#include <map>
 #include <memory>
+#include <mutex>
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -13,6 +16,14 @@
 #include "scheduler/worker.hpp"
 #include "utils/tracing/probes.hpp"
 
+namespace {
+
+// An OperatorTask is executed once per operator, so a mutex is cheap compared to the operator's execution
+std::mutex execution_statistics_mutex;
+std::map<std::string, opossum::OperatorTask::ExecutionStatistics> execution_statistics_by_operator;
+
+}  // namespace
+
 namespace opossum {
 OperatorTask::OperatorTask(std::shared_ptr<AbstractOperator> op, CleanupTemporaries cleanup_temporaries,
                            SchedulePriority priority, bool stealable)
@@ -58,6 +69,11 @@ std::shared_ptr<OperatorTask> OperatorTask::_add_tasks_from_operator(
 
 const std::shared_ptr<AbstractOperator>& OperatorTask::get_operator() const { return _op; }
 
+std::map<std::string, OperatorTask::ExecutionStatistics> OperatorTask::execution_statistics() {
+  std::lock_guard<std::mutex> lock(execution_statistics_mutex);
+  return execution_statistics_by_operator;
+}
+
 void OperatorTask::_on_execute() {
   auto context = _op->transaction_context();
   if (context) {
@@ -85,6 +101,13 @@ void OperatorTask::_on_execute() {
   DTRACE_PROBE2(HYRISE, OPERATOR_TASKS, reinterpret_cast<uintptr_t>(_op.get()), reinterpret_cast<uintptr_t>(this));
   _op->execute();
 
+  {
+    std::lock_guard<std::mutex> lock(execution_statistics_mutex);
+    auto& statistics = execution_statistics_by_operator[_op->name()];
+    ++statistics.executed_task_count;
+    statistics.execution_duration += _op->performance_data().walltime;
+  }
+
   /**
    * Check whether the operator is a ReadWrite operator, and if it is, whether it failed.
    * If it failed, trigger rollback of transaction.
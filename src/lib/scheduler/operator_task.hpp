@@ -1,6 +1,9 @@
 #pragma once
 
+#include <chrono>
+#include <map>
 #include <memory>
+#include <string>
 #include <unordered_map>
 #include <vector>
 
@@ -15,6 +18,11 @@ class AbstractOperator;
  */
 class OperatorTask : public AbstractTask {
  public:
+  struct ExecutionStatistics {
+    uint64_t executed_task_count{0};
+    std::chrono::nanoseconds execution_duration{0};
+  };
+
   // We don't like abbreviations, but "operator" is a keyword
   OperatorTask(std::shared_ptr<AbstractOperator> op, CleanupTemporaries cleanup_temporaries,
                SchedulePriority priority = SchedulePriority::Default, bool stealable = true);
@@ -29,6 +37,12 @@ class OperatorTask : public AbstractTask {
 
   std::string description() const override;
 
+  /**
+   * Number and total execution time of the OperatorTasks executed so far per operator name (e.g., "TableScan"), see
+   * MetaTableManager::generate_operator_tasks_table()
+   */
+  static std::map<std::string, ExecutionStatistics> execution_statistics();
+
  protected:
   void _on_execute() override;
 
@@ -0,0 +1,115 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <new>
+
+namespace opossum {
+
+/**
+ * Free list of memory blocks of one size, one per thread. Blocks are allocated from the global heap only if the free
+ * list is empty, and returned to it only if the free list is full or the thread exits.
+ */
+template <size_t block_size>
+class TaskBlockFreeList {
+ public:
+  static constexpr auto MAX_FREE_BLOCKS = size_t{1'024};
+
+  static void* pop() {
+    if (!_head) return ::operator new(block_size);
+
+    auto* const block = _head;
+    _head = block->next;
+    --_size;
+    return block;
+  }
+
+  static void push(void* pointer) {
+    if (_thread_exited || _size >= MAX_FREE_BLOCKS) {
+      ::operator delete(pointer);
+      return;
+    }
+
+    // Makes sure the free list is emptied when the thread exits
+    _cleanup.is_used = true;
+
+    _head = new (pointer) Block{_head};
+    ++_size;
+  }
+
+ private:
+  struct Block {
+    Block* next;
+  };
+
+  struct Cleanup {
+    ~Cleanup() {
+      while (_head) {
+        auto* const block = _head;
+        _head = block->next;
+        ::operator delete(block);
+      }
+      _size = 0;
+      _thread_exited = true;
+    }
+
+    bool is_used{false};
+  };
+
+  // Trivially destructible, so that they can still be accessed while other thread_local objects are destroyed
+  inline static thread_local Block* _head = nullptr;
+  inline static thread_local size_t _size = 0;
+  inline static thread_local bool _thread_exited = false;
+
+  inline static thread_local Cleanup _cleanup;
+};
+
+/**
+ * Recycles the memory of tasks, which operators create and destroy at a high rate (e.g., one JobTask per morsel).
+ * Freed blocks are kept in a free list per thread and block size (see TaskBlockFreeList), so that allocating a task
+ * usually neither takes a lock nor calls into the global heap. Tasks are mostly destroyed by the thread that created
+ * and waited for them, so their blocks return to the free list they were taken from. Otherwise, a block joins the
+ * free list of the thread that freed it.
+ *
+ * Meant for std::allocate_shared, which places the task and its control block in a single block, see JobTask::make().
+ */
+template <typename T>
+class TaskAllocator {
+ public:
+  using value_type = T;
+
+  TaskAllocator() = default;
+
+  template <typename U>
+  TaskAllocator(const TaskAllocator<U>&) {}  // NOLINT - implicit conversion is required for rebinding
+
+  T* allocate(const size_t n) {
+    if (n != 1) return static_cast<T*>(::operator new(n * sizeof(T)));
+    return static_cast<T*>(FreeList::pop());
+  }
+
+  void deallocate(T* pointer, const size_t n) {
+    if (n != 1) {
+      ::operator delete(pointer);
+      return;
+    }
+    FreeList::push(pointer);
+  }
+
+  template <typename U>
+  bool operator==(const TaskAllocator<U>&) const {
+    return true;
+  }
+
+  template <typename U>
+  bool operator!=(const TaskAllocator<U>&) const {
+    return false;
+  }
+
+ private:
+  static_assert(alignof(T) <= __STDCPP_DEFAULT_NEW_ALIGNMENT__, "Blocks are allocated with the default alignment");
+
+  using FreeList = TaskBlockFreeList<std::max(sizeof(T), sizeof(void*))>;
+};
+
+}  // namespace opossum
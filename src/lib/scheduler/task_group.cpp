@@ -0,0 +1,96 @@
+#include "task_group.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "utils/assert.hpp"
+
+namespace {
+
+// The group of the innermost TaskGroup::Scope on this thread, empty if there is none
+thread_local std::shared_ptr<opossum::TaskGroup> this_thread_group;
+
+// Atomically raises `value` to at least `new_value`
+void raise_to(std::atomic<uint64_t>& value, const uint64_t new_value) {
+  auto current_value = value.load();
+  while (current_value < new_value && !value.compare_exchange_weak(current_value, new_value)) {
+  }
+}
+
+}  // namespace
+
+namespace opossum {
+
+TaskGroup::Scope::Scope(const std::shared_ptr<TaskGroup>& group) : _previous_group(std::move(::this_thread_group)) {
+  ::this_thread_group = group;
+}
+
+TaskGroup::Scope::~Scope() { ::this_thread_group = std::move(_previous_group); }
+
+const std::shared_ptr<TaskGroup>& TaskGroup::current() {
+  return ::this_thread_group ? ::this_thread_group : default_group();
+}
+
+const std::shared_ptr<TaskGroup>& TaskGroup::default_group() {
+  static const auto group = std::make_shared<TaskGroup>("Default");
+  return group;
+}
+
+TaskGroup::TaskGroup(const std::string& name, const uint32_t weight) : _name(name), _weight(weight) {
+  Assert(_weight > 0, "The weight of a TaskGroup has to be positive");
+}
+
+const std::string& TaskGroup::name() const { return _name; }
+
+uint32_t TaskGroup::weight() const { return _weight; }
+
+uint64_t TaskGroup::virtual_runtime() const { return _virtual_runtime; }
+
+void TaskGroup::catch_up_virtual_runtime(const uint64_t min_virtual_runtime) {
+  raise_to(_virtual_runtime, min_virtual_runtime);
+}
+
+TaskGroup::AdmissionState TaskGroup::admission_state() const { return _admission_state; }
+
+bool TaskGroup::is_admitted() const { return _admission_state != AdmissionState::Pending; }
+
+void TaskGroup::set_admission_state(const AdmissionState admission_state) {
+  if (admission_state == AdmissionState::Pending) {
+    _admission_requested = std::chrono::steady_clock::now();
+  } else if (admission_state == AdmissionState::Admitted && _admission_state == AdmissionState::Pending) {
+    const auto admission_wait = std::chrono::steady_clock::now() - _admission_requested;
+    _admission_wait_nanoseconds += std::chrono::duration_cast<std::chrono::nanoseconds>(admission_wait).count();
+  }
+
+  _admission_state = admission_state;
+}
+
+void TaskGroup::record_execution(const std::chrono::nanoseconds wait_duration,
+                                 const std::chrono::nanoseconds execution_duration) {
+  ++_executed_task_count;
+  _execution_nanoseconds += execution_duration.count();
+  _wait_nanoseconds += wait_duration.count();
+  raise_to(_max_wait_nanoseconds, wait_duration.count());
+
+  _virtual_runtime += execution_duration.count() * DEFAULT_WEIGHT / _weight;
+}
+
+uint64_t TaskGroup::executed_task_count() const { return _executed_task_count; }
+
+std::chrono::nanoseconds TaskGroup::execution_duration() const {
+  return std::chrono::nanoseconds{_execution_nanoseconds};
+}
+
+std::chrono::nanoseconds TaskGroup::wait_duration() const { return std::chrono::nanoseconds{_wait_nanoseconds}; }
+
+std::chrono::nanoseconds TaskGroup::max_wait_duration() const {
+  return std::chrono::nanoseconds{_max_wait_nanoseconds};
+}
+
+std::chrono::nanoseconds TaskGroup::admission_wait_duration() const {
+  return std::chrono::nanoseconds{_admission_wait_nanoseconds};
+}
+
+}  // namespace opossum
@@ -0,0 +1,107 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * A TaskGroup bundles the tasks of a query or a session, so that the scheduler can share the workers fairly between
+ * concurrent queries. Tasks join the group that is current on the thread that schedules them (see Scope). Workers make
+ * the group of a task current while executing it, so that the JobTasks spawned by an operator end up in the group of
+ * the operator's query. Tasks scheduled outside of any group belong to the default group.
+ *
+ * Each group accounts the CPU time its tasks consumed, divided by its weight, as its virtual runtime. The TaskQueue
+ * prefers the group with the lowest virtual runtime (as in Linux' Completely Fair Scheduler), so a group with twice
+ * the weight receives twice the CPU time of a competing group. A short query that arrives while a long-running query
+ * keeps all workers busy is thus executed right away instead of waiting behind thousands of tasks.
+ *
+ * Additionally, groups can be subject to admission control (see NodeQueueScheduler::set_max_admitted_groups()). The
+ * tasks of a group that is not admitted yet remain in the TaskQueue until another group releases its admission.
+ */
+class TaskGroup : private Noncopyable {
+ public:
+  static constexpr uint32_t DEFAULT_WEIGHT = 100;
+
+  enum class AdmissionState { Unrestricted, Pending, Admitted };
+
+  /**
+   * Makes a group the current group of the calling thread for the lifetime of the Scope
+   */
+  class Scope : private Noncopyable {
+   public:
+    explicit Scope(const std::shared_ptr<TaskGroup>& group);
+    ~Scope();
+
+   private:
+    std::shared_ptr<TaskGroup> _previous_group;
+  };
+
+  /**
+   * @return The group of the Scope that is active on this thread or the default group if there is none
+   */
+  static const std::shared_ptr<TaskGroup>& current();
+  static const std::shared_ptr<TaskGroup>& default_group();
+
+  explicit TaskGroup(const std::string& name, const uint32_t weight = DEFAULT_WEIGHT);
+
+  const std::string& name() const;
+  uint32_t weight() const;
+
+  /**
+   * Consumed CPU time in nanoseconds, scaled by DEFAULT_WEIGHT / weight
+   */
+  uint64_t virtual_runtime() const;
+
+  /**
+   * A group that (re-)enters a TaskQueue must not use the CPU time it did not consume while it was inactive to starve
+   * the other groups. Thus, its virtual runtime is raised to the virtual runtime of the queue.
+   */
+  void catch_up_virtual_runtime(const uint64_t min_virtual_runtime);
+
+  AdmissionState admission_state() const;
+  bool is_admitted() const;
+
+  /**
+   * Called by the scheduler. A group becomes subject to admission control by being set to Pending or Admitted.
+   */
+  void set_admission_state(const AdmissionState admission_state);
+
+  /**
+   * Called by the Worker after executing one of the group's tasks. `wait_duration` is the time the task spent in a
+   * queue, `execution_duration` the time it ran, excluding other tasks the worker executed while the task waited.
+   */
+  void record_execution(const std::chrono::nanoseconds wait_duration,
+                        const std::chrono::nanoseconds execution_duration);
+
+  /**
+   * Statistics of the group. They are updated concurrently, so they are only a snapshot.
+   */
+  uint64_t executed_task_count() const;
+  std::chrono::nanoseconds execution_duration() const;
+  std::chrono::nanoseconds wait_duration() const;
+  std::chrono::nanoseconds max_wait_duration() const;
+  std::chrono::nanoseconds admission_wait_duration() const;
+
+ private:
+  const std::string _name;
+  const uint32_t _weight;
+
+  std::atomic<uint64_t> _virtual_runtime{0};
+
+  std::atomic<AdmissionState> _admission_state{AdmissionState::Unrestricted};
+  std::chrono::steady_clock::time_point _admission_requested;
+
+  std::atomic<uint64_t> _executed_task_count{0};
+  std::atomic<uint64_t> _execution_nanoseconds{0};
+  std::atomic<uint64_t> _wait_nanoseconds{0};
+  std::atomic<uint64_t> _max_wait_nanoseconds{0};
+  std::atomic<uint64_t> _admission_wait_nanoseconds{0};
+};
+
+}  // namespace opossum
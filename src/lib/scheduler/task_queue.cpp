@@ -1,24 +1,33 @@
 #include "task_queue.hpp"
 
+#include <algorithm>
+#include <deque>
+#include <limits>
 #include <memory>
+#include <mutex>
 #include <utility>
+#include <vector>
 
+#include "abstract_scheduler.hpp"
 #include "abstract_task.hpp"
+#include "current_scheduler.hpp"
+#include "task_group.hpp"
 #include "utils/assert.hpp"
 
 namespace opossum {
 
 TaskQueue::TaskQueue(NodeID node_id) : _node_id(node_id) {}
 
-bool TaskQueue::empty() const {
-  for (const auto& queue : _queues) {
-    if (!queue.empty()) return false;
-  }
-  return true;
-}
+bool TaskQueue::empty() const { return _high_priority_queue.empty() && _group_queues_task_count == 0; }
 
 NodeID TaskQueue::node_id() const { return _node_id; }
 
+size_t TaskQueue::size() const { return _high_priority_queue.unsafe_size() + _group_queues_task_count; }
+
+uint64_t TaskQueue::pushed_task_count() const { return _pushed_task_count.load(std::memory_order_relaxed); }
+
+uint32_t TaskQueue::parked_worker_count() const { return _parked_worker_count; }
+
 void TaskQueue::push(const std::shared_ptr<AbstractTask>& task, uint32_t priority) {
   DebugAssert((priority < NUM_PRIORITY_LEVELS), "Illegal priority level");
 
@@ -26,33 +35,213 @@ void TaskQueue::push(const std::shared_ptr<AbstractTask>& task, uint32_t priorit
   if (!task->try_mark_as_enqueued()) return;
 
   task->set_node_id(_node_id);
-  _queues[priority].push(task);
+  _pushed_task_count.fetch_add(1, std::memory_order_relaxed);
 
-  new_task.notify_one();
+  if (priority == static_cast<uint32_t>(SchedulePriority::High)) {
+    _high_priority_queue.push(task);
+  } else {
+    std::lock_guard<std::mutex> lock(_group_queues_mutex);
+    _push_to_group_queue(task);
+    _update_min_waiting_virtual_runtime();
+  }
+
+  notify_new_task();
 }
 
-std::shared_ptr<AbstractTask> TaskQueue::pull() {
-  std::shared_ptr<AbstractTask> task;
-  for (auto& queue : _queues) {
-    if (queue.try_pop(task)) {
-      return task;
+void TaskQueue::push(const std::vector<std::shared_ptr<AbstractTask>>& tasks) {
+  auto pushed_task_count = size_t{0};
+  {
+    std::lock_guard<std::mutex> lock(_group_queues_mutex);
+    for (const auto& task : tasks) {
+      if (!task->try_mark_as_enqueued()) continue;
+
+      task->set_node_id(_node_id);
+      if (task->priority() == SchedulePriority::High) {
+        _high_priority_queue.push(task);
+      } else {
+        _push_to_group_queue(task);
+      }
+      ++pushed_task_count;
     }
+    _update_min_waiting_virtual_runtime();
   }
-  return nullptr;
+  _pushed_task_count.fetch_add(pushed_task_count, std::memory_order_relaxed);
+
+  notify_new_tasks(pushed_task_count);
+}
+
+std::shared_ptr<AbstractTask> TaskQueue::pull(const TaskFilter& filter) {
+  if (auto task = _pull_from_high_priority_queue(filter)) return task;
+  if (_group_queues_task_count == 0) return nullptr;
+
+  std::lock_guard<std::mutex> lock(_group_queues_mutex);
+  return _pull_from_group_queues(filter);
+}
+
+std::shared_ptr<AbstractTask> TaskQueue::steal(const TaskFilter& filter) {
+  const auto stealable_filter = [&](const AbstractTask& task) {
+    return task.is_stealable() && (!filter || filter(task));
+  };
+
+  if (auto task = _pull_from_high_priority_queue(stealable_filter)) return task;
+  if (_group_queues_task_count == 0) return nullptr;
+
+  std::lock_guard<std::mutex> lock(_group_queues_mutex);
+  return _pull_from_group_queues(stealable_filter);
+}
+
+bool TaskQueue::has_group_behind(const TaskGroup& group) const {
+  return _min_waiting_virtual_runtime.load() < group.virtual_runtime();
+}
+
+void TaskQueue::advance_virtual_runtime(const uint64_t virtual_runtime) {
+  auto current_virtual_runtime = _virtual_runtime.load();
+  while (current_virtual_runtime < virtual_runtime &&
+         !_virtual_runtime.compare_exchange_weak(current_virtual_runtime, virtual_runtime)) {
+  }
+}
+
+void TaskQueue::notify_group_admitted() {
+  {
+    std::lock_guard<std::mutex> lock(_group_queues_mutex);
+    _update_min_waiting_virtual_runtime();
+  }
+
+  // All of the group's tasks might be waiting, so a single worker would not suffice
+  if (!empty()) notify_all_workers();
 }
 
-std::shared_ptr<AbstractTask> TaskQueue::steal() {
+void TaskQueue::_push_to_group_queue(const std::shared_ptr<AbstractTask>& task) {
+  const auto& group = task->group();
+  auto group_queue_iter = std::find_if(_group_queues.begin(), _group_queues.end(),
+                                       [&](const auto& group_queue) { return group_queue.group == group; });
+  if (group_queue_iter == _group_queues.end()) {
+    group->catch_up_virtual_runtime(_virtual_runtime);
+    group_queue_iter = _group_queues.insert(_group_queues.end(), GroupQueue{group, {}});
+  }
+
+  group_queue_iter->tasks.emplace_back(task);
+  ++_group_queues_task_count;
+}
+
+std::shared_ptr<AbstractTask> TaskQueue::_pull_from_high_priority_queue(const TaskFilter& filter) {
   std::shared_ptr<AbstractTask> task;
-  for (auto& queue : _queues) {
-    if (queue.try_pop(task)) {
-      if (task->is_stealable()) {
-        return task;
-      } else {
-        queue.push(task);
-      }
-    }
+  if (!filter) return _high_priority_queue.try_pop(task) ? task : nullptr;
+
+  // Rejected tasks are pushed back. Each task that was queued when the search started is checked at most once.
+  for (auto remaining_task_count = _high_priority_queue.unsafe_size();
+       remaining_task_count > 0 && _high_priority_queue.try_pop(task); --remaining_task_count) {
+    if (filter(*task)) return task;
+    _high_priority_queue.push(task);
   }
   return nullptr;
 }
 
+std::shared_ptr<AbstractTask> TaskQueue::_pull_from_group_queues(const TaskFilter& filter) {
+  auto best_group_queue_iter = _group_queues.end();
+  auto best_task_iter = std::deque<std::shared_ptr<AbstractTask>>::iterator{};
+
+  for (auto group_queue_iter = _group_queues.begin(); group_queue_iter != _group_queues.end(); ++group_queue_iter) {
+    const auto& group = *group_queue_iter->group;
+    if (!group.is_admitted()) continue;
+    if (best_group_queue_iter != _group_queues.end() &&
+        group.virtual_runtime() >= best_group_queue_iter->group->virtual_runtime()) {
+      continue;
+    }
+
+    auto& tasks = group_queue_iter->tasks;
+    const auto task_iter =
+        filter ? std::find_if(tasks.begin(), tasks.end(), [&](const auto& task) { return filter(*task); })
+               : tasks.begin();
+    if (task_iter == tasks.end()) continue;
+
+    best_group_queue_iter = group_queue_iter;
+    best_task_iter = task_iter;
+  }
+
+  if (best_group_queue_iter == _group_queues.end()) return nullptr;
+
+  auto task = std::move(*best_task_iter);
+  best_group_queue_iter->tasks.erase(best_task_iter);
+  --_group_queues_task_count;
+
+  advance_virtual_runtime(best_group_queue_iter->group->virtual_runtime());
+  if (best_group_queue_iter->tasks.empty()) _group_queues.erase(best_group_queue_iter);
+  _update_min_waiting_virtual_runtime();
+
+  return task;
+}
+
+void TaskQueue::_update_min_waiting_virtual_runtime() {
+  auto min_virtual_runtime = std::numeric_limits<uint64_t>::max();
+  for (const auto& group_queue : _group_queues) {
+    if (group_queue.group->is_admitted()) {
+      min_virtual_runtime = std::min(min_virtual_runtime, group_queue.group->virtual_runtime());
+    }
+  }
+  _min_waiting_virtual_runtime = min_virtual_runtime;
+}
+
+uint64_t TaskQueue::prepare_park() {
+  _parked_worker_count.fetch_add(1);
+
+  // Pairs with the fence in notify_new_task(): Either the pushing thread sees this worker as parked, or the worker
+  // sees the pushed task when it checks the queues before calling park()
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  return _park_epoch.load();
+}
+
+void TaskQueue::cancel_park() { _parked_worker_count.fetch_sub(1); }
+
+void TaskQueue::park(const uint64_t epoch) {
+  {
+    std::unique_lock<std::mutex> unique_lock(_park_mutex);
+    _park_condition_variable.wait(unique_lock, [&]() { return _park_epoch.load() != epoch; });
+  }
+  _parked_worker_count.fetch_sub(1);
+}
+
+void TaskQueue::notify_new_task() { notify_new_tasks(1); }
+
+void TaskQueue::notify_new_tasks(const size_t task_count) {
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  auto remaining_task_count = task_count - _wake_parked_workers(task_count);
+  if (remaining_task_count == 0 || !CurrentScheduler::is_set()) return;
+
+  for (const auto& queue : CurrentScheduler::get()->queues()) {
+    if (queue.get() == this) continue;
+
+    remaining_task_count -= queue->_wake_parked_workers(remaining_task_count);
+    if (remaining_task_count == 0) return;
+  }
+}
+
+void TaskQueue::notify_all_workers() {
+  {
+    std::lock_guard<std::mutex> lock(_park_mutex);
+    ++_park_epoch;
+  }
+  _park_condition_variable.notify_all();
+}
+
+size_t TaskQueue::_wake_parked_workers(const size_t max_count) {
+  const auto parked_worker_count = size_t{_parked_worker_count.load()};
+  if (parked_worker_count == 0 || max_count == 0) return 0;
+
+  {
+    std::lock_guard<std::mutex> lock(_park_mutex);
+    ++_park_epoch;
+  }
+
+  if (max_count >= parked_worker_count) {
+    _park_condition_variable.notify_all();
+    return parked_worker_count;
+  }
+
+  for (auto worker_index = size_t{0}; worker_index < max_count; ++worker_index) {
+    _park_condition_variable.notify_one();
+  }
+  return max_count;
+}
+
 }  // namespace opossum
@@ -2,19 +2,33 @@
 
 #include <stdint.h>
 #include <tbb/concurrent_queue.h>
-#include <array>
 #include <atomic>
 #include <condition_variable>
+#include <deque>
+#include <functional>
+#include <limits>
 #include <memory>
+#include <mutex>
+#include <vector>
 
 #include "types.hpp"
 
 namespace opossum {
 
 class AbstractTask;
+class TaskGroup;
+
+/**
+ * Decides whether a worker may execute a task, see Worker::_wait_for_tasks(). An empty filter accepts all tasks.
+ */
+using TaskFilter = std::function<bool(const AbstractTask&)>;
 
 /**
  * Holds a queue of AbstractTasks, usually one of these exists per node
+ *
+ * Tasks with SchedulePriority::High are executed in FIFO order. As they are used for tasks of running queries that
+ * became ready, they bypass the fair sharing between TaskGroups and the admission control. All other tasks are queued
+ * per TaskGroup. pull() takes the oldest task of the admitted group with the lowest virtual runtime (see TaskGroup).
  */
 class TaskQueue {
  public:
@@ -26,31 +40,106 @@ class TaskQueue {
 
   NodeID node_id() const;
 
+  /**
+   * Statistics of the queue, see MetaTableManager::generate_task_queues_table(). Only snapshots.
+   */
+  size_t size() const;
+  uint64_t pushed_task_count() const;
+  uint32_t parked_worker_count() const;
+
   void push(const std::shared_ptr<AbstractTask>& task, uint32_t priority);
 
   /**
-   * Returns a Tasks that is ready to be executed and removes it from the queue
+   * Pushes all @param tasks while acquiring the lock only once. Each task is queued according to its own priority.
+   */
+  void push(const std::vector<std::shared_ptr<AbstractTask>>& tasks);
+
+  /**
+   * Returns a Tasks that is ready to be executed and accepted by @param filter and removes it from the queue
+   */
+  std::shared_ptr<AbstractTask> pull(const TaskFilter& filter = nullptr);
+
+  /**
+   * Returns a Tasks that is ready to be executed and accepted by @param filter and removes it from one of the
+   * stealable queues
+   */
+  std::shared_ptr<AbstractTask> steal(const TaskFilter& filter = nullptr);
+
+  /**
+   * Returns true if an admitted group with a lower virtual runtime than @param group waits in this queue. Workers
+   * check this before executing a task of their own deque, so that a group that arrives while the workers are busy
+   * with the tasks of another group gets its share. Only a snapshot, but does not acquire a lock.
    */
-  std::shared_ptr<AbstractTask> pull();
+  bool has_group_behind(const TaskGroup& group) const;
 
   /**
-   * Returns a Tasks that is ready to be executed and removes it from one of the stealable queues
+   * Groups that enter this queue catch up to this virtual runtime, see TaskGroup::catch_up_virtual_runtime(). The
+   * workers advance it to the virtual runtime of the group whose task they executed last.
    */
-  std::shared_ptr<AbstractTask> steal();
+  void advance_virtual_runtime(const uint64_t virtual_runtime);
 
   /**
-   * Notifies one worker as soon as a new task gets pushed into the queue
+   * Called by the scheduler when a group was admitted, as its tasks might already wait in this queue
    */
-  std::condition_variable new_task;
+  void notify_group_admitted();
 
   /**
-   * Mutex accessed by workers in order to notify them using condition variable
+   * Idle workers of this node park here instead of polling. To not miss a task that is pushed while it parks, a worker
+   * first announces itself with prepare_park(), then checks all queues once more, and only then either calls
+   * cancel_park() or park() with the epoch returned by prepare_park(). park() returns as soon as
+   * notify_new_task() or notify_all_workers() was called after prepare_park().
    */
-  std::mutex lock;
+  uint64_t prepare_park();
+  void cancel_park();
+  void park(const uint64_t epoch);
+
+  /**
+   * Wakes up a parked worker of this node or, if there is none, of another node, which can then steal the task.
+   * Called whenever a task was pushed to this queue or to the deque of one of the node's workers.
+   */
+  void notify_new_task();
+
+  /**
+   * Like notify_new_task(), but wakes up to @param task_count workers, preferring those of this node
+   */
+  void notify_new_tasks(const size_t task_count);
+
+  /**
+   * Wakes up all parked workers of this node, e.g., when the scheduler shuts down
+   */
+  void notify_all_workers();
 
  private:
+  struct GroupQueue {
+    std::shared_ptr<TaskGroup> group;
+    std::deque<std::shared_ptr<AbstractTask>> tasks;
+  };
+
+  std::shared_ptr<AbstractTask> _pull_from_high_priority_queue(const TaskFilter& filter);
+
+  // All three have to be called while holding _group_queues_mutex
+  void _push_to_group_queue(const std::shared_ptr<AbstractTask>& task);
+  std::shared_ptr<AbstractTask> _pull_from_group_queues(const TaskFilter& filter);
+  void _update_min_waiting_virtual_runtime();
+
+  // Wakes up to @param max_count parked workers of this node and returns how many were woken up
+  size_t _wake_parked_workers(const size_t max_count);
+
   NodeID _node_id;
-  std::array<tbb::concurrent_queue<std::shared_ptr<AbstractTask>>, NUM_PRIORITY_LEVELS> _queues;
+  tbb::concurrent_queue<std::shared_ptr<AbstractTask>> _high_priority_queue;
+
+  // Only contains groups with at least one task
+  std::vector<GroupQueue> _group_queues;
+  std::mutex _group_queues_mutex;
+  std::atomic<size_t> _group_queues_task_count{0};
+  std::atomic<uint64_t> _min_waiting_virtual_runtime{std::numeric_limits<uint64_t>::max()};
+  std::atomic<uint64_t> _virtual_runtime{0};
+  std::atomic<uint64_t> _pushed_task_count{0};
+
+  std::atomic<uint32_t> _parked_worker_count{0};
+  std::atomic<uint64_t> _park_epoch{0};
+  std::condition_variable _park_condition_variable;
+  std::mutex _park_mutex;
 };
 
 }  // namespace opossum
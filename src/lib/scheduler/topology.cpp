@@ -7,14 +7,109 @@
 #endif
 
 #include <algorithm>
+#include <fstream>
 #include <iomanip>
 #include <memory>
+#include <optional>
 #include <sstream>
+#include <string>
 #include <thread>
 #include <utility>
 #include <vector>
 
 #include "memory/numa_memory_resource.hpp"
+#include "utils/string_utils.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Returns the first line of a sysfs file, or std::nullopt if it does not exist
+std::optional<std::string> read_sysfs_file(const std::filesystem::path& path) {
+  auto file = std::ifstream{path};
+  auto line = std::string{};
+  if (!file || !std::getline(file, line) || line.empty()) return std::nullopt;
+  return line;
+}
+
+// Parses CPU lists such as "0-3,8,10-11"
+std::vector<CpuID> parse_cpu_list(const std::string& cpu_list) {
+  auto cpu_ids = std::vector<CpuID>{};
+  for (const auto& range : split_string_by_delimiter(cpu_list, ',')) {
+    const auto dash_position = range.find('-');
+    const auto first_cpu_id = std::stoul(range.substr(0, dash_position));
+    const auto last_cpu_id =
+        dash_position == std::string::npos ? first_cpu_id : std::stoul(range.substr(dash_position + 1));
+    for (auto cpu_id = first_cpu_id; cpu_id <= last_cpu_id; ++cpu_id) {
+      cpu_ids.emplace_back(static_cast<CpuID>(cpu_id));
+    }
+  }
+  return cpu_ids;
+}
+
+// Parses cache sizes such as "48K" or "2M"
+size_t parse_cache_size(const std::string& cache_size) {
+  auto suffix_position = size_t{0};
+  const auto value = size_t{std::stoul(cache_size, &suffix_position)};
+  if (suffix_position == cache_size.size()) return value;
+
+  switch (cache_size[suffix_position]) {
+    case 'K':
+      return value * 1024;
+    case 'M':
+      return value * 1024 * 1024;
+    case 'G':
+      return value * 1024 * 1024 * 1024;
+    default:
+      return value;
+  }
+}
+
+struct CpuLayout {
+  std::optional<CpuID> core_id;
+  std::optional<CpuID> cache_domain_id;
+  std::optional<size_t> l2_cache_size;
+};
+
+CpuLayout read_cpu_layout(const std::filesystem::path& sysfs_cpu_path, const CpuID cpu_id) {
+  const auto cpu_path = sysfs_cpu_path / ("cpu" + std::to_string(cpu_id));
+  auto layout = CpuLayout{};
+
+  if (const auto siblings = read_sysfs_file(cpu_path / "topology" / "thread_siblings_list")) {
+    const auto sibling_ids = parse_cpu_list(*siblings);
+    if (!sibling_ids.empty()) layout.core_id = *std::min_element(sibling_ids.cbegin(), sibling_ids.cend());
+  }
+
+  // Each cache that the CPU can access is described by one indexN directory. The cache with the highest level is the
+  // last-level cache, instruction caches are ignored.
+  auto last_level = 0;
+  for (auto cache_index = 0;; ++cache_index) {
+    const auto cache_path = cpu_path / "cache" / ("index" + std::to_string(cache_index));
+    const auto level = read_sysfs_file(cache_path / "level");
+    if (!level) break;
+
+    const auto type = read_sysfs_file(cache_path / "type");
+    if (type == "Instruction") continue;
+
+    const auto level_number = std::stoi(*level);
+    if (level_number == 2) {
+      if (const auto size = read_sysfs_file(cache_path / "size")) layout.l2_cache_size = parse_cache_size(*size);
+    }
+
+    const auto shared_cpus = read_sysfs_file(cache_path / "shared_cpu_list");
+    if (level_number > last_level && shared_cpus) {
+      const auto shared_cpu_ids = parse_cpu_list(*shared_cpus);
+      if (shared_cpu_ids.empty()) continue;
+
+      last_level = level_number;
+      layout.cache_domain_id = *std::min_element(shared_cpu_ids.cbegin(), shared_cpu_ids.cend());
+    }
+  }
+
+  return layout;
+}
+
+}  // namespace
 
 namespace opossum {
 
@@ -29,13 +124,24 @@ Topology::Topology() { _init_default_topology(); }
 std::ostream& operator<<(std::ostream& stream, const TopologyNode& topology_node) {
   stream << "Number of Node CPUs: " << topology_node.cpus.size() << ", CPUIDs: [";
   for (size_t cpu_idx = 0; cpu_idx < topology_node.cpus.size(); ++cpu_idx) {
-    stream << topology_node.cpus[cpu_idx].cpu_id;
+    const auto& cpu = topology_node.cpus[cpu_idx];
+    stream << cpu.cpu_id;
+    if (cpu.core_id != cpu.cpu_id) stream << " (SMT sibling of " << cpu.core_id << ")";
     if (cpu_idx + 1 < topology_node.cpus.size()) {
       stream << ", ";
     }
   }
   stream << "]";
 
+  // Cache domains in the order of their first CPU
+  auto cache_domain_ids = std::vector<CpuID>{};
+  for (const auto& cpu : topology_node.cpus) {
+    if (std::find(cache_domain_ids.cbegin(), cache_domain_ids.cend(), cpu.cache_domain_id) == cache_domain_ids.cend()) {
+      cache_domain_ids.emplace_back(cpu.cache_domain_id);
+    }
+  }
+  stream << ", Cache domains: " << cache_domain_ids.size();
+
   return stream;
 }
 
@@ -49,6 +155,8 @@ void Topology::use_fake_numa_topology(uint32_t max_num_workers, uint32_t workers
   Topology::get()._init_fake_numa_topology(max_num_workers, workers_per_node);
 }
 
+void Topology::set_sysfs_cpu_path(const std::filesystem::path& path) { Topology::get()._sysfs_cpu_path = path; }
+
 void Topology::_init_default_topology(uint32_t max_num_cores) {
 #if !HYRISE_NUMA_SUPPORT
   _init_non_numa_topology(max_num_cores);
@@ -72,27 +180,23 @@ void Topology::_init_numa_topology(uint32_t max_num_cores) {
   auto max_node = numa_max_node();
   auto num_configured_cpus = static_cast<CpuID>(numa_num_configured_cpus());
   auto cpu_bitmask = numa_allocate_cpumask();
-  auto core_count = uint32_t{0};
 
   for (auto node_id = 0; node_id <= max_node; node_id++) {
-    if (max_num_cores == 0 || core_count < max_num_cores) {
-      auto cpus = std::vector<TopologyCpu>();
-
-      numa_node_to_cpus(node_id, cpu_bitmask);
-
-      for (CpuID cpu_id{0}; cpu_id < num_configured_cpus; ++cpu_id) {
-        if (numa_bitmask_isbitset(cpu_bitmask, cpu_id)) {
-          if (max_num_cores == 0 || core_count < max_num_cores) {
-            cpus.emplace_back(TopologyCpu(cpu_id));
-            _num_cpus++;
-          }
-          core_count++;
-        }
-      }
-
-      TopologyNode node(std::move(cpus));
-      _nodes.emplace_back(std::move(node));
+    if (max_num_cores != 0 && _num_cpus >= max_num_cores) break;
+
+    numa_node_to_cpus(node_id, cpu_bitmask);
+
+    auto cpu_ids = std::vector<CpuID>{};
+    for (CpuID cpu_id{0}; cpu_id < num_configured_cpus; ++cpu_id) {
+      if (numa_bitmask_isbitset(cpu_bitmask, cpu_id)) cpu_ids.emplace_back(cpu_id);
     }
+
+    const auto max_num_node_cpus = max_num_cores == 0 ? cpu_ids.size() : size_t{max_num_cores - _num_cpus};
+    auto cpus = _create_cpus(cpu_ids, max_num_node_cpus);
+    _num_cpus += static_cast<uint32_t>(cpus.size());
+
+    TopologyNode node(std::move(cpus));
+    _nodes.emplace_back(std::move(node));
   }
 
   _create_memory_resources();
@@ -105,16 +209,14 @@ void Topology::_init_non_numa_topology(uint32_t max_num_cores) {
   _clear();
   _fake_numa_topology = false;
 
-  _num_cpus = std::thread::hardware_concurrency();
-  if (max_num_cores != 0) {
-    _num_cpus = std::min(_num_cpus, max_num_cores);
+  const auto num_hardware_cpus = std::thread::hardware_concurrency();
+  auto cpu_ids = std::vector<CpuID>{};
+  for (auto cpu_id = CpuID{0}; cpu_id < num_hardware_cpus; cpu_id++) {
+    cpu_ids.emplace_back(cpu_id);
   }
 
-  auto cpus = std::vector<TopologyCpu>();
-
-  for (auto cpu_id = CpuID{0}; cpu_id < _num_cpus; cpu_id++) {
-    cpus.emplace_back(TopologyCpu(cpu_id));
-  }
+  auto cpus = _create_cpus(cpu_ids, max_num_cores == 0 ? cpu_ids.size() : size_t{max_num_cores});
+  _num_cpus = static_cast<uint32_t>(cpus.size());
 
   auto node = TopologyNode(std::move(cpus));
   _nodes.emplace_back(std::move(node));
@@ -139,13 +241,15 @@ void Topology::_init_fake_numa_topology(uint32_t max_num_workers, uint32_t worke
   auto cpu_id = CpuID{0};
 
   for (auto node_id = uint32_t{0}; node_id < num_nodes; node_id++) {
-    auto cpus = std::vector<TopologyCpu>();
+    auto cpu_ids = std::vector<CpuID>();
 
     for (auto worker_id = uint32_t{0}; worker_id < workers_per_node && cpu_id < num_workers; worker_id++) {
-      cpus.emplace_back(TopologyCpu(cpu_id));
+      cpu_ids.emplace_back(cpu_id);
       cpu_id++;
     }
 
+    // The fake nodes keep their consecutive CPUs, only their cores and cache domains are read
+    auto cpus = _create_cpus(cpu_ids, cpu_ids.size());
     auto node = TopologyNode(std::move(cpus));
 
     _nodes.emplace_back(std::move(node));
@@ -159,15 +263,54 @@ const std::vector<TopologyNode>& Topology::nodes() const { return _nodes; }
 
 size_t Topology::num_cpus() const { return _num_cpus; }
 
+size_t Topology::l2_cache_size() const { return _l2_cache_size; }
+
 boost::container::pmr::memory_resource* Topology::get_memory_resource(int node_id) {
   DebugAssert(node_id >= 0 && node_id < static_cast<int>(_nodes.size()), "node_id is out of bounds");
   return &_memory_resources[static_cast<size_t>(node_id)];
 }
 
+std::vector<TopologyCpu> Topology::_create_cpus(const std::vector<CpuID>& cpu_ids, const size_t max_num_cpus) {
+  auto cpus = std::vector<TopologyCpu>{};
+  cpus.reserve(cpu_ids.size());
+  for (const auto cpu_id : cpu_ids) {
+    const auto layout = read_cpu_layout(_sysfs_cpu_path, cpu_id);
+    if (layout.l2_cache_size) _l2_cache_size = *layout.l2_cache_size;
+
+    // Without information about the caches, all CPUs of the node are assumed to share them
+    cpus.emplace_back(TopologyCpu(cpu_id, layout.core_id.value_or(cpu_id),
+                                  layout.cache_domain_id.value_or(cpu_ids.front())));
+  }
+
+  if (cpus.size() <= max_num_cpus) return cpus;
+
+  // Use the first hardware thread of every physical core, then the second one, and so on. The rank of a CPU is the
+  // number of its siblings with a lower ID.
+  auto ranked_cpus = std::vector<std::pair<size_t, TopologyCpu>>{};
+  ranked_cpus.reserve(cpus.size());
+  for (const auto& cpu : cpus) {
+    const auto rank = std::count_if(cpus.cbegin(), cpus.cend(), [&](const auto& other_cpu) {
+      return other_cpu.core_id == cpu.core_id && other_cpu.cpu_id < cpu.cpu_id;
+    });
+    ranked_cpus.emplace_back(static_cast<size_t>(rank), cpu);
+  }
+  std::stable_sort(ranked_cpus.begin(), ranked_cpus.end(),
+                   [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
+  ranked_cpus.erase(ranked_cpus.begin() + static_cast<std::ptrdiff_t>(max_num_cpus), ranked_cpus.end());
+
+  cpus.clear();
+  for (const auto& [rank, cpu] : ranked_cpus) {
+    cpus.emplace_back(cpu);
+  }
+  std::sort(cpus.begin(), cpus.end(), [](const auto& lhs, const auto& rhs) { return lhs.cpu_id < rhs.cpu_id; });
+  return cpus;
+}
+
 void Topology::_clear() {
   _nodes.clear();
   _memory_resources.clear();
   _num_cpus = 0;
+  _l2_cache_size = DEFAULT_L2_CACHE_SIZE;
 }
 
 void Topology::_create_memory_resources() {
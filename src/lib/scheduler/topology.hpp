@@ -1,5 +1,6 @@
 #pragma once
 
+#include <filesystem>
 #include <memory>
 #include <ostream>
 #include <utility>
@@ -20,9 +21,18 @@ class memory_resource;
 namespace opossum {
 
 struct TopologyCpu final {
-  explicit TopologyCpu(CpuID cpu_id) : cpu_id(cpu_id) {}
+  explicit TopologyCpu(CpuID cpu_id) : cpu_id(cpu_id), core_id(cpu_id), cache_domain_id(cpu_id) {}
+  TopologyCpu(CpuID cpu_id, CpuID core_id, CpuID cache_domain_id)
+      : cpu_id(cpu_id), core_id(core_id), cache_domain_id(cache_domain_id) {}
 
   CpuID cpu_id = INVALID_CPU_ID;
+
+  // Lowest ID of the hardware threads that share a physical core with this CPU (i.e., its SMT siblings)
+  CpuID core_id = INVALID_CPU_ID;
+
+  // Lowest ID of the CPUs that share the last-level cache with this CPU. Workers prefer to steal from workers of the
+  // same cache domain, see Worker::_steal_task().
+  CpuID cache_domain_id = INVALID_CPU_ID;
 };
 
 struct TopologyNode final {
@@ -39,6 +49,11 @@ std::ostream& operator<<(std::ostream& stream, const TopologyNode& topology_node
  * if needed, e.g. for testing purposes.
  *
  * The static 'use_*_topology()' methods replace the current topology information by the new one, and should be used carefully.
+ *
+ * The physical cores and the caches of the CPUs are read from sysfs (/sys/devices/system/cpu). If the information is
+ * not available (e.g., on macOS), each CPU is its own core and all CPUs of a node share one cache domain. When fewer
+ * cores are requested than the system has, one hardware thread of each physical core is used before its SMT siblings
+ * are, as two workers on the same core compete for its execution units and its L1/L2 caches.
  */
 class Topology final : public Singleton<Topology> {
  public:
@@ -79,10 +94,25 @@ class Topology final : public Singleton<Topology> {
    */
   static void use_fake_numa_topology(uint32_t max_num_workers = 0, uint32_t workers_per_node = 1);
 
+  /**
+   * Read the layout of the CPUs from @param path instead of /sys/devices/system/cpu, e.g., for testing purposes.
+   * Only affects topologies that are initialized afterwards.
+   */
+  static void set_sysfs_cpu_path(const std::filesystem::path& path);
+
+  static constexpr auto DEFAULT_SYSFS_CPU_PATH = "/sys/devices/system/cpu";
+  static constexpr auto DEFAULT_L2_CACHE_SIZE = size_t{256'000};
+
   const std::vector<TopologyNode>& nodes() const;
 
   size_t num_cpus() const;
 
+  /**
+   * Size of the L2 cache of a core in bytes, DEFAULT_L2_CACHE_SIZE if it cannot be read from sysfs. Used to size the
+   * partitions of operators such as the JoinHash.
+   */
+  size_t l2_cache_size() const;
+
   boost::container::pmr::memory_resource* get_memory_resource(int node_id);
 
  private:
@@ -95,11 +125,20 @@ class Topology final : public Singleton<Topology> {
   void _init_non_numa_topology(uint32_t max_num_cores = 0);
   void _init_fake_numa_topology(uint32_t max_num_workers = 0, uint32_t workers_per_node = 1);
 
+  /**
+   * Reads the physical core and the cache domain of each CPU in @param cpu_ids and returns at most @param max_num_cpus
+   * of them, ordered by their ID. If the CPUs have to be limited, SMT siblings are only used once each physical core
+   * has a CPU. Also updates the L2 cache size.
+   */
+  std::vector<TopologyCpu> _create_cpus(const std::vector<CpuID>& cpu_ids, size_t max_num_cpus);
+
   void _clear();
   void _create_memory_resources();
 
   std::vector<TopologyNode> _nodes;
   uint32_t _num_cpus{0};
+  size_t _l2_cache_size{DEFAULT_L2_CACHE_SIZE};
+  std::filesystem::path _sysfs_cpu_path{DEFAULT_SYSFS_CPU_PATH};
   bool _fake_numa_topology{false};
 
   static const int _number_of_hardware_nodes;
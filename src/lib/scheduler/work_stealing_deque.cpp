@@ -0,0 +1,118 @@
+#include "work_stealing_deque.hpp"
+
+#include <memory>
+#include <utility>
+
+#include "abstract_task.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+WorkStealingDeque::Buffer::Buffer(const size_t init_capacity)
+    : capacity(init_capacity), slots(std::make_unique<std::atomic<AbstractTask*>[]>(init_capacity)) {
+  DebugAssert((capacity & (capacity - 1)) == 0, "Capacity must be a power of two");
+}
+
+AbstractTask* WorkStealingDeque::Buffer::get(const int64_t index) const {
+  return slots[static_cast<size_t>(index) & (capacity - 1)].load(std::memory_order_relaxed);
+}
+
+void WorkStealingDeque::Buffer::put(const int64_t index, AbstractTask* task) {
+  slots[static_cast<size_t>(index) & (capacity - 1)].store(task, std::memory_order_relaxed);
+}
+
+WorkStealingDeque::WorkStealingDeque() {
+  _buffers.emplace_back(std::make_unique<Buffer>(INITIAL_CAPACITY));
+  _buffer.store(_buffers.back().get(), std::memory_order_relaxed);
+}
+
+WorkStealingDeque::~WorkStealingDeque() {
+  // Release the tasks that were never executed
+  while (pop()) {
+  }
+}
+
+void WorkStealingDeque::push(const std::shared_ptr<AbstractTask>& task) {
+  const auto bottom = _bottom.load(std::memory_order_relaxed);
+  const auto top = _top.load(std::memory_order_acquire);
+  auto buffer = _buffer.load(std::memory_order_relaxed);
+
+  if (bottom - top > static_cast<int64_t>(buffer->capacity) - 1) {
+    buffer = _grow(buffer, bottom, top);
+  }
+
+  task->_enqueued_self_reference = task;
+  buffer->put(bottom, task.get());
+
+  // Publish the task (and its self reference) before it becomes visible to thieves
+  std::atomic_thread_fence(std::memory_order_release);
+  _bottom.store(bottom + 1, std::memory_order_relaxed);
+}
+
+std::shared_ptr<AbstractTask> WorkStealingDeque::pop() {
+  const auto bottom = _bottom.load(std::memory_order_relaxed) - 1;
+  const auto buffer = _buffer.load(std::memory_order_relaxed);
+  _bottom.store(bottom, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  auto top = _top.load(std::memory_order_relaxed);
+
+  if (top > bottom) {
+    // The deque was empty
+    _bottom.store(bottom + 1, std::memory_order_relaxed);
+    return nullptr;
+  }
+
+  auto task = buffer->get(bottom);
+  if (top == bottom) {
+    // This is the last task, thieves might compete for it
+    if (!_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+      task = nullptr;
+    }
+    _bottom.store(bottom + 1, std::memory_order_relaxed);
+  }
+
+  return task ? _take_ownership(task) : nullptr;
+}
+
+std::shared_ptr<AbstractTask> WorkStealingDeque::steal() {
+  auto top = _top.load(std::memory_order_acquire);
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  const auto bottom = _bottom.load(std::memory_order_acquire);
+
+  if (top >= bottom) return nullptr;
+
+  // The task has to be read before the CAS, as the owner might overwrite the slot once top was incremented
+  const auto task = _buffer.load(std::memory_order_acquire)->get(top);
+  if (!_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+    return nullptr;
+  }
+
+  return _take_ownership(task);
+}
+
+bool WorkStealingDeque::empty() const {
+  return _bottom.load(std::memory_order_relaxed) <= _top.load(std::memory_order_relaxed);
+}
+
+size_t WorkStealingDeque::size() const {
+  const auto size = _bottom.load(std::memory_order_relaxed) - _top.load(std::memory_order_relaxed);
+  return size > 0 ? static_cast<size_t>(size) : size_t{0};
+}
+
+WorkStealingDeque::Buffer* WorkStealingDeque::_grow(Buffer* buffer, const int64_t bottom, const int64_t top) {
+  auto new_buffer = std::make_unique<Buffer>(buffer->capacity * 2);
+  for (auto index = top; index < bottom; ++index) {
+    new_buffer->put(index, buffer->get(index));
+  }
+
+  _buffers.emplace_back(std::move(new_buffer));
+  _buffer.store(_buffers.back().get(), std::memory_order_release);
+  return _buffers.back().get();
+}
+
+std::shared_ptr<AbstractTask> WorkStealingDeque::_take_ownership(AbstractTask* task) {
+  // Only the single worker that removed the task from the deque gets here
+  return std::move(task->_enqueued_self_reference);
+}
+
+}  // namespace opossum
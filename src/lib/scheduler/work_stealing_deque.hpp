@@ -0,0 +1,81 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractTask;
+
+/**
+ * A lock-free work-stealing deque as described by Chase and Lev (https://doi.org/10.1145/1073970.1073974), using the
+ * C11 memory orderings of Lê et al. (https://doi.org/10.1145/2442516.2442524).
+ *
+ * Each Worker owns one deque. Only the owner pushes and pops at the bottom, so its tasks are executed LIFO, which
+ * keeps the data of recently spawned tasks in the cache. Other workers steal from the top, i.e., the oldest tasks,
+ * which are usually the largest ones. Owner and thieves only synchronize when they compete for the last task.
+ *
+ * The deque stores raw pointers, so that slots can be accessed atomically. While a task is enqueued, it is kept alive
+ * by a reference to itself (AbstractTask::_enqueued_self_reference), which the worker that pops or steals it takes
+ * over. The ring buffer grows when it is full. Replaced buffers are kept until the deque is destroyed, as thieves might
+ * still read from them.
+ */
+class WorkStealingDeque : private Noncopyable {
+ public:
+  static constexpr auto INITIAL_CAPACITY = size_t{256};
+
+  WorkStealingDeque();
+  ~WorkStealingDeque();
+
+  /**
+   * Adds a task at the bottom. Must only be called by the owner.
+   */
+  void push(const std::shared_ptr<AbstractTask>& task);
+
+  /**
+   * Removes the task at the bottom, i.e., the most recently pushed one. Must only be called by the owner.
+   * Returns nullptr if the deque is empty.
+   */
+  std::shared_ptr<AbstractTask> pop();
+
+  /**
+   * Removes the task at the top, i.e., the oldest one. Can be called by any thread. Returns nullptr if the deque is
+   * empty or if another thread took the task first.
+   */
+  std::shared_ptr<AbstractTask> steal();
+
+  /**
+   * Only a snapshot, as other threads might push or steal concurrently
+   */
+  bool empty() const;
+  size_t size() const;
+
+ protected:
+  struct Buffer {
+    explicit Buffer(const size_t init_capacity);
+
+    AbstractTask* get(const int64_t index) const;
+    void put(const int64_t index, AbstractTask* task);
+
+    const size_t capacity;
+    std::unique_ptr<std::atomic<AbstractTask*>[]> slots;
+  };
+
+  Buffer* _grow(Buffer* buffer, const int64_t bottom, const int64_t top);
+
+  static std::shared_ptr<AbstractTask> _take_ownership(AbstractTask* task);
+
+  // Padded to separate cache lines, as _top is written by thieves and _bottom by the owner
+  alignas(64) std::atomic<int64_t> _top{0};
+  alignas(64) std::atomic<int64_t> _bottom{0};
+  alignas(64) std::atomic<Buffer*> _buffer;
+
+  // All buffers ever used, including the current one. Only modified by the owner.
+  std::vector<std::unique_ptr<Buffer>> _buffers;
+};
+
+}  // namespace opossum
@@ -8,12 +8,14 @@
 #include <iostream>
 #include <memory>
 #include <mutex>
+#include <random>
 #include <thread>
 #include <vector>
 
 #include "abstract_scheduler.hpp"
 #include "abstract_task.hpp"
 #include "current_scheduler.hpp"
+#include "task_group.hpp"
 #include "task_queue.hpp"
 
 namespace {
@@ -23,24 +25,33 @@ namespace {
  * Uses a weak_ptr, because otherwise the ref-count of it would not reach zero within the main() scope of the program.
  */
 thread_local std::weak_ptr<opossum::Worker> this_thread_worker;
-}  // namespace
 
-// The sleep time was determined experimentally
-static constexpr auto WORKER_SLEEP_TIME = std::chrono::microseconds(300);
+// The statistics of a worker are only written by its own thread, so they do not need an atomic read-modify-write
+void add_to_counter(std::atomic<uint64_t>& counter, const uint64_t value) {
+  counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+}
+
+uint64_t nanoseconds_since(const std::chrono::steady_clock::time_point time_point) {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - time_point).count();
+}
+
+}  // namespace
 
 namespace opossum {
 
 std::shared_ptr<Worker> Worker::get_this_thread_worker() { return ::this_thread_worker.lock(); }
 
-Worker::Worker(const std::shared_ptr<TaskQueue>& queue, WorkerID id, CpuID cpu_id)
-    : _queue(queue), _id(id), _cpu_id(cpu_id) {}
+Worker::Worker(const std::shared_ptr<TaskQueue>& queue, WorkerID id, CpuID cpu_id, CpuID cache_domain_id)
+    : _queue(queue), _id(id), _cpu_id(cpu_id), _cache_domain_id(cache_domain_id), _random_engine(id + 1) {}
 
 WorkerID Worker::id() const { return _id; }
 
-std::shared_ptr<TaskQueue> Worker::queue() const { return _queue; }
+const std::shared_ptr<TaskQueue>& Worker::queue() const { return _queue; }
 
 CpuID Worker::cpu_id() const { return _cpu_id; }
 
+CpuID Worker::cache_domain_id() const { return _cache_domain_id; }
+
 void Worker::operator()() {
   Assert(this_thread_worker.expired(), "Thread already has a worker");
 
@@ -54,36 +65,127 @@ void Worker::operator()() {
 }
 
 void Worker::_work() {
-  auto task = _queue->pull();
-
-  if (!task) {
-    // Simple work stealing without explicitly transferring data between nodes.
-    auto work_stealing_successful = false;
-    for (auto& queue : CurrentScheduler::get()->queues()) {
-      if (queue == _queue) {
-        continue;
-      }
+  if (_try_execute_task()) return;
+
+  // Park until a task is pushed. As it might have been pushed after the last check, check once more after announcing
+  // that this worker is about to park (see TaskQueue::prepare_park()).
+  const auto epoch = _queue->prepare_park();
+  const auto task = _find_task();
+  if (task || !CurrentScheduler::get()->active()) {
+    _queue->cancel_park();
+    if (task) _execute_task(task);
+    return;
+  }
+
+  const auto parked = std::chrono::steady_clock::now();
+  _queue->park(epoch);
+  add_to_counter(_statistics.idle_nanoseconds, nanoseconds_since(parked));
+}
+
+bool Worker::_try_execute_task(const TaskFilter& filter) {
+  const auto task = _find_task(filter);
+  if (!task) return false;
 
-      task = queue->steal();
-      if (task) {
-        task->set_node_id(_queue->node_id());
-        work_stealing_successful = true;
-        break;
+  _execute_task(task);
+  return true;
+}
+
+std::shared_ptr<AbstractTask> Worker::_find_task(const TaskFilter& filter) {
+  // The most recently pushed task of this worker is the most likely to find its data in the cache. However, if the
+  // TaskQueue holds tasks of a group that received less than its fair share, one of them is executed first.
+  if (auto task = _pop_task(filter)) {
+    if (_queue->has_group_behind(*task->group())) {
+      if (auto queued_task = _queue->pull(filter)) {
+        _deque.push(task);
+        return queued_task;
       }
     }
+    return task;
+  }
+
+  // Tasks scheduled from outside the workers, tasks that must not be stolen, and tasks for this node
+  if (auto task = _queue->pull(filter)) return task;
+
+  const auto steal_started = std::chrono::steady_clock::now();
+  auto task = _steal_task(filter);
+  add_to_counter(_statistics.steal_nanoseconds, nanoseconds_since(steal_started));
+  add_to_counter(task ? _statistics.successful_steal_count : _statistics.failed_steal_count, 1);
+  return task;
+}
+
+std::shared_ptr<AbstractTask> Worker::_pop_task(const TaskFilter& filter) {
+  if (!filter) return _deque.pop();
+
+  // Only this worker pops from its deque, so the rejected tasks can be pushed back in their original order
+  auto rejected_tasks = std::vector<std::shared_ptr<AbstractTask>>{};
+  auto task = _deque.pop();
+  while (task && !filter(*task)) {
+    rejected_tasks.emplace_back(std::move(task));
+    task = _deque.pop();
+  }
+
+  for (auto rejected_task_iter = rejected_tasks.rbegin(); rejected_task_iter != rejected_tasks.rend();
+       ++rejected_task_iter) {
+    _deque.push(*rejected_task_iter);
+  }
+  return task;
+}
 
-    // If there is no ready task neither in our queue nor in any other, worker waits for a new task to be pushed to the
-    // own queue or returns after timer exceeded (whatever occurs first).
-    if (!work_stealing_successful) {
-      {
-        std::unique_lock<std::mutex> unique_lock(_queue->lock);
-        _queue->new_task.wait_for(unique_lock, WORKER_SLEEP_TIME);
+std::shared_ptr<AbstractTask> Worker::_steal_task(const TaskFilter& filter) {
+  const auto& workers = CurrentScheduler::get()->workers();
+  const auto& queues = CurrentScheduler::get()->queues();
+  const auto first_victim = std::uniform_int_distribution<size_t>{0, workers.size() - 1}(_random_engine);
+
+  // A stolen task cannot be returned to the deque it was stolen from, so the deques of other workers are only searched
+  // without a filter. Their tasks are executed by their owners or by idle workers.
+  if (!filter) {
+    // Steal from the workers of the same node first, as they share the memory with this worker. Among them, the
+    // workers that share the last-level cache come first, as the data their tasks work on might still be cached.
+    // Starting at a random victim spreads the thieves over the workers.
+    for (const auto same_cache_domain : {true, false}) {
+      for (auto victim_offset = size_t{0}; victim_offset < workers.size(); ++victim_offset) {
+        const auto& victim = workers[(first_victim + victim_offset) % workers.size()];
+        if (victim.get() == this || victim->queue() != _queue) continue;
+        if ((victim->cache_domain_id() == _cache_domain_id) != same_cache_domain) continue;
+
+        if (auto task = victim->steal()) return task;
       }
-      return;
     }
   }
 
+  // Steal from other nodes without explicitly transferring data between them. Only stealable tasks are pushed to the
+  // deques of the workers, the TaskQueues check whether a task can be stolen.
+  auto task = std::shared_ptr<AbstractTask>{};
+  for (auto victim_offset = size_t{0}; victim_offset < workers.size() && !task && !filter; ++victim_offset) {
+    const auto& victim = workers[(first_victim + victim_offset) % workers.size()];
+    if (victim->queue() == _queue) continue;
+
+    task = victim->steal();
+  }
+
+  for (auto queue_iter = queues.cbegin(); queue_iter != queues.cend() && !task; ++queue_iter) {
+    if (*queue_iter == _queue) continue;
+
+    task = (*queue_iter)->steal(filter);
+  }
+
+  if (task) task->set_node_id(_queue->node_id());
+  return task;
+}
+
+void Worker::_execute_task(const std::shared_ptr<AbstractTask>& task) {
+  const auto started = std::chrono::steady_clock::now();
   task->execute();
+  const auto execution_duration = std::chrono::steady_clock::now() - started;
+
+  _statistics.task_wait_durations.record(started - task->enqueue_time());
+  _statistics.task_execution_durations.record(execution_duration);
+  // Tasks executed while another task waits are already part of the outer task's execution duration
+  if (_wait_depth == 0) {
+    add_to_counter(_statistics.busy_nanoseconds,
+                   std::chrono::duration_cast<std::chrono::nanoseconds>(execution_duration).count());
+  }
+  _queue->advance_virtual_runtime(task->group()->virtual_runtime());
 
   // This is part of the Scheduler shutdown system. Count the number of tasks a Worker executed to allow the
   // Scheduler to determine whether all tasks finished
@@ -97,8 +199,43 @@ void Worker::join() {
   _thread.join();
 }
 
+void Worker::push(const std::shared_ptr<AbstractTask>& task) {
+  DebugAssert(get_this_thread_worker().get() == this, "Only the worker itself can push to its deque");
+  DebugAssert(task->is_stealable(), "Tasks that must not be stolen have to be pushed to a TaskQueue");
+
+  // Someone else was first to enqueue this task? No problem!
+  if (!task->try_mark_as_enqueued()) return;
+
+  task->set_node_id(_queue->node_id());
+  _deque.push(task);
+
+  _queue->notify_new_task();
+}
+
+void Worker::push(const std::vector<std::shared_ptr<AbstractTask>>& tasks) {
+  DebugAssert(get_this_thread_worker().get() == this, "Only the worker itself can push to its deque");
+
+  auto pushed_task_count = size_t{0};
+  for (const auto& task : tasks) {
+    DebugAssert(task->is_stealable(), "Tasks that must not be stolen have to be pushed to a TaskQueue");
+    if (!task->try_mark_as_enqueued()) continue;
+
+    task->set_node_id(_queue->node_id());
+    _deque.push(task);
+    ++pushed_task_count;
+  }
+
+  _queue->notify_new_tasks(pushed_task_count);
+}
+
+std::shared_ptr<AbstractTask> Worker::steal() { return _deque.steal(); }
+
 uint64_t Worker::num_finished_tasks() const { return _num_finished_tasks; }
 
+const Worker::Statistics& Worker::statistics() const { return _statistics; }
+
+size_t Worker::deque_size() const { return _deque.size(); }
+
 void Worker::_set_affinity() {
 #if HYRISE_NUMA_SUPPORT
   cpu_set_t cpuset;
@@ -1,41 +1,110 @@
 #pragma once
 
+#include <algorithm>
 #include <atomic>
 #include <memory>
+#include <random>
 #include <thread>
 #include <vector>
 
+#include "task_group.hpp"
+#include "task_queue.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
+#include "utils/duration_histogram.hpp"
+#include "work_stealing_deque.hpp"
 
 namespace opossum {
 
-class TaskQueue;
+class AbstractTask;
 
 /**
  * To be executed on a separate Thread, fetches and executes tasks until the queue is empty AND the shutdown flag is set
  * Ideally there should be one Worker actively doing work per CPU, but multiple might be active occasionally
+ *
+ * Tasks scheduled by the worker's own tasks are pushed to its WorkStealingDeque and executed LIFO. When the deque is
+ * empty, the worker pulls from its node's TaskQueue and then steals from other workers, preferring those that share its
+ * last-level cache, see Worker::_find_task().
+ * Before executing a task from its deque, the worker checks whether a TaskGroup that received less than its fair share
+ * waits in the TaskQueue (see TaskQueue::has_group_behind()).
+ * If there is no task anywhere, the worker parks until a new task is pushed.
+ * While a task waits for the tasks of a group that is subject to admission control, the worker only executes tasks of
+ * such groups, see Worker::_wait_for_tasks().
  */
 class Worker : public std::enable_shared_from_this<Worker>, private Noncopyable {
   friend class CurrentScheduler;
 
  public:
+  /**
+   * While a task waits for other tasks (see CurrentScheduler::wait_for_tasks()), its worker executes other tasks,
+   * which might wait themselves. Each of these nested waits adds to the worker's stack. Beyond this depth, a wait only
+   * executes the tasks it waits for. Tasks that do not need to wait can use
+   * CurrentScheduler::schedule_tasks_with_continuation() instead.
+   */
+  static constexpr auto MAX_NESTED_WAIT_DEPTH = size_t{8};
+
+  /**
+   * Counters that the worker updates while it runs, see MetaTableManager::generate_workers_table(). Only the worker's
+   * thread writes them, so they cost a relaxed store. Other threads read a snapshot.
+   */
+  struct Statistics : private Noncopyable {
+    // Time spent executing tasks, including the time a task waited for other tasks
+    std::atomic<uint64_t> busy_nanoseconds{0};
+
+    // Time spent parked, as there was no task anywhere
+    std::atomic<uint64_t> idle_nanoseconds{0};
+
+    // Time spent searching the deques of other workers and the TaskQueues of other nodes for a task
+    std::atomic<uint64_t> steal_nanoseconds{0};
+    std::atomic<uint64_t> successful_steal_count{0};
+    std::atomic<uint64_t> failed_steal_count{0};
+
+    // Time from pushing a task to a deque or TaskQueue until its execution started
+    DurationHistogram task_wait_durations;
+
+    // Time from the start of a task's execution until it was done
+    DurationHistogram task_execution_durations;
+  };
+
   static std::shared_ptr<Worker> get_this_thread_worker();
 
-  Worker(const std::shared_ptr<TaskQueue>& queue, WorkerID id, CpuID cpu_id);
+  Worker(const std::shared_ptr<TaskQueue>& queue, WorkerID id, CpuID cpu_id, CpuID cache_domain_id);
 
   /**
    * Unique ID of a worker. Currently not in use, but really helpful for debugging.
    */
   WorkerID id() const;
-  std::shared_ptr<TaskQueue> queue() const;
+  const std::shared_ptr<TaskQueue>& queue() const;
   CpuID cpu_id() const;
 
+  /**
+   * The CPUs that share the last-level cache, see TopologyCpu::cache_domain_id
+   */
+  CpuID cache_domain_id() const;
+
   void start();
   void join();
 
+  /**
+   * Pushes a ready task to the worker's own deque. Must only be called from the worker's thread.
+   */
+  void push(const std::shared_ptr<AbstractTask>& task);
+  void push(const std::vector<std::shared_ptr<AbstractTask>>& tasks);
+
+  /**
+   * Takes the oldest task from the worker's deque. Called by other workers when they are idle.
+   */
+  std::shared_ptr<AbstractTask> steal();
+
   uint64_t num_finished_tasks() const;
 
+  const Statistics& statistics() const;
+
+  /**
+   * Number of tasks in the worker's deque. Only a snapshot.
+   */
+  size_t deque_size() const;
+
   void operator=(const Worker&) = delete;
   void operator=(Worker&&) = delete;
 
@@ -55,11 +124,55 @@ class Worker : public std::enable_shared_from_this<Worker>, private Noncopyable
       return true;
     };
 
+    const auto is_awaited = [&tasks](const auto& task) {
+      return std::any_of(tasks.cbegin(), tasks.cend(), [&](const auto& awaited_task) {
+        return awaited_task.get() == &task;
+      });
+    };
+
+    // The tasks of unrestricted groups, e.g., those of the server, start new statements, which request admission for
+    // their own groups (see SQLPipelineStatement::get_result_table()). If such a task was executed while the worker
+    // waits for the tasks of an admission-controlled group, its statement might queue up behind that group. As nested
+    // waits return in LIFO order, the group would only be released after the nested statement finished, which waits
+    // for that very release. Thus, as long as such a wait is on the worker's stack, it only executes the tasks of
+    // admission-controlled groups and the tasks it waits for.
+    const auto restricts_groups =
+        !_executes_admission_controlled_tasks_only && std::any_of(tasks.cbegin(), tasks.cend(), [](const auto& task) {
+          return task->group()->admission_state() != TaskGroup::AdmissionState::Unrestricted;
+        });
+    if (restricts_groups) _executes_admission_controlled_tasks_only = true;
+
+    // Waiting tasks do not push new tasks, so the worker must not park here. Beyond MAX_NESTED_WAIT_DEPTH, the worker
+    // only executes the tasks it waits for, as any other task might wait as well and deepen the stack further. Once
+    // all of them are executed by other workers, it waits for them without executing anything.
+    ++_wait_depth;
+    auto filter = TaskFilter{};
+    if (_wait_depth > MAX_NESTED_WAIT_DEPTH) {
+      filter = is_awaited;
+    } else if (_executes_admission_controlled_tasks_only) {
+      filter = [&](const auto& task) {
+        return task.group()->admission_state() != TaskGroup::AdmissionState::Unrestricted || is_awaited(task);
+      };
+    }
+
     while (!tasks_completed()) {
-      _work();
+      if (!_try_execute_task(filter)) std::this_thread::yield();
     }
+    --_wait_depth;
+
+    if (restricts_groups) _executes_admission_controlled_tasks_only = false;
   }
 
+  // Executes a task that is accepted by @param filter if one can be found, returns false otherwise
+  bool _try_execute_task(const TaskFilter& filter = nullptr);
+
+  std::shared_ptr<AbstractTask> _find_task(const TaskFilter& filter = nullptr);
+
+  // Pops the most recently pushed task of the own deque that is accepted by @param filter
+  std::shared_ptr<AbstractTask> _pop_task(const TaskFilter& filter);
+  std::shared_ptr<AbstractTask> _steal_task(const TaskFilter& filter);
+  void _execute_task(const std::shared_ptr<AbstractTask>& task);
+
  private:
   /**
    * Pin a worker to a particular core.
@@ -70,8 +183,21 @@ class Worker : public std::enable_shared_from_this<Worker>, private Noncopyable
   std::shared_ptr<TaskQueue> _queue;
   WorkerID _id;
   CpuID _cpu_id;
+  CpuID _cache_domain_id;
   std::thread _thread;
   std::atomic<uint64_t> _num_finished_tasks{0};
+  Statistics _statistics;
+
+  WorkStealingDeque _deque;
+
+  // Number of nested calls to _wait_for_tasks(), only accessed by the worker's thread
+  size_t _wait_depth{0};
+
+  // Set while a wait for the tasks of an admission-controlled group is on the stack, see _wait_for_tasks()
+  bool _executes_admission_controlled_tasks_only{false};
+
+  // Used to pick the first victim for stealing, only accessed by the worker's thread
+  std::minstd_rand _random_engine;
 };
 
 }  // namespace opossum
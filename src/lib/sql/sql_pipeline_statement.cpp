@@ -3,6 +3,7 @@
 #include <boost/algorithm/string.hpp>
 
 #include <iomanip>
+#include <optional>
 #include <utility>
 
 #include "SQLParser.h"
@@ -11,7 +12,9 @@
 #include "expression/value_expression.hpp"
 #include "logical_query_plan/lqp_utils.hpp"
 #include "optimizer/optimizer.hpp"
+#include "scheduler/abstract_scheduler.hpp"
 #include "scheduler/current_scheduler.hpp"
+#include "scheduler/task_group.hpp"
 #include "sql/sql_pipeline_builder.hpp"
 #include "sql/sql_plan_cache.hpp"
 #include "sql/sql_translator.hpp"
@@ -192,7 +195,25 @@ const std::shared_ptr<const Table>& SQLPipelineStatement::get_result_table() {
 
   DTRACE_PROBE3(HYRISE, TASKS_PER_STATEMENT, reinterpret_cast<uintptr_t>(&tasks), _sql_string.c_str(),
                 reinterpret_cast<uintptr_t>(this));
-  CurrentScheduler::schedule_and_wait_for_tasks(tasks);
+  if (CurrentScheduler::is_set()) {
+    // The tasks are executed in their own TaskGroup, so that they share the workers fairly with concurrent queries and
+    // count against the scheduler's limit of admitted queries. The group inherits the weight of the current group,
+    // e.g., of a session. A statement that is executed by a task of an admitted query shares the query's group, as
+    // waiting for admission again could deadlock.
+    const auto scheduler = CurrentScheduler::get();
+    const auto& current_group = TaskGroup::current();
+    const auto own_group = current_group->admission_state() == TaskGroup::AdmissionState::Unrestricted;
+    _task_group = own_group ? std::make_shared<TaskGroup>(_sql_string, current_group->weight()) : current_group;
+
+    // The admission is released even if an operator throws, e.g., when the server reports the error and carries on
+    auto admission = std::optional<AbstractScheduler::Admission>{};
+    if (own_group) admission.emplace(scheduler, _task_group);
+
+    const auto task_group_scope = TaskGroup::Scope{_task_group};
+    CurrentScheduler::schedule_and_wait_for_tasks(tasks);
+  } else {
+    CurrentScheduler::schedule_and_wait_for_tasks(tasks);
+  }
 
   if (_auto_commit) {
     _transaction_context->commit();
@@ -217,4 +238,6 @@ const std::shared_ptr<TransactionContext>& SQLPipelineStatement::transaction_con
 }
 
 const std::shared_ptr<SQLPipelineStatementMetrics>& SQLPipelineStatement::metrics() const { return _metrics; }
+
+const std::shared_ptr<TaskGroup>& SQLPipelineStatement::task_group() const { return _task_group; }
 }  // namespace opossum
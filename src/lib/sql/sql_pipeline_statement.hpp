@@ -11,6 +11,8 @@
 
 namespace opossum {
 
+class TaskGroup;
+
 // Holds relevant information about the execution of an SQLPipelineStatement.
 struct SQLPipelineStatementMetrics {
   std::chrono::nanoseconds sql_translation_duration{};
@@ -71,6 +73,10 @@ class SQLPipelineStatement : public Noncopyable {
 
   const std::shared_ptr<SQLPipelineStatementMetrics>& metrics() const;
 
+  // Returns the TaskGroup the statement's tasks were executed in, which holds their scheduling statistics. This is a
+  // nullptr if the statement was not executed yet or was executed without a scheduler.
+  const std::shared_ptr<TaskGroup>& task_group() const;
+
  private:
   const std::string _sql_string;
   const UseMvcc _use_mvcc;
@@ -96,6 +102,8 @@ class SQLPipelineStatement : public Noncopyable {
 
   std::shared_ptr<SQLPipelineStatementMetrics> _metrics;
 
+  std::shared_ptr<TaskGroup> _task_group;
+
   // Delete temporary tables
   const CleanupTemporaries _cleanup_temporaries;
 };
@@ -52,6 +52,7 @@
 #include "logical_query_plan/update_node.hpp"
 #include "logical_query_plan/validate_node.hpp"
 #include "storage/lqp_view.hpp"
+#include "storage/meta_table_manager.hpp"
 #include "storage/storage_manager.hpp"
 #include "storage/table.hpp"
 
@@ -268,6 +269,7 @@ std::shared_ptr<AbstractExpression> SQLTranslator::translate_hsql_expr(const hsq
 
 std::shared_ptr<AbstractLQPNode> SQLTranslator::_translate_insert(const hsql::InsertStatement& insert) {
   const auto table_name = std::string{insert.tableName};
+  AssertInput(!MetaTableManager::is_meta_table_name(table_name), "Cannot insert into meta table " + table_name);
   const auto target_table = StorageManager::get().get_table(table_name);
   auto insert_data_node = std::shared_ptr<AbstractLQPNode>{};
   auto column_expressions = std::vector<std::shared_ptr<AbstractExpression>>{};
@@ -368,6 +370,9 @@ std::shared_ptr<AbstractLQPNode> SQLTranslator::_translate_insert(const hsql::In
 }
 
 std::shared_ptr<AbstractLQPNode> SQLTranslator::_translate_delete(const hsql::DeleteStatement& delete_statement) {
+  AssertInput(!MetaTableManager::is_meta_table_name(delete_statement.tableName),
+              std::string{"Cannot delete from meta table "} + delete_statement.tableName);
+
   const auto sql_identifier_resolver = std::make_shared<SQLIdentifierResolver>();
   auto data_to_delete_node = _translate_stored_table(delete_statement.tableName, sql_identifier_resolver);
 
@@ -385,6 +390,7 @@ std::shared_ptr<AbstractLQPNode> SQLTranslator::_translate_update(const hsql::Up
   AssertInput(update.table->type == hsql::kTableName, "UPDATE can only reference table by name");
 
   const auto table_name = std::string{update.table->name};
+  AssertInput(!MetaTableManager::is_meta_table_name(table_name), "Cannot update meta table " + table_name);
 
   auto translation_state = _translate_table_ref(*update.table);
 
@@ -543,7 +549,7 @@ std::shared_ptr<AbstractLQPNode> SQLTranslator::_translate_stored_table(
   const auto stored_table_node = StoredTableNode::make(name);
   const auto validated_stored_table_node = _validate_if_active(stored_table_node);
 
-  const auto table = StorageManager::get().get_table(name);
+  const auto table = stored_table_node->table();
 
   // Publish the columns of the table in the SQLIdentifierResolver
   for (auto column_id = ColumnID{0}; column_id < table->column_count(); ++column_id) {
@@ -908,8 +914,8 @@ void SQLTranslator::_translate_select_list_groupby_having(const hsql::SelectStat
   //
   // This might create unnecessary aggregate nodes when we already have an aggregation that creates unique results:
   // `SELECT DISTINCT a, MIN(b) FROM t GROUP BY a` would have one aggregate that groups by a and calculates MIN(b), and
-  // one that groups by both a and MIN(b) without calculating anything. Fixing this should be done by an optimizer rule
-  // that checks for each GROUP BY whether it guarantees the results to be unique or not. Doable, but no priority.
+  // one that groups by both a and MIN(b) without calculating anything. The DependentGroupByReductionRule removes such
+  // AggregateNodes if their input is known to be unique (see lqp_is_unique_on()).
   if (select.selectDistinct) {
     _current_lqp = AggregateNode::make(_inflated_select_list_expressions,
                                        std::vector<std::shared_ptr<AbstractExpression>>{}, _current_lqp);
@@ -1251,6 +1257,9 @@ std::shared_ptr<AbstractExpression> SQLTranslator::_translate_hsql_expr(
               return std::make_shared<AggregateExpression>(
                   aggregate_function, _translate_hsql_expr(*expr.exprList->front(), sql_identifier_resolver));
             }
+
+          case AggregateFunction::Any:
+            FailInput("ANY() is only used internally");
         }
       }
 
@@ -4,12 +4,14 @@
 #include <iterator>
 #include <type_traits>
 #include <unordered_set>
+#include <utility>
 
 #include "resolve_type.hpp"
 
 #include "abstract_filter.hpp"
 #include "min_max_filter.hpp"
 #include "range_filter.hpp"
+#include "zone_map.hpp"
 #include "storage/base_encoded_segment.hpp"
 #include "storage/dictionary_segment.hpp"
 #include "storage/reference_segment.hpp"
@@ -68,12 +70,18 @@ std::shared_ptr<SegmentStatistics> SegmentStatistics::build_statistics(
       statistics = build_statistics_from_dictionary(dictionary);
     }
     // clang-format on
+
+    statistics->set_zone_map(ZoneMap<DataTypeT>::build(typed_segment));
   });
   return statistics;
 }
 
 void SegmentStatistics::add_filter(std::shared_ptr<AbstractFilter> filter) { _filters.emplace_back(filter); }
 
+void SegmentStatistics::set_zone_map(std::shared_ptr<const BaseZoneMap> zone_map) { _zone_map = std::move(zone_map); }
+
+std::shared_ptr<const BaseZoneMap> SegmentStatistics::zone_map() const { return _zone_map; }
+
 bool SegmentStatistics::can_prune(const PredicateCondition predicate_type, const AllTypeVariant& variant_value,
                                   const std::optional<AllTypeVariant>& variant_value2) const {
   for (const auto& filter : _filters) {
@@ -7,6 +7,7 @@
 #include "types.hpp"
 
 #include "abstract_filter.hpp"
+#include "zone_map.hpp"
 
 namespace opossum {
 
@@ -29,7 +30,16 @@ class SegmentStatistics final {
   bool can_prune(const PredicateCondition predicate_type, const AllTypeVariant& variant_value,
                  const std::optional<AllTypeVariant>& variant_value2 = std::nullopt) const;
 
+  void set_zone_map(std::shared_ptr<const BaseZoneMap> zone_map);
+
+  /**
+   * Returns the per-block zone map of the segment or nullptr if there is none, e.g., because the segment consists of a
+   * single block only.
+   */
+  std::shared_ptr<const BaseZoneMap> zone_map() const;
+
  protected:
   std::vector<std::shared_ptr<AbstractFilter>> _filters;
+  std::shared_ptr<const BaseZoneMap> _zone_map;
 };
 }  // namespace opossum
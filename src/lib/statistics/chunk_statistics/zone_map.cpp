@@ -0,0 +1,166 @@
+#include "zone_map.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "boost/variant.hpp"
+
+#include "storage/segment_iterate.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+BaseZoneMap::BaseZoneMap(const ChunkOffset row_count, const ChunkOffset block_size)
+    : _row_count(row_count), _block_size(block_size) {
+  Assert(block_size > 0, "Block size of zone map must be positive");
+}
+
+ChunkOffset BaseZoneMap::row_count() const { return _row_count; }
+
+ChunkOffset BaseZoneMap::block_size() const { return _block_size; }
+
+size_t BaseZoneMap::block_count() const { return (_row_count + _block_size - 1) / _block_size; }
+
+template <typename T>
+ZoneMap<T>::ZoneMap(const ChunkOffset row_count, const ChunkOffset block_size, std::vector<Block> blocks)
+    : BaseZoneMap(row_count, block_size), _blocks(std::move(blocks)) {
+  Assert(_blocks.size() == block_count(), "Number of blocks does not match row count and block size");
+}
+
+template <typename T>
+std::shared_ptr<ZoneMap<T>> ZoneMap<T>::build(const BaseSegment& segment, const ChunkOffset block_size) {
+  const auto row_count = static_cast<ChunkOffset>(segment.size());
+  if (row_count <= block_size) return nullptr;
+
+  auto blocks = std::vector<Block>((row_count + block_size - 1) / block_size);
+  auto block_has_value = std::vector<bool>(blocks.size(), false);
+
+  segment_iterate<T>(segment, [&](const auto& position) {
+    const auto block_id = position.chunk_offset() / block_size;
+    auto& block = blocks[block_id];
+
+    if (position.is_null()) {
+      ++block.null_value_count;
+      return;
+    }
+
+    if constexpr (std::is_floating_point_v<T>) {
+      // std::min and std::max would ignore a NaN unless it is the first value, or else propagate it
+      if (std::isnan(position.value())) {
+        block.contains_nan = true;
+        return;
+      }
+    }
+
+    if (!block_has_value[block_id]) {
+      block.min = position.value();
+      block.max = position.value();
+      block_has_value[block_id] = true;
+    } else {
+      block.min = std::min(block.min, static_cast<T>(position.value()));
+      block.max = std::max(block.max, static_cast<T>(position.value()));
+    }
+  });
+
+  return std::make_shared<ZoneMap<T>>(row_count, block_size, std::move(blocks));
+}
+
+template <typename T>
+const std::vector<typename ZoneMap<T>::Block>& ZoneMap<T>::blocks() const {
+  return _blocks;
+}
+
+template <typename T>
+std::vector<ZoneMapBlockMatch> ZoneMap<T>::evaluate(const PredicateCondition predicate_condition,
+                                                    const AllTypeVariant& variant_value,
+                                                    const std::optional<AllTypeVariant>& variant_value2) const {
+  auto block_matches = std::vector<ZoneMapBlockMatch>(_blocks.size(), ZoneMapBlockMatch::Some);
+
+  if (variant_is_null(variant_value) || (variant_value2 && variant_is_null(*variant_value2))) {
+    return block_matches;
+  }
+
+  const auto value = boost::get<T>(variant_value);
+
+  // BETWEEN is evaluated as the conjunction of a lower and an upper bound predicate
+  auto upper_bound_predicate_condition = std::optional<PredicateCondition>{};
+  auto lower_bound_predicate_condition = predicate_condition;
+  if (is_between_predicate_condition(predicate_condition)) {
+    Assert(static_cast<bool>(variant_value2), "Between operator needs two values.");
+    lower_bound_predicate_condition = is_lower_inclusive_between(predicate_condition)
+                                          ? PredicateCondition::GreaterThanEquals
+                                          : PredicateCondition::GreaterThan;
+    upper_bound_predicate_condition = is_upper_inclusive_between(predicate_condition)
+                                          ? PredicateCondition::LessThanEquals
+                                          : PredicateCondition::LessThan;
+  }
+
+  for (auto block_id = size_t{0}; block_id < _blocks.size(); ++block_id) {
+    const auto& block = _blocks[block_id];
+    const auto block_row_count = std::min(_block_size, static_cast<ChunkOffset>(_row_count - block_id * _block_size));
+
+    auto block_match = _evaluate_block(block, block_row_count, lower_bound_predicate_condition, value);
+    if (upper_bound_predicate_condition && block_match != ZoneMapBlockMatch::None) {
+      const auto upper_bound_match =
+          _evaluate_block(block, block_row_count, *upper_bound_predicate_condition, boost::get<T>(*variant_value2));
+      if (upper_bound_match != ZoneMapBlockMatch::All) block_match = upper_bound_match;
+    }
+    block_matches[block_id] = block_match;
+  }
+
+  return block_matches;
+}
+
+template <typename T>
+ZoneMapBlockMatch ZoneMap<T>::_evaluate_block(const Block& block, const ChunkOffset block_row_count,
+                                              const PredicateCondition predicate_condition, const T& value) const {
+  // NULLs never satisfy a comparison
+  if (block.null_value_count == block_row_count) return ZoneMapBlockMatch::None;
+
+  // NaN rows have to be compared individually (e.g., NaN != 5 holds, NaN > 5 does not)
+  if (block.contains_nan) return ZoneMapBlockMatch::Some;
+
+  auto matches_none = false;
+  auto matches_all_non_null_values = false;
+
+  // Operators work as follows: value_from_table <operator> value
+  switch (predicate_condition) {
+    case PredicateCondition::Equals:
+      matches_none = value < block.min || value > block.max;
+      matches_all_non_null_values = block.min == value && block.max == value;
+      break;
+    case PredicateCondition::NotEquals:
+      matches_none = block.min == value && block.max == value;
+      matches_all_non_null_values = value < block.min || value > block.max;
+      break;
+    case PredicateCondition::LessThan:
+      matches_none = block.min >= value;
+      matches_all_non_null_values = block.max < value;
+      break;
+    case PredicateCondition::LessThanEquals:
+      matches_none = block.min > value;
+      matches_all_non_null_values = block.max <= value;
+      break;
+    case PredicateCondition::GreaterThan:
+      matches_none = block.max <= value;
+      matches_all_non_null_values = block.min > value;
+      break;
+    case PredicateCondition::GreaterThanEquals:
+      matches_none = block.max < value;
+      matches_all_non_null_values = block.min >= value;
+      break;
+    default:
+      return ZoneMapBlockMatch::Some;
+  }
+
+  if (matches_none) return ZoneMapBlockMatch::None;
+  if (matches_all_non_null_values && block.null_value_count == 0) return ZoneMapBlockMatch::All;
+  return ZoneMapBlockMatch::Some;
+}
+
+EXPLICITLY_INSTANTIATE_DATA_TYPES(ZoneMap);
+
+}  // namespace opossum
@@ -0,0 +1,82 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseSegment;
+
+// Result of evaluating a predicate on the value range of one block of a ZoneMap
+enum class ZoneMapBlockMatch : uint8_t { None, Some, All };
+
+/**
+ * A zone map stores the minimum and maximum value of every block of `block_size` consecutive rows of a segment.
+ * While the filters in SegmentStatistics only allow the ChunkPruningRule to skip entire chunks at optimization time,
+ * zone maps are consulted by the table scan at runtime. There, they are used to skip blocks that cannot contain any
+ * match and to add blocks in which all rows match without evaluating the predicate. This is most effective for
+ * mostly clustered columns, e.g., dates in append-only tables.
+ *
+ * Zone maps are built by the ChunkEncoder as part of the SegmentStatistics.
+ */
+class BaseZoneMap {
+ public:
+  static constexpr auto DEFAULT_BLOCK_SIZE = ChunkOffset{4'096};
+
+  BaseZoneMap(const ChunkOffset row_count, const ChunkOffset block_size);
+  virtual ~BaseZoneMap() = default;
+
+  ChunkOffset row_count() const;
+  ChunkOffset block_size() const;
+  size_t block_count() const;
+
+  /**
+   * Evaluates `value_from_table <predicate_condition> variant_value [AND variant_value2]` for each block. Blocks that
+   * contain NULLs are never reported as ZoneMapBlockMatch::All, blocks that contain NaN are always reported as
+   * ZoneMapBlockMatch::Some (unless they only hold NULLs). For predicates that cannot be evaluated on a value
+   * range (e.g., LIKE) or NULL values, all blocks are reported as ZoneMapBlockMatch::Some.
+   */
+  virtual std::vector<ZoneMapBlockMatch> evaluate(
+      const PredicateCondition predicate_condition, const AllTypeVariant& variant_value,
+      const std::optional<AllTypeVariant>& variant_value2 = std::nullopt) const = 0;
+
+ protected:
+  const ChunkOffset _row_count;
+  const ChunkOffset _block_size;
+};
+
+template <typename T>
+class ZoneMap : public BaseZoneMap {
+ public:
+  struct Block {
+    T min{};
+    T max{};
+    ChunkOffset null_value_count{0};
+    // NaN is neither smaller nor greater than any other value, so it is not part of [min, max]
+    bool contains_nan{false};
+  };
+
+  ZoneMap(const ChunkOffset row_count, const ChunkOffset block_size, std::vector<Block> blocks);
+
+  // Returns nullptr if the segment does not span more than a single block, as the segment-wide filters suffice then.
+  static std::shared_ptr<ZoneMap<T>> build(const BaseSegment& segment,
+                                           const ChunkOffset block_size = DEFAULT_BLOCK_SIZE);
+
+  const std::vector<Block>& blocks() const;
+
+  std::vector<ZoneMapBlockMatch> evaluate(
+      const PredicateCondition predicate_condition, const AllTypeVariant& variant_value,
+      const std::optional<AllTypeVariant>& variant_value2 = std::nullopt) const override;
+
+ protected:
+  ZoneMapBlockMatch _evaluate_block(const Block& block, const ChunkOffset block_row_count,
+                                    const PredicateCondition predicate_condition, const T& value) const;
+
+  const std::vector<Block> _blocks;
+};
+
+}  // namespace opossum
@@ -7,9 +7,16 @@
 #include <utility>
 #include <vector>
 
+#include "base_dictionary_segment.hpp"
 #include "base_segment.hpp"
 #include "chunk.hpp"
+#include "index/adaptive_radix_tree/adaptive_radix_tree_index.hpp"
+#include "index/adaptive_radix_tree/string_adaptive_radix_tree_index.hpp"
+#include "index/b_tree/b_tree_index.hpp"
 #include "index/base_index.hpp"
+#include "index/delta/delta_index.hpp"
+#include "index/group_key/composite_group_key_index.hpp"
+#include "index/group_key/group_key_index.hpp"
 #include "reference_segment.hpp"
 #include "resolve_type.hpp"
 #include "statistics/chunk_statistics/chunk_statistics.hpp"
@@ -19,7 +26,10 @@ namespace opossum {
 
 Chunk::Chunk(Segments segments, const std::shared_ptr<MvccData>& mvcc_data,
              const std::optional<PolymorphicAllocator<Chunk>>& alloc)
-    : _segments(std::move(segments)), _mvcc_data(mvcc_data) {
+    : _segments(std::move(segments)),
+      _mvcc_data(mvcc_data),
+      _indices(std::make_shared<pmr_vector<std::shared_ptr<BaseIndex>>>()),
+      _delta_indexes(std::make_shared<pmr_vector<std::shared_ptr<BaseDeltaIndex>>>()) {
 #if HYRISE_DEBUG
   const auto chunk_size = _segments.empty() ? 0u : _segments[0]->size();
   const auto is_reference_chunk =
@@ -42,7 +52,11 @@ Chunk::Chunk(Segments segments, const std::shared_ptr<MvccData>& mvcc_data,
 
 bool Chunk::is_mutable() const { return _is_mutable; }
 
-void Chunk::mark_immutable() { _is_mutable = false; }
+void Chunk::mark_immutable() {
+  // Delta indexes are only created for mutable chunks and merged once the chunk is immutable (see create_delta_index())
+  std::lock_guard<std::mutex> lock(_delta_index_mutex);
+  _is_mutable = false;
+}
 
 void Chunk::replace_segment(size_t column_id, const std::shared_ptr<BaseSegment>& segment) {
   std::atomic_store(&_segments.at(column_id), segment);
@@ -59,6 +73,8 @@ void Chunk::append(const std::vector<AllTypeVariant>& values) {
               ("append: number of segments (" + std::to_string(_segments.size()) + ") does not match value list (" +
                std::to_string(values.size()) + ")"));
 
+  const auto chunk_offset = static_cast<ChunkOffset>(size());
+
   auto segment_it = _segments.cbegin();
   auto value_it = values.begin();
   for (; segment_it != _segments.end(); segment_it++, value_it++) {
@@ -66,6 +82,11 @@ void Chunk::append(const std::vector<AllTypeVariant>& values) {
     DebugAssert(base_value_segment, "Can't append to segment that is not a ValueSegment");
     base_value_segment->append(*value_it);
   }
+
+  // Like the Insert operator, add the row to the delta indexes only once it was written
+  for (const auto& delta_index : *std::atomic_load(&_delta_indexes)) {
+    delta_index->insert(*get_segment(delta_index->column_id()), chunk_offset, chunk_offset + 1);
+  }
 }
 
 std::shared_ptr<BaseSegment> Chunk::get_segment(ColumnID column_id) const {
@@ -92,10 +113,13 @@ SharedScopedLockingPtr<MvccData> Chunk::get_scoped_mvcc_data_lock() const {
 
 std::shared_ptr<MvccData> Chunk::mvcc_data() const { return _mvcc_data; }
 
+pmr_vector<std::shared_ptr<BaseIndex>> Chunk::indices() const { return *std::atomic_load(&_indices); }
+
 std::vector<std::shared_ptr<BaseIndex>> Chunk::get_indices(
     const std::vector<std::shared_ptr<const BaseSegment>>& segments) const {
+  const auto indices = std::atomic_load(&_indices);
   auto result = std::vector<std::shared_ptr<BaseIndex>>();
-  std::copy_if(_indices.cbegin(), _indices.cend(), std::back_inserter(result),
+  std::copy_if(indices->cbegin(), indices->cend(), std::back_inserter(result),
                [&](const auto& index) { return index->is_index_for(segments); });
   return result;
 }
@@ -107,11 +131,12 @@ std::vector<std::shared_ptr<BaseIndex>> Chunk::get_indices(const std::vector<Col
 
 std::shared_ptr<BaseIndex> Chunk::get_index(const SegmentIndexType index_type,
                                             const std::vector<std::shared_ptr<const BaseSegment>>& segments) const {
-  auto index_it = std::find_if(_indices.cbegin(), _indices.cend(), [&](const auto& index) {
+  const auto indices = std::atomic_load(&_indices);
+  auto index_it = std::find_if(indices->cbegin(), indices->cend(), [&](const auto& index) {
     return index->is_index_for(segments) && index->type() == index_type;
   });
 
-  return (index_it == _indices.cend()) ? nullptr : *index_it;
+  return (index_it == indices->cend()) ? nullptr : *index_it;
 }
 
 std::shared_ptr<BaseIndex> Chunk::get_index(const SegmentIndexType index_type,
@@ -120,10 +145,117 @@ std::shared_ptr<BaseIndex> Chunk::get_index(const SegmentIndexType index_type,
   return get_index(index_type, segments);
 }
 
+std::shared_ptr<BaseIndex> Chunk::create_index(const SegmentIndexType index_type,
+                                               const std::vector<ColumnID>& column_ids) {
+  switch (index_type) {
+    case SegmentIndexType::GroupKey:
+      return create_index<GroupKeyIndex>(column_ids);
+    case SegmentIndexType::CompositeGroupKey:
+      return create_index<CompositeGroupKeyIndex>(column_ids);
+    case SegmentIndexType::AdaptiveRadixTree:
+      return create_index<AdaptiveRadixTreeIndex>(column_ids);
+    case SegmentIndexType::BTree:
+      return create_index<BTreeIndex>(column_ids);
+    case SegmentIndexType::StringAdaptiveRadixTree:
+      return create_index<StringAdaptiveRadixTreeIndex>(column_ids);
+    default:
+      Fail("Index type cannot be created on a chunk");
+  }
+}
+
+void Chunk::add_index(const std::shared_ptr<BaseIndex>& index) {
+  DebugAssert(([&]() {
+                for (const auto& segment : index->get_indexed_segments()) {
+                  if (std::find(_segments.cbegin(), _segments.cend(), segment) == _segments.cend()) return false;
+                }
+                return true;
+              }()),
+              "All segments must be part of the chunk.");
+  _add_index(index);
+}
+
 void Chunk::remove_index(const std::shared_ptr<BaseIndex>& index) {
-  auto it = std::find(_indices.cbegin(), _indices.cend(), index);
-  DebugAssert(it != _indices.cend(), "Trying to remove a non-existing index");
-  _indices.erase(it);
+  std::lock_guard<std::mutex> lock(_index_mutex);
+
+  auto indices = std::make_shared<pmr_vector<std::shared_ptr<BaseIndex>>>(*_indices);
+  auto it = std::find(indices->cbegin(), indices->cend(), index);
+  DebugAssert(it != indices->cend(), "Trying to remove a non-existing index");
+  indices->erase(it);
+  std::atomic_store(&_indices, std::shared_ptr<const pmr_vector<std::shared_ptr<BaseIndex>>>{indices});
+}
+
+void Chunk::_add_index(const std::shared_ptr<BaseIndex>& index) {
+  std::lock_guard<std::mutex> lock(_index_mutex);
+
+  auto indices = std::make_shared<pmr_vector<std::shared_ptr<BaseIndex>>>(*_indices);
+  indices->emplace_back(index);
+  std::atomic_store(&_indices, std::shared_ptr<const pmr_vector<std::shared_ptr<BaseIndex>>>{indices});
+}
+
+std::shared_ptr<BaseDeltaIndex> Chunk::create_delta_index(const ColumnID column_id,
+                                                          const SegmentIndexType target_index_type) {
+  std::lock_guard<std::mutex> lock(_delta_index_mutex);
+  if (!is_mutable()) return nullptr;
+  Assert(!get_delta_index(column_id), "Column already has a delta index");
+
+  const auto segment = get_segment(column_id);
+  const auto delta_index = BaseDeltaIndex::create(segment->data_type(), column_id, target_index_type);
+  delta_index->insert(*segment, ChunkOffset{0}, segment->size());
+
+  auto delta_indexes = std::make_shared<pmr_vector<std::shared_ptr<BaseDeltaIndex>>>(*_delta_indexes);
+  delta_indexes->emplace_back(delta_index);
+  std::atomic_store(&_delta_indexes, std::shared_ptr<const pmr_vector<std::shared_ptr<BaseDeltaIndex>>>{delta_indexes});
+  return delta_index;
+}
+
+std::shared_ptr<BaseDeltaIndex> Chunk::get_delta_index(const ColumnID column_id) const {
+  const auto delta_indexes = std::atomic_load(&_delta_indexes);
+  const auto delta_index_it =
+      std::find_if(delta_indexes->cbegin(), delta_indexes->cend(),
+                   [&](const auto& delta_index) { return delta_index->column_id() == column_id; });
+  return (delta_index_it == delta_indexes->cend()) ? nullptr : *delta_index_it;
+}
+
+void Chunk::remove_delta_index(const ColumnID column_id) {
+  std::lock_guard<std::mutex> lock(_delta_index_mutex);
+
+  auto delta_indexes = std::make_shared<pmr_vector<std::shared_ptr<BaseDeltaIndex>>>(*_delta_indexes);
+  const auto delta_index_it =
+      std::find_if(delta_indexes->cbegin(), delta_indexes->cend(),
+                   [&](const auto& delta_index) { return delta_index->column_id() == column_id; });
+  DebugAssert(delta_index_it != delta_indexes->cend(), "Trying to remove a non-existing delta index");
+  delta_indexes->erase(delta_index_it);
+  std::atomic_store(&_delta_indexes, std::shared_ptr<const pmr_vector<std::shared_ptr<BaseDeltaIndex>>>{delta_indexes});
+}
+
+pmr_vector<std::shared_ptr<BaseDeltaIndex>> Chunk::delta_indexes() const { return *std::atomic_load(&_delta_indexes); }
+
+void Chunk::merge_delta_indexes() {
+  Assert(!is_mutable(), "Delta indexes of mutable chunks cannot be merged");
+
+  std::lock_guard<std::mutex> lock(_delta_index_mutex);
+
+  auto remaining_delta_indexes = std::make_shared<pmr_vector<std::shared_ptr<BaseDeltaIndex>>>();
+  for (const auto& delta_index : *_delta_indexes) {
+    const auto target_index_type = delta_index->target_index_type();
+    const auto segment = get_segment(delta_index->column_id());
+
+    // All chunk indexes but the BTreeIndex and the StringAdaptiveRadixTreeIndex require dictionary-encoded segments.
+    // If the segment was encoded otherwise, the delta index is kept. It does not change anymore and still answers
+    // scans.
+    const auto works_on_any_encoding = target_index_type == SegmentIndexType::BTree ||
+                                       target_index_type == SegmentIndexType::StringAdaptiveRadixTree;
+    if (!works_on_any_encoding && !std::dynamic_pointer_cast<const BaseDictionarySegment>(segment)) {
+      remaining_delta_indexes->emplace_back(delta_index);
+      continue;
+    }
+
+    create_index(target_index_type, {delta_index->column_id()});
+  }
+
+  // The merged indexes were added first, so that concurrent readers always find either them or the delta indexes
+  std::atomic_store(&_delta_indexes,
+                    std::shared_ptr<const pmr_vector<std::shared_ptr<BaseDeltaIndex>>>{remaining_delta_indexes});
 }
 
 bool Chunk::references_exactly_one_table() const {
@@ -148,7 +280,7 @@ bool Chunk::references_exactly_one_table() const {
 
 void Chunk::migrate(boost::container::pmr::memory_resource* memory_source) {
   // Migrating chunks with indices is not implemented yet.
-  if (!_indices.empty()) {
+  if (!std::atomic_load(&_indices)->empty()) {
     Fail("Cannot migrate Chunk with Indices.");
   }
 
@@ -216,4 +348,8 @@ const std::optional<std::pair<ColumnID, OrderByMode>>& Chunk::ordered_by() const
 
 void Chunk::set_ordered_by(const std::pair<ColumnID, OrderByMode>& ordered_by) { _ordered_by.emplace(ordered_by); }
 
+NodeID Chunk::node_id() const { return _node_id; }
+
+void Chunk::set_node_id(const NodeID node_id) { _node_id = node_id; }
+
 }  // namespace opossum
@@ -9,6 +9,7 @@
 #include <algorithm>
 #include <atomic>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <string>
 #include <vector>
@@ -20,9 +21,11 @@
 #include "types.hpp"
 #include "utils/copyable_atomic.hpp"
 #include "utils/scoped_locking_ptr.hpp"
+#include "utils/timer.hpp"
 
 namespace opossum {
 
+class BaseDeltaIndex;
 class BaseIndex;
 class BaseSegment;
 class ChunkStatistics;
@@ -63,7 +66,7 @@ class Chunk : private Noncopyable {
   // returns the number of rows (cannot exceed ChunkOffset (uint32_t))
   uint32_t size() const;
 
-  // adds a new row, given as a list of values, to the chunk
+  // adds a new row, given as a list of values, to the chunk and to its delta indexes
   // note this is slow and not thread-safe and should be used for testing purposes only
   void append(const std::vector<AllTypeVariant>& values);
 
@@ -96,6 +99,17 @@ class Chunk : private Noncopyable {
 
   std::shared_ptr<MvccData> mvcc_data() const;
 
+  /**
+   * @defgroup Chunk indexes (see BaseIndex)
+   *
+   * Indexes can be added and removed while queries are running (e.g., by the IndexAdvisorPlugin). Like the segments,
+   * the list of indexes is therefore replaced atomically: it is copied on write and readers get a snapshot.
+   * @{
+   */
+
+  // All chunk indexes, regardless of the indexed segments
+  pmr_vector<std::shared_ptr<BaseIndex>> indices() const;
+
   std::vector<std::shared_ptr<BaseIndex>> get_indices(
       const std::vector<std::shared_ptr<const BaseSegment>>& segments) const;
   std::vector<std::shared_ptr<BaseIndex>> get_indices(const std::vector<ColumnID>& column_ids) const;
@@ -116,8 +130,10 @@ class Chunk : private Noncopyable {
                 }()),
                 "All segments must be part of the chunk.");
 
+    auto timer = Timer{};
     auto index = std::make_shared<Index>(segments_to_index);
-    _indices.emplace_back(index);
+    index->set_build_duration(timer.lap());
+    _add_index(index);
     return index;
   }
 
@@ -127,7 +143,39 @@ class Chunk : private Noncopyable {
     return create_index<Index>(segments);
   }
 
+  // Creates a chunk index of a type that is only known at runtime
+  std::shared_ptr<BaseIndex> create_index(const SegmentIndexType index_type, const std::vector<ColumnID>& column_ids);
+
+  // Adds an index that was built elsewhere (e.g., restored by ImportBinary)
+  void add_index(const std::shared_ptr<BaseIndex>& index);
+
   void remove_index(const std::shared_ptr<BaseIndex>& index);
+  /** @} */
+
+  /**
+   * @defgroup Delta indexes on single columns of mutable chunks (see BaseDeltaIndex)
+   *
+   * The list of delta indexes is copied on write and atomically replaced, so that it can be read while delta indexes
+   * are added or merged.
+   * @{
+   */
+
+  // Returns nullptr if the chunk is immutable (e.g., because it was encoded concurrently). It needs a regular chunk
+  // index then.
+  std::shared_ptr<BaseDeltaIndex> create_delta_index(const ColumnID column_id,
+                                                     const SegmentIndexType target_index_type);
+
+  // Returns nullptr if there is no delta index on the column
+  std::shared_ptr<BaseDeltaIndex> get_delta_index(const ColumnID column_id) const;
+
+  void remove_delta_index(const ColumnID column_id);
+
+  pmr_vector<std::shared_ptr<BaseDeltaIndex>> delta_indexes() const;
+
+  // Called once the chunk is immutable and encoded. Replaces every delta index by a chunk index of its target type,
+  // unless the target type cannot index the encoded segment (e.g., a GroupKeyIndex on an LZ4Segment).
+  void merge_delta_indexes();
+  /** @} */
 
   void migrate(boost::container::pmr::memory_resource* memory_source);
 
@@ -152,6 +200,14 @@ class Chunk : private Noncopyable {
   const std::optional<std::pair<ColumnID, OrderByMode>>& ordered_by() const;
   void set_ordered_by(const std::pair<ColumnID, OrderByMode>& ordered_by);
 
+  /**
+   * The NUMA node that holds the data of this chunk (see NUMAPlacement), or INVALID_NODE_ID if it was not placed on a
+   * particular node. Operators prefer this node when scheduling the tasks that process the chunk. Chunks of reference
+   * tables inherit the node of the chunk they were created from.
+   */
+  NodeID node_id() const;
+  void set_node_id(const NodeID node_id);
+
   /**
    * Returns the count of deleted/invalidated rows within this chunk resulting from already committed transactions.
    */
@@ -177,14 +233,20 @@ class Chunk : private Noncopyable {
  private:
   std::vector<std::shared_ptr<const BaseSegment>> _get_segments_for_ids(const std::vector<ColumnID>& column_ids) const;
 
+  void _add_index(const std::shared_ptr<BaseIndex>& index);
+
  private:
   PolymorphicAllocator<Chunk> _alloc;
   Segments _segments;
   std::shared_ptr<MvccData> _mvcc_data;
-  pmr_vector<std::shared_ptr<BaseIndex>> _indices;
+  std::shared_ptr<const pmr_vector<std::shared_ptr<BaseIndex>>> _indices;
+  std::shared_ptr<const pmr_vector<std::shared_ptr<BaseDeltaIndex>>> _delta_indexes;
+  std::mutex _index_mutex;
+  std::mutex _delta_index_mutex;
   std::shared_ptr<ChunkStatistics> _statistics;
-  bool _is_mutable = true;
+  std::atomic_bool _is_mutable{true};
   std::optional<std::pair<ColumnID, OrderByMode>> _ordered_by;
+  NodeID _node_id{INVALID_NODE_ID};
   mutable std::atomic_uint64_t _invalid_row_count = 0;
   std::optional<CommitID> _cleanup_commit_id;
 };
@@ -45,6 +45,7 @@ void ChunkEncoder::encode_chunk(const std::shared_ptr<Chunk>& chunk, const std::
 
   chunk->mark_immutable();
   chunk->set_statistics(std::make_shared<ChunkStatistics>(column_statistics));
+  chunk->merge_delta_indexes();
 
   if (chunk->has_mvcc_data()) {
     // MvccData::shrink() will acquire a write lock itself
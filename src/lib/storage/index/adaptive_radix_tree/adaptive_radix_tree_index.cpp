@@ -43,6 +43,71 @@ AdaptiveRadixTreeIndex::AdaptiveRadixTreeIndex(const std::vector<std::shared_ptr
   _root = _bulk_insert(pairs_to_insert);
 }
 
+AdaptiveRadixTreeIndex::AdaptiveRadixTreeIndex(const std::vector<std::shared_ptr<const BaseSegment>>& segments_to_index,
+                                               std::vector<ChunkOffset>&& chunk_offsets, const FlatTree& flat_tree)
+    : BaseIndex{get_index_type_of<AdaptiveRadixTreeIndex>()},
+      _indexed_segment(std::dynamic_pointer_cast<const BaseDictionarySegment>(segments_to_index.front())),
+      _chunk_offsets(std::move(chunk_offsets)) {
+  Assert(static_cast<bool>(_indexed_segment), "AdaptiveRadixTree only works with dictionary segments for now");
+  Assert((segments_to_index.size() == 1), "AdaptiveRadixTree only works with a single segment");
+  Assert(!flat_tree.child_counts.empty(), "Index on empty segment is not defined");
+
+  auto position = FlatTreePosition{};
+  _root = _restore(flat_tree, position);
+  Assert(position.node_id == flat_tree.child_counts.size() && position.leaf_id == flat_tree.leaf_ends.size(),
+         "Tree does not match its nodes");
+}
+
+const std::vector<ChunkOffset>& AdaptiveRadixTreeIndex::chunk_offsets() const { return _chunk_offsets; }
+
+AdaptiveRadixTreeIndex::FlatTree AdaptiveRadixTreeIndex::flat_tree() const {
+  auto flat_tree = FlatTree{};
+  _flatten(*_root, flat_tree);
+  return flat_tree;
+}
+
+void AdaptiveRadixTreeIndex::_flatten(const ARTNode& node, FlatTree& flat_tree) const {
+  const auto children = node.children();
+  flat_tree.child_counts.emplace_back(static_cast<uint16_t>(children.size()));
+  if (children.empty()) {
+    flat_tree.leaf_ends.emplace_back(static_cast<ChunkOffset>(std::distance(_chunk_offsets.cbegin(), node.end())));
+    return;
+  }
+
+  for (const auto& child : children) {
+    flat_tree.partial_keys.emplace_back(child.first);
+  }
+  for (const auto& child : children) {
+    _flatten(*child.second, flat_tree);
+  }
+}
+
+std::shared_ptr<ARTNode> AdaptiveRadixTreeIndex::_restore(const FlatTree& flat_tree, FlatTreePosition& position) {
+  Assert(position.node_id < flat_tree.child_counts.size(), "Tree does not match its nodes");
+  const auto child_count = flat_tree.child_counts[position.node_id++];
+
+  if (child_count == 0) {
+    // The range of a leaf begins where the range of the previous leaf ends
+    Assert(position.leaf_id < flat_tree.leaf_ends.size() &&
+               flat_tree.leaf_ends[position.leaf_id] <= _chunk_offsets.size(),
+           "Tree does not match its ChunkOffsets");
+    auto lower = _chunk_offsets.cbegin() + (position.leaf_id == 0 ? 0 : flat_tree.leaf_ends[position.leaf_id - 1]);
+    auto upper = _chunk_offsets.cbegin() + flat_tree.leaf_ends[position.leaf_id];
+    ++position.leaf_id;
+    return std::make_shared<Leaf>(lower, upper);
+  }
+
+  Assert(position.partial_key_id + child_count <= flat_tree.partial_keys.size(), "Tree does not match its nodes");
+  auto children = std::vector<std::pair<uint8_t, std::shared_ptr<ARTNode>>>{};
+  children.reserve(child_count);
+  const auto first_partial_key_id = position.partial_key_id;
+  position.partial_key_id += child_count;
+  for (auto child_id = size_t{0}; child_id < child_count; ++child_id) {
+    children.emplace_back(flat_tree.partial_keys[first_partial_key_id + child_id], _restore(flat_tree, position));
+  }
+  return _create_inner_node(children);
+}
+
 BaseIndex::Iterator AdaptiveRadixTreeIndex::_lower_bound(const std::vector<AllTypeVariant>& values) const {
   assert(values.size() == 1);
   ValueID value_id = _indexed_segment->lower_bound(values[0]);
@@ -114,6 +179,11 @@ std::shared_ptr<ARTNode> AdaptiveRadixTreeIndex::_bulk_insert(
     }
   }
   // finally create the appropriate ARTNode according to the size of the children
+  return _create_inner_node(children);
+}
+
+std::shared_ptr<ARTNode> AdaptiveRadixTreeIndex::_create_inner_node(
+    std::vector<std::pair<uint8_t, std::shared_ptr<ARTNode>>>& children) {
   if (children.size() <= 4) {
     return std::make_shared<ARTNode4>(children);
   } else if (children.size() <= 16) {
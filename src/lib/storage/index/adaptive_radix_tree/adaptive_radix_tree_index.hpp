@@ -43,14 +43,33 @@ class AdaptiveRadixTreeIndex : public BaseIndex {
    */
   static size_t estimate_memory_consumption(ChunkOffset row_count, ChunkOffset distinct_count, uint32_t value_bytes);
 
+  /**
+   * The nodes of the tree in pre-order without pointers, e.g., to store the index (see ExportBinary). For each node,
+   * child_counts holds its number of children, which is zero for leaves. After the child count of an inner node,
+   * partial_keys holds the partial keys of its children. leaf_ends holds the end of each leaf's range in
+   * chunk_offsets(), the ranges of the leaves are consecutive.
+   */
+  struct FlatTree {
+    std::vector<uint16_t> child_counts;
+    std::vector<uint8_t> partial_keys;
+    std::vector<ChunkOffset> leaf_ends;
+  };
+
   explicit AdaptiveRadixTreeIndex(const std::vector<std::shared_ptr<const BaseSegment>>& segments_to_index);
 
+  // Restores an index from its structures (e.g., read by ImportBinary) without scanning the segment again
+  AdaptiveRadixTreeIndex(const std::vector<std::shared_ptr<const BaseSegment>>& segments_to_index,
+                         std::vector<ChunkOffset>&& chunk_offsets, const FlatTree& flat_tree);
+
   AdaptiveRadixTreeIndex(AdaptiveRadixTreeIndex&&) = default;
 
   AdaptiveRadixTreeIndex& operator=(AdaptiveRadixTreeIndex&&) = default;
 
   virtual ~AdaptiveRadixTreeIndex() = default;
 
+  const std::vector<ChunkOffset>& chunk_offsets() const;
+  FlatTree flat_tree() const;
+
   /**
    *All keys in the ART have to be binary comparable in the sense that if the most significant differing bit between
    *BinaryComparable a and BinaryComparable b is greater for a <=> a > b.
@@ -85,6 +104,20 @@ class AdaptiveRadixTreeIndex : public BaseIndex {
   std::shared_ptr<ARTNode> _bulk_insert(const std::vector<std::pair<BinaryComparable, ChunkOffset>>& values,
                                         size_t depth, Iterator& it);
 
+  // Creates the smallest node type that can hold the children
+  static std::shared_ptr<ARTNode> _create_inner_node(
+      std::vector<std::pair<uint8_t, std::shared_ptr<ARTNode>>>& children);
+
+  void _flatten(const ARTNode& node, FlatTree& flat_tree) const;
+
+  // Restores the node at the current position of each of the FlatTree's vectors and advances them
+  struct FlatTreePosition {
+    size_t node_id{0};
+    size_t partial_key_id{0};
+    size_t leaf_id{0};
+  };
+  std::shared_ptr<ARTNode> _restore(const FlatTree& flat_tree, FlatTreePosition& position);
+
   std::vector<std::shared_ptr<const BaseSegment>> _get_indexed_segments() const;
 
   size_t _memory_consumption() const final;
@@ -35,6 +35,14 @@ ARTNode4::ARTNode4(std::vector<std::pair<uint8_t, std::shared_ptr<ARTNode>>>& ch
   }
 }
 
+std::vector<std::pair<uint8_t, std::shared_ptr<ARTNode>>> ARTNode4::children() const {
+  auto children = std::vector<std::pair<uint8_t, std::shared_ptr<ARTNode>>>{};
+  for (auto child_id = size_t{0}; child_id < _children.size() && _children[child_id]; ++child_id) {
+    children.emplace_back(_partial_keys[child_id], _children[child_id]);
+  }
+  return children;
+}
+
 /**
  *
  * searches the child that satisfies the query (lower_bound/ upper_bound + partial_key)
@@ -113,6 +121,14 @@ ARTNode16::ARTNode16(std::vector<std::pair<uint8_t, std::shared_ptr<ARTNode>>>&
   }
 }
 
+std::vector<std::pair<uint8_t, std::shared_ptr<ARTNode>>> ARTNode16::children() const {
+  auto children = std::vector<std::pair<uint8_t, std::shared_ptr<ARTNode>>>{};
+  for (auto child_id = size_t{0}; child_id < _children.size() && _children[child_id]; ++child_id) {
+    children.emplace_back(_partial_keys[child_id], _children[child_id]);
+  }
+  return children;
+}
+
 /**
  * searches the child that satisfies the query (lower_bound/ upper_bound + partial_key)
  * calls the appropriate function on the child
@@ -209,6 +225,15 @@ ARTNode48::ARTNode48(const std::vector<std::pair<uint8_t, std::shared_ptr<ARTNod
   }
 }
 
+std::vector<std::pair<uint8_t, std::shared_ptr<ARTNode>>> ARTNode48::children() const {
+  auto children = std::vector<std::pair<uint8_t, std::shared_ptr<ARTNode>>>{};
+  for (auto partial_key = size_t{0}; partial_key < _index_to_child.size(); ++partial_key) {
+    if (_index_to_child[partial_key] == INVALID_INDEX) continue;
+    children.emplace_back(static_cast<uint8_t>(partial_key), _children[_index_to_child[partial_key]]);
+  }
+  return children;
+}
+
 /**
  * searches the child that satisfies the query (lower_bound/ upper_bound + partial_key)
  * calls the appropriate function on the child
@@ -299,6 +324,14 @@ ARTNode256::ARTNode256(const std::vector<std::pair<uint8_t, std::shared_ptr<ARTN
   }
 }
 
+std::vector<std::pair<uint8_t, std::shared_ptr<ARTNode>>> ARTNode256::children() const {
+  auto children = std::vector<std::pair<uint8_t, std::shared_ptr<ARTNode>>>{};
+  for (auto partial_key = size_t{0}; partial_key < _children.size(); ++partial_key) {
+    if (_children[partial_key]) children.emplace_back(static_cast<uint8_t>(partial_key), _children[partial_key]);
+  }
+  return children;
+}
+
 /**
  * searches the child that satisfies the query (lower_bound/ upper_bound + partial_key)
  * calls the appropriate function on the child
@@ -379,4 +412,6 @@ BaseIndex::Iterator Leaf::begin() const { return _begin; }
 
 BaseIndex::Iterator Leaf::end() const { return _end; }
 
+std::vector<std::pair<uint8_t, std::shared_ptr<ARTNode>>> Leaf::children() const { return {}; }
+
 }  // namespace opossum
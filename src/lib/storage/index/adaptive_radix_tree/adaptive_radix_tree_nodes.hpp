@@ -34,6 +34,9 @@ class ARTNode : private Noncopyable {
   virtual Iterator upper_bound(const AdaptiveRadixTreeIndex::BinaryComparable& key, size_t depth) const = 0;
   virtual Iterator begin() const = 0;
   virtual Iterator end() const = 0;
+
+  // The children ordered by their partial keys, empty for leaves (see AdaptiveRadixTreeIndex::flat_tree())
+  virtual std::vector<std::pair<uint8_t, std::shared_ptr<ARTNode>>> children() const = 0;
 };
 
 /**
@@ -56,6 +59,7 @@ class ARTNode4 final : public ARTNode {
   Iterator upper_bound(const AdaptiveRadixTreeIndex::BinaryComparable& key, size_t depth) const override;
   Iterator begin() const override;
   Iterator end() const override;
+  std::vector<std::pair<uint8_t, std::shared_ptr<ARTNode>>> children() const override;
 
  private:
   /**
@@ -89,6 +93,7 @@ class ARTNode16 final : public ARTNode {
   Iterator upper_bound(const AdaptiveRadixTreeIndex::BinaryComparable& key, size_t depth) const override;
   Iterator begin() const override;
   Iterator end() const override;
+  std::vector<std::pair<uint8_t, std::shared_ptr<ARTNode>>> children() const override;
 
  private:
   Iterator _delegate_to_child(
@@ -120,6 +125,7 @@ class ARTNode48 final : public ARTNode {
   Iterator upper_bound(const AdaptiveRadixTreeIndex::BinaryComparable& key, size_t depth) const override;
   Iterator begin() const override;
   Iterator end() const override;
+  std::vector<std::pair<uint8_t, std::shared_ptr<ARTNode>>> children() const override;
 
  private:
   Iterator _delegate_to_child(const AdaptiveRadixTreeIndex::BinaryComparable& key, size_t depth,
@@ -142,6 +148,7 @@ class ARTNode256 final : public ARTNode {
   Iterator upper_bound(const AdaptiveRadixTreeIndex::BinaryComparable& key, size_t depth) const override;
   Iterator begin() const override;
   Iterator end() const override;
+  std::vector<std::pair<uint8_t, std::shared_ptr<ARTNode>>> children() const override;
 
  private:
   Iterator _delegate_to_child(const AdaptiveRadixTreeIndex::BinaryComparable& key, size_t depth,
@@ -186,6 +193,7 @@ class Leaf final : public ARTNode {
   Iterator upper_bound(const AdaptiveRadixTreeIndex::BinaryComparable&, size_t) const override;
   Iterator begin() const override;
   Iterator end() const override;
+  std::vector<std::pair<uint8_t, std::shared_ptr<ARTNode>>> children() const override;
 
  private:
   Iterator _begin;
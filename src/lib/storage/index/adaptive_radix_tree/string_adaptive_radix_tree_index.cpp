@@ -0,0 +1,179 @@
+#include "string_adaptive_radix_tree_index.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "storage/base_segment.hpp"
+#include "storage/segment_iterate.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+size_t StringAdaptiveRadixTreeIndex::estimate_memory_consumption(ChunkOffset row_count, ChunkOffset distinct_count,
+                                                                 uint32_t value_bytes) {
+  // A tree with n leaves has less than n inner nodes. In the worst case, no prefix is shared between the values.
+  return row_count * sizeof(ChunkOffset) + distinct_count * (2 * sizeof(Node) + value_bytes);
+}
+
+StringAdaptiveRadixTreeIndex::StringAdaptiveRadixTreeIndex(
+    const std::vector<std::shared_ptr<const BaseSegment>>& segments_to_index)
+    : BaseIndex{get_index_type_of<StringAdaptiveRadixTreeIndex>()}, _indexed_segment(segments_to_index.front()) {
+  Assert(segments_to_index.size() == 1, "StringAdaptiveRadixTree only works with a single segment");
+  Assert(_indexed_segment->data_type() == DataType::String, "StringAdaptiveRadixTree only works with string segments");
+
+  auto values = std::vector<std::pair<pmr_string, ChunkOffset>>{};
+  segment_iterate<pmr_string>(*_indexed_segment, [&](const auto& position) {
+    if (position.is_null()) return;
+    values.emplace_back(position.value(), position.chunk_offset());
+  });
+
+  // pmr_string compares the bytes as unsigned chars, which is the order of the partial keys
+  std::stable_sort(values.begin(), values.end(),
+                   [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
+
+  auto sorted_keys = std::vector<pmr_string>{};
+  sorted_keys.reserve(values.size());
+  _chunk_offsets.reserve(values.size());
+  for (auto& [value, chunk_offset] : values) {
+    sorted_keys.emplace_back(std::move(value));
+    _chunk_offsets.emplace_back(chunk_offset);
+  }
+
+  if (!sorted_keys.empty()) _build(sorted_keys, 0, sorted_keys.size(), 0);
+}
+
+uint32_t StringAdaptiveRadixTreeIndex::_build(const std::vector<pmr_string>& sorted_keys, const size_t begin,
+                                              const size_t end, const size_t depth) {
+  const auto node_id = static_cast<uint32_t>(_nodes.size());
+  _nodes.emplace_back();
+
+  // As the keys are sorted, all keys share the prefix that the first and the last key share
+  const auto& first_key = sorted_keys[begin];
+  const auto& last_key = sorted_keys[end - 1];
+  auto prefix_length = size_t{0};
+  while (depth + prefix_length < first_key.size() && depth + prefix_length < last_key.size() &&
+         first_key[depth + prefix_length] == last_key[depth + prefix_length]) {
+    ++prefix_length;
+  }
+  const auto key_depth = depth + prefix_length;
+
+  // Keys that end after the prefix are smaller than all others
+  auto children_begin = begin;
+  while (children_begin < end && sorted_keys[children_begin].size() == key_depth) {
+    ++children_begin;
+  }
+
+  auto partial_keys = std::vector<uint8_t>{};
+  auto children = std::vector<uint32_t>{};
+  for (auto child_begin = children_begin; child_begin < end;) {
+    const auto partial_key = static_cast<uint8_t>(sorted_keys[child_begin][key_depth]);
+    auto child_end = child_begin + 1;
+    while (child_end < end && static_cast<uint8_t>(sorted_keys[child_end][key_depth]) == partial_key) {
+      ++child_end;
+    }
+
+    partial_keys.emplace_back(partial_key);
+    children.emplace_back(_build(sorted_keys, child_begin, child_end, key_depth + 1));
+    child_begin = child_end;
+  }
+
+  // _build() adds nodes, so the node is only accessed once its children are built
+  auto& node = _nodes[node_id];
+  node.prefix = std::string{first_key.substr(depth, prefix_length)};
+  node.begin = static_cast<ChunkOffset>(begin);
+  node.children_begin = static_cast<ChunkOffset>(children_begin);
+  node.end = static_cast<ChunkOffset>(end);
+
+  if (children.size() > MAX_SEARCHED_CHILDREN) {
+    node.child_positions.resize(256);
+    auto child_position = uint16_t{0};
+    for (auto byte = size_t{0}; byte < node.child_positions.size(); ++byte) {
+      while (child_position < partial_keys.size() && partial_keys[child_position] < byte) ++child_position;
+      node.child_positions[byte] = child_position;
+    }
+  }
+
+  node.partial_keys = std::move(partial_keys);
+  node.children = std::move(children);
+
+  return node_id;
+}
+
+template <bool Inclusive>
+ChunkOffset StringAdaptiveRadixTreeIndex::_find(const pmr_string& value) const {
+  if (_nodes.empty()) return ChunkOffset{0};
+
+  const auto value_view = std::string_view{value.data(), value.size()};
+  auto node_id = uint32_t{0};
+  auto depth = size_t{0};
+
+  while (true) {
+    const auto& node = _nodes[node_id];
+
+    // Compare the prefix of the node to the corresponding bytes of the value. If they differ, or if the value ends
+    // within the prefix, all keys of the subtree are either smaller or greater than the value.
+    const auto remaining_length = value_view.size() - depth;
+    const auto compared_length = std::min(node.prefix.size(), remaining_length);
+    const auto comparison =
+        std::string_view{node.prefix}.substr(0, compared_length).compare(value_view.substr(depth, compared_length));
+    if (comparison < 0) return node.end;
+    if (comparison > 0 || remaining_length < node.prefix.size()) return node.begin;
+    depth += node.prefix.size();
+
+    // The keys that end after the prefix equal the value
+    if (depth == value_view.size()) return Inclusive ? node.children_begin : node.begin;
+
+    const auto partial_key = static_cast<uint8_t>(value_view[depth]);
+    auto child_position = size_t{0};
+    if (!node.child_positions.empty()) {
+      child_position = node.child_positions[partial_key];
+    } else {
+      while (child_position < node.partial_keys.size() && node.partial_keys[child_position] < partial_key) {
+        ++child_position;
+      }
+    }
+
+    if (child_position == node.children.size()) return node.end;
+    if (node.partial_keys[child_position] != partial_key) return _nodes[node.children[child_position]].begin;
+
+    node_id = node.children[child_position];
+    ++depth;
+  }
+}
+
+BaseIndex::Iterator StringAdaptiveRadixTreeIndex::_lower_bound(const std::vector<AllTypeVariant>& values) const {
+  Assert(values.size() == 1, "StringAdaptiveRadixTree only indexes a single segment");
+  return _chunk_offsets.cbegin() + _find<false>(boost::get<pmr_string>(values[0]));
+}
+
+BaseIndex::Iterator StringAdaptiveRadixTreeIndex::_upper_bound(const std::vector<AllTypeVariant>& values) const {
+  Assert(values.size() == 1, "StringAdaptiveRadixTree only indexes a single segment");
+  return _chunk_offsets.cbegin() + _find<true>(boost::get<pmr_string>(values[0]));
+}
+
+BaseIndex::Iterator StringAdaptiveRadixTreeIndex::_cbegin() const { return _chunk_offsets.cbegin(); }
+
+BaseIndex::Iterator StringAdaptiveRadixTreeIndex::_cend() const { return _chunk_offsets.cend(); }
+
+std::vector<std::shared_ptr<const BaseSegment>> StringAdaptiveRadixTreeIndex::_get_indexed_segments() const {
+  return {_indexed_segment};
+}
+
+size_t StringAdaptiveRadixTreeIndex::_memory_consumption() const {
+  // Only prefixes that exceed the short string optimization (SSO) use heap memory
+  static const auto short_string_capacity = std::string{}.capacity();
+
+  auto bytes = sizeof(*this) + _chunk_offsets.capacity() * sizeof(ChunkOffset) + _nodes.capacity() * sizeof(Node);
+  for (const auto& node : _nodes) {
+    if (node.prefix.capacity() > short_string_capacity) bytes += node.prefix.capacity();
+    bytes += node.partial_keys.capacity() * sizeof(uint8_t) + node.children.capacity() * sizeof(uint32_t) +
+             node.child_positions.capacity() * sizeof(uint16_t);
+  }
+  return bytes;
+}
+
+}  // namespace opossum
@@ -0,0 +1,86 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "storage/index/base_index.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseSegment;
+
+/**
+ * An Adaptive Radix Tree (ART) on a single string segment of any encoding. Unlike the AdaptiveRadixTreeIndex, which
+ * indexes the ValueIDs of a DictionarySegment, its keys are the bytes of the values themselves. Thus, it answers
+ * range predicates without the dictionary and, as all strings with a common prefix form one subtree, prefix searches
+ * such as LIKE 'abc%' (which the LQPTranslator turns into the range ["abc", "abd"), see LikeMatcher::prefix_bounds()).
+ *
+ * Paths without branches are compressed into a prefix stored in the node, so a node exists only where keys diverge
+ * (or end). As in the ART paper (https://db.in.tum.de/~leis/papers/ART.pdf), the representation of a node's children
+ * adapts to their number: up to 16 partial keys are searched directly (like Node4/Node16), larger nodes map each
+ * byte to its child position (like Node48/Node256).
+ *
+ * The ChunkOffsets are stored ordered by their value. Each node covers a contiguous range of them, which is why a
+ * lookup returns as soon as it leaves the path of the searched value. NULL values are not indexed.
+ */
+class StringAdaptiveRadixTreeIndex : public BaseIndex {
+  friend class StringAdaptiveRadixTreeIndexTest;
+
+ public:
+  /**
+   * Predicts the memory consumption in bytes of creating this index.
+   * See BaseIndex::estimate_memory_consumption()
+   */
+  static size_t estimate_memory_consumption(ChunkOffset row_count, ChunkOffset distinct_count, uint32_t value_bytes);
+
+  explicit StringAdaptiveRadixTreeIndex(const std::vector<std::shared_ptr<const BaseSegment>>& segments_to_index);
+
+ protected:
+  // Nodes with more children use the byte-addressed child_positions instead of searching partial_keys
+  static constexpr auto MAX_SEARCHED_CHILDREN = size_t{16};
+
+  struct Node {
+    // The bytes that all keys in the subtree share after the partial key that led to this node
+    std::string prefix;
+
+    // The subtree covers [begin, end) in _chunk_offsets. Keys that end after the prefix come first, the children
+    // cover [children_begin, end).
+    ChunkOffset begin{0};
+    ChunkOffset children_begin{0};
+    ChunkOffset end{0};
+
+    // The partial keys of the children in ascending order, children[i] is the position of the child in _nodes
+    std::vector<uint8_t> partial_keys;
+    std::vector<uint32_t> children;
+
+    // For nodes with more than MAX_SEARCHED_CHILDREN children: the position of the first child whose partial key is
+    // not smaller than the byte, for every possible byte
+    std::vector<uint16_t> child_positions;
+  };
+
+  Iterator _lower_bound(const std::vector<AllTypeVariant>& values) const final;
+  Iterator _upper_bound(const std::vector<AllTypeVariant>& values) const final;
+  Iterator _cbegin() const final;
+  Iterator _cend() const final;
+  std::vector<std::shared_ptr<const BaseSegment>> _get_indexed_segments() const final;
+  size_t _memory_consumption() const final;
+
+  // Builds the subtree for the sorted keys [begin, end), of which the first depth bytes were consumed by its ancestors.
+  // Returns the position of its root in _nodes.
+  uint32_t _build(const std::vector<pmr_string>& sorted_keys, const size_t begin, const size_t end, const size_t depth);
+
+  // Returns the position in _chunk_offsets of the first key that is not smaller than (or, if Inclusive, greater than)
+  // value
+  template <bool Inclusive>
+  ChunkOffset _find(const pmr_string& value) const;
+
+  const std::shared_ptr<const BaseSegment> _indexed_segment;
+  std::vector<ChunkOffset> _chunk_offsets;
+
+  // The root is the first node, there are no nodes if no value is indexed
+  std::vector<Node> _nodes;
+};
+
+}  // namespace opossum
@@ -1,5 +1,7 @@
 #include "b_tree_index.hpp"
 
+#include <algorithm>
+
 #include "resolve_type.hpp"
 #include "storage/index/segment_index_type.hpp"
 
@@ -7,7 +9,19 @@ namespace opossum {
 
 size_t BTreeIndex::estimate_memory_consumption(ChunkOffset row_count, ChunkOffset distinct_count,
                                                uint32_t value_bytes) {
-  Fail("BTreeIndex::estimate_memory_consumption() is not implemented yet");
+  if (distinct_count == 0) return row_count * sizeof(ChunkOffset);
+
+  // Leaves store a key and a position per slot, inner nodes only a key
+  const auto keys_per_node = std::max(size_t{64} / std::max(size_t{value_bytes}, size_t{1}), size_t{8});
+  auto node_count = (size_t{distinct_count} + keys_per_node - 1) / keys_per_node;
+  auto bytes = row_count * sizeof(ChunkOffset) + node_count * keys_per_node * (value_bytes + sizeof(ChunkOffset));
+
+  while (node_count > 1) {
+    node_count = (node_count + keys_per_node - 1) / keys_per_node;
+    bytes += node_count * keys_per_node * value_bytes;
+  }
+
+  return bytes;
 }
 
 BTreeIndex::BTreeIndex(const std::vector<std::shared_ptr<const BaseSegment>>& segments_to_index)
@@ -17,6 +31,18 @@ BTreeIndex::BTreeIndex(const std::vector<std::shared_ptr<const BaseSegment>>& se
       make_shared_by_data_type<BaseBTreeIndexImpl, BTreeIndexImpl>(_indexed_segments->data_type(), _indexed_segments);
 }
 
+BTreeIndex::BTreeIndex(const std::vector<std::shared_ptr<const BaseSegment>>& segments_to_index,
+                       std::vector<ChunkOffset>&& chunk_offsets, std::vector<ChunkOffset>&& key_positions)
+    : BaseIndex{get_index_type_of<BTreeIndex>()}, _indexed_segments(segments_to_index[0]) {
+  Assert((segments_to_index.size() == 1), "BTreeIndex only works with a single segment.");
+  _impl = make_shared_by_data_type<BaseBTreeIndexImpl, BTreeIndexImpl>(
+      _indexed_segments->data_type(), _indexed_segments, std::move(chunk_offsets), key_positions);
+}
+
+const std::vector<ChunkOffset>& BTreeIndex::chunk_offsets() const { return _impl->chunk_offsets(); }
+
+std::vector<ChunkOffset> BTreeIndex::key_positions() const { return _impl->key_positions(); }
+
 size_t BTreeIndex::_memory_consumption() const { return _impl->memory_consumption(); }
 
 BTreeIndex::Iterator BTreeIndex::_lower_bound(const std::vector<AllTypeVariant>& values) const {
@@ -19,14 +19,23 @@ class BTreeIndex : public BaseIndex {
   /**
    * Predicts the memory consumption in bytes of creating this index.
    * See BaseIndex::estimate_memory_consumption()
-   * The introduction of PMR strings increased this significantly (in one test from 320 to 896). If you are interested
-   * in reducing the memory footprint of these indexes, this is probably the first place you should look.
+   * Assumes that the tree is bulk-loaded into nodes of 64 bytes (see BTreeIndexImpl). Heap allocations of long strings
+   * are not included.
    */
   static size_t estimate_memory_consumption(ChunkOffset row_count, ChunkOffset distinct_count, uint32_t value_bytes);
 
   BTreeIndex() = delete;
   explicit BTreeIndex(const std::vector<std::shared_ptr<const BaseSegment>>& segments_to_index);
 
+  // Restores an index from its structures (e.g., read by ImportBinary) without sorting the segment's values again
+  BTreeIndex(const std::vector<std::shared_ptr<const BaseSegment>>& segments_to_index,
+             std::vector<ChunkOffset>&& chunk_offsets, std::vector<ChunkOffset>&& key_positions);
+
+  // The ChunkOffsets of all non-NULL rows ordered by their value, and the position of each distinct value's first
+  // ChunkOffset in them
+  const std::vector<ChunkOffset>& chunk_offsets() const;
+  std::vector<ChunkOffset> key_positions() const;
+
  protected:
   Iterator _lower_bound(const std::vector<AllTypeVariant>&) const override;
   Iterator _upper_bound(const std::vector<AllTypeVariant>&) const override;
@@ -1,16 +1,192 @@
 #include "b_tree_index_impl.hpp"
 
+#include <algorithm>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+#include "storage/dictionary_segment.hpp"
 #include "storage/index/base_index.hpp"
+#include "storage/segment_accessor.hpp"
 #include "storage/segment_iterate.hpp"
+#include "storage/vector_compression/resolve_compressed_vector_type.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
 
 namespace opossum {
 
+const std::vector<ChunkOffset>& BaseBTreeIndexImpl::chunk_offsets() const { return _chunk_offsets; }
+
+template <typename DataType>
+BTreeIndexImpl<DataType>::BTreeIndexImpl(const std::shared_ptr<const BaseSegment>& segments_to_index) {
+  auto keys = std::vector<DataType>{};
+  auto positions = std::vector<ChunkOffset>{};
+
+  if (const auto dictionary_segment = std::dynamic_pointer_cast<const DictionarySegment<DataType>>(segments_to_index)) {
+    // The dictionary is already sorted and free of duplicates, so a counting sort of the value ids suffices
+    const auto& dictionary = *dictionary_segment->dictionary();
+    const auto null_value_id = dictionary_segment->null_value_id();
+
+    auto value_id_offsets = std::vector<ChunkOffset>(dictionary.size() + 1, 0);
+    resolve_compressed_vector_type(*dictionary_segment->attribute_vector(), [&](const auto& attribute_vector) {
+      for (const auto value_id : attribute_vector) {
+        if (static_cast<ValueID>(value_id) != null_value_id) ++value_id_offsets[value_id + 1];
+      }
+    });
+    std::partial_sum(value_id_offsets.begin(), value_id_offsets.end(), value_id_offsets.begin());
+
+    _chunk_offsets.resize(value_id_offsets.back());
+    auto write_offsets = value_id_offsets;
+    resolve_compressed_vector_type(*dictionary_segment->attribute_vector(), [&](const auto& attribute_vector) {
+      auto chunk_offset = ChunkOffset{0};
+      for (auto value_id_iter = attribute_vector.cbegin(); value_id_iter != attribute_vector.cend();
+           ++value_id_iter, ++chunk_offset) {
+        const auto value_id = static_cast<ValueID>(*value_id_iter);
+        if (value_id != null_value_id) _chunk_offsets[write_offsets[value_id]++] = chunk_offset;
+      }
+    });
+
+    keys.assign(dictionary.cbegin(), dictionary.cend());
+    positions.assign(value_id_offsets.cbegin(), value_id_offsets.cend() - 1);
+  } else {
+    auto values = std::vector<std::pair<DataType, ChunkOffset>>{};
+    segment_iterate<DataType>(*segments_to_index, [&](const auto& position) {
+      if (position.is_null()) return;
+      values.emplace_back(position.value(), position.chunk_offset());
+    });
+
+    // The values are materialized in the order of their ChunkOffsets, a stable sort keeps that order for equal values
+    std::stable_sort(values.begin(), values.end(),
+                     [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
+
+    _chunk_offsets.resize(values.size());
+    for (auto value_idx = size_t{0}; value_idx < values.size(); ++value_idx) {
+      _chunk_offsets[value_idx] = values[value_idx].second;
+      if (keys.empty() || keys.back() != values[value_idx].first) {
+        keys.emplace_back(std::move(values[value_idx].first));
+        positions.emplace_back(static_cast<ChunkOffset>(value_idx));
+      }
+    }
+  }
+
+  _bulk_load(std::move(keys), positions);
+}
+
+template <typename DataType>
+BTreeIndexImpl<DataType>::BTreeIndexImpl(const std::shared_ptr<const BaseSegment>& segments_to_index,
+                                         std::vector<ChunkOffset>&& chunk_offsets,
+                                         const std::vector<ChunkOffset>& key_positions) {
+  _chunk_offsets = std::move(chunk_offsets);
+
+  const auto segment_accessor = create_segment_accessor<DataType>(segments_to_index);
+  auto keys = std::vector<DataType>{};
+  keys.reserve(key_positions.size());
+  for (const auto key_position : key_positions) {
+    const auto value = segment_accessor->access(_chunk_offsets[key_position]);
+    Assert(value, "NULL values are not indexed");
+    keys.emplace_back(*value);
+  }
+
+  _bulk_load(std::move(keys), key_positions);
+}
+
+template <typename DataType>
+void BTreeIndexImpl<DataType>::_bulk_load(std::vector<DataType>&& keys, const std::vector<ChunkOffset>& positions) {
+  _key_count = keys.size();
+  if (_key_count == 0) return;
+
+  const auto& greatest_key = keys.back();
+
+  // Fill the leaves
+  _leaves.resize((_key_count + NODE_SIZE - 1) / NODE_SIZE);
+  for (auto key_idx = size_t{0}; key_idx < _leaves.size() * NODE_SIZE; ++key_idx) {
+    auto& leaf = _leaves[key_idx / NODE_SIZE];
+    const auto slot = key_idx % NODE_SIZE;
+    if (key_idx < _key_count) {
+      leaf.keys[slot] = keys[key_idx];
+      leaf.positions[slot] = positions[key_idx];
+      _add_to_heap_memory_usage(keys[key_idx]);
+    } else {
+      leaf.keys[slot] = greatest_key;
+      leaf.positions[slot] = static_cast<ChunkOffset>(_chunk_offsets.size());
+    }
+  }
+
+  // Build the inner levels bottom-up, each node stores the smallest key of each of its children
+  auto child_keys = std::vector<DataType>{};
+  child_keys.reserve(_leaves.size());
+  for (const auto& leaf : _leaves) {
+    child_keys.emplace_back(leaf.keys[0]);
+  }
+
+  while (child_keys.size() > 1) {
+    auto level = std::vector<InnerNode>((child_keys.size() + NODE_SIZE - 1) / NODE_SIZE);
+    for (auto child_idx = size_t{0}; child_idx < level.size() * NODE_SIZE; ++child_idx) {
+      const auto& key = child_idx < child_keys.size() ? child_keys[child_idx] : greatest_key;
+      level[child_idx / NODE_SIZE].keys[child_idx % NODE_SIZE] = key;
+      if (child_idx < child_keys.size()) _add_to_heap_memory_usage(key);
+    }
+
+    child_keys.clear();
+    for (const auto& node : level) {
+      child_keys.emplace_back(node.keys[0]);
+    }
+
+    _inner_levels.insert(_inner_levels.begin(), std::move(level));
+  }
+}
+
 template <typename DataType>
-BTreeIndexImpl<DataType>::BTreeIndexImpl(const std::shared_ptr<const BaseSegment>& segments_to_index)
-    : _heap_bytes_used{0} {
-  _bulk_insert(segments_to_index);
+template <bool Inclusive>
+size_t BTreeIndexImpl<DataType>::_count_keys_before(const std::array<DataType, NODE_SIZE>& keys,
+                                                     const DataType& value) {
+  if constexpr (std::is_arithmetic_v<DataType>) {
+    // Comparing all keys without branches allows the compiler to use SIMD instructions, a node is a single cache line
+    auto count = size_t{0};
+
+    // NOLINTNEXTLINE
+    ;  // clang-format off
+    #pragma omp simd reduction(+:count)
+    // clang-format on
+    for (auto key_idx = size_t{0}; key_idx < NODE_SIZE; ++key_idx) {
+      if constexpr (Inclusive) {
+        count += keys[key_idx] <= value;
+      } else {
+        count += keys[key_idx] < value;
+      }
+    }
+
+    return count;
+  } else {
+    if constexpr (Inclusive) {
+      return std::upper_bound(keys.cbegin(), keys.cend(), value) - keys.cbegin();
+    } else {
+      return std::lower_bound(keys.cbegin(), keys.cend(), value) - keys.cbegin();
+    }
+  }
+}
+
+template <typename DataType>
+template <bool Inclusive>
+BaseBTreeIndexImpl::Iterator BTreeIndexImpl<DataType>::_find(const DataType& value) const {
+  if (_key_count == 0) return _chunk_offsets.cend();
+
+  // Descend into the last child whose smallest key is before value. The padding of the last node of a level might
+  // point past the existing children, which is why the node index is capped.
+  auto node_idx = size_t{0};
+  for (auto level_idx = size_t{0}; level_idx < _inner_levels.size(); ++level_idx) {
+    const auto child_count =
+        level_idx + 1 < _inner_levels.size() ? _inner_levels[level_idx + 1].size() : _leaves.size();
+    const auto keys_before = _count_keys_before<Inclusive>(_inner_levels[level_idx][node_idx].keys, value);
+    node_idx = std::min(node_idx * NODE_SIZE + (keys_before > 0 ? keys_before - 1 : 0), child_count - 1);
+  }
+
+  // If all keys of the leaf are before value, the result is the first key of the next leaf
+  const auto key_idx =
+      std::min(node_idx * NODE_SIZE + _count_keys_before<Inclusive>(_leaves[node_idx].keys, value), _key_count);
+  if (key_idx == _key_count) return _chunk_offsets.cend();
+
+  return _chunk_offsets.cbegin() + _leaves[key_idx / NODE_SIZE].positions[key_idx % NODE_SIZE];
 }
 
 template <typename DataType>
@@ -34,59 +210,34 @@ BaseBTreeIndexImpl::Iterator BTreeIndexImpl<DataType>::cend() const {
 }
 
 template <typename DataType>
-BaseBTreeIndexImpl::Iterator BTreeIndexImpl<DataType>::lower_bound(DataType value) const {
-  auto result = _btree.lower_bound(value);
-  if (result == _btree.end()) {
-    return _chunk_offsets.end();
-  } else {
-    return _chunk_offsets.begin() + result->second;
+std::vector<ChunkOffset> BTreeIndexImpl<DataType>::key_positions() const {
+  auto key_positions = std::vector<ChunkOffset>(_key_count);
+  for (auto key_idx = size_t{0}; key_idx < _key_count; ++key_idx) {
+    key_positions[key_idx] = _leaves[key_idx / NODE_SIZE].positions[key_idx % NODE_SIZE];
   }
+  return key_positions;
 }
 
 template <typename DataType>
-BaseBTreeIndexImpl::Iterator BTreeIndexImpl<DataType>::upper_bound(DataType value) const {
-  auto result = _btree.upper_bound(value);
-  if (result == _btree.end()) {
-    return _chunk_offsets.end();
-  } else {
-    return _chunk_offsets.begin() + result->second;
-  }
+BaseBTreeIndexImpl::Iterator BTreeIndexImpl<DataType>::lower_bound(const DataType& value) const {
+  return _find<false>(value);
 }
 
 template <typename DataType>
-size_t BTreeIndexImpl<DataType>::memory_consumption() const {
-  return sizeof(std::vector<ChunkOffset>) + sizeof(ChunkOffset) * _chunk_offsets.size() + _btree.bytes_used() +
-         _heap_bytes_used;
+BaseBTreeIndexImpl::Iterator BTreeIndexImpl<DataType>::upper_bound(const DataType& value) const {
+  return _find<true>(value);
 }
 
 template <typename DataType>
-void BTreeIndexImpl<DataType>::_bulk_insert(const std::shared_ptr<const BaseSegment>& segment) {
-  std::vector<std::pair<ChunkOffset, DataType>> values;
-
-  // Materialize
-  segment_iterate<DataType>(*segment, [&](const auto& position) {
-    if (position.is_null()) return;
-    values.push_back(std::make_pair(position.chunk_offset(), position.value()));
-  });
-
-  // Sort
-  std::sort(values.begin(), values.end(), [](const auto& a, const auto& b) { return a.second < b.second; });
-  _chunk_offsets.resize(values.size());
-  for (size_t i = 0; i < values.size(); i++) {
-    _chunk_offsets[i] = values[i].first;
+size_t BTreeIndexImpl<DataType>::memory_consumption() const {
+  auto inner_node_count = size_t{0};
+  for (const auto& level : _inner_levels) {
+    inner_node_count += level.size();
   }
 
-  // Build index
-  DataType current_value = values[0].second;
-  _btree[current_value] = 0;
-  _add_to_heap_memory_usage(current_value);
-  for (size_t i = 0; i < values.size(); i++) {
-    if (values[i].second != current_value) {
-      current_value = values[i].second;
-      _btree[current_value] = i;
-      _add_to_heap_memory_usage(current_value);
-    }
-  }
+  return sizeof(*this) + sizeof(ChunkOffset) * _chunk_offsets.size() + sizeof(LeafNode) * _leaves.size() +
+         sizeof(std::vector<InnerNode>) * _inner_levels.size() + sizeof(InnerNode) * inner_node_count +
+         _heap_bytes_used;
 }
 
 template <typename DataType>
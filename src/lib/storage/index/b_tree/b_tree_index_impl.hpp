@@ -1,13 +1,10 @@
 #pragma once
 
-#ifdef __clang__
-#pragma clang diagnostic ignored "-Wall"
-#include <btree_map.h>
-#pragma clang diagnostic pop
-#elif __GNUC__
-#pragma GCC system_header
-#include <btree_map.h>
-#endif
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <type_traits>
+#include <vector>
 
 #include "all_type_variant.hpp"
 #include "storage/base_segment.hpp"
@@ -30,37 +27,85 @@ class BaseBTreeIndexImpl : public Noncopyable {
   virtual Iterator cbegin() const = 0;
   virtual Iterator cend() const = 0;
 
+  const std::vector<ChunkOffset>& chunk_offsets() const;
+
+  // For each distinct value, the position of its first ChunkOffset in chunk_offsets()
+  virtual std::vector<ChunkOffset> key_positions() const = 0;
+
  protected:
+  // The ChunkOffsets of all non-NULL rows, ordered by their value
   std::vector<ChunkOffset> _chunk_offsets;
 };
 
 /**
-* Implementation: https://code.google.com/archive/p/cpp-btree/
-* Note: does not support null values right now.
-*/
+ * A read-only B+-tree that is bulk-loaded once from the indexed (immutable) segment. Dictionary segments are loaded
+ * from their sorted dictionary without sorting the values, all other segments are materialized and sorted.
+ *
+ * The tree does not use pointers: all nodes of a level are stored consecutively, so that child `slot` of node `node`
+ * is node `node * NODE_SIZE + slot` of the next level. Each node holds NODE_SIZE keys, which for arithmetic types
+ * fill a cache line. Inner nodes store the smallest key of each child, leaves store the distinct values together with
+ * the position of their first ChunkOffset in _chunk_offsets (BaseIndex requires a single ChunkOffset vector to
+ * iterate over). Unused slots of the last node of a level are filled with the greatest key.
+ *
+ * Within a node, arithmetic keys are searched by counting the smaller keys without branches, which the compiler
+ * vectorizes. Strings use a binary search. NULL values are not indexed.
+ */
 template <typename DataType>
 class BTreeIndexImpl : public BaseBTreeIndexImpl {
   friend BTreeIndexTest;
 
  public:
+  // Number of keys per node. For arithmetic types, the keys of a node fill a cache line (64 bytes).
+  static constexpr auto NODE_SIZE =
+      std::is_arithmetic_v<DataType> ? std::max(size_t{64} / sizeof(DataType), size_t{8}) : size_t{16};
+
   explicit BTreeIndexImpl(const std::shared_ptr<const BaseSegment>& segments_to_index);
 
+  // Restores the tree from chunk_offsets() and key_positions() without sorting the values. The keys are read from the
+  // segment at the first ChunkOffset of each distinct value.
+  BTreeIndexImpl(const std::shared_ptr<const BaseSegment>& segments_to_index, std::vector<ChunkOffset>&& chunk_offsets,
+                 const std::vector<ChunkOffset>& key_positions);
+
   size_t memory_consumption() const override;
 
-  Iterator lower_bound(DataType value) const;
-  Iterator upper_bound(DataType value) const;
+  Iterator lower_bound(const DataType& value) const;
+  Iterator upper_bound(const DataType& value) const;
 
   Iterator lower_bound(const std::vector<AllTypeVariant>&) const override;
   Iterator upper_bound(const std::vector<AllTypeVariant>&) const override;
   Iterator cbegin() const override;
   Iterator cend() const override;
 
+  std::vector<ChunkOffset> key_positions() const override;
+
  protected:
-  void _bulk_insert(const std::shared_ptr<const BaseSegment>&);
+  struct alignas(64) InnerNode {
+    std::array<DataType, NODE_SIZE> keys;
+  };
+
+  struct alignas(64) LeafNode {
+    std::array<DataType, NODE_SIZE> keys;
+    std::array<ChunkOffset, NODE_SIZE> positions;
+  };
+
+  void _bulk_load(std::vector<DataType>&& keys, const std::vector<ChunkOffset>& positions);
   void _add_to_heap_memory_usage(const DataType&);
 
-  btree::btree_map<DataType, size_t> _btree;
-  size_t _heap_bytes_used;
+  // Returns the number of keys in the node that are smaller than (or, if Inclusive, equal to) value
+  template <bool Inclusive>
+  static size_t _count_keys_before(const std::array<DataType, NODE_SIZE>& keys, const DataType& value);
+
+  // Returns the position in _chunk_offsets of the first key that is not smaller than (or, if Inclusive, greater than)
+  // value
+  template <bool Inclusive>
+  Iterator _find(const DataType& value) const;
+
+  // Root level first
+  std::vector<std::vector<InnerNode>> _inner_levels;
+  std::vector<LeafNode> _leaves;
+  size_t _key_count{0};
+
+  size_t _heap_bytes_used{0};
 };
 
 }  // namespace opossum
@@ -4,6 +4,7 @@
 #include <vector>
 
 #include "storage/index/adaptive_radix_tree/adaptive_radix_tree_index.hpp"
+#include "storage/index/adaptive_radix_tree/string_adaptive_radix_tree_index.hpp"
 #include "storage/index/b_tree/b_tree_index.hpp"
 #include "storage/index/group_key/composite_group_key_index.hpp"
 #include "storage/index/group_key/group_key_index.hpp"
@@ -21,6 +22,8 @@ size_t BaseIndex::estimate_memory_consumption(SegmentIndexType type, ChunkOffset
       return AdaptiveRadixTreeIndex::estimate_memory_consumption(row_count, distinct_count, value_bytes);
     case SegmentIndexType::BTree:
       return BTreeIndex::estimate_memory_consumption(row_count, distinct_count, value_bytes);
+    case SegmentIndexType::StringAdaptiveRadixTree:
+      return StringAdaptiveRadixTreeIndex::estimate_memory_consumption(row_count, distinct_count, value_bytes);
     default:
       Fail("estimate_memory_consumption() is not implemented for the given index type");
   }
@@ -59,6 +62,23 @@ BaseIndex::Iterator BaseIndex::cend() const { return _cend(); }
 
 SegmentIndexType BaseIndex::type() const { return _type; }
 
+std::vector<std::shared_ptr<const BaseSegment>> BaseIndex::get_indexed_segments() const {
+  return _get_indexed_segments();
+}
+
 size_t BaseIndex::memory_consumption() const { return _memory_consumption(); }
 
+std::chrono::nanoseconds BaseIndex::build_duration() const { return _build_duration; }
+
+void BaseIndex::set_build_duration(const std::chrono::nanoseconds build_duration) { _build_duration = build_duration; }
+
+size_t BaseIndex::lookup_count() const { return _lookup_count.load(); }
+
+size_t BaseIndex::skipped_row_count() const { return _skipped_row_count.load(); }
+
+void BaseIndex::record_lookups(const size_t lookup_count, const size_t skipped_row_count) const {
+  _lookup_count.fetch_add(lookup_count, std::memory_order_relaxed);
+  _skipped_row_count.fetch_add(skipped_row_count, std::memory_order_relaxed);
+}
+
 }  // namespace opossum
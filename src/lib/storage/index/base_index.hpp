@@ -1,5 +1,6 @@
 #pragma once
 
+#include <chrono>
 #include <memory>
 #include <vector>
 
@@ -7,6 +8,7 @@
 #include "segment_index_type.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
+#include "utils/copyable_atomic.hpp"
 
 namespace opossum {
 
@@ -121,11 +123,30 @@ class BaseIndex : private Noncopyable {
 
   SegmentIndexType type() const;
 
+  // Returns the indexed segments in the order of the index's columns
+  std::vector<std::shared_ptr<const BaseSegment>> get_indexed_segments() const;
+
   /**
    * Returns the memory consumption of this Index in bytes
    */
   size_t memory_consumption() const;
 
+  /**
+   * @defgroup Usage statistics, e.g., for the meta_indexes table (see MetaTableManager)
+   * @{
+   */
+  std::chrono::nanoseconds build_duration() const;
+  void set_build_duration(const std::chrono::nanoseconds build_duration);
+
+  // Number of lookups of the index by operators and the number of rows they did not need to read due to the index.
+  // For a lookup in a chunk of n rows that returns m rows, n - m rows were skipped.
+  size_t lookup_count() const;
+  size_t skipped_row_count() const;
+
+  // The counters do not change the index itself and are updated concurrently, which is why this is const
+  void record_lookups(const size_t lookup_count, const size_t skipped_row_count) const;
+  /** @} */
+
  protected:
   /**
    * Seperate the public interface of the index from the interface for programmers implementing own
@@ -140,5 +161,9 @@ class BaseIndex : private Noncopyable {
 
  private:
   const SegmentIndexType _type;
+
+  std::chrono::nanoseconds _build_duration{0};
+  mutable copyable_atomic<size_t> _lookup_count{0};
+  mutable copyable_atomic<size_t> _skipped_row_count{0};
 };
 }  // namespace opossum
@@ -0,0 +1,129 @@
+#include "delta_index.hpp"
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "storage/segment_iterate.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+std::shared_ptr<BaseDeltaIndex> BaseDeltaIndex::create(const DataType data_type, const ColumnID column_id,
+                                                       const SegmentIndexType target_index_type) {
+  return make_shared_by_data_type<BaseDeltaIndex, DeltaIndex>(data_type, column_id, target_index_type);
+}
+
+BaseDeltaIndex::BaseDeltaIndex(const ColumnID column_id, const SegmentIndexType target_index_type)
+    : _column_id(column_id), _target_index_type(target_index_type) {}
+
+ColumnID BaseDeltaIndex::column_id() const { return _column_id; }
+
+SegmentIndexType BaseDeltaIndex::target_index_type() const { return _target_index_type; }
+
+template <typename T>
+DeltaIndex<T>::DeltaIndex(const ColumnID column_id, const SegmentIndexType target_index_type)
+    : BaseDeltaIndex(column_id, target_index_type) {}
+
+template <typename T>
+void DeltaIndex<T>::insert(const BaseSegment& segment, const ChunkOffset begin_chunk_offset,
+                           const ChunkOffset end_chunk_offset) {
+  DebugAssert(end_chunk_offset <= segment.size(), "Range exceeds the segment");
+
+  std::unique_lock<std::shared_mutex> lock(_mutex);
+
+  segment_with_iterators<T>(segment, [&](auto it, const auto end) {
+    it += begin_chunk_offset;
+    for (auto chunk_offset = begin_chunk_offset; chunk_offset < end_chunk_offset; ++chunk_offset, ++it) {
+      if (it->is_null()) continue;
+      _chunk_offsets.emplace(it->value(), chunk_offset);
+    }
+  });
+}
+
+template <typename T>
+std::vector<ChunkOffset> DeltaIndex<T>::scan(const PredicateCondition predicate_condition,
+                                             const AllTypeVariant& value,
+                                             const std::optional<AllTypeVariant>& value2) const {
+  Assert(!is_between_predicate_condition(predicate_condition) || value2, "BETWEEN requires a second value");
+
+  auto chunk_offsets = std::vector<ChunkOffset>{};
+  if (variant_is_null(value) || (value2 && variant_is_null(*value2))) return chunk_offsets;
+
+  const auto typed_value = boost::get<T>(value);
+
+  std::shared_lock<std::shared_mutex> lock(_mutex);
+
+  switch (predicate_condition) {
+    case PredicateCondition::Equals: {
+      const auto [range_begin, range_end] = _chunk_offsets.equal_range(typed_value);
+      _append_range(range_begin, range_end, chunk_offsets);
+      break;
+    }
+    case PredicateCondition::NotEquals: {
+      const auto [range_begin, range_end] = _chunk_offsets.equal_range(typed_value);
+      _append_range(_chunk_offsets.cbegin(), range_begin, chunk_offsets);
+      _append_range(range_end, _chunk_offsets.cend(), chunk_offsets);
+      break;
+    }
+    case PredicateCondition::LessThan:
+      _append_range(_chunk_offsets.cbegin(), _chunk_offsets.lower_bound(typed_value), chunk_offsets);
+      break;
+    case PredicateCondition::LessThanEquals:
+      _append_range(_chunk_offsets.cbegin(), _chunk_offsets.upper_bound(typed_value), chunk_offsets);
+      break;
+    case PredicateCondition::GreaterThan:
+      _append_range(_chunk_offsets.upper_bound(typed_value), _chunk_offsets.cend(), chunk_offsets);
+      break;
+    case PredicateCondition::GreaterThanEquals:
+      _append_range(_chunk_offsets.lower_bound(typed_value), _chunk_offsets.cend(), chunk_offsets);
+      break;
+    case PredicateCondition::BetweenInclusive:
+    case PredicateCondition::BetweenLowerExclusive:
+    case PredicateCondition::BetweenUpperExclusive:
+    case PredicateCondition::BetweenExclusive: {
+      const auto typed_value2 = boost::get<T>(*value2);
+
+      const auto lower_inclusive = predicate_condition == PredicateCondition::BetweenInclusive ||
+                                   predicate_condition == PredicateCondition::BetweenUpperExclusive;
+      const auto upper_inclusive = predicate_condition == PredicateCondition::BetweenInclusive ||
+                                   predicate_condition == PredicateCondition::BetweenLowerExclusive;
+
+      // For empty ranges (e.g., BETWEEN 5 AND 3), range_end could be located before range_begin
+      if (typed_value2 < typed_value || (typed_value2 == typed_value && !(lower_inclusive && upper_inclusive))) {
+        break;
+      }
+
+      const auto range_begin =
+          lower_inclusive ? _chunk_offsets.lower_bound(typed_value) : _chunk_offsets.upper_bound(typed_value);
+      const auto range_end =
+          upper_inclusive ? _chunk_offsets.upper_bound(typed_value2) : _chunk_offsets.lower_bound(typed_value2);
+
+      _append_range(range_begin, range_end, chunk_offsets);
+      break;
+    }
+    default:
+      Fail("Unsupported predicate condition for DeltaIndex");
+  }
+
+  return chunk_offsets;
+}
+
+template <typename T>
+size_t DeltaIndex<T>::size() const {
+  std::shared_lock<std::shared_mutex> lock(_mutex);
+  return _chunk_offsets.size();
+}
+
+template <typename T>
+void DeltaIndex<T>::_append_range(const typename Map::const_iterator begin, const typename Map::const_iterator end,
+                                  std::vector<ChunkOffset>& chunk_offsets) {
+  for (auto entry_iter = begin; entry_iter != end; ++entry_iter) {
+    chunk_offsets.emplace_back(entry_iter->second);
+  }
+}
+
+EXPLICITLY_INSTANTIATE_DATA_TYPES(DeltaIndex);
+
+}  // namespace opossum
@@ -0,0 +1,87 @@
+#pragma once
+
+#include <map>
+#include <memory>
+#include <optional>
+#include <shared_mutex>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "storage/index/segment_index_type.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseSegment;
+
+/**
+ * The chunk indexes (see BaseIndex) require immutable, mostly dictionary-encoded segments. The DeltaIndex fills the
+ * gap for the mutable Chunk of a Table: it indexes a single ValueSegment and accepts new rows while being read.
+ *
+ * Table::create_index() places a DeltaIndex on mutable Chunks instead of the requested index,
+ * Table::append_mutable_chunk() adds one for every single-column index of the Table, and the Insert operator as well
+ * as Chunk::append() fill it.
+ * Once the Chunk is encoded, ChunkEncoder merges it into a regular index of the requested (target) type.
+ *
+ * Like the chunk indexes, the DeltaIndex covers all physical rows - rolled back or deleted rows are filtered out by
+ * the Validate operator. NULL values are not indexed.
+ *
+ * The entries are kept in an ordered multimap that is guarded by a reader-writer lock, so that scans (which only take
+ * the shared lock) do not block each other.
+ */
+class BaseDeltaIndex : private Noncopyable {
+ public:
+  static std::shared_ptr<BaseDeltaIndex> create(const DataType data_type, const ColumnID column_id,
+                                                const SegmentIndexType target_index_type);
+
+  BaseDeltaIndex(const ColumnID column_id, const SegmentIndexType target_index_type);
+  virtual ~BaseDeltaIndex() = default;
+
+  ColumnID column_id() const;
+
+  // The type of the chunk index that replaces this DeltaIndex once the Chunk is encoded
+  SegmentIndexType target_index_type() const;
+
+  // Adds the rows [begin_chunk_offset, end_chunk_offset) of the indexed segment
+  virtual void insert(const BaseSegment& segment, const ChunkOffset begin_chunk_offset,
+                      const ChunkOffset end_chunk_offset) = 0;
+
+  /**
+   * Returns the ChunkOffsets of all rows that satisfy the predicate, ordered by value (as if iterating over a chunk
+   * index from lower_bound() to upper_bound()). value2 is required for BETWEEN predicates.
+   */
+  virtual std::vector<ChunkOffset> scan(const PredicateCondition predicate_condition, const AllTypeVariant& value,
+                                        const std::optional<AllTypeVariant>& value2 = std::nullopt) const = 0;
+
+  // Number of indexed rows
+  virtual size_t size() const = 0;
+
+ protected:
+  const ColumnID _column_id;
+  const SegmentIndexType _target_index_type;
+};
+
+template <typename T>
+class DeltaIndex : public BaseDeltaIndex {
+ public:
+  DeltaIndex(const ColumnID column_id, const SegmentIndexType target_index_type);
+
+  void insert(const BaseSegment& segment, const ChunkOffset begin_chunk_offset,
+              const ChunkOffset end_chunk_offset) final;
+
+  std::vector<ChunkOffset> scan(const PredicateCondition predicate_condition, const AllTypeVariant& value,
+                                const std::optional<AllTypeVariant>& value2 = std::nullopt) const final;
+
+  size_t size() const final;
+
+ protected:
+  using Map = std::multimap<T, ChunkOffset>;
+
+  static void _append_range(const typename Map::const_iterator begin, const typename Map::const_iterator end,
+                            std::vector<ChunkOffset>& chunk_offsets);
+
+  mutable std::shared_mutex _mutex;
+  Map _chunk_offsets;
+};
+
+}  // namespace opossum
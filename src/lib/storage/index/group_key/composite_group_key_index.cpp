@@ -126,27 +126,38 @@ BaseIndex::Iterator CompositeGroupKeyIndex::_upper_bound(const std::vector<AllTy
 VariableLengthKey CompositeGroupKeyIndex::_create_composite_key(const std::vector<AllTypeVariant>& values,
                                                                 bool is_upper_bound) const {
   auto result = VariableLengthKey(_keys.key_size());
+  auto used_segment_count = values.size();
 
   // retrieve the partial keys for every value except for the last one and append them into one partial-key
   for (auto column_id = ColumnID{0}; column_id < values.size() - 1; ++column_id) {
-    auto partial_key = _indexed_segments[column_id]->lower_bound(values[column_id]);
+    const auto& segment = _indexed_segments[column_id];
+    auto partial_key = segment->lower_bound(values[column_id]);
     auto bits_of_partial_key =
-        byte_width_for_fixed_size_byte_aligned_type(*_indexed_segments[column_id]->compressed_vector_type()) * CHAR_BIT;
+        byte_width_for_fixed_size_byte_aligned_type(*segment->compressed_vector_type()) * CHAR_BIT;
     result.shift_and_set(partial_key, static_cast<uint8_t>(bits_of_partial_key));
+
+    // if the value is not part of the dictionary, no key starts with the values so far and the remaining values do not
+    // matter: both bounds point to the first greater key, i.e., the remaining partial keys are zero
+    if (partial_key == segment->upper_bound(values[column_id])) {
+      used_segment_count = column_id + 1u;
+      break;
+    }
   }
 
   // retrieve the partial key for the last value (depending on whether we have a lower- or upper-bound-query)
   // and append it to the previously created partial key to obtain the key containing all provided values
-  const auto& segment_for_last_value = _indexed_segments[values.size() - 1];
-  auto&& partial_key = is_upper_bound ? segment_for_last_value->upper_bound(values.back())
-                                      : segment_for_last_value->lower_bound(values.back());
-  auto bits_of_partial_key =
-      byte_width_for_fixed_size_byte_aligned_type(*segment_for_last_value->compressed_vector_type()) * CHAR_BIT;
-  result.shift_and_set(partial_key, static_cast<uint8_t>(bits_of_partial_key));
+  if (used_segment_count == values.size()) {
+    const auto& segment_for_last_value = _indexed_segments[values.size() - 1];
+    auto&& partial_key = is_upper_bound ? segment_for_last_value->upper_bound(values.back())
+                                        : segment_for_last_value->lower_bound(values.back());
+    auto bits_of_partial_key =
+        byte_width_for_fixed_size_byte_aligned_type(*segment_for_last_value->compressed_vector_type()) * CHAR_BIT;
+    result.shift_and_set(partial_key, static_cast<uint8_t>(bits_of_partial_key));
+  }
 
   // fill empty space of key with zeros if less values than segments were provided
   auto empty_bits = std::accumulate(
-      _indexed_segments.cbegin() + values.size(), _indexed_segments.cend(), static_cast<uint8_t>(0u),
+      _indexed_segments.cbegin() + used_segment_count, _indexed_segments.cend(), static_cast<uint8_t>(0u),
       [](auto value, auto segment) {
         return value + byte_width_for_fixed_size_byte_aligned_type(*segment->compressed_vector_type()) * CHAR_BIT;
       });
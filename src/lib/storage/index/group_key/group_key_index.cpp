@@ -1,6 +1,7 @@
 #include "group_key_index.hpp"
 
 #include <memory>
+#include <utility>
 #include <vector>
 
 #include "storage/base_dictionary_segment.hpp"
@@ -57,6 +58,23 @@ GroupKeyIndex::GroupKeyIndex(const std::vector<std::shared_ptr<const BaseSegment
   });
 }
 
+GroupKeyIndex::GroupKeyIndex(const std::vector<std::shared_ptr<const BaseSegment>>& segments_to_index,
+                             std::vector<std::size_t>&& index_offsets, std::vector<ChunkOffset>&& index_postings)
+    : BaseIndex{get_index_type_of<GroupKeyIndex>()},
+      _indexed_segments(std::dynamic_pointer_cast<const BaseDictionarySegment>(segments_to_index[0])),
+      _index_offsets(std::move(index_offsets)),
+      _index_postings(std::move(index_postings)) {
+  Assert(static_cast<bool>(_indexed_segments), "GroupKeyIndex only works with dictionary segments_to_index.");
+  Assert((segments_to_index.size() == 1), "GroupKeyIndex only works with a single segment.");
+  Assert(_index_offsets.size() == _indexed_segments->unique_values_count() + 1u &&
+             _index_postings.size() == _indexed_segments->size(),
+         "Index structures do not match the segment");
+}
+
+const std::vector<std::size_t>& GroupKeyIndex::index_offsets() const { return _index_offsets; }
+
+const std::vector<ChunkOffset>& GroupKeyIndex::index_postings() const { return _index_postings; }
+
 GroupKeyIndex::Iterator GroupKeyIndex::_lower_bound(const std::vector<AllTypeVariant>& values) const {
   DebugAssert((values.size() == 1), "Group Key Index expects only one input value");
 
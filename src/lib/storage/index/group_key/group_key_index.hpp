@@ -59,6 +59,13 @@ class GroupKeyIndex : public BaseIndex {
 
   explicit GroupKeyIndex(const std::vector<std::shared_ptr<const BaseSegment>>& segments_to_index);
 
+  // Restores an index from its structures (e.g., read by ImportBinary) without scanning the segment again
+  GroupKeyIndex(const std::vector<std::shared_ptr<const BaseSegment>>& segments_to_index,
+                std::vector<std::size_t>&& index_offsets, std::vector<ChunkOffset>&& index_postings);
+
+  const std::vector<std::size_t>& index_offsets() const;
+  const std::vector<ChunkOffset>& index_postings() const;
+
  private:
   Iterator _lower_bound(const std::vector<AllTypeVariant>& values) const final;
 
@@ -10,12 +10,23 @@ namespace opossum {
 
 namespace hana = boost::hana;
 
-enum class SegmentIndexType : uint8_t { Invalid, GroupKey, CompositeGroupKey, AdaptiveRadixTree, BTree };
+// TableHash refers to the table-wide BaseTableHashIndex, all other types are chunk indexes (see BaseIndex).
+// New types are appended, as the values are persisted by ExportBinary.
+enum class SegmentIndexType : uint8_t {
+  Invalid,
+  GroupKey,
+  CompositeGroupKey,
+  AdaptiveRadixTree,
+  BTree,
+  TableHash,
+  StringAdaptiveRadixTree
+};
 
 class GroupKeyIndex;
 class CompositeGroupKeyIndex;
 class AdaptiveRadixTreeIndex;
 class BTreeIndex;
+class StringAdaptiveRadixTreeIndex;
 
 namespace detail {
 
@@ -23,7 +34,9 @@ constexpr auto segment_index_map =
     hana::make_map(hana::make_pair(hana::type_c<GroupKeyIndex>, SegmentIndexType::GroupKey),
                    hana::make_pair(hana::type_c<CompositeGroupKeyIndex>, SegmentIndexType::CompositeGroupKey),
                    hana::make_pair(hana::type_c<AdaptiveRadixTreeIndex>, SegmentIndexType::AdaptiveRadixTree),
-                   hana::make_pair(hana::type_c<BTreeIndex>, SegmentIndexType::BTree));
+                   hana::make_pair(hana::type_c<BTreeIndex>, SegmentIndexType::BTree),
+                   hana::make_pair(hana::type_c<StringAdaptiveRadixTreeIndex>,
+                                   SegmentIndexType::StringAdaptiveRadixTree));
 
 }  // namespace detail
 
@@ -0,0 +1,112 @@
+#include "table_hash_index.hpp"
+
+#include <functional>
+#include <memory>
+
+#include "lossless_cast.hpp"
+#include "resolve_type.hpp"
+#include "storage/segment_iterate.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+std::shared_ptr<BaseTableHashIndex> BaseTableHashIndex::create(const DataType data_type, const ColumnID column_id) {
+  return make_shared_by_data_type<BaseTableHashIndex, TableHashIndex>(data_type, column_id);
+}
+
+BaseTableHashIndex::BaseTableHashIndex(const ColumnID column_id) : _column_id(column_id) {}
+
+ColumnID BaseTableHashIndex::column_id() const { return _column_id; }
+
+template <typename T>
+TableHashIndex<T>::TableHashIndex(const ColumnID column_id) : BaseTableHashIndex(column_id) {}
+
+template <typename T>
+void TableHashIndex<T>::insert(const ChunkID chunk_id, const BaseSegment& segment,
+                               const ChunkOffset begin_chunk_offset, const ChunkOffset end_chunk_offset) {
+  DebugAssert(end_chunk_offset <= segment.size(), "Range exceeds the segment");
+
+  segment_with_iterators<T>(segment, [&](auto it, const auto end) {
+    it += begin_chunk_offset;
+    for (auto chunk_offset = begin_chunk_offset; chunk_offset < end_chunk_offset; ++chunk_offset, ++it) {
+      if (it->is_null()) continue;
+
+      auto& partition = _partition(it->value());
+      std::lock_guard<std::mutex> lock(partition.mutex);
+      partition.row_ids.emplace(it->value(), RowID{chunk_id, chunk_offset});
+    }
+  });
+}
+
+template <typename T>
+void TableHashIndex<T>::erase(const ChunkID chunk_id, const BaseSegment& segment, const ChunkOffset begin_chunk_offset,
+                              const ChunkOffset end_chunk_offset) {
+  DebugAssert(end_chunk_offset <= segment.size(), "Range exceeds the segment");
+
+  segment_with_iterators<T>(segment, [&](auto it, const auto end) {
+    it += begin_chunk_offset;
+    for (auto chunk_offset = begin_chunk_offset; chunk_offset < end_chunk_offset; ++chunk_offset, ++it) {
+      if (it->is_null()) continue;
+
+      const auto row_id = RowID{chunk_id, chunk_offset};
+      auto& partition = _partition(it->value());
+      std::lock_guard<std::mutex> lock(partition.mutex);
+      auto [range_begin, range_end] = partition.row_ids.equal_range(it->value());
+      for (auto entry_iter = range_begin; entry_iter != range_end; ++entry_iter) {
+        if (entry_iter->second == row_id) {
+          partition.row_ids.erase(entry_iter);
+          break;
+        }
+      }
+    }
+  });
+}
+
+template <typename T>
+PosList TableHashIndex<T>::lookup(const AllTypeVariant& value) const {
+  if (variant_is_null(value)) return PosList{};
+
+  // Values that cannot be represented as T (e.g., 3.5 for an int column) cannot be equal to any indexed value
+  const auto typed_value = lossless_variant_cast<T>(value);
+  if (!typed_value) return PosList{};
+
+  return lookup(*typed_value);
+}
+
+template <typename T>
+PosList TableHashIndex<T>::lookup(const T& value) const {
+  auto matches = PosList{};
+
+  const auto& partition = _partition(value);
+  std::lock_guard<std::mutex> lock(partition.mutex);
+  const auto [range_begin, range_end] = partition.row_ids.equal_range(value);
+  for (auto entry_iter = range_begin; entry_iter != range_end; ++entry_iter) {
+    matches.emplace_back(entry_iter->second);
+  }
+
+  return matches;
+}
+
+template <typename T>
+size_t TableHashIndex<T>::size() const {
+  auto size = size_t{0};
+  for (const auto& partition : _partitions) {
+    std::lock_guard<std::mutex> lock(partition.mutex);
+    size += partition.row_ids.size();
+  }
+  return size;
+}
+
+template <typename T>
+typename TableHashIndex<T>::Partition& TableHashIndex<T>::_partition(const T& value) {
+  return _partitions[std::hash<T>{}(value) % PARTITION_COUNT];
+}
+
+template <typename T>
+const typename TableHashIndex<T>::Partition& TableHashIndex<T>::_partition(const T& value) const {
+  return _partitions[std::hash<T>{}(value) % PARTITION_COUNT];
+}
+
+EXPLICITLY_INSTANTIATE_DATA_TYPES(TableHashIndex);
+
+}  // namespace opossum
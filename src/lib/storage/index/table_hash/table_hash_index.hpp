@@ -0,0 +1,83 @@
+#pragma once
+
+#include <array>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+#include "all_type_variant.hpp"
+#include "storage/pos_list.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseSegment;
+
+/**
+ * A hash index over a single column of a whole Table, mapping values to the RowIDs of all rows holding that value.
+ * In contrast to the chunk indexes (see BaseIndex), it spans all Chunks including the mutable one, so that point
+ * lookups (e.g., `WHERE pk = ?`) do not need to touch every Chunk.
+ *
+ * The index is maintained by the Insert operator and by Table::remove_chunk. It contains every physical row with a
+ * non-NULL value, no matter whether that row is visible to a given transaction. Deleting a row only sets its end_cid,
+ * older transactions can still see it - resolving visibility is left to the Validate operator.
+ *
+ * Entries are spread over PARTITION_COUNT partitions by the hash of their value. Each partition is guarded by its own
+ * mutex so that concurrent inserts and lookups rarely contend.
+ */
+class BaseTableHashIndex : private Noncopyable {
+ public:
+  static constexpr auto PARTITION_COUNT = size_t{64};
+
+  static std::shared_ptr<BaseTableHashIndex> create(const DataType data_type, const ColumnID column_id);
+
+  explicit BaseTableHashIndex(const ColumnID column_id);
+  virtual ~BaseTableHashIndex() = default;
+
+  ColumnID column_id() const;
+
+  // Adds (or removes) the rows [begin_chunk_offset, end_chunk_offset) of the given segment of Chunk chunk_id.
+  // NULL values are not indexed.
+  virtual void insert(const ChunkID chunk_id, const BaseSegment& segment, const ChunkOffset begin_chunk_offset,
+                      const ChunkOffset end_chunk_offset) = 0;
+  virtual void erase(const ChunkID chunk_id, const BaseSegment& segment, const ChunkOffset begin_chunk_offset,
+                     const ChunkOffset end_chunk_offset) = 0;
+
+  // Returns the unsorted RowIDs of all rows with the given value. NULL never matches.
+  virtual PosList lookup(const AllTypeVariant& value) const = 0;
+
+  // Number of indexed RowIDs
+  virtual size_t size() const = 0;
+
+ protected:
+  const ColumnID _column_id;
+};
+
+template <typename T>
+class TableHashIndex : public BaseTableHashIndex {
+ public:
+  explicit TableHashIndex(const ColumnID column_id);
+
+  void insert(const ChunkID chunk_id, const BaseSegment& segment, const ChunkOffset begin_chunk_offset,
+              const ChunkOffset end_chunk_offset) final;
+  void erase(const ChunkID chunk_id, const BaseSegment& segment, const ChunkOffset begin_chunk_offset,
+             const ChunkOffset end_chunk_offset) final;
+
+  PosList lookup(const AllTypeVariant& value) const final;
+  PosList lookup(const T& value) const;
+
+  size_t size() const final;
+
+ protected:
+  struct Partition {
+    mutable std::mutex mutex;
+    std::unordered_multimap<T, RowID> row_ids;
+  };
+
+  Partition& _partition(const T& value);
+  const Partition& _partition(const T& value) const;
+
+  std::array<Partition, PARTITION_COUNT> _partitions;
+};
+
+}  // namespace opossum
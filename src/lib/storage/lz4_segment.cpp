@@ -3,10 +3,12 @@
 #include <lz4.h>
 
 #include <climits>
+#include <cstring>
 #include <sstream>
 #include <string>
 
 #include "resolve_type.hpp"
+#include "storage/lz4_segment/lz4_block_cache.hpp"
 #include "storage/vector_compression/base_compressed_vector.hpp"
 #include "storage/vector_compression/base_vector_decompressor.hpp"
 #include "utils/assert.hpp"
@@ -19,6 +21,7 @@ LZ4Segment<T>::LZ4Segment(pmr_vector<pmr_vector<char>>&& lz4_blocks, std::option
                           pmr_vector<char>&& dictionary, const size_t block_size, const size_t last_block_size,
                           const size_t compressed_size, const size_t num_elements)
     : BaseEncodedSegment{data_type_from_type<T>()},
+      _cache_segment_id{LZ4BlockCache::allocate_segment_id()},
       _lz4_blocks{std::move(lz4_blocks)},
       _null_values{std::move(null_values)},
       _dictionary{std::move(dictionary)},
@@ -34,6 +37,7 @@ LZ4Segment<T>::LZ4Segment(pmr_vector<pmr_vector<char>>&& lz4_blocks, std::option
                           const size_t block_size, const size_t last_block_size, const size_t compressed_size,
                           const size_t num_elements)
     : BaseEncodedSegment{data_type_from_type<T>()},
+      _cache_segment_id{LZ4BlockCache::allocate_segment_id()},
       _lz4_blocks{std::move(lz4_blocks)},
       _null_values{std::move(null_values)},
       _dictionary{std::move(dictionary)},
@@ -97,7 +101,11 @@ std::vector<T> LZ4Segment<T>::decompress() const {
   // This offset is needed to write directly into the decompressed data vector.
   auto decompression_offset = size_t{0u};
   for (auto block_index = size_t{0u}; block_index < num_blocks; ++block_index) {
-    _decompress_block(block_index, decompressed_data, decompression_offset);
+    auto* const block_begin = reinterpret_cast<char*>(decompressed_data.data()) + decompression_offset;
+    if (!_copy_block_from_cache(block_index, block_begin)) {
+      _decompress_block(block_index, decompressed_data, decompression_offset);
+      _add_block_to_cache(block_index, block_begin);
+    }
     decompression_offset += _block_size;
   }
   return decompressed_data;
@@ -121,7 +129,11 @@ std::vector<pmr_string> LZ4Segment<pmr_string>::decompress() const {
   for (auto block_index = size_t{0u}; block_index < num_blocks; ++block_index) {
     // This offset is needed to write directly into the decompressed data vector.
     const auto decompression_offset = block_index * _block_size;
-    _decompress_block_to_bytes(block_index, decompressed_data, decompression_offset);
+    auto* const block_begin = decompressed_data.data() + decompression_offset;
+    if (!_copy_block_from_cache(block_index, block_begin)) {
+      _decompress_block_to_bytes(block_index, decompressed_data, decompression_offset);
+      _add_block_to_cache(block_index, block_begin);
+    }
   }
 
   /**
@@ -154,7 +166,7 @@ std::vector<pmr_string> LZ4Segment<pmr_string>::decompress() const {
 template <typename T>
 void LZ4Segment<T>::_decompress_block(const size_t block_index, std::vector<T>& decompressed_data,
                                       const size_t write_offset) const {
-  const auto decompressed_block_size = block_index + 1 != _lz4_blocks.size() ? _block_size : _last_block_size;
+  const auto decompressed_block_size = _decompressed_block_size(block_index);
   auto& compressed_block = _lz4_blocks[block_index];
   const auto compressed_block_size = compressed_block.size();
 
@@ -189,8 +201,34 @@ void LZ4Segment<T>::_decompress_block(const size_t block_index, std::vector<T>&
               "Decompressed LZ4 block has different size than the initial source data.");
 }
 
+template <typename T>
+bool LZ4Segment<T>::_copy_block_from_cache(const size_t block_index, char* destination) const {
+  const auto cached_block = LZ4BlockCache::get().try_get(_cache_segment_id, block_index);
+  if (!cached_block) return false;
+
+  std::memcpy(destination, cached_block->data(), cached_block->size());
+  return true;
+}
+
+template <typename T>
+void LZ4Segment<T>::_add_block_to_cache(const size_t block_index, const char* decompressed_block) const {
+  const auto block_size = _decompressed_block_size(block_index);
+  LZ4BlockCache::get().set(_cache_segment_id, block_index,
+                           std::make_shared<const std::vector<char>>(decompressed_block, decompressed_block + block_size));
+}
+
+template <typename T>
+size_t LZ4Segment<T>::_decompressed_block_size(const size_t block_index) const {
+  return block_index + 1 != _lz4_blocks.size() ? _block_size : _last_block_size;
+}
+
 template <typename T>
 void LZ4Segment<T>::_decompress_block_to_bytes(const size_t block_index, std::vector<char>& decompressed_data) const {
+  if (const auto cached_block = LZ4BlockCache::get().try_get(_cache_segment_id, block_index)) {
+    decompressed_data.assign(cached_block->cbegin(), cached_block->cend());
+    return;
+  }
+
   // Assure that the decompressed data fits into the vector.
   if (decompressed_data.size() != _block_size) {
     decompressed_data.resize(_block_size);
@@ -208,12 +246,14 @@ void LZ4Segment<T>::_decompress_block_to_bytes(const size_t block_index, std::ve
   if (block_index + 1 == _lz4_blocks.size()) {
     decompressed_data.resize(_last_block_size);
   }
+
+  _add_block_to_cache(block_index, decompressed_data.data());
 }
 
 template <typename T>
 void LZ4Segment<T>::_decompress_block_to_bytes(const size_t block_index, std::vector<char>& decompressed_data,
                                                const size_t write_offset) const {
-  const auto decompressed_block_size = block_index + 1 != _lz4_blocks.size() ? _block_size : _last_block_size;
+  const auto decompressed_block_size = _decompressed_block_size(block_index);
   auto& compressed_block = _lz4_blocks[block_index];
   const auto compressed_block_size = compressed_block.size();
 
@@ -112,7 +112,8 @@ class LZ4Segment : public BaseEncodedSegment {
   size_t size() const final;
 
   /**
-   * Decompresses the whole segment at once into a single vector.
+   * Decompresses the whole segment at once into a single vector. Blocks that are found in the LZ4BlockCache are copied
+   * from there, all other blocks are decompressed and added to the cache.
    *
    * @return A vector containing all the decompressed values in order.
    */
@@ -120,7 +121,7 @@ class LZ4Segment : public BaseEncodedSegment {
 
   /**
    * Retrieves a single value by only decompressing the block in resides in. Each call of this method causes the
-   * decompression of a block.
+   * decompression of a block, unless it is found in the LZ4BlockCache.
    *
    * @param chunk_offset The chunk offset identifies a single value in the segment.
    * @return The decompressed value.
@@ -167,6 +168,8 @@ class LZ4Segment : public BaseEncodedSegment {
   /**@}*/
 
  private:
+  // Identifies this segment's blocks in the LZ4BlockCache
+  const uint64_t _cache_segment_id;
   const pmr_vector<pmr_vector<char>> _lz4_blocks;
   const std::optional<pmr_vector<bool>> _null_values;
   const pmr_vector<char> _dictionary;
@@ -187,9 +190,20 @@ class LZ4Segment : public BaseEncodedSegment {
    */
   void _decompress_block(const size_t block_index, std::vector<T>& decompressed_data, const size_t write_offset) const;
 
+  /**
+   * If the block is cached in the LZ4BlockCache, copies it to `destination` and returns true. Otherwise returns false.
+   */
+  bool _copy_block_from_cache(const size_t block_index, char* destination) const;
+
+  // Adds a copy of the decompressed block, which starts at `decompressed_block`, to the LZ4BlockCache
+  void _add_block_to_cache(const size_t block_index, const char* decompressed_block) const;
+
+  size_t _decompressed_block_size(const size_t block_index) const;
+
   /**
    * Decompresses a single block into a char vector. This method resizes the input vector if the decompressed data
-   * would not fit into it. It is used for string-segments as well as non-string-segments.
+   * would not fit into it. It is used for string-segments as well as non-string-segments. The LZ4BlockCache is used
+   * (and populated) by this method.
    * This allows a uniform interface in the decompress method for caching. For non-string-segments the decompressed
    * values have to be further cast to type T, while string-segments can use the char-vector directly.
    *
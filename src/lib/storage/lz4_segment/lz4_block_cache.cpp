@@ -0,0 +1,74 @@
+#include "lz4_block_cache.hpp"
+
+#include <boost/functional/hash.hpp>
+
+#include "storage/lz4_segment/lz4_encoder.hpp"
+
+namespace opossum {
+
+namespace {
+
+size_t block_count_for_capacity(const size_t capacity_in_bytes) {
+  return capacity_in_bytes / LZ4Encoder::_block_size;
+}
+
+}  // namespace
+
+bool LZ4BlockCacheKey::operator==(const LZ4BlockCacheKey& other) const {
+  return segment_id == other.segment_id && block_index == other.block_index;
+}
+
+LZ4BlockCache::LZ4BlockCache()
+    : _capacity_in_bytes{DEFAULT_CAPACITY_IN_BYTES}, _cache{block_count_for_capacity(DEFAULT_CAPACITY_IN_BYTES)} {}
+
+uint64_t LZ4BlockCache::allocate_segment_id() {
+  static auto next_segment_id = std::atomic<uint64_t>{0};
+  return next_segment_id++;
+}
+
+LZ4BlockCache::Block LZ4BlockCache::try_get(const uint64_t segment_id, const size_t block_index) {
+  const auto key = LZ4BlockCacheKey{segment_id, block_index};
+
+  std::lock_guard<std::mutex> lock(_mutex);
+  if (_cache.capacity() == 0 || !_cache.has(key)) return nullptr;
+  return _cache.get(key);
+}
+
+void LZ4BlockCache::set(const uint64_t segment_id, const size_t block_index, const Block& block) {
+  std::lock_guard<std::mutex> lock(_mutex);
+  if (_cache.capacity() == 0) return;
+  _cache.set(LZ4BlockCacheKey{segment_id, block_index}, block);
+}
+
+void LZ4BlockCache::resize(const size_t capacity_in_bytes) {
+  std::lock_guard<std::mutex> lock(_mutex);
+  _capacity_in_bytes = capacity_in_bytes;
+  _cache.resize(block_count_for_capacity(capacity_in_bytes));
+}
+
+size_t LZ4BlockCache::capacity_in_bytes() const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _capacity_in_bytes;
+}
+
+size_t LZ4BlockCache::size() const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _cache.size();
+}
+
+void LZ4BlockCache::clear() {
+  std::lock_guard<std::mutex> lock(_mutex);
+  _cache.clear();
+}
+
+}  // namespace opossum
+
+namespace std {
+
+size_t hash<opossum::LZ4BlockCacheKey>::operator()(const opossum::LZ4BlockCacheKey& key) const {
+  auto hash = boost::hash_value(key.segment_id);
+  boost::hash_combine(hash, key.block_index);
+  return hash;
+}
+
+}  // namespace std
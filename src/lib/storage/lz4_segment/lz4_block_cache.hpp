@@ -0,0 +1,81 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "cache/gdfs_cache.hpp"
+#include "types.hpp"
+#include "utils/singleton.hpp"
+
+namespace opossum {
+
+// Identifies a block within an LZ4Segment. See LZ4BlockCache.
+struct LZ4BlockCacheKey {
+  uint64_t segment_id;
+  size_t block_index;
+
+  bool operator==(const LZ4BlockCacheKey& other) const;
+};
+
+}  // namespace opossum
+
+namespace std {
+
+template <>
+struct hash<opossum::LZ4BlockCacheKey> {
+  size_t operator()(const opossum::LZ4BlockCacheKey& key) const;
+};
+
+}  // namespace std
+
+namespace opossum {
+
+/**
+ * Process-wide cache of decompressed LZ4 blocks. Without it, every access to an LZ4Segment (be it a sequential scan
+ * or a point access) has to decompress the accessed blocks again, which makes LZ4 unsuitable for data that is queried
+ * repeatedly.
+ *
+ * Blocks are identified by a segment id (handed out by allocate_segment_id(), so that the memory address of a
+ * destroyed segment cannot lead to stale entries) and the index of the block within the segment. The cache uses the
+ * GDFS policy, which considers how often a block is accessed, so that a single large scan does not evict all
+ * frequently accessed blocks.
+ *
+ * The memory consumption is bounded by the capacity, given in bytes. As the size of decompressed blocks is limited by
+ * the LZ4Encoder's block size, the capacity is translated into a maximum number of cached blocks.
+ */
+class LZ4BlockCache : public Singleton<LZ4BlockCache> {
+ public:
+  using Block = std::shared_ptr<const std::vector<char>>;
+
+  static constexpr auto DEFAULT_CAPACITY_IN_BYTES = size_t{256} * 1024 * 1024;
+
+  // Returns a new id for each call, used by LZ4Segments to identify their blocks
+  static uint64_t allocate_segment_id();
+
+  // Returns the cached block or nullptr if the block is not cached
+  Block try_get(const uint64_t segment_id, const size_t block_index);
+
+  void set(const uint64_t segment_id, const size_t block_index, const Block& block);
+
+  // Setting the capacity to 0 disables the cache
+  void resize(const size_t capacity_in_bytes);
+  size_t capacity_in_bytes() const;
+
+  // Number of cached blocks
+  size_t size() const;
+
+  void clear();
+
+ protected:
+  LZ4BlockCache();
+
+  friend class Singleton;
+
+  size_t _capacity_in_bytes;
+  GDFSCache<LZ4BlockCacheKey, Block> _cache;
+  mutable std::mutex _mutex;
+};
+
+}  // namespace opossum
@@ -0,0 +1,256 @@
+#include "meta_table_manager.hpp"
+
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "scheduler/abstract_scheduler.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/operator_task.hpp"
+#include "scheduler/task_queue.hpp"
+#include "scheduler/worker.hpp"
+#include "storage/index/base_index.hpp"
+#include "storage/index/index_info.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+std::string index_type_name(const SegmentIndexType index_type) {
+  switch (index_type) {
+    case SegmentIndexType::GroupKey:
+      return "GroupKey";
+    case SegmentIndexType::CompositeGroupKey:
+      return "CompositeGroupKey";
+    case SegmentIndexType::AdaptiveRadixTree:
+      return "AdaptiveRadixTree";
+    case SegmentIndexType::BTree:
+      return "BTree";
+    case SegmentIndexType::TableHash:
+      return "TableHash";
+    case SegmentIndexType::StringAdaptiveRadixTree:
+      return "StringAdaptiveRadixTree";
+    case SegmentIndexType::Invalid:
+      break;
+  }
+  Fail("Invalid index type");
+}
+
+int64_t percentile_ns(const DurationHistogram& histogram, const double percentile) {
+  return histogram.percentile(percentile).count();
+}
+
+}  // namespace
+
+namespace opossum {
+
+MetaTableManager::MetaTableManager() {
+  _generators.emplace("indexes", &MetaTableManager::generate_indexes_table);
+  _generators.emplace("workers", &MetaTableManager::generate_workers_table);
+  _generators.emplace("task_queues", &MetaTableManager::generate_task_queues_table);
+  _generators.emplace("operator_tasks", &MetaTableManager::generate_operator_tasks_table);
+}
+
+bool MetaTableManager::is_meta_table_name(const std::string& name) {
+  return name.size() > META_PREFIX.size() && name.compare(0, META_PREFIX.size(), META_PREFIX) == 0;
+}
+
+std::vector<std::string> MetaTableManager::table_names() const {
+  auto table_names = std::vector<std::string>{};
+  table_names.reserve(_generators.size());
+
+  for (const auto& [name, generator] : _generators) {
+    table_names.emplace_back(META_PREFIX + name);
+  }
+
+  return table_names;
+}
+
+bool MetaTableManager::has_table(const std::string& name) const {
+  return is_meta_table_name(name) && _generators.count(name.substr(META_PREFIX.size()));
+}
+
+std::shared_ptr<Table> MetaTableManager::generate_table(const std::string& name) const {
+  Assert(has_table(name), "No such meta table named '" + name + "'");
+
+  return _generators.at(name.substr(META_PREFIX.size()))();
+}
+
+std::shared_ptr<Table> MetaTableManager::generate_indexes_table() {
+  TableColumnDefinitions column_definitions;
+  column_definitions.emplace_back("table_name", DataType::String, false);
+  column_definitions.emplace_back("index_name", DataType::String, false);
+  column_definitions.emplace_back("column_names", DataType::String, false);
+  column_definitions.emplace_back("index_type", DataType::String, false);
+  column_definitions.emplace_back("chunk_count", DataType::Int, false);
+  column_definitions.emplace_back("memory_bytes", DataType::Long, false);
+  column_definitions.emplace_back("build_time_ns", DataType::Long, false);
+  column_definitions.emplace_back("lookup_count", DataType::Long, false);
+  column_definitions.emplace_back("skipped_row_count", DataType::Long, false);
+
+  auto output_table = std::make_shared<Table>(column_definitions, TableType::Data, std::nullopt, UseMvcc::Yes);
+
+  struct IndexStatistics {
+    int32_t chunk_count{0};
+    int64_t memory_bytes{0};
+    int64_t build_time_ns{0};
+    int64_t lookup_count{0};
+    int64_t skipped_row_count{0};
+  };
+
+  for (const auto& [table_name, table] : StorageManager::get().tables()) {
+    // Indexes created by Table::create_index() have a chunk index of the same type on each immutable chunk. Indexes
+    // created on individual chunks are listed as well, without a name.
+    auto statistics_by_index = std::map<std::pair<SegmentIndexType, std::vector<ColumnID>>, IndexStatistics>{};
+
+    const auto chunk_count = table->chunk_count();
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      const auto chunk = table->get_chunk(chunk_id);
+      if (!chunk) continue;
+
+      for (const auto& index : chunk->indices()) {
+        auto column_ids = std::vector<ColumnID>{};
+        for (const auto& indexed_segment : index->get_indexed_segments()) {
+          for (auto column_id = ColumnID{0}; column_id < chunk->column_count(); ++column_id) {
+            if (chunk->get_segment(column_id) == indexed_segment) {
+              column_ids.emplace_back(column_id);
+              break;
+            }
+          }
+        }
+
+        auto& statistics = statistics_by_index[{index->type(), column_ids}];
+        ++statistics.chunk_count;
+        statistics.memory_bytes += index->memory_consumption();
+        statistics.build_time_ns += index->build_duration().count();
+        statistics.lookup_count += index->lookup_count();
+        statistics.skipped_row_count += index->skipped_row_count();
+      }
+    }
+
+    const auto index_infos = table->get_indexes();
+    for (const auto& [index_key, statistics] : statistics_by_index) {
+      const auto& [index_type, column_ids] = index_key;
+
+      auto index_name = std::string{};
+      for (const auto& index_info : index_infos) {
+        if (index_info.type == index_type && index_info.column_ids == column_ids) index_name = index_info.name;
+      }
+
+      auto column_names = std::string{};
+      for (const auto column_id : column_ids) {
+        if (!column_names.empty()) column_names += ",";
+        column_names += table->column_name(column_id);
+      }
+
+      output_table->append({pmr_string{table_name}, pmr_string{index_name}, pmr_string{column_names},
+                            pmr_string{index_type_name(index_type)}, statistics.chunk_count, statistics.memory_bytes,
+                            statistics.build_time_ns, statistics.lookup_count, statistics.skipped_row_count});
+    }
+  }
+
+  return output_table;
+}
+
+std::shared_ptr<Table> MetaTableManager::generate_workers_table() {
+  TableColumnDefinitions column_definitions;
+  column_definitions.emplace_back("worker_id", DataType::Int, false);
+  column_definitions.emplace_back("node_id", DataType::Int, false);
+  column_definitions.emplace_back("cpu_id", DataType::Int, false);
+  column_definitions.emplace_back("cache_domain_id", DataType::Int, false);
+  column_definitions.emplace_back("executed_task_count", DataType::Long, false);
+  column_definitions.emplace_back("busy_ns", DataType::Long, false);
+  column_definitions.emplace_back("idle_ns", DataType::Long, false);
+  column_definitions.emplace_back("steal_ns", DataType::Long, false);
+  column_definitions.emplace_back("successful_steal_count", DataType::Long, false);
+  column_definitions.emplace_back("failed_steal_count", DataType::Long, false);
+  column_definitions.emplace_back("deque_size", DataType::Long, false);
+  column_definitions.emplace_back("task_wait_p50_ns", DataType::Long, false);
+  column_definitions.emplace_back("task_wait_p99_ns", DataType::Long, false);
+  column_definitions.emplace_back("task_execution_p50_ns", DataType::Long, false);
+  column_definitions.emplace_back("task_execution_p99_ns", DataType::Long, false);
+
+  auto output_table = std::make_shared<Table>(column_definitions, TableType::Data, std::nullopt, UseMvcc::Yes);
+
+  const auto& scheduler = CurrentScheduler::get();
+  if (!scheduler) return output_table;
+
+  for (const auto& worker : scheduler->workers()) {
+    const auto& statistics = worker->statistics();
+    output_table->append({static_cast<int32_t>(worker->id()), static_cast<int32_t>(worker->queue()->node_id()),
+                          static_cast<int32_t>(worker->cpu_id()), static_cast<int32_t>(worker->cache_domain_id()),
+                          static_cast<int64_t>(worker->num_finished_tasks()),
+                          static_cast<int64_t>(statistics.busy_nanoseconds.load()),
+                          static_cast<int64_t>(statistics.idle_nanoseconds.load()),
+                          static_cast<int64_t>(statistics.steal_nanoseconds.load()),
+                          static_cast<int64_t>(statistics.successful_steal_count.load()),
+                          static_cast<int64_t>(statistics.failed_steal_count.load()),
+                          static_cast<int64_t>(worker->deque_size()),
+                          percentile_ns(statistics.task_wait_durations, 50.0),
+                          percentile_ns(statistics.task_wait_durations, 99.0),
+                          percentile_ns(statistics.task_execution_durations, 50.0),
+                          percentile_ns(statistics.task_execution_durations, 99.0)});
+  }
+
+  return output_table;
+}
+
+std::shared_ptr<Table> MetaTableManager::generate_task_queues_table() {
+  TableColumnDefinitions column_definitions;
+  column_definitions.emplace_back("node_id", DataType::Int, false);
+  column_definitions.emplace_back("worker_count", DataType::Int, false);
+  column_definitions.emplace_back("parked_worker_count", DataType::Int, false);
+  column_definitions.emplace_back("size", DataType::Long, false);
+  column_definitions.emplace_back("pushed_task_count", DataType::Long, false);
+  column_definitions.emplace_back("task_wait_p50_ns", DataType::Long, false);
+  column_definitions.emplace_back("task_wait_p95_ns", DataType::Long, false);
+  column_definitions.emplace_back("task_wait_p99_ns", DataType::Long, false);
+  column_definitions.emplace_back("task_wait_p999_ns", DataType::Long, false);
+
+  auto output_table = std::make_shared<Table>(column_definitions, TableType::Data, std::nullopt, UseMvcc::Yes);
+
+  const auto& scheduler = CurrentScheduler::get();
+  if (!scheduler) return output_table;
+
+  for (const auto& queue : scheduler->queues()) {
+    auto worker_count = int32_t{0};
+    auto task_wait_durations = DurationHistogram{};
+    for (const auto& worker : scheduler->workers()) {
+      if (worker->queue() != queue) continue;
+
+      ++worker_count;
+      task_wait_durations.merge(worker->statistics().task_wait_durations);
+    }
+
+    output_table->append({static_cast<int32_t>(queue->node_id()), worker_count,
+                          static_cast<int32_t>(queue->parked_worker_count()), static_cast<int64_t>(queue->size()),
+                          static_cast<int64_t>(queue->pushed_task_count()), percentile_ns(task_wait_durations, 50.0),
+                          percentile_ns(task_wait_durations, 95.0), percentile_ns(task_wait_durations, 99.0),
+                          percentile_ns(task_wait_durations, 99.9)});
+  }
+
+  return output_table;
+}
+
+std::shared_ptr<Table> MetaTableManager::generate_operator_tasks_table() {
+  TableColumnDefinitions column_definitions;
+  column_definitions.emplace_back("operator_name", DataType::String, false);
+  column_definitions.emplace_back("executed_task_count", DataType::Long, false);
+  column_definitions.emplace_back("execution_ns", DataType::Long, false);
+
+  auto output_table = std::make_shared<Table>(column_definitions, TableType::Data, std::nullopt, UseMvcc::Yes);
+
+  for (const auto& [operator_name, statistics] : OperatorTask::execution_statistics()) {
+    output_table->append({pmr_string{operator_name}, static_cast<int64_t>(statistics.executed_task_count),
+                          static_cast<int64_t>(statistics.execution_duration.count())});
+  }
+
+  return output_table;
+}
+
+}  // namespace opossum
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "utils/singleton.hpp"
+
+namespace opossum {
+
+class Table;
+
+/**
+ * Meta tables are read-only tables that describe the state of the database (e.g., "meta_indexes") and can be queried
+ * via SQL like any other table. They are not stored: the StorageManager generates a new snapshot whenever one of them
+ * is requested via get_table(). Within a statement, the translator and the optimizer share one snapshot held by the
+ * StoredTableNode, while GetTable generates the snapshot that is returned. All meta table names start with META_PREFIX.
+ */
+class MetaTableManager : public Singleton<MetaTableManager> {
+ public:
+  static inline const auto META_PREFIX = std::string{"meta_"};
+
+  static bool is_meta_table_name(const std::string& name);
+
+  // Names of all meta tables, including the prefix
+  std::vector<std::string> table_names() const;
+
+  bool has_table(const std::string& name) const;
+
+  // Generates the current contents of the meta table
+  std::shared_ptr<Table> generate_table(const std::string& name) const;
+
+  /**
+   * Lists each chunk index (see BaseIndex) of every stored table with one row per index type and indexed columns:
+   * the number of indexed chunks, their memory consumption and build time, and how often operators (IndexScan,
+   * JoinIndex) looked them up and how many rows that saved them from reading.
+   */
+  static std::shared_ptr<Table> generate_indexes_table();
+
+  /**
+   * Lists each Worker of the current scheduler (none without a scheduler) with the counters it keeps while it runs
+   * (see Worker::Statistics): how long it executed tasks, was parked, or looked for tasks to steal, how often stealing
+   * succeeded, the size of its deque, and percentiles of the time tasks waited to be executed and were executed.
+   */
+  static std::shared_ptr<Table> generate_workers_table();
+
+  /**
+   * Lists each TaskQueue of the current scheduler, i.e., one per node, with the number of queued, pushed, and parked
+   * workers, as well as percentiles of the time the tasks executed by the node's workers waited to be executed.
+   */
+  static std::shared_ptr<Table> generate_task_queues_table();
+
+  /**
+   * Lists how many OperatorTasks were executed per operator name and how long they took, see
+   * OperatorTask::execution_statistics().
+   */
+  static std::shared_ptr<Table> generate_operator_tasks_table();
+
+ protected:
+  friend class Singleton<MetaTableManager>;
+
+  MetaTableManager();
+
+  // Names without the prefix
+  std::map<std::string, std::function<std::shared_ptr<Table>()>> _generators;
+};
+
+}  // namespace opossum
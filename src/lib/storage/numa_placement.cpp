@@ -0,0 +1,43 @@
+#include "numa_placement.hpp"
+
+#include <atomic>
+#include <memory>
+
+#include "scheduler/topology.hpp"
+#include "storage/chunk.hpp"
+#include "storage/table.hpp"
+
+namespace {
+
+// Shared by all tables, see NUMAPlacement::place_chunks()
+std::atomic<size_t> next_node_id{0};
+
+}  // namespace
+
+namespace opossum {
+
+void NUMAPlacement::place_chunks(Table& table) {
+  if (table.type() != TableType::Data) return;
+
+  auto& topology = Topology::get();
+  const auto node_count = topology.nodes().size();
+  if (node_count <= 1) return;
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+    const auto chunk = table.get_chunk(chunk_id);
+    if (chunk->node_id() != INVALID_NODE_ID) continue;
+
+    const auto node_id = NodeID{static_cast<NodeID::base_type>(next_node_id++ % node_count)};
+
+#if HYRISE_NUMA_SUPPORT
+    if (!chunk->indices().empty() || !chunk->delta_indexes().empty()) continue;
+    chunk->migrate(topology.get_memory_resource(static_cast<int>(node_id)));
+#endif
+
+    chunk->set_node_id(node_id);
+  }
+}
+
+void NUMAPlacement::reset_next_node_id(const NodeID node_id) { next_node_id = static_cast<size_t>(node_id); }
+
+}  // namespace opossum
@@ -0,0 +1,34 @@
+#pragma once
+
+#include "types.hpp"
+
+namespace opossum {
+
+class Table;
+
+/**
+ * Interleaves the chunks of data tables across the nodes of the Topology, so that scans use the memory bandwidth of
+ * all nodes instead of saturating the one the table happened to be loaded on. The home node of each chunk is stored
+ * in Chunk::node_id(). Operators schedule the tasks that process a chunk on its home node (see process_morsels()).
+ *
+ * NOT thread-safe. Chunks must not be accessed by other operations while they are placed.
+ */
+class NUMAPlacement final {
+ public:
+  /**
+   * Assigns the chunks of @param table to the nodes in a round-robin fashion. The round-robin continues across calls,
+   * so that the chunks of many small tables do not all end up on the first node. Chunks that already have a home node
+   * keep it.
+   *
+   * With NUMA support, the segments of each chunk are migrated to the memory of its node. Chunks with indexes cannot be
+   * migrated and are left without a home node.
+   */
+  static void place_chunks(Table& table);
+
+  /**
+   * Sets the node that the next placed chunk is assigned to. Used by tests to get a deterministic placement.
+   */
+  static void reset_next_node_id(const NodeID node_id = NodeID{0});
+};
+
+}  // namespace opossum
@@ -11,6 +11,8 @@
 #include "scheduler/current_scheduler.hpp"
 #include "scheduler/job_task.hpp"
 #include "statistics/generate_table_statistics.hpp"
+#include "storage/meta_table_manager.hpp"
+#include "storage/numa_placement.hpp"
 #include "statistics/table_statistics.hpp"
 #include "utils/assert.hpp"
 
@@ -19,11 +21,15 @@ namespace opossum {
 void StorageManager::add_table(const std::string& name, std::shared_ptr<Table> table) {
   Assert(_tables.find(name) == _tables.end(), "A table with the name " + name + " already exists");
   Assert(_views.find(name) == _views.end(), "Cannot add table " + name + " - a view with the same name already exists");
+  Assert(!MetaTableManager::is_meta_table_name(name), "Cannot add table " + name + " - the prefix is reserved");
 
   for (ChunkID chunk_id{0}; chunk_id < table->chunk_count(); chunk_id++) {
     Assert(table->get_chunk(chunk_id)->has_mvcc_data(), "Table must have MVCC data.");
   }
 
+  // Interleave the chunks across the NUMA nodes before the table becomes visible to other operations
+  NUMAPlacement::place_chunks(*table);
+
   table->set_table_statistics(std::make_shared<TableStatistics>(generate_table_statistics(*table)));
   _tables.emplace(name, std::move(table));
 }
@@ -34,13 +40,19 @@ void StorageManager::drop_table(const std::string& name) {
 }
 
 std::shared_ptr<Table> StorageManager::get_table(const std::string& name) const {
+  // Meta tables are generated on each access, so that they show the current state. Their statistics are only needed by
+  // the optimizer, which generates them once per statement (see StoredTableNode::table()).
+  if (MetaTableManager::is_meta_table_name(name)) return MetaTableManager::get().generate_table(name);
+
   const auto iter = _tables.find(name);
   Assert(iter != _tables.end(), "No such table named '" + name + "'");
 
   return iter->second;
 }
 
-bool StorageManager::has_table(const std::string& name) const { return _tables.count(name); }
+bool StorageManager::has_table(const std::string& name) const {
+  return _tables.count(name) || MetaTableManager::get().has_table(name);
+}
 
 std::vector<std::string> StorageManager::table_names() const {
   std::vector<std::string> table_names;
@@ -18,6 +18,8 @@ class AbstractLQPNode;
 
 // The StorageManager is a singleton that maintains all tables
 // by mapping table names to table instances.
+// Tables whose names start with MetaTableManager::META_PREFIX are not stored but generated by get_table() (see
+// MetaTableManager). They are not part of table_names() and tables().
 class StorageManager : public Singleton<StorageManager> {
  public:
   /**
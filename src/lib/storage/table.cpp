@@ -10,6 +10,9 @@
 
 #include "resolve_type.hpp"
 #include "statistics/table_statistics.hpp"
+#include "storage/index/base_index.hpp"
+#include "storage/index/delta/delta_index.hpp"
+#include "storage/index/table_hash/table_hash_index.hpp"
 #include "storage/segment_iterate.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
@@ -27,7 +30,9 @@ Table::Table(const TableColumnDefinitions& column_definitions, const TableType t
       _type(type),
       _use_mvcc(use_mvcc),
       _max_chunk_size(type == TableType::Data ? max_chunk_size.value_or(Chunk::DEFAULT_SIZE) : Chunk::MAX_SIZE),
-      _append_mutex(std::make_unique<std::mutex>()) {
+      _append_mutex(std::make_unique<std::mutex>()),
+      _index_creation_mutex(std::make_unique<std::shared_mutex>()),
+      _index_mutex(std::make_unique<std::mutex>()) {
   // _max_chunk_size has no meaning if the table is a reference table.
   DebugAssert(type == TableType::Data || !max_chunk_size, "Must not set max_chunk_size for reference tables");
   DebugAssert(!max_chunk_size || *max_chunk_size > 0, "Table must have a chunk size greater than 0.");
@@ -108,7 +113,15 @@ void Table::append(const std::vector<AllTypeVariant>& values) {
     append_mutable_chunk();
   }
 
-  _chunks.back()->append(values);
+  const auto& chunk = _chunks.back();
+  chunk->append(values);
+
+  const auto chunk_id = ChunkID{static_cast<ChunkID::base_type>(_chunks.size() - 1)};
+  const auto chunk_offset = static_cast<ChunkOffset>(chunk->size() - 1);
+  for (const auto& table_hash_index : _table_hash_indexes) {
+    table_hash_index->insert(chunk_id, *chunk->get_segment(table_hash_index->column_id()), chunk_offset,
+                             chunk_offset + 1);
+  }
 }
 
 void Table::append_mutable_chunk() {
@@ -126,6 +139,15 @@ void Table::append_mutable_chunk() {
   }
 
   append_chunk(segments, mvcc_data);
+
+  // Single-column indexes of the table also cover the new chunk through a delta index (see BaseDeltaIndex)
+  const auto& chunk = _chunks.back();
+  for (const auto& index_info : get_indexes()) {
+    if (index_info.type == SegmentIndexType::TableHash || index_info.column_ids.size() != 1) continue;
+    if (chunk->get_delta_index(index_info.column_ids[0])) continue;
+
+    chunk->create_delta_index(index_info.column_ids[0], index_info.type);
+  }
 }
 
 uint64_t Table::row_count() const {
@@ -162,6 +184,13 @@ void Table::remove_chunk(ChunkID chunk_id) {
     auto invalidated_rows_count = _chunks[chunk_id]->size();
     _table_statistics->decrease_invalid_row_count(invalidated_rows_count);
   }
+
+  const auto& chunk = _chunks[chunk_id];
+  for (const auto& table_hash_index : _table_hash_indexes) {
+    table_hash_index->erase(chunk_id, *chunk->get_segment(table_hash_index->column_id()), ChunkOffset{0},
+                            chunk->size());
+  }
+
   _chunks[chunk_id] = nullptr;
 }
 
@@ -229,7 +258,105 @@ std::vector<std::vector<AllTypeVariant>> Table::get_rows() const {
 
 std::unique_lock<std::mutex> Table::acquire_append_mutex() { return std::unique_lock<std::mutex>(*_append_mutex); }
 
-std::vector<IndexInfo> Table::get_indexes() const { return _indexes; }
+std::shared_lock<std::shared_mutex> Table::acquire_index_creation_mutex() {
+  return std::shared_lock<std::shared_mutex>(*_index_creation_mutex);
+}
+
+std::vector<IndexInfo> Table::get_indexes() const {
+  std::lock_guard<std::mutex> lock(*_index_mutex);
+  return _indexes;
+}
+
+void Table::add_index_info(const IndexInfo& index_info) {
+  std::lock_guard<std::mutex> lock(*_index_mutex);
+  _indexes.emplace_back(index_info);
+}
+
+void Table::remove_index(const std::vector<ColumnID>& column_ids, const SegmentIndexType index_type) {
+  Assert(index_type != SegmentIndexType::TableHash, "Table-wide hash indexes cannot be removed");
+
+  // The index is unregistered first, so that new plans do not use it anymore and new Chunks do not get a delta index
+  {
+    std::lock_guard<std::mutex> lock(*_index_mutex);
+    const auto index_info_it = std::find_if(_indexes.cbegin(), _indexes.cend(), [&](const auto& index_info) {
+      return index_info.column_ids == column_ids && index_info.type == index_type;
+    });
+    Assert(index_info_it != _indexes.cend(), "Trying to remove a non-existing index");
+    _indexes.erase(index_info_it);
+  }
+
+  for (const auto& chunk : _chunks) {
+    if (!chunk) continue;
+
+    // get_index() also matches indexes that cover column_ids as a prefix
+    const auto index = chunk->get_index(index_type, column_ids);
+    if (index && index->get_indexed_segments().size() == column_ids.size()) {
+      chunk->remove_index(index);
+    }
+
+    if (column_ids.size() == 1) {
+      const auto delta_index = chunk->get_delta_index(column_ids[0]);
+      if (delta_index && delta_index->target_index_type() == index_type) {
+        chunk->remove_delta_index(column_ids[0]);
+      }
+    }
+  }
+}
+
+void Table::create_table_hash_index(const ColumnID column_id, const std::string& name) {
+  Assert(_type == TableType::Data, "Table-wide hash indexes can only be created on data tables");
+  Assert(column_id < column_count(), "column_id invalid");
+  Assert(!get_table_hash_index(column_id), "Column already has a table-wide hash index");
+
+  const auto table_hash_index = BaseTableHashIndex::create(column_data_type(column_id), column_id);
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < _chunks.size(); ++chunk_id) {
+    const auto chunk = _chunks[chunk_id];
+    if (!chunk) continue;
+
+    table_hash_index->insert(chunk_id, *chunk->get_segment(column_id), ChunkOffset{0}, chunk->size());
+  }
+
+  _table_hash_indexes.emplace_back(table_hash_index);
+  add_index_info(IndexInfo{{column_id}, name, SegmentIndexType::TableHash});
+}
+
+std::shared_ptr<BaseTableHashIndex> Table::get_table_hash_index(const ColumnID column_id) const {
+  for (const auto& table_hash_index : _table_hash_indexes) {
+    if (table_hash_index->column_id() == column_id) return table_hash_index;
+  }
+  return nullptr;
+}
+
+const std::vector<std::shared_ptr<BaseTableHashIndex>>& Table::table_hash_indexes() const {
+  return _table_hash_indexes;
+}
+
+void Table::add_unique_constraint(const std::vector<ColumnID>& column_ids, const IsPrimaryKey is_primary_key) {
+  Assert(_type == TableType::Data, "Constraints can only be declared on data tables");
+  Assert(!column_ids.empty(), "A constraint needs at least one column");
+
+  for (auto column_idx = size_t{0}; column_idx < column_ids.size(); ++column_idx) {
+    const auto column_id = column_ids[column_idx];
+    Assert(static_cast<size_t>(column_id) < column_count(), "ColumnID out of range");
+    Assert(std::find(column_ids.cbegin() + column_idx + 1, column_ids.cend(), column_id) == column_ids.cend(),
+           "Constraint contains a column twice");
+
+    if (is_primary_key == IsPrimaryKey::Yes) {
+      Assert(!column_is_nullable(column_id), "Columns of a PRIMARY KEY must be NOT NULL");
+    }
+  }
+
+  if (is_primary_key == IsPrimaryKey::Yes) {
+    Assert(std::none_of(_constraint_definitions.cbegin(), _constraint_definitions.cend(),
+                        [](const auto& constraint) { return constraint.is_primary_key == IsPrimaryKey::Yes; }),
+           "A table can only have one PRIMARY KEY");
+  }
+
+  _constraint_definitions.emplace_back(TableConstraintDefinition{column_ids, is_primary_key});
+}
+
+const TableConstraintDefinitions& Table::get_unique_constraints() const { return _constraint_definitions; }
 
 size_t Table::estimate_memory_usage() const {
   auto bytes = size_t{sizeof(*this)};
@@ -1,7 +1,9 @@
 #pragma once
 
+#include <algorithm>
 #include <memory>
 #include <mutex>
+#include <shared_mutex>
 #include <string>
 #include <utility>
 #include <vector>
@@ -12,12 +14,14 @@
 #include "chunk.hpp"
 #include "storage/index/index_info.hpp"
 #include "storage/table_column_definition.hpp"
+#include "storage/table_constraint_definition.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
 #include "utils/performance_warning.hpp"
 
 namespace opossum {
 
+class BaseTableHashIndex;
 class TableStatistics;
 
 /**
@@ -116,7 +120,7 @@ class Table : private Noncopyable {
    * @defgroup Convenience methods for accessing/adding Table data. Slow, use only for testing!
    * @{
    */
-  // inserts a row at the end of the table
+  // inserts a row at the end of the table and adds it to the delta indexes and the table-wide hash indexes
   // note this is slow and not thread-safe and should be used for testing purposes only
   void append(const std::vector<AllTypeVariant>& values);
 
@@ -151,23 +155,98 @@ class Table : private Noncopyable {
 
   std::unique_lock<std::mutex> acquire_append_mutex();
 
+  /**
+   * Inserts hold this mutex (shared) from allocating their rows until they added them to the delta indexes.
+   * create_index() locks it exclusively while it creates delta indexes, so that it never reads rows into a delta index
+   * that are still being written.
+   */
+  std::shared_lock<std::shared_mutex> acquire_index_creation_mutex();
+
   void set_table_statistics(std::shared_ptr<TableStatistics> table_statistics) { _table_statistics = table_statistics; }
 
   std::shared_ptr<TableStatistics> table_statistics() const { return _table_statistics; }
 
   std::vector<IndexInfo> get_indexes() const;
 
+  /**
+   * Creates a chunk index of the given type on every immutable Chunk. Rows can still be appended to mutable Chunks,
+   * so they get a delta index (see BaseDeltaIndex) instead, which is replaced by the requested index once the Chunk
+   * is encoded. Chunks appended later get a delta index as well (see append_mutable_chunk()).
+   * Delta indexes only exist for single columns, so multi-column indexes require all Chunks to be immutable. Chunks
+   * appended afterwards are not covered by them and are scanned instead (see LQPTranslator).
+   *
+   * Indexes can be created and removed while queries and Inserts are running (e.g., by the IndexAdvisorPlugin). Readers
+   * see the index lists of the Chunks and get_indexes() either before or after the change. Inserts are only blocked
+   * while the delta indexes are created, not while the indexes of the immutable Chunks are built.
+   */
   template <typename Index>
   void create_index(const std::vector<ColumnID>& column_ids, const std::string& name = "") {
     SegmentIndexType index_type = get_index_type_of<Index>();
+    Assert(column_ids.size() == 1 || std::none_of(_chunks.cbegin(), _chunks.cend(),
+                                                  [](const auto& chunk) { return chunk && chunk->is_mutable(); }),
+           "Multi-column indexes cannot cover mutable Chunks, mark them immutable first");
+
+    // No rows are added to immutable Chunks, so their indexes are built without blocking Inserts
+    const auto chunk_count = _chunks.size();
+    for (auto chunk_id = size_t{0}; chunk_id < chunk_count; ++chunk_id) {
+      const auto& chunk = _chunks[chunk_id];
+      if (chunk && !chunk->is_mutable()) chunk->create_index<Index>(column_ids);
+    }
+
+    // Delta indexes read the rows of mutable Chunks, so they are created while no Insert writes rows. The index is
+    // registered under the same lock, so that every Chunk appended from now on gets a delta index as well (see
+    // append_mutable_chunk()). Chunks that were appended or encoded during the builds above are caught up on here.
+    std::unique_lock<std::shared_mutex> index_creation_lock(*_index_creation_mutex);
+
+    for (const auto& chunk : _chunks) {
+      if (!chunk) continue;
+
+      const auto indices = chunk->get_indices(column_ids);
+      const auto has_index = std::any_of(indices.cbegin(), indices.cend(), [&](const auto& index) {
+        return index->type() == index_type && index->get_indexed_segments().size() == column_ids.size();
+      });
+      if (has_index) continue;
+
+      // A Chunk that was encoded in the meantime gets the regular index
+      if (chunk->is_mutable() &&
+          (chunk->get_delta_index(column_ids[0]) || chunk->create_delta_index(column_ids[0], index_type))) {
+        continue;
+      }
 
-    for (auto& chunk : _chunks) {
       chunk->create_index<Index>(column_ids);
     }
-    IndexInfo i = {column_ids, name, index_type};
-    _indexes.emplace_back(i);
+
+    std::lock_guard<std::mutex> lock(*_index_mutex);
+    _indexes.emplace_back(IndexInfo{column_ids, name, index_type});
   }
 
+  // Registers an index whose chunk indexes were added to the Chunks directly (e.g., by ImportBinary)
+  void add_index_info(const IndexInfo& index_info);
+
+  // Removes the chunk indexes (and delta indexes) of the given type on exactly these columns, created by create_index()
+  void remove_index(const std::vector<ColumnID>& column_ids, const SegmentIndexType index_type);
+
+  /**
+   * Creates a table-wide hash index (see BaseTableHashIndex) on a single column and fills it with all rows currently in
+   * the Table. Afterwards, the Insert operator keeps it up to date. Must not run concurrently with Inserts.
+   */
+  void create_table_hash_index(const ColumnID column_id, const std::string& name = "");
+
+  // Returns nullptr if there is no table-wide hash index on the column
+  std::shared_ptr<BaseTableHashIndex> get_table_hash_index(const ColumnID column_id) const;
+
+  const std::vector<std::shared_ptr<BaseTableHashIndex>>& table_hash_indexes() const;
+
+  /**
+   * Declares a UNIQUE or PRIMARY KEY constraint (see TableConstraintDefinition). The rows already in the Table are not
+   * checked, they are expected to satisfy the constraint (see unique_constraint_satisfied()). Afterwards, the Insert
+   * operator fails for rows that would violate it.
+   */
+  void add_unique_constraint(const std::vector<ColumnID>& column_ids,
+                             const IsPrimaryKey is_primary_key = IsPrimaryKey::No);
+
+  const TableConstraintDefinitions& get_unique_constraints() const;
+
   /**
    * For debugging purposes, makes an estimation about the memory used by this Table (including Chunk and Segments)
    */
@@ -181,6 +260,10 @@ class Table : private Noncopyable {
   tbb::concurrent_vector<std::shared_ptr<Chunk>> _chunks;
   std::shared_ptr<TableStatistics> _table_statistics;
   std::unique_ptr<std::mutex> _append_mutex;
+  std::unique_ptr<std::shared_mutex> _index_creation_mutex;
+  std::unique_ptr<std::mutex> _index_mutex;  // Guards _indexes
   std::vector<IndexInfo> _indexes;
+  std::vector<std::shared_ptr<BaseTableHashIndex>> _table_hash_indexes;
+  TableConstraintDefinitions _constraint_definitions;
 };
 }  // namespace opossum
@@ -0,0 +1,30 @@
+#pragma once
+
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+enum class IsPrimaryKey : bool { Yes = true, No = false };
+
+/**
+ * A UNIQUE or PRIMARY KEY constraint over one or more columns of a Table. No two visible rows may share the values of
+ * all these columns. As in SQL, rows with a NULL in any of the columns do not violate a UNIQUE constraint. The columns
+ * of a PRIMARY KEY are NOT NULL, and a Table has at most one.
+ *
+ * The constraints are checked by the Insert operator (see unique_constraint_checker.hpp) and used by optimizer rules
+ * that rely on the uniqueness of columns (e.g., DependentGroupByReductionRule).
+ */
+struct TableConstraintDefinition final {
+  bool operator==(const TableConstraintDefinition& rhs) const {
+    return column_ids == rhs.column_ids && is_primary_key == rhs.is_primary_key;
+  }
+
+  std::vector<ColumnID> column_ids;
+  IsPrimaryKey is_primary_key{IsPrimaryKey::No};
+};
+
+using TableConstraintDefinitions = std::vector<TableConstraintDefinition>;
+
+}  // namespace opossum
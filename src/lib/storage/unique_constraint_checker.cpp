@@ -0,0 +1,238 @@
+#include "unique_constraint_checker.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "boost/functional/hash.hpp"
+
+#include "all_type_variant.hpp"
+#include "statistics/chunk_statistics/chunk_statistics.hpp"
+#include "storage/index/table_hash/table_hash_index.hpp"
+#include "storage/mvcc_data.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// The values of the constrained columns of a row
+using Key = std::vector<AllTypeVariant>;
+
+struct KeyHash {
+  size_t operator()(const Key& key) const {
+    auto hash = size_t{0};
+    for (const auto& value : key) {
+      boost::hash_combine(hash, std::hash<AllTypeVariant>{}(value));
+    }
+    return hash;
+  }
+};
+
+using KeySet = std::unordered_set<Key, KeyHash>;
+
+/**
+ * Returns whether a row counts for the check of transaction_id (see unique_constraint_satisfied()).
+ * INVALID_TRANSACTION_ID stands for a check outside of a transaction, where only committed deletes are ignored.
+ */
+bool row_is_relevant(const MvccData& mvcc_data, const ChunkOffset chunk_offset, const TransactionID transaction_id) {
+  // Deleted by a committed transaction or rolled back
+  if (mvcc_data.end_cids[chunk_offset] != MvccData::MAX_COMMIT_ID) return false;
+
+  const auto row_tid = TransactionID{mvcc_data.tids[chunk_offset]};
+
+  // Not committed yet. If the inserting transaction deleted the row again, its tid was reset.
+  if (mvcc_data.begin_cids[chunk_offset] == MvccData::MAX_COMMIT_ID) return row_tid != INVALID_TRANSACTION_ID;
+
+  // Committed, but possibly about to be deleted by this transaction (e.g., by an Update)
+  return transaction_id == INVALID_TRANSACTION_ID || row_tid != transaction_id;
+}
+
+/**
+ * Calls functor(chunk_offset, key) for each relevant row in [begin_chunk_offset, end_chunk_offset) of the chunk.
+ * Rows with a NULL in one of the columns are skipped, they cannot violate the constraint.
+ */
+template <typename Functor>
+void for_each_key(const Chunk& chunk, const std::vector<ColumnID>& column_ids, const ChunkOffset begin_chunk_offset,
+                  const ChunkOffset end_chunk_offset, const TransactionID transaction_id, const Functor& functor) {
+  const auto row_count = end_chunk_offset - begin_chunk_offset;
+  auto keys = std::vector<Key>(row_count, Key(column_ids.size()));
+  auto key_has_null = std::vector<bool>(row_count);
+
+  for (auto column_idx = size_t{0}; column_idx < column_ids.size(); ++column_idx) {
+    segment_with_iterators<ResolveDataTypeTag, EraseTypes::Always>(
+        *chunk.get_segment(column_ids[column_idx]), [&](auto it, const auto /*end*/) {
+          it += begin_chunk_offset;
+          for (auto row_idx = size_t{0}; row_idx < row_count; ++row_idx, ++it) {
+            if (it->is_null()) {
+              key_has_null[row_idx] = true;
+            } else {
+              keys[row_idx][column_idx] = it->value();
+            }
+          }
+        });
+  }
+
+  const auto call_for_relevant_rows = [&](const MvccData* const mvcc_data) {
+    for (auto row_idx = size_t{0}; row_idx < row_count; ++row_idx) {
+      if (key_has_null[row_idx]) continue;
+
+      const auto chunk_offset = static_cast<ChunkOffset>(begin_chunk_offset + row_idx);
+      if (mvcc_data && !row_is_relevant(*mvcc_data, chunk_offset, transaction_id)) continue;
+
+      functor(chunk_offset, std::move(keys[row_idx]));
+    }
+  };
+
+  if (chunk.has_mvcc_data()) {
+    const auto mvcc_data = chunk.get_scoped_mvcc_data_lock();
+    call_for_relevant_rows(&*mvcc_data);
+  } else {
+    call_for_relevant_rows(nullptr);
+  }
+}
+
+bool row_has_key(const Chunk& chunk, const ChunkOffset chunk_offset, const std::vector<ColumnID>& column_ids,
+                 const Key& key) {
+  for (auto column_idx = size_t{0}; column_idx < column_ids.size(); ++column_idx) {
+    const auto value = (*chunk.get_segment(column_ids[column_idx]))[chunk_offset];
+    if (variant_is_null(value) || !(value == key[column_idx])) return false;
+  }
+  return true;
+}
+
+// Looks up the new keys in the table-wide hash index on column_ids[indexed_column_idx]
+bool satisfied_using_table_hash_index(const Table& table, const BaseTableHashIndex& table_hash_index,
+                                      const size_t indexed_column_idx, const std::vector<ColumnID>& column_ids,
+                                      const std::vector<std::pair<RowID, Key>>& new_keys,
+                                      const TransactionID transaction_id) {
+  for (const auto& [new_row_id, key] : new_keys) {
+    for (const auto& row_id : table_hash_index.lookup(key[indexed_column_idx])) {
+      if (row_id == new_row_id) continue;
+
+      const auto chunk = table.get_chunk(row_id.chunk_id);
+      if (!chunk) continue;
+
+      if (chunk->has_mvcc_data() &&
+          !row_is_relevant(*chunk->get_scoped_mvcc_data_lock(), row_id.chunk_offset, transaction_id)) {
+        continue;
+      }
+
+      if (row_has_key(*chunk, row_id.chunk_offset, column_ids, key)) return false;
+    }
+  }
+
+  return true;
+}
+
+// Scans all Chunks for the new keys, skipping the new rows themselves and Chunks ruled out by their statistics
+bool satisfied_using_scan(const Table& table, const std::vector<ColumnID>& column_ids, const KeySet& new_key_set,
+                          const std::vector<ChunkOffsetRange>& new_rows, const TransactionID transaction_id) {
+  // The range of the new values per column, used to prune Chunks
+  auto min_values = std::vector<AllTypeVariant>(column_ids.size());
+  auto max_values = std::vector<AllTypeVariant>(column_ids.size());
+  for (const auto& key : new_key_set) {
+    for (auto column_idx = size_t{0}; column_idx < column_ids.size(); ++column_idx) {
+      const auto& value = key[column_idx];
+      if (variant_is_null(min_values[column_idx]) || value < min_values[column_idx]) min_values[column_idx] = value;
+      if (variant_is_null(max_values[column_idx]) || max_values[column_idx] < value) max_values[column_idx] = value;
+    }
+  }
+
+  auto new_rows_by_chunk = std::unordered_map<ChunkID, std::vector<ChunkOffsetRange>>{};
+  for (const auto& range : new_rows) {
+    new_rows_by_chunk[range.chunk_id].emplace_back(range);
+  }
+
+  const auto chunk_count = table.chunk_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = table.get_chunk(chunk_id);
+    if (!chunk) continue;
+
+    if (const auto statistics = chunk->statistics()) {
+      auto prunable = false;
+      for (auto column_idx = size_t{0}; column_idx < column_ids.size() && !prunable; ++column_idx) {
+        prunable = statistics->can_prune(column_ids[column_idx], PredicateCondition::BetweenInclusive,
+                                         min_values[column_idx], max_values[column_idx]);
+      }
+      if (prunable) continue;
+    }
+
+    const auto new_rows_iter = new_rows_by_chunk.find(chunk_id);
+    const auto is_new_row = [&](const ChunkOffset chunk_offset) {
+      if (new_rows_iter == new_rows_by_chunk.cend()) return false;
+      return std::any_of(new_rows_iter->second.cbegin(), new_rows_iter->second.cend(), [&](const auto& range) {
+        return chunk_offset >= range.begin_chunk_offset && chunk_offset < range.end_chunk_offset;
+      });
+    };
+
+    auto satisfied = true;
+    for_each_key(*chunk, column_ids, ChunkOffset{0}, chunk->size(), transaction_id,
+                 [&](const ChunkOffset chunk_offset, Key&& key) {
+                   if (satisfied && !is_new_row(chunk_offset) && new_key_set.count(key)) satisfied = false;
+                 });
+    if (!satisfied) return false;
+  }
+
+  return true;
+}
+
+}  // namespace
+
+namespace opossum {
+
+bool unique_constraint_satisfied(const Table& table, const TableConstraintDefinition& constraint,
+                                 const std::vector<ChunkOffsetRange>& new_rows, const TransactionID transaction_id) {
+  const auto& column_ids = constraint.column_ids;
+
+  // Collect the keys of the new rows, which must not contain duplicates themselves
+  auto new_keys = std::vector<std::pair<RowID, Key>>{};
+  auto new_key_set = KeySet{};
+  auto satisfied = true;
+  for (const auto& range : new_rows) {
+    const auto chunk = table.get_chunk(range.chunk_id);
+    for_each_key(*chunk, column_ids, range.begin_chunk_offset, range.end_chunk_offset, transaction_id,
+                 [&](const ChunkOffset chunk_offset, Key&& key) {
+                   if (!new_key_set.emplace(key).second) satisfied = false;
+                   new_keys.emplace_back(RowID{range.chunk_id, chunk_offset}, std::move(key));
+                 });
+  }
+  if (!satisfied) return false;
+  if (new_keys.empty()) return true;
+
+  for (auto column_idx = size_t{0}; column_idx < column_ids.size(); ++column_idx) {
+    if (const auto table_hash_index = table.get_table_hash_index(column_ids[column_idx])) {
+      return satisfied_using_table_hash_index(table, *table_hash_index, column_idx, column_ids, new_keys,
+                                              transaction_id);
+    }
+  }
+
+  return satisfied_using_scan(table, column_ids, new_key_set, new_rows, transaction_id);
+}
+
+bool unique_constraint_satisfied(const Table& table, const TableConstraintDefinition& constraint) {
+  auto key_set = KeySet{};
+  auto satisfied = true;
+
+  const auto chunk_count = table.chunk_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count && satisfied; ++chunk_id) {
+    const auto chunk = table.get_chunk(chunk_id);
+    if (!chunk) continue;
+
+    for_each_key(*chunk, constraint.column_ids, ChunkOffset{0}, chunk->size(), INVALID_TRANSACTION_ID,
+                 [&](const ChunkOffset /*chunk_offset*/, Key&& key) {
+                   if (!key_set.emplace(std::move(key)).second) satisfied = false;
+                 });
+  }
+
+  return satisfied;
+}
+
+}  // namespace opossum
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <vector>
+
+#include "storage/table_constraint_definition.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class Table;
+
+// The rows [begin_chunk_offset, end_chunk_offset) of a Chunk, e.g., the rows written by an Insert
+struct ChunkOffsetRange {
+  ChunkID chunk_id{};
+  ChunkOffset begin_chunk_offset{};
+  ChunkOffset end_chunk_offset{};
+};
+
+/**
+ * Checks the rows in new_rows against a UNIQUE or PRIMARY KEY constraint of the table (see TableConstraintDefinition):
+ * Returns false if two of them or one of them and another row of the table share the values of the constrained
+ * columns.
+ *
+ * The check is conservative towards concurrent transactions. Besides the committed rows, it also counts the rows that
+ * other transactions inserted but did not commit yet, and the rows that others are about to delete. Only rows whose
+ * deletion (or rollback) was committed and rows that transaction_id itself deletes are ignored. Thus, of two
+ * transactions inserting the same key, at least the one checking last fails, even if its snapshot does not include the
+ * other row.
+ *
+ * If one of the constrained columns has a table-wide hash index (see BaseTableHashIndex), the matching rows are looked
+ * up in it. In that case, new_rows have to be in the index already. Otherwise, all Chunks of the table are scanned,
+ * except for those that the ChunkStatistics rule out for the new values.
+ */
+bool unique_constraint_satisfied(const Table& table, const TableConstraintDefinition& constraint,
+                                 const std::vector<ChunkOffsetRange>& new_rows, const TransactionID transaction_id);
+
+// Checks all rows of the table against the constraint, e.g., before it is declared (see Table::add_unique_constraint)
+bool unique_constraint_satisfied(const Table& table, const TableConstraintDefinition& constraint);
+
+}  // namespace opossum
@@ -4,6 +4,7 @@
 #include "concurrency/transaction_manager.hpp"
 #include "operators/abstract_operator.hpp"
 #include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
 #include "scheduler/operator_task.hpp"
 
 namespace opossum {
@@ -11,9 +12,13 @@ namespace opossum {
 void ExecuteServerPreparedStatementTask::_on_execute() {
   try {
     const auto tasks = OperatorTask::make_tasks_from_operator(_prepared_plan, CleanupTemporaries::Yes);
-    CurrentScheduler::schedule_and_wait_for_tasks(tasks);
-    auto result_table = tasks.back()->get_operator()->get_output();
-    _promise.set_value(std::move(result_table));
+
+    // Instead of blocking its worker until the plan is executed, this task ends right away and the result is passed
+    // on by a continuation. It keeps this task, and thus the promise, alive.
+    const auto self = std::static_pointer_cast<ExecuteServerPreparedStatementTask>(shared_from_this());
+    const auto continuation = std::make_shared<JobTask>(
+        [self, root_task = tasks.back()]() { self->_promise.set_value(root_task->get_operator()->get_output()); });
+    CurrentScheduler::schedule_tasks_with_continuation(tasks, continuation);
   } catch (const std::exception&) {
     _promise.set_exception(boost::current_exception());
   }
@@ -57,6 +57,11 @@ class copyable_atomic {
     return _atomic.operator--(std::forward<Args>(args)...);
   }
 
+  template <typename... Args>
+  decltype(auto) fetch_add(Args&&... args) {
+    return _atomic.fetch_add(std::forward<Args>(args)...);
+  }
+
   template <typename... Args>
   bool exchange(Args&&... args) {
     return _atomic.exchange(std::forward<Args>(args)...);
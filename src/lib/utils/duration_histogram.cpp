@@ -0,0 +1,80 @@
+#include "duration_histogram.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+void DurationHistogram::record(const std::chrono::nanoseconds duration) {
+  const auto nanoseconds = static_cast<uint64_t>(std::max(duration.count(), decltype(duration.count()){0}));
+  _bucket_counts[_bucket_index(nanoseconds)].fetch_add(1, std::memory_order_relaxed);
+}
+
+void DurationHistogram::merge(const DurationHistogram& other) {
+  for (auto bucket_index = size_t{0}; bucket_index < BUCKET_COUNT; ++bucket_index) {
+    _bucket_counts[bucket_index].fetch_add(other._bucket_counts[bucket_index].load(std::memory_order_relaxed),
+                                           std::memory_order_relaxed);
+  }
+}
+
+void DurationHistogram::reset() {
+  for (auto& bucket_count : _bucket_counts) {
+    bucket_count.store(0, std::memory_order_relaxed);
+  }
+}
+
+uint64_t DurationHistogram::count() const {
+  auto count = uint64_t{0};
+  for (const auto& bucket_count : _bucket_counts) {
+    count += bucket_count.load(std::memory_order_relaxed);
+  }
+  return count;
+}
+
+std::chrono::nanoseconds DurationHistogram::percentile(const double percentile) const {
+  Assert(percentile >= 0.0 && percentile <= 100.0, "Percentile must be between 0 and 100");
+
+  // Concurrent calls to record() might increase the counts while this iterates over them, so the percentile is taken
+  // from a snapshot
+  auto bucket_counts = std::array<uint64_t, BUCKET_COUNT>{};
+  auto count = uint64_t{0};
+  for (auto bucket_index = size_t{0}; bucket_index < BUCKET_COUNT; ++bucket_index) {
+    bucket_counts[bucket_index] = _bucket_counts[bucket_index].load(std::memory_order_relaxed);
+    count += bucket_counts[bucket_index];
+  }
+  if (count == 0) return std::chrono::nanoseconds{0};
+
+  // The rank of the duration, starting at 1
+  const auto rank = std::max(static_cast<uint64_t>(std::ceil(percentile / 100.0 * static_cast<double>(count))),
+                             uint64_t{1});
+  auto seen_count = uint64_t{0};
+  for (auto bucket_index = size_t{0}; bucket_index < BUCKET_COUNT; ++bucket_index) {
+    seen_count += bucket_counts[bucket_index];
+    if (seen_count >= rank) {
+      return std::chrono::nanoseconds{static_cast<std::chrono::nanoseconds::rep>(_bucket_upper_bound(bucket_index))};
+    }
+  }
+  Fail("Rank exceeds the number of recorded durations");
+}
+
+size_t DurationHistogram::_bucket_index(const uint64_t nanoseconds) {
+  if (nanoseconds < SUB_BUCKET_COUNT) return nanoseconds;
+
+  // Position of the most significant bit, at least SUB_BUCKET_BITS. The SUB_BUCKET_BITS bits below it select the
+  // bucket within that power of two.
+  const auto magnitude = static_cast<size_t>(63 - __builtin_clzll(nanoseconds));
+  const auto sub_bucket = (nanoseconds >> (magnitude - SUB_BUCKET_BITS)) & (SUB_BUCKET_COUNT - 1);
+  return (magnitude - SUB_BUCKET_BITS + 1) * SUB_BUCKET_COUNT + sub_bucket;
+}
+
+uint64_t DurationHistogram::_bucket_upper_bound(const size_t bucket_index) {
+  if (bucket_index < SUB_BUCKET_COUNT) return bucket_index;
+
+  const auto magnitude = bucket_index / SUB_BUCKET_COUNT + SUB_BUCKET_BITS - 1;
+  const auto sub_bucket = uint64_t{bucket_index % SUB_BUCKET_COUNT};
+  return ((SUB_BUCKET_COUNT + sub_bucket + 1) << (magnitude - SUB_BUCKET_BITS)) - 1;
+}
+
+}  // namespace opossum
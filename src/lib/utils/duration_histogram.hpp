@@ -0,0 +1,53 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Counts durations in buckets instead of storing them, so that percentiles can be estimated at constant memory and
+ * recording a duration is a single relaxed atomic increment. It can thus stay enabled on hot paths, e.g., for every
+ * task a Worker executes.
+ *
+ * Durations below 2^SUB_BUCKET_BITS nanoseconds have a bucket each. Above, each power of two is divided into
+ * 2^SUB_BUCKET_BITS buckets of equal width, which limits the relative error of a percentile to 1 / 2^SUB_BUCKET_BITS
+ * (as in HdrHistogram).
+ */
+class DurationHistogram : private Noncopyable {
+ public:
+  static constexpr auto SUB_BUCKET_BITS = size_t{3};
+  static constexpr auto SUB_BUCKET_COUNT = size_t{1} << SUB_BUCKET_BITS;
+  static constexpr auto BUCKET_COUNT = (64 - SUB_BUCKET_BITS + 1) * SUB_BUCKET_COUNT;
+
+  DurationHistogram() = default;
+
+  void record(const std::chrono::nanoseconds duration);
+
+  /**
+   * Adds the counts of @param other to this histogram, e.g., to combine the histograms of all workers
+   */
+  void merge(const DurationHistogram& other);
+
+  void reset();
+
+  uint64_t count() const;
+
+  /**
+   * @return The largest duration that falls into the same bucket as the @param percentile (between 0 and 100) of all
+   *         recorded durations, or zero if there are none
+   */
+  std::chrono::nanoseconds percentile(const double percentile) const;
+
+ protected:
+  static size_t _bucket_index(const uint64_t nanoseconds);
+  static uint64_t _bucket_upper_bound(const size_t bucket_index);
+
+  std::array<std::atomic<uint64_t>, BUCKET_COUNT> _bucket_counts{};
+};
+
+}  // namespace opossum
@@ -5,6 +5,7 @@
 #include "expression/expression_utils.hpp"
 #include "expression/pqp_subquery_expression.hpp"
 #include "operators/limit.hpp"
+#include "operators/pipeline.hpp"
 #include "operators/projection.hpp"
 #include "operators/table_scan.hpp"
 #include "utils/format_duration.hpp"
@@ -66,6 +67,15 @@ void PQPVisualizer::_build_subtree(const std::shared_ptr<const AbstractOperator>
       _visualize_subqueries(op, limit->row_count_expression(), visualized_ops);
     } break;
 
+    case OperatorType::Pipeline: {
+      const auto pipeline = std::dynamic_pointer_cast<const Pipeline>(op);
+      for (const auto& stage : pipeline->stages()) {
+        if (const auto table_scan = std::dynamic_pointer_cast<const TableScan>(stage)) {
+          _visualize_subqueries(op, table_scan->predicate(), visualized_ops);
+        }
+      }
+    } break;
+
     default: {}  // OperatorType has no expressions
   }
 }
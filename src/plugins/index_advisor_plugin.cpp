@@ -0,0 +1,380 @@
+#include "index_advisor_plugin.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include "expression/abstract_predicate_expression.hpp"
+#include "expression/pqp_column_expression.hpp"
+#include "operators/abstract_join_operator.hpp"
+#include "operators/get_table.hpp"
+#include "operators/index_scan.hpp"
+#include "operators/table_scan.hpp"
+#include "resolve_type.hpp"
+#include "sql/sql_plan_cache.hpp"
+#include "storage/base_dictionary_segment.hpp"
+#include "storage/index/group_key/group_key_index.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Both thresholds mirror the IndexScanRule: If a scan does not satisfy them, the optimizer would not use the index.
+constexpr auto INDEX_SCAN_SELECTIVITY_THRESHOLD = 0.01;
+constexpr auto INDEX_SCAN_ROW_COUNT_THRESHOLD = size_t{1000};
+
+// Follows the column through operators that forward the columns of their input unchanged down to a GetTable
+std::optional<IndexAdvisorPlugin::IndexCandidate> resolve_stored_column(std::shared_ptr<const AbstractOperator> op,
+                                                                        const ColumnID column_id) {
+  while (op) {
+    switch (op->type()) {
+      case OperatorType::GetTable:
+        return IndexAdvisorPlugin::IndexCandidate{static_cast<const GetTable&>(*op).table_name(), column_id};
+      case OperatorType::IndexScan:
+      case OperatorType::Limit:
+      case OperatorType::Pipeline:
+      case OperatorType::Sort:
+      case OperatorType::TableScan:
+      case OperatorType::Validate:
+        op = op->input_left();
+        break;
+      default:
+        return std::nullopt;
+    }
+  }
+  return std::nullopt;
+}
+
+// Returns the column of predicates like `a < 5` or `a BETWEEN ? AND 7`, which could be answered by an index
+std::optional<ColumnID> get_indexable_column(const TableScan& table_scan) {
+  const auto predicate = std::dynamic_pointer_cast<AbstractPredicateExpression>(table_scan.predicate());
+  if (!predicate) return std::nullopt;
+
+  const auto predicate_condition = predicate->predicate_condition;
+  if (predicate_condition == PredicateCondition::Like || predicate_condition == PredicateCondition::NotLike ||
+      (!is_binary_predicate_condition(predicate_condition) && !is_between_predicate_condition(predicate_condition))) {
+    return std::nullopt;
+  }
+
+  auto column_id = std::optional<ColumnID>{};
+  for (const auto& argument : predicate->arguments) {
+    if (const auto column_expression = std::dynamic_pointer_cast<PQPColumnExpression>(argument)) {
+      if (column_id) return std::nullopt;
+      column_id = column_expression->column_id;
+    } else if (argument->type != ExpressionType::Value && argument->type != ExpressionType::Placeholder &&
+               argument->type != ExpressionType::CorrelatedParameter) {
+      return std::nullopt;
+    }
+  }
+  return column_id;
+}
+
+size_t input_row_count(const AbstractOperator& op) { return op.input_left()->performance_data().output_row_count; }
+
+}  // namespace
+
+namespace opossum {
+
+const std::string IndexAdvisorPlugin::description() const {
+  return "Creates and drops indexes based on the cached query plans";
+}
+
+void IndexAdvisorPlugin::start() {
+  _loop_thread = std::make_unique<PausableLoopThread>(DEFAULT_TUNING_INTERVAL, [&](size_t) { tune(); });
+}
+
+void IndexAdvisorPlugin::stop() {
+  // Joins the thread, so that no tuning runs while the plugin is unloaded
+  _loop_thread.reset();
+
+  std::lock_guard<std::mutex> lock(_mutex);
+  _workload.clear();
+  _created_indexes.clear();
+}
+
+void IndexAdvisorPlugin::set_memory_budget(const size_t memory_budget) {
+  std::lock_guard<std::mutex> lock(_mutex);
+  _memory_budget = memory_budget;
+}
+
+size_t IndexAdvisorPlugin::memory_budget() const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _memory_budget;
+}
+
+void IndexAdvisorPlugin::tune() {
+  // Building an index can take minutes for large tables. Only the decision which indexes to create and drop is made
+  // while holding _mutex, so that recording and assessing the workload are not blocked by the builds.
+  std::lock_guard<std::mutex> tuning_lock(_tuning_mutex);
+
+  auto dropped_indexes = std::vector<IndexCandidate>{};
+  auto new_indexes = std::vector<IndexCandidate>{};
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    _collect_workload();
+
+    // Greedily pick the candidates with the highest benefit per byte
+    auto picked_candidates = std::vector<IndexCandidate>{};
+    auto remaining_budget = _memory_budget;
+    for (const auto& assessment : _assess_candidates()) {
+      if (assessment.benefit <= 0.0 || assessment.memory_cost > remaining_budget) continue;
+      remaining_budget -= assessment.memory_cost;
+      picked_candidates.emplace_back(assessment.candidate);
+    }
+
+    for (auto created_index_iter = _created_indexes.begin(); created_index_iter != _created_indexes.end();) {
+      const auto is_picked = std::find(picked_candidates.cbegin(), picked_candidates.cend(), *created_index_iter) !=
+                             picked_candidates.cend();
+      if (is_picked) {
+        ++created_index_iter;
+        continue;
+      }
+
+      dropped_indexes.emplace_back(*created_index_iter);
+      created_index_iter = _created_indexes.erase(created_index_iter);
+    }
+
+    for (const auto& candidate : picked_candidates) {
+      if (std::find(_created_indexes.cbegin(), _created_indexes.cend(), candidate) != _created_indexes.cend()) continue;
+      new_indexes.emplace_back(candidate);
+    }
+  }
+
+  auto indexes_changed = false;
+  auto created_indexes = std::vector<IndexCandidate>{};
+  auto& storage_manager = StorageManager::get();
+
+  // Drop the indexes that were not picked anymore first, so that their memory is freed. The tables might have been
+  // dropped (or replaced) in the meantime.
+  for (const auto& dropped_index : dropped_indexes) {
+    const auto& table_name = dropped_index.first;
+    const auto column_id = dropped_index.second;
+    if (!storage_manager.has_table(table_name)) continue;
+
+    const auto table = storage_manager.get_table(table_name);
+    const auto index_infos = table->get_indexes();
+    const auto has_index = std::any_of(index_infos.cbegin(), index_infos.cend(), [&](const auto& index_info) {
+      return index_info.column_ids == std::vector<ColumnID>{column_id} && index_info.type == SegmentIndexType::GroupKey;
+    });
+    if (has_index) {
+      table->remove_index({column_id}, SegmentIndexType::GroupKey);
+      indexes_changed = true;
+    }
+  }
+
+  for (const auto& candidate : new_indexes) {
+    if (!storage_manager.has_table(candidate.first)) continue;
+
+    storage_manager.get_table(candidate.first)->create_index<GroupKeyIndex>({candidate.second});
+    created_indexes.emplace_back(candidate);
+    indexes_changed = true;
+  }
+
+  if (!indexes_changed) return;
+
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _created_indexes.insert(_created_indexes.end(), created_indexes.cbegin(), created_indexes.cend());
+
+    // Cached plans were optimized without knowledge of the new indexes (or still use the dropped ones)
+    for (auto& [sql_string, query_information] : _workload) {
+      query_information.past_frequency += query_information.frequency;
+      query_information.frequency = 0;
+    }
+  }
+  SQLPhysicalPlanCache::get().clear();
+  SQLLogicalPlanCache::get().clear();
+}
+
+std::vector<IndexAdvisorPlugin::CandidateAssessment> IndexAdvisorPlugin::assess_candidates() {
+  std::lock_guard<std::mutex> lock(_mutex);
+  _collect_workload();
+  return _assess_candidates();
+}
+
+void IndexAdvisorPlugin::_collect_workload() {
+  for (const auto& [sql_string, physical_plan, frequency] : SQLPhysicalPlanCache::get().snapshot()) {
+    auto query_information_iter = _workload.find(sql_string);
+    if (query_information_iter == _workload.end()) {
+      // Only the cached plan itself is executed the first time the query is run, later requests execute deep copies
+      // of it. Thus, the performance data of the cached plan does not change anymore once it was executed.
+      if (!physical_plan->get_output()) continue;
+
+      query_information_iter = _workload.emplace(sql_string, QueryInformation{}).first;
+      _collect_column_uses(physical_plan, query_information_iter->second.column_uses);
+    }
+    query_information_iter->second.frequency = frequency;
+  }
+}
+
+void IndexAdvisorPlugin::_collect_column_uses(const std::shared_ptr<const AbstractOperator>& op,
+                                              std::vector<ColumnUse>& column_uses) {
+  auto visited_operators = std::unordered_set<std::shared_ptr<const AbstractOperator>>{};
+  auto operators_to_visit = std::vector<std::shared_ptr<const AbstractOperator>>{op};
+
+  while (!operators_to_visit.empty()) {
+    const auto current_operator = operators_to_visit.back();
+    operators_to_visit.pop_back();
+    if (!current_operator || !visited_operators.emplace(current_operator).second) continue;
+
+    operators_to_visit.emplace_back(current_operator->input_left());
+    operators_to_visit.emplace_back(current_operator->input_right());
+
+    const auto output_row_count = current_operator->performance_data().output_row_count;
+
+    switch (current_operator->type()) {
+      case OperatorType::TableScan: {
+        const auto column_id = get_indexable_column(static_cast<const TableScan&>(*current_operator));
+        if (!column_id) break;
+
+        const auto candidate = resolve_stored_column(current_operator->input_left(), *column_id);
+        if (candidate) {
+          column_uses.emplace_back(ColumnUse{*candidate, input_row_count(*current_operator), output_row_count, false});
+        }
+      } break;
+
+      case OperatorType::IndexScan: {
+        const auto& index_scan = static_cast<const IndexScan&>(*current_operator);
+        if (index_scan.left_column_ids().size() != 1) break;
+
+        const auto candidate = resolve_stored_column(current_operator->input_left(), index_scan.left_column_ids()[0]);
+        if (candidate) {
+          column_uses.emplace_back(ColumnUse{*candidate, input_row_count(*current_operator), output_row_count, false});
+        }
+      } break;
+
+      case OperatorType::JoinIndex: {
+        // JoinIndex uses the indexes of the right input
+        const auto& join = static_cast<const AbstractJoinOperator&>(*current_operator);
+        const auto candidate =
+            resolve_stored_column(current_operator->input_right(), join.primary_predicate().column_ids.second);
+        if (candidate) {
+          // Without an index, every row of the left input is compared with every row of the right input
+          const auto comparison_count =
+              input_row_count(*current_operator) * current_operator->input_right()->performance_data().output_row_count;
+          column_uses.emplace_back(ColumnUse{*candidate, comparison_count, output_row_count, true});
+        }
+      } break;
+
+      default:
+        break;
+    }
+  }
+}
+
+double IndexAdvisorPlugin::_benefit(const ColumnUse& column_use) {
+  if (column_use.output_row_count >= column_use.input_row_count) return 0.0;
+
+  if (!column_use.is_join) {
+    if (column_use.input_row_count < INDEX_SCAN_ROW_COUNT_THRESHOLD) return 0.0;
+
+    const auto selectivity =
+        static_cast<double>(column_use.output_row_count) / static_cast<double>(column_use.input_row_count);
+    if (selectivity > INDEX_SCAN_SELECTIVITY_THRESHOLD) return 0.0;
+  }
+
+  return static_cast<double>(column_use.input_row_count - column_use.output_row_count);
+}
+
+std::optional<size_t> IndexAdvisorPlugin::_estimate_memory_cost(const IndexCandidate& candidate) {
+  const auto table = StorageManager::get().get_table(candidate.first);
+
+  auto value_bytes = uint32_t{0};
+  resolve_data_type(table->column_data_type(candidate.second), [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+    value_bytes = sizeof(ColumnDataType);
+  });
+
+  auto memory_cost = size_t{0};
+  for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+    const auto chunk = table->get_chunk(chunk_id);
+    if (!chunk) continue;
+
+    // Mutable chunks get a delta index, for which we assume that all values are distinct
+    if (chunk->is_mutable()) {
+      memory_cost += BaseIndex::estimate_memory_consumption(SegmentIndexType::GroupKey, chunk->size(), chunk->size(),
+                                                            value_bytes);
+      continue;
+    }
+
+    const auto dictionary_segment =
+        std::dynamic_pointer_cast<const BaseDictionarySegment>(chunk->get_segment(candidate.second));
+    if (!dictionary_segment) return std::nullopt;
+
+    memory_cost += BaseIndex::estimate_memory_consumption(
+        SegmentIndexType::GroupKey, chunk->size(), dictionary_segment->unique_values_count(), value_bytes);
+  }
+
+  return memory_cost;
+}
+
+size_t IndexAdvisorPlugin::_measure_memory_cost(const IndexCandidate& candidate) {
+  const auto table = StorageManager::get().get_table(candidate.first);
+
+  auto memory_cost = size_t{0};
+  for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+    const auto chunk = table->get_chunk(chunk_id);
+    if (!chunk) continue;
+
+    const auto index = chunk->get_index(SegmentIndexType::GroupKey, std::vector<ColumnID>{candidate.second});
+    if (index) memory_cost += index->memory_consumption();
+  }
+
+  return memory_cost;
+}
+
+std::vector<IndexAdvisorPlugin::CandidateAssessment> IndexAdvisorPlugin::_assess_candidates() const {
+  auto benefits = std::map<IndexCandidate, double>{};
+  for (const auto& [sql_string, query_information] : _workload) {
+    const auto frequency = query_information.frequency + query_information.past_frequency;
+    for (const auto& column_use : query_information.column_uses) {
+      benefits[column_use.candidate] += _benefit(column_use) * static_cast<double>(frequency);
+    }
+  }
+
+  auto& storage_manager = StorageManager::get();
+
+  auto assessments = std::vector<CandidateAssessment>{};
+  for (const auto& [candidate, benefit] : benefits) {
+    const auto& table_name = candidate.first;
+    const auto column_id = candidate.second;
+    if (!storage_manager.has_table(table_name)) continue;
+
+    const auto table = storage_manager.get_table(table_name);
+    if (static_cast<size_t>(column_id) >= table->column_count()) continue;
+
+    const auto exists =
+        std::find(_created_indexes.cbegin(), _created_indexes.cend(), candidate) != _created_indexes.cend();
+    if (!exists) {
+      // Leave columns alone that already have an index that we did not create
+      const auto index_infos = table->get_indexes();
+      const auto has_other_index = std::any_of(index_infos.cbegin(), index_infos.cend(), [&](const auto& index_info) {
+        return index_info.column_ids.front() == column_id;
+      });
+      if (has_other_index) continue;
+    }
+
+    const auto memory_cost = exists ? std::optional<size_t>{_measure_memory_cost(candidate)}
+                                    : _estimate_memory_cost(candidate);
+    if (!memory_cost) continue;
+
+    assessments.emplace_back(CandidateAssessment{candidate, benefit, *memory_cost, exists});
+  }
+
+  std::sort(assessments.begin(), assessments.end(), [](const auto& lhs, const auto& rhs) {
+    const auto lhs_benefit_per_byte = lhs.benefit / static_cast<double>(std::max(lhs.memory_cost, size_t{1}));
+    const auto rhs_benefit_per_byte = rhs.benefit / static_cast<double>(std::max(rhs.memory_cost, size_t{1}));
+    return lhs_benefit_per_byte > rhs_benefit_per_byte;
+  });
+
+  return assessments;
+}
+
+EXPORT_PLUGIN(IndexAdvisorPlugin)
+
+}  // namespace opossum
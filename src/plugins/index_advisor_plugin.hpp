@@ -0,0 +1,122 @@
+#pragma once
+
+#include <chrono>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "types.hpp"
+#include "utils/abstract_plugin.hpp"
+#include "utils/pausable_loop_thread.hpp"
+#include "utils/singleton.hpp"
+
+namespace opossum {
+
+class AbstractOperator;
+
+/**
+ * The IndexAdvisorPlugin creates and drops GroupKeyIndexes (see Table::create_index) based on the recorded workload.
+ *
+ * Periodically, it walks the physical plans in the SQLPhysicalPlanCache and collects the columns of stored tables
+ * that are scanned (TableScan, IndexScan) or used as the indexed side of a JoinIndex. The selectivity of a scan is
+ * taken from the OperatorPerformanceData of the operator and its input. Each use is weighed by the number of times the
+ * query was requested from the cache.
+ *
+ * The benefit of an index on a column is the number of rows that a scan no longer has to look at, summed up over all
+ * uses. Like the IndexScanRule, we only count scans that are selective enough and read enough rows for an index to
+ * pay off. Joins only count when they were executed as JoinIndex, as no other join uses chunk indexes.
+ *
+ * The candidates are then picked greedily by their benefit per byte until the memory budget is exhausted. Indexes of
+ * picked candidates are created, indexes that were created by the plugin before but are no longer picked are dropped.
+ * Indexes created by others are never touched. As the optimizer only considers indexes while planning, the plan
+ * caches are cleared whenever an index was created or dropped. The collected workload is kept by the plugin.
+ *
+ * Only columns that are dictionary-encoded in all immutable chunks are considered, as the GroupKeyIndex requires that.
+ * The plugin changes the indexes of tables while queries and Inserts might be running. Table::create_index() and
+ * Table::remove_index() allow for that, as the Chunks replace their index lists atomically (see Chunk::indices()).
+ */
+class IndexAdvisorPlugin : public AbstractPlugin, public Singleton<IndexAdvisorPlugin> {
+ public:
+  // A column of a stored table
+  using IndexCandidate = std::pair<std::string, ColumnID>;
+
+  struct CandidateAssessment {
+    IndexCandidate candidate;
+
+    // Rows that are not read anymore if the index exists, summed up over all uses
+    double benefit{0.0};
+
+    // Estimated for new indexes, measured for existing ones
+    size_t memory_cost{0};
+
+    bool exists{false};
+  };
+
+  static constexpr auto DEFAULT_MEMORY_BUDGET = size_t{256'000'000};
+  static constexpr auto DEFAULT_TUNING_INTERVAL = std::chrono::milliseconds{10'000};
+
+  const std::string description() const final;
+
+  void start() final;
+
+  void stop() final;
+
+  void set_memory_budget(const size_t memory_budget);
+  size_t memory_budget() const;
+
+  // Collects the workload from the plan cache and creates/drops indexes. Called periodically once the plugin started.
+  void tune();
+
+  // Collects the workload from the plan cache and assesses all candidates, sorted by their benefit per byte
+  std::vector<CandidateAssessment> assess_candidates();
+
+ protected:
+  friend class Singleton<IndexAdvisorPlugin>;
+
+  IndexAdvisorPlugin() = default;
+
+  // A single use of a column by an operator of a cached plan
+  struct ColumnUse {
+    IndexCandidate candidate;
+    size_t input_row_count{0};
+    size_t output_row_count{0};
+    bool is_join{false};
+  };
+
+  struct QueryInformation {
+    std::vector<ColumnUse> column_uses;
+
+    // Frequency of the query in the plan cache. Once the plugin clears the cache, the frequency is moved to
+    // past_frequency, as the cache starts counting from zero again.
+    size_t frequency{0};
+    size_t past_frequency{0};
+  };
+
+  void _collect_workload();
+  static void _collect_column_uses(const std::shared_ptr<const AbstractOperator>& op,
+                                   std::vector<ColumnUse>& column_uses);
+
+  static double _benefit(const ColumnUse& column_use);
+  static std::optional<size_t> _estimate_memory_cost(const IndexCandidate& candidate);
+  static size_t _measure_memory_cost(const IndexCandidate& candidate);
+
+  std::vector<CandidateAssessment> _assess_candidates() const;
+
+  std::unique_ptr<PausableLoopThread> _loop_thread;
+  size_t _memory_budget{DEFAULT_MEMORY_BUDGET};
+
+  // Guards the workload, the set of created indexes, and the budget
+  mutable std::mutex _mutex;
+
+  // Serializes tune(), which does not hold _mutex while it creates and drops indexes
+  std::mutex _tuning_mutex;
+
+  std::map<std::string, QueryInformation> _workload;
+  std::vector<IndexCandidate> _created_indexes;
+};
+
+}  // namespace opossum
@@ -1,3 +1,6 @@
+#include <algorithm>
+#include <tuple>
+
 #include "base_test.hpp"
 
 #include "cache/cache.hpp"
@@ -253,6 +256,22 @@ TEST(CachePolicyTest, Iterators) {
   ASSERT_EQ(value_sum, 200);
 }
 
+TEST(CachePolicyTest, Snapshot) {
+  Cache<int, int> cache(3);
+
+  cache.set(1, 100);
+  cache.set(2, 200);
+  cache.get_entry(2);
+
+  auto entries = cache.snapshot();
+  std::sort(entries.begin(), entries.end());
+
+  // The default GDFS cache tracks how often each entry was accessed
+  ASSERT_EQ(entries.size(), 2u);
+  EXPECT_EQ(entries[0], std::make_tuple(1, 100, size_t{1}));
+  EXPECT_EQ(entries[1], std::make_tuple(2, 200, size_t{2}));
+}
+
 template <typename T>
 class CacheTest : public BaseTest {};
 
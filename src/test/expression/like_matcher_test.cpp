@@ -1,4 +1,6 @@
+#include <optional>
 #include <string>
+#include <utility>
 
 #include "gtest/gtest.h"
 
@@ -54,4 +56,67 @@ TEST_F(LikeMatcherTest, NotMatching) {
   EXPECT_FALSE(match("Hello", "He_o"));
 }
 
+TEST_F(LikeMatcherTest, GeneralPattern) {
+  EXPECT_TRUE(match("", ""));
+  EXPECT_FALSE(match("a", ""));
+  EXPECT_TRUE(match("", "%%"));
+  EXPECT_FALSE(match("xaxbx", "%a%b"));
+  EXPECT_TRUE(match("xaxb", "%a%b"));
+  EXPECT_TRUE(match("abc", "___"));
+  EXPECT_FALSE(match("abcd", "___"));
+  EXPECT_TRUE(match("abb", "ab%b"));
+  EXPECT_FALSE(match("ab", "ab%b"));
+  EXPECT_TRUE(match("special requests", "%special%requests"));
+  EXPECT_TRUE(match("forest green", "forest%"));
+  EXPECT_TRUE(match("MEDIUM POLISHED COPPER", "MEDIUM POLISHED%"));
+  EXPECT_TRUE(match("xxaxbxxcxdx", "%a_b%c_d%"));
+  EXPECT_FALSE(match("xxaxbxxcxdx", "%a_b%c__d%"));
+  EXPECT_TRUE(match("aab", "%a_"));
+  EXPECT_TRUE(match("abcabd", "a%_d"));
+  EXPECT_FALSE(match("abcabc", "a%_d"));
+  // Both the first and the last block have to fit into the string without overlapping
+  EXPECT_FALSE(match("aba", "aba%aba"));
+  EXPECT_TRUE(match("abaaba", "aba%aba"));
+}
+
+TEST_F(LikeMatcherTest, FindSubstring) {
+  const auto haystack = std::string{"The quick brown fox jumps over the lazy dog. The quick brown fox jumps again."};
+
+  EXPECT_EQ(LikeMatcher::find_substring(haystack, "quick"), 4u);
+  EXPECT_EQ(LikeMatcher::find_substring(haystack, "quick", 5), 49u);
+  EXPECT_EQ(LikeMatcher::find_substring(haystack, "again."), haystack.size() - 6);
+  EXPECT_EQ(LikeMatcher::find_substring(haystack, "T"), 0u);
+  EXPECT_EQ(LikeMatcher::find_substring(haystack, ""), 0u);
+  EXPECT_EQ(LikeMatcher::find_substring(haystack, "cat"), pmr_string::npos);
+  EXPECT_EQ(LikeMatcher::find_substring(haystack, "again.", haystack.size()), pmr_string::npos);
+  EXPECT_EQ(LikeMatcher::find_substring("abc", "abcd"), pmr_string::npos);
+
+  // Compare with std::string::find for all needles and offsets
+  for (auto needle_begin = size_t{0}; needle_begin < haystack.size(); needle_begin += 7) {
+    for (auto needle_size = size_t{1}; needle_size < 24 && needle_begin + needle_size <= haystack.size();
+         ++needle_size) {
+      const auto needle = haystack.substr(needle_begin, needle_size);
+      for (auto offset = size_t{0}; offset <= haystack.size(); offset += 3) {
+        EXPECT_EQ(LikeMatcher::find_substring(haystack, needle, offset), haystack.find(needle, offset));
+      }
+    }
+  }
+}
+
+TEST_F(LikeMatcherTest, PrefixBounds) {
+  using Bounds = std::pair<pmr_string, std::optional<pmr_string>>;
+
+  EXPECT_EQ(LikeMatcher::prefix_bounds("abc%"), Bounds("abc", pmr_string{"abd"}));
+  EXPECT_EQ(LikeMatcher::prefix_bounds("a%"), Bounds("a", pmr_string{"b"}));
+  EXPECT_EQ(LikeMatcher::prefix_bounds("ab\xFF%"), Bounds("ab\xFF", pmr_string{"ac"}));
+  EXPECT_EQ(LikeMatcher::prefix_bounds("\xFF\xFF%"), Bounds("\xFF\xFF", std::nullopt));
+
+  // Only patterns that select a range of strings have bounds
+  EXPECT_EQ(LikeMatcher::prefix_bounds("%"), std::nullopt);
+  EXPECT_EQ(LikeMatcher::prefix_bounds("abc"), std::nullopt);
+  EXPECT_EQ(LikeMatcher::prefix_bounds("%abc"), std::nullopt);
+  EXPECT_EQ(LikeMatcher::prefix_bounds("a_c%"), std::nullopt);
+  EXPECT_EQ(LikeMatcher::prefix_bounds("ab%c%"), std::nullopt);
+}
+
 }  // namespace opossum
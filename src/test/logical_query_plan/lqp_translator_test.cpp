@@ -44,6 +44,7 @@
 #include "operators/table_scan.hpp"
 #include "operators/union_positions.hpp"
 #include "storage/chunk_encoder.hpp"
+#include "storage/index/group_key/composite_group_key_index.hpp"
 #include "storage/index/group_key/group_key_index.hpp"
 #include "storage/prepared_plan.hpp"
 #include "storage/storage_manager.hpp"
@@ -471,6 +472,24 @@ TEST_F(LQPTranslatorTest, PredicateNodeIndexScan) {
   EXPECT_EQ(*table_scan_op->predicate(), *equals_(b, 42));
 }
 
+TEST_F(LQPTranslatorTest, PredicateNodeIndexScanWithLossyValue) {
+  const auto stored_table_node = StoredTableNode::make("int_float_chunked");
+
+  const auto table = StorageManager::get().get_table("int_float_chunked");
+  table->get_chunk(ChunkID{0})->create_index<GroupKeyIndex>(std::vector<ColumnID>{ColumnID{0}});
+
+  // 3.5 cannot be cast to the int column without loss, so it is evaluated by a TableScan
+  auto predicate_node = PredicateNode::make(equals_(stored_table_node->get_column("a"), 3.5));
+  predicate_node->set_left_input(stored_table_node);
+  predicate_node->scan_type = ScanType::IndexScan;
+  const auto op = LQPTranslator{}.translate_node(predicate_node);
+
+  const auto table_scan_op = std::dynamic_pointer_cast<const TableScan>(op);
+  ASSERT_TRUE(table_scan_op);
+  const auto a = PQPColumnExpression::from_table(*table, "a");
+  EXPECT_EQ(*table_scan_op->predicate(), *equals_(a, 3.5));
+}
+
 TEST_F(LQPTranslatorTest, PredicateNodeBinaryIndexScan) {
   /**
    * Build LQP and translate to PQP
@@ -506,9 +525,7 @@ TEST_F(LQPTranslatorTest, PredicateNodeBinaryIndexScan) {
   EXPECT_EQ(*table_scan_op->predicate(), *between_inclusive_(b, 42, 1337));
 }
 
-TEST_F(LQPTranslatorTest, PredicateNodeIndexScanFailsWhenNotApplicable) {
-  if (!HYRISE_DEBUG) GTEST_SKIP();
-
+TEST_F(LQPTranslatorTest, PredicateNodeIndexScanOnReferences) {
   /**
    * Build LQP and translate to PQP
    */
@@ -520,14 +537,55 @@ TEST_F(LQPTranslatorTest, PredicateNodeIndexScanFailsWhenNotApplicable) {
   table->get_chunk(index_chunk_ids[0])->create_index<GroupKeyIndex>(index_column_ids);
   table->get_chunk(index_chunk_ids[1])->create_index<GroupKeyIndex>(index_column_ids);
 
-  auto predicate_node = PredicateNode::make(equals_(stored_table_node->get_column("b"), 42));
+  auto predicate_node = PredicateNode::make(less_than_(stored_table_node->get_column("a"), 42));
   predicate_node->set_left_input(stored_table_node);
-  auto predicate_node2 = PredicateNode::make(less_than_(stored_table_node->get_column("a"), 42));
+  auto predicate_node2 = PredicateNode::make(equals_(stored_table_node->get_column("b"), placeholder_(ParameterID{0})));
   predicate_node2->set_left_input(predicate_node);
-
-  // The optimizer should not set this ScanType in this situation
   predicate_node2->scan_type = ScanType::IndexScan;
-  EXPECT_THROW(LQPTranslator{}.translate_node(predicate_node2), std::logic_error);
+
+  const auto op = LQPTranslator{}.translate_node(predicate_node2);
+
+  /**
+   * Check PQP - on a reference table, the IndexScan handles chunks without an index itself
+   */
+  const auto index_scan_op = std::dynamic_pointer_cast<const IndexScan>(op);
+  ASSERT_TRUE(index_scan_op);
+  EXPECT_TRUE(get_included_chunk_ids(index_scan_op).empty());
+  EXPECT_EQ(index_scan_op->input_left()->type(), OperatorType::TableScan);
+}
+
+TEST_F(LQPTranslatorTest, PredicateNodeCompositeIndexScan) {
+  /**
+   * Build LQP and translate to PQP
+   */
+  const auto stored_table_node = StoredTableNode::make("int_float_chunked");
+
+  const auto table = StorageManager::get().get_table("int_float_chunked");
+  std::vector<ColumnID> index_column_ids = {ColumnID{0}, ColumnID{1}};
+  std::vector<ChunkID> index_chunk_ids = {ChunkID{0}, ChunkID{2}};
+  table->get_chunk(index_chunk_ids[0])->create_index<CompositeGroupKeyIndex>(index_column_ids);
+  table->get_chunk(index_chunk_ids[1])->create_index<CompositeGroupKeyIndex>(index_column_ids);
+
+  const auto a = stored_table_node->get_column("a");
+  const auto b = stored_table_node->get_column("b");
+  auto predicate_node = PredicateNode::make(and_(equals_(a, 42), equals_(b, 3.5f)));
+  predicate_node->set_left_input(stored_table_node);
+  predicate_node->scan_type = ScanType::IndexScan;
+  const auto op = LQPTranslator{}.translate_node(predicate_node);
+
+  /**
+   * Check PQP
+   */
+  const auto union_op = std::dynamic_pointer_cast<UnionPositions>(op);
+  ASSERT_TRUE(union_op);
+
+  const auto index_scan_op = std::dynamic_pointer_cast<const IndexScan>(op->input_left());
+  ASSERT_TRUE(index_scan_op);
+  EXPECT_EQ(get_included_chunk_ids(index_scan_op), index_chunk_ids);
+
+  const auto table_scan_op = std::dynamic_pointer_cast<const TableScan>(op->input_right());
+  ASSERT_TRUE(table_scan_op);
+  EXPECT_EQ(get_excluded_chunk_ids(table_scan_op), index_chunk_ids);
 }
 
 TEST_F(LQPTranslatorTest, ProjectionNode) {
@@ -0,0 +1,122 @@
+#include <memory>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "expression/expression_functional.hpp"
+#include "logical_query_plan/pipeline_aware_lqp_translator.hpp"
+#include "logical_query_plan/predicate_node.hpp"
+#include "logical_query_plan/sort_node.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "logical_query_plan/union_node.hpp"
+#include "logical_query_plan/validate_node.hpp"
+#include "operators/get_table.hpp"
+#include "operators/pipeline.hpp"
+#include "operators/sort.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/validate.hpp"
+#include "sql/sql_pipeline_builder.hpp"
+#include "storage/storage_manager.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class PipelineAwareLQPTranslatorTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    StorageManager::get().add_table("int_int_int", load_table("resources/test_data/tbl/int_int_int.tbl", 2));
+
+    stored_table_node = StoredTableNode::make("int_int_int");
+    a = stored_table_node->get_column("a");
+    b = stored_table_node->get_column("b");
+  }
+
+  std::shared_ptr<StoredTableNode> stored_table_node;
+  LQPColumnReference a, b;
+};
+
+TEST_F(PipelineAwareLQPTranslatorTest, PipelinesPredicatesAndValidate) {
+  // clang-format off
+  const auto lqp =
+  PredicateNode::make(greater_than_(a, 9),
+    PredicateNode::make(equals_(b, 10),
+      ValidateNode::make(
+        stored_table_node)));
+  // clang-format on
+
+  const auto pipeline = std::dynamic_pointer_cast<const Pipeline>(PipelineAwareLQPTranslator{}.translate_node(lqp));
+  ASSERT_TRUE(pipeline);
+  EXPECT_EQ(pipeline->input_left()->type(), OperatorType::GetTable);
+
+  // The stages are ordered from the bottom to the top of the LQP
+  const auto& stages = pipeline->stages();
+  ASSERT_EQ(stages.size(), 3u);
+  EXPECT_EQ(stages[0]->type(), OperatorType::Validate);
+  const auto table_scan_b = std::dynamic_pointer_cast<const TableScan>(stages[1]);
+  const auto table_scan_a = std::dynamic_pointer_cast<const TableScan>(stages[2]);
+  ASSERT_TRUE(table_scan_a && table_scan_b);
+  EXPECT_EQ(table_scan_b->predicate()->as_column_name(), "b = 10");
+  EXPECT_EQ(table_scan_a->predicate()->as_column_name(), "a > 9");
+}
+
+TEST_F(PipelineAwareLQPTranslatorTest, SingleNodeIsNotPipelined) {
+  const auto lqp = PredicateNode::make(greater_than_(a, 9), stored_table_node);
+
+  const auto pqp = PipelineAwareLQPTranslator{}.translate_node(lqp);
+  EXPECT_EQ(pqp->type(), OperatorType::TableScan);
+  EXPECT_EQ(pqp->input_left()->type(), OperatorType::GetTable);
+}
+
+TEST_F(PipelineAwareLQPTranslatorTest, PipelineBreakers) {
+  // clang-format off
+  const auto lqp =
+  PredicateNode::make(greater_than_(a, 9),
+    SortNode::make(expression_vector(a), std::vector<OrderByMode>{OrderByMode::Ascending},
+      PredicateNode::make(equals_(b, 10),
+        PredicateNode::make(less_than_(a, 11),
+          stored_table_node))));
+  // clang-format on
+
+  const auto pqp = PipelineAwareLQPTranslator{}.translate_node(lqp);
+
+  // The TableScan above the Sort has no StoredTableNode as its input
+  EXPECT_EQ(pqp->type(), OperatorType::TableScan);
+  EXPECT_EQ(pqp->input_left()->type(), OperatorType::Sort);
+
+  const auto pipeline = std::dynamic_pointer_cast<const Pipeline>(pqp->input_left()->input_left());
+  ASSERT_TRUE(pipeline);
+  EXPECT_EQ(pipeline->stages().size(), 2u);
+}
+
+TEST_F(PipelineAwareLQPTranslatorTest, SharedNodesAreNotFused) {
+  // The shared predicate would be executed twice if it was part of both pipelines
+  const auto shared_predicate_node = PredicateNode::make(less_than_(a, 11), stored_table_node);
+
+  // clang-format off
+  const auto lqp =
+  UnionNode::make(UnionMode::Positions,
+    PredicateNode::make(equals_(b, 10), shared_predicate_node),
+    PredicateNode::make(greater_than_(a, 9), shared_predicate_node));
+  // clang-format on
+
+  const auto pqp = PipelineAwareLQPTranslator{}.translate_node(lqp);
+
+  ASSERT_EQ(pqp->input_left()->type(), OperatorType::TableScan);
+  ASSERT_EQ(pqp->input_right()->type(), OperatorType::TableScan);
+  EXPECT_EQ(pqp->input_left()->input_left(), pqp->input_right()->input_left());
+  EXPECT_EQ(pqp->input_left()->input_left()->type(), OperatorType::TableScan);
+}
+
+TEST_F(PipelineAwareLQPTranslatorTest, SameResultAsLQPTranslator) {
+  const auto sql = "SELECT * FROM int_int_int WHERE a > 9 AND b = 10 AND c < 11";
+
+  auto pipelined_sql_pipeline =
+      SQLPipelineBuilder{sql}.with_lqp_translator(std::make_shared<PipelineAwareLQPTranslator>()).create_pipeline();
+  auto sql_pipeline = SQLPipelineBuilder{sql}.create_pipeline();
+
+  EXPECT_TABLE_EQ_ORDERED(pipelined_sql_pipeline.get_result_table(), sql_pipeline.get_result_table());
+}
+
+}  // namespace opossum
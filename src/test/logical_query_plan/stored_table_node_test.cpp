@@ -8,6 +8,7 @@
 #include "logical_query_plan/lqp_utils.hpp"
 #include "logical_query_plan/stored_table_node.hpp"
 #include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
 
 namespace opossum {
 
@@ -49,6 +50,18 @@ TEST_F(StoredTableNodeTest, Equals) {
 
 TEST_F(StoredTableNodeTest, Copy) { EXPECT_EQ(*_stored_table_node->deep_copy(), *_stored_table_node); }
 
+TEST_F(StoredTableNodeTest, Table) {
+  EXPECT_EQ(_stored_table_node->table(), StorageManager::get().get_table("t_a"));
+
+  // A meta table is generated once per node and shared with its copies
+  const auto meta_table_node = StoredTableNode::make("meta_indexes");
+  const auto meta_table = meta_table_node->table();
+  EXPECT_TRUE(meta_table->table_statistics());
+  EXPECT_EQ(meta_table_node->table(), meta_table);
+  EXPECT_EQ(std::static_pointer_cast<StoredTableNode>(meta_table_node->deep_copy())->table(), meta_table);
+  EXPECT_NE(StoredTableNode::make("meta_indexes")->table(), meta_table);
+}
+
 TEST_F(StoredTableNodeTest, NodeExpressions) { ASSERT_EQ(_stored_table_node->node_expressions.size(), 0u); }
 
 }  // namespace opossum
@@ -201,6 +201,34 @@ TYPED_TEST(OperatorsAggregateTest, SingleAggregateCountDistinct) {
                     "resources/test_data/tbl/aggregateoperator/groupby_int_1gb_1agg/count_distinct.tbl", 1);
 }
 
+TYPED_TEST(OperatorsAggregateTest, SingleAggregateAny) {
+  // ANY() is only used for columns that are functionally dependent on the GROUP BY columns
+  TableColumnDefinitions column_definitions;
+  column_definitions.emplace_back("a", DataType::Int);
+  column_definitions.emplace_back("b", DataType::String);
+
+  const auto table = std::make_shared<Table>(column_definitions, TableType::Data, 2);
+  table->append({1, "one"});
+  table->append({2, "two"});
+  table->append({1, "one"});
+  table->append({3, "three"});
+  table->append({2, "two"});
+
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  const auto aggregate = std::make_shared<TypeParam>(
+      table_wrapper, std::vector<AggregateColumnDefinition>{{ColumnID{1}, AggregateFunction::Any}},
+      std::vector<ColumnID>{ColumnID{0}});
+  aggregate->execute();
+
+  const auto expected_result = std::make_shared<Table>(column_definitions, TableType::Data);
+  expected_result->append({1, "one"});
+  expected_result->append({2, "two"});
+  expected_result->append({3, "three"});
+  EXPECT_TABLE_EQ_UNORDERED(aggregate->get_output(), expected_result);
+}
+
 TYPED_TEST(OperatorsAggregateTest, StringSingleAggregateMax) {
   this->test_output(this->_table_wrapper_1_1_string, {{ColumnID{1}, AggregateFunction::Max}}, {ColumnID{0}},
                     "resources/test_data/tbl/aggregateoperator/groupby_string_1gb_1agg/max.tbl", 1);
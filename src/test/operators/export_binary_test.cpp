@@ -10,9 +10,14 @@
 
 #include "import_export/binary.hpp"
 #include "operators/export_binary.hpp"
+#include "operators/import_binary.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
 #include "storage/chunk_encoder.hpp"
+#include "storage/index/adaptive_radix_tree/adaptive_radix_tree_index.hpp"
+#include "storage/index/b_tree/b_tree_index.hpp"
+#include "storage/index/group_key/composite_group_key_index.hpp"
+#include "storage/index/group_key/group_key_index.hpp"
 #include "storage/storage_manager.hpp"
 #include "storage/table.hpp"
 #include "utils/assert.hpp"
@@ -371,4 +376,107 @@ TEST_F(OperatorsExportBinaryTest, AllTypesDictionaryNullValues) {
   EXPECT_TRUE(compare_files("resources/test_data/bin/AllTypesDictionaryNullValues.bin", filename));
 }
 
+TEST_F(OperatorsExportBinaryTest, Indexes) {
+  TableColumnDefinitions column_definitions;
+  column_definitions.emplace_back("a", DataType::Int);
+  column_definitions.emplace_back("b", DataType::String);
+
+  table = std::make_shared<Table>(column_definitions, TableType::Data, 3);
+  for (const auto value : {4, 2, 4, 1, 3, 1, 2}) {
+    table->append({value, pmr_string{"v" + std::to_string(value)}});
+  }
+  ChunkEncoder::encode_chunks(table, {ChunkID{0}, ChunkID{1}}, EncodingType::Dictionary);
+
+  table->create_index<GroupKeyIndex>({ColumnID{0}}, "a_group_key");
+  table->create_index<AdaptiveRadixTreeIndex>({ColumnID{1}});
+  table->create_table_hash_index(ColumnID{1}, "b_hash");
+  table->create_index<BTreeIndex>({ColumnID{0}}, "a_b_tree");
+
+  ExportBinary::write_binary(*table, filename);
+  const auto imported_table = ImportBinary::read_binary(filename);
+  EXPECT_TABLE_EQ_ORDERED(imported_table, table);
+
+  const auto index_infos = imported_table->get_indexes();
+  ASSERT_EQ(index_infos.size(), 4u);
+  EXPECT_EQ(index_infos[0].name, "a_group_key");
+  EXPECT_EQ(index_infos[0].type, SegmentIndexType::GroupKey);
+  EXPECT_EQ(index_infos[0].column_ids, std::vector<ColumnID>{ColumnID{0}});
+  EXPECT_EQ(index_infos[1].type, SegmentIndexType::AdaptiveRadixTree);
+  EXPECT_EQ(index_infos[1].column_ids, std::vector<ColumnID>{ColumnID{1}});
+  EXPECT_EQ(index_infos[2].name, "b_hash");
+  EXPECT_EQ(index_infos[2].type, SegmentIndexType::TableHash);
+  EXPECT_TRUE(imported_table->get_table_hash_index(ColumnID{1}));
+  EXPECT_EQ(index_infos[3].type, SegmentIndexType::BTree);
+
+  // The chunk indexes are restored with the same structures
+  for (ChunkID chunk_id{0}; chunk_id < ChunkID{2}; ++chunk_id) {
+    const auto chunk = imported_table->get_chunk(chunk_id);
+    const auto index = std::dynamic_pointer_cast<GroupKeyIndex>(chunk->get_index(SegmentIndexType::GroupKey,
+                                                                                 std::vector<ColumnID>{ColumnID{0}}));
+    const auto original_index = std::dynamic_pointer_cast<GroupKeyIndex>(
+        table->get_chunk(chunk_id)->get_index(SegmentIndexType::GroupKey, std::vector<ColumnID>{ColumnID{0}}));
+    ASSERT_TRUE(index);
+    EXPECT_EQ(index->index_offsets(), original_index->index_offsets());
+    EXPECT_EQ(index->index_postings(), original_index->index_postings());
+    EXPECT_EQ(std::vector<ChunkOffset>(index->lower_bound({4}), index->upper_bound({4})),
+              std::vector<ChunkOffset>(original_index->lower_bound({4}), original_index->upper_bound({4})));
+
+    const auto art_index = std::dynamic_pointer_cast<AdaptiveRadixTreeIndex>(
+        chunk->get_index(SegmentIndexType::AdaptiveRadixTree, std::vector<ColumnID>{ColumnID{1}}));
+    const auto original_art_index = std::dynamic_pointer_cast<AdaptiveRadixTreeIndex>(
+        table->get_chunk(chunk_id)->get_index(SegmentIndexType::AdaptiveRadixTree, std::vector<ColumnID>{ColumnID{1}}));
+    ASSERT_TRUE(art_index);
+    EXPECT_EQ(art_index->chunk_offsets(), original_art_index->chunk_offsets());
+    EXPECT_EQ(art_index->flat_tree().child_counts, original_art_index->flat_tree().child_counts);
+    EXPECT_EQ(art_index->flat_tree().partial_keys, original_art_index->flat_tree().partial_keys);
+    EXPECT_EQ(art_index->flat_tree().leaf_ends, original_art_index->flat_tree().leaf_ends);
+    EXPECT_EQ(std::vector<ChunkOffset>(art_index->lower_bound({pmr_string{"v2"}}),
+                                       art_index->upper_bound({pmr_string{"v4"}})),
+              std::vector<ChunkOffset>(original_art_index->lower_bound({pmr_string{"v2"}}),
+                                       original_art_index->upper_bound({pmr_string{"v4"}})));
+
+    const auto b_tree_index = std::dynamic_pointer_cast<BTreeIndex>(
+        chunk->get_index(SegmentIndexType::BTree, std::vector<ColumnID>{ColumnID{0}}));
+    const auto original_b_tree_index = std::dynamic_pointer_cast<BTreeIndex>(
+        table->get_chunk(chunk_id)->get_index(SegmentIndexType::BTree, std::vector<ColumnID>{ColumnID{0}}));
+    ASSERT_TRUE(b_tree_index);
+    EXPECT_EQ(b_tree_index->chunk_offsets(), original_b_tree_index->chunk_offsets());
+    EXPECT_EQ(b_tree_index->key_positions(), original_b_tree_index->key_positions());
+    EXPECT_EQ(std::vector<ChunkOffset>(b_tree_index->lower_bound({2}), b_tree_index->upper_bound({3})),
+              std::vector<ChunkOffset>(original_b_tree_index->lower_bound({2}),
+                                       original_b_tree_index->upper_bound({3})));
+  }
+
+  // The last chunk was not encoded and gets delta indexes
+  EXPECT_TRUE(imported_table->get_chunk(ChunkID{2})->get_delta_index(ColumnID{0}));
+  EXPECT_TRUE(imported_table->get_chunk(ChunkID{2})->get_delta_index(ColumnID{1}));
+}
+
+TEST_F(OperatorsExportBinaryTest, IndexesOnColumnPrefixes) {
+  TableColumnDefinitions column_definitions;
+  column_definitions.emplace_back("a", DataType::Int);
+  column_definitions.emplace_back("b", DataType::Int);
+
+  table = std::make_shared<Table>(column_definitions, TableType::Data, 3);
+  for (const auto value : {4, 2, 4, 1, 3, 1}) {
+    table->append({value, value * 2});
+  }
+  ChunkEncoder::encode_chunks(table, {ChunkID{0}, ChunkID{1}}, EncodingType::Dictionary);
+
+  // The wider index comes first in the chunks, but must not be exported in place of the narrower one
+  table->create_index<CompositeGroupKeyIndex>({ColumnID{0}, ColumnID{1}}, "ab");
+  table->create_index<CompositeGroupKeyIndex>({ColumnID{0}}, "a");
+
+  ExportBinary::write_binary(*table, filename);
+  const auto imported_table = ImportBinary::read_binary(filename);
+
+  ASSERT_EQ(imported_table->get_indexes().size(), 2u);
+  for (ChunkID chunk_id{0}; chunk_id < imported_table->chunk_count(); ++chunk_id) {
+    const auto indices = imported_table->get_chunk(chunk_id)->get_indices(std::vector<ColumnID>{ColumnID{0}});
+    ASSERT_EQ(indices.size(), 2u);
+    EXPECT_EQ(indices[0]->get_indexed_segments().size(), 2u);
+    EXPECT_EQ(indices[1]->get_indexed_segments().size(), 1u);
+  }
+}
+
 }  // namespace opossum
@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <map>
 #include <memory>
 #include <numeric>
@@ -7,6 +8,7 @@
 #include "base_test.hpp"
 #include "gtest/gtest.h"
 
+#include "operators/get_table.hpp"
 #include "operators/index_scan.hpp"
 #include "operators/print.hpp"
 #include "operators/table_wrapper.hpp"
@@ -15,6 +17,8 @@
 #include "storage/index/b_tree/b_tree_index.hpp"
 #include "storage/index/group_key/composite_group_key_index.hpp"
 #include "storage/index/group_key/group_key_index.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/storage_manager.hpp"
 #include "storage/table.hpp"
 #include "types.hpp"
 
@@ -129,6 +133,87 @@ TYPED_TEST(OperatorsIndexScanTest, SingleColumnScanOnDataTable) {
   }
 }
 
+TYPED_TEST(OperatorsIndexScanTest, SingleColumnScanOnReferenceTable) {
+  const auto right_values = std::vector<AllTypeVariant>{AllTypeVariant{4}};
+  const auto right_values2 = std::vector<AllTypeVariant>{AllTypeVariant{9}};
+
+  // Reference all rows in reverse order, plus a NULL row that never matches
+  const auto data_table = this->_int_int->get_output();
+  const auto pos_list = std::make_shared<PosList>();
+  for (auto chunk_id = ChunkID{0}; chunk_id < data_table->chunk_count(); ++chunk_id) {
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < data_table->get_chunk(chunk_id)->size(); ++chunk_offset) {
+      pos_list->emplace_back(RowID{chunk_id, chunk_offset});
+    }
+  }
+  std::reverse(pos_list->begin(), pos_list->end());
+  pos_list->emplace_back(NULL_ROW_ID);
+
+  auto reference_table = std::make_shared<Table>(data_table->column_definitions(), TableType::References);
+  reference_table->append_chunk({std::make_shared<ReferenceSegment>(data_table, ColumnID{0}, pos_list),
+                                 std::make_shared<ReferenceSegment>(data_table, ColumnID{1}, pos_list)});
+  auto references = std::make_shared<TableWrapper>(reference_table);
+  references->execute();
+
+  std::map<PredicateCondition, std::vector<AllTypeVariant>> tests;
+  tests[PredicateCondition::Equals] = {104, 104};
+  tests[PredicateCondition::NotEquals] = {100, 102, 106, 108, 110, 112, 100, 102, 106, 108, 110, 112};
+  tests[PredicateCondition::LessThan] = {100, 102, 100, 102};
+  tests[PredicateCondition::GreaterThanEquals] = {104, 106, 108, 110, 112, 104, 106, 108, 110, 112};
+  tests[PredicateCondition::BetweenInclusive] = {104, 106, 108, 104, 106, 108};
+  tests[PredicateCondition::BetweenExclusive] = {106, 108, 106, 108};
+
+  for (const auto& test : tests) {
+    auto scan = std::make_shared<IndexScan>(references, this->_index_type, this->_column_ids, test.first, right_values,
+                                            right_values2);
+    scan->execute();
+
+    this->ASSERT_COLUMN_EQ(scan->get_output(), ColumnID{1u}, test.second);
+
+    // The output references the data table directly and keeps the order of the input
+    const auto output = scan->get_output();
+    ASSERT_EQ(output->chunk_count(), 1u);
+    const auto output_segment =
+        std::dynamic_pointer_cast<const ReferenceSegment>(output->get_chunk(ChunkID{0})->get_segment(ColumnID{0}));
+    ASSERT_TRUE(output_segment);
+    EXPECT_EQ(output_segment->referenced_table(), data_table);
+    EXPECT_TRUE(std::is_sorted(output_segment->pos_list()->cbegin(), output_segment->pos_list()->cend(),
+                               [](const auto& lhs, const auto& rhs) { return rhs < lhs; }));
+  }
+}
+
+TYPED_TEST(OperatorsIndexScanTest, ScanWithParameters) {
+  const auto right_values = std::vector<AllParameterVariant>{ParameterID{0}};
+  const auto right_values2 = std::vector<AllParameterVariant>{ParameterID{1}};
+
+  // Parameters have to be set before the execution
+  auto scan_without_parameters = std::make_shared<IndexScan>(
+      this->_int_int, this->_index_type, this->_column_ids, PredicateCondition::Equals, right_values);
+  EXPECT_THROW(scan_without_parameters->execute(), std::logic_error);
+
+  auto scan = std::make_shared<IndexScan>(this->_int_int, this->_index_type, this->_column_ids,
+                                          PredicateCondition::BetweenInclusive, right_values, right_values2);
+  scan->set_parameters({{ParameterID{0}, AllTypeVariant{4}}, {ParameterID{1}, AllTypeVariant{9}}});
+  scan->execute();
+
+  this->ASSERT_COLUMN_EQ(scan->get_output(), ColumnID{1u}, {104, 106, 108, 104, 106, 108});
+
+  // Parameters that cannot be cast to the column type without loss are compared without the index
+  auto scan_fraction = std::make_shared<IndexScan>(this->_int_int, this->_index_type, this->_column_ids,
+                                                   PredicateCondition::BetweenInclusive, right_values, right_values2);
+  scan_fraction->set_parameters({{ParameterID{0}, AllTypeVariant{3.5}}, {ParameterID{1}, AllTypeVariant{9.5f}}});
+  scan_fraction->execute();
+
+  this->ASSERT_COLUMN_EQ(scan_fraction->get_output(), ColumnID{1u}, {104, 106, 108, 104, 106, 108});
+
+  // Comparisons with NULL never match
+  auto scan_null = std::make_shared<IndexScan>(this->_int_int, this->_index_type, this->_column_ids,
+                                               PredicateCondition::NotEquals, right_values);
+  scan_null->set_parameters({{ParameterID{0}, NullValue{}}});
+  scan_null->execute();
+
+  EXPECT_EQ(scan_null->get_output()->row_count(), 0u);
+}
+
 TYPED_TEST(OperatorsIndexScanTest, SingleColumnScanValueGreaterThanMaxDictionaryValue) {
   const auto all_rows =
       std::vector<AllTypeVariant>{100, 102, 104, 106, 108, 110, 112, 100, 102, 104, 106, 108, 110, 112};
@@ -238,4 +323,168 @@ TYPED_TEST(OperatorsIndexScanTest, InvalidIndexTypeThrows) {
   EXPECT_THROW(scan->execute(), std::logic_error);
 }
 
+class OperatorsIndexScanTableHashTest : public BaseTest {};
+
+TEST_F(OperatorsIndexScanTableHashTest, ScanTableHashIndex) {
+  auto table = load_table("resources/test_data/tbl/int_int_shuffled.tbl", 4);
+  table->create_table_hash_index(ColumnID{0});
+  StorageManager::get().add_table("int_int", table);
+
+  const auto column_ids = std::vector<ColumnID>{ColumnID{0}};
+  const auto right_values = std::vector<AllTypeVariant>{AllTypeVariant{10}};
+
+  auto get_table = std::make_shared<GetTable>("int_int");
+  get_table->execute();
+  auto scan = std::make_shared<IndexScan>(get_table, SegmentIndexType::TableHash, column_ids,
+                                          PredicateCondition::Equals, right_values);
+  scan->execute();
+
+  const auto output = scan->get_output();
+  ASSERT_EQ(output->chunk_count(), 1u);
+  const auto pos_list = std::dynamic_pointer_cast<const ReferenceSegment>(
+                            output->get_chunk(ChunkID{0})->get_segment(ColumnID{0}))
+                            ->pos_list();
+  EXPECT_EQ(*pos_list, PosList({RowID{ChunkID{0}, ChunkOffset{2}}, RowID{ChunkID{1}, ChunkOffset{2}}}));
+  EXPECT_EQ(output->get_value<int32_t>(ColumnID{1}, 0u), 110);
+  EXPECT_EQ(output->get_value<int32_t>(ColumnID{1}, 1u), 110);
+
+  // If GetTable omits chunks, the matches have to be mapped to the ChunkIDs of its output
+  auto get_table_pruned = std::make_shared<GetTable>("int_int");
+  get_table_pruned->set_excluded_chunk_ids({ChunkID{0}});
+  get_table_pruned->execute();
+  auto scan_pruned = std::make_shared<IndexScan>(get_table_pruned, SegmentIndexType::TableHash, column_ids,
+                                                 PredicateCondition::Equals, right_values);
+  scan_pruned->execute();
+
+  const auto output_pruned = scan_pruned->get_output();
+  ASSERT_EQ(output_pruned->chunk_count(), 1u);
+  const auto pos_list_pruned = std::dynamic_pointer_cast<const ReferenceSegment>(
+                                   output_pruned->get_chunk(ChunkID{0})->get_segment(ColumnID{0}))
+                                   ->pos_list();
+  EXPECT_EQ(*pos_list_pruned, PosList({RowID{ChunkID{0}, ChunkOffset{2}}}));
+
+  // No matches, no chunks
+  auto scan_no_match = std::make_shared<IndexScan>(get_table, SegmentIndexType::TableHash, column_ids,
+                                                   PredicateCondition::Equals, std::vector<AllTypeVariant>{5});
+  scan_no_match->execute();
+  EXPECT_EQ(scan_no_match->get_output()->chunk_count(), 0u);
+
+  // Only point lookups are supported
+  auto scan_less_than = std::make_shared<IndexScan>(get_table, SegmentIndexType::TableHash, column_ids,
+                                                    PredicateCondition::LessThan, right_values);
+  EXPECT_THROW(scan_less_than->execute(), std::logic_error);
+}
+
+class OperatorsIndexScanReferenceTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _data_table = load_table("resources/test_data/tbl/int_int_shuffled.tbl", 7);
+    ChunkEncoder::encode_all_chunks(_data_table);
+
+    const auto pos_list = std::make_shared<PosList>();
+    for (auto chunk_id = ChunkID{0}; chunk_id < _data_table->chunk_count(); ++chunk_id) {
+      const auto chunk_size = _data_table->get_chunk(chunk_id)->size();
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+        pos_list->emplace_back(RowID{chunk_id, chunk_offset});
+      }
+    }
+
+    auto reference_table = std::make_shared<Table>(_data_table->column_definitions(), TableType::References);
+    reference_table->append_chunk({std::make_shared<ReferenceSegment>(_data_table, ColumnID{0}, pos_list),
+                                   std::make_shared<ReferenceSegment>(_data_table, ColumnID{1}, pos_list)});
+    _references = std::make_shared<TableWrapper>(reference_table);
+    _references->execute();
+  }
+
+  std::shared_ptr<Table> _data_table;
+  std::shared_ptr<TableWrapper> _references;
+};
+
+TEST_F(OperatorsIndexScanReferenceTest, ReferencedChunksWithoutIndex) {
+  // Only the first chunk has an index, rows of the second chunk are compared directly
+  const auto column_ids = std::vector<ColumnID>{ColumnID{0}};
+  _data_table->get_chunk(ChunkID{0})->create_index<GroupKeyIndex>(column_ids);
+
+  auto scan = std::make_shared<IndexScan>(_references, SegmentIndexType::GroupKey, column_ids,
+                                          PredicateCondition::GreaterThan, std::vector<AllTypeVariant>{8});
+  scan->execute();
+
+  const auto output = scan->get_output();
+  ASSERT_EQ(output->row_count(), 4u);
+  EXPECT_EQ(output->get_value<int32_t>(ColumnID{1}, 0u), 110);
+  EXPECT_EQ(output->get_value<int32_t>(ColumnID{1}, 1u), 112);
+  EXPECT_EQ(output->get_value<int32_t>(ColumnID{1}, 2u), 110);
+  EXPECT_EQ(output->get_value<int32_t>(ColumnID{1}, 3u), 112);
+}
+
+TEST_F(OperatorsIndexScanReferenceTest, SingleReferencedChunk) {
+  // The input references only some rows of the first chunk, in reverse order, so that chunk's index is searched
+  const auto column_ids = std::vector<ColumnID>{ColumnID{0}};
+  _data_table->get_chunk(ChunkID{0})->create_index<GroupKeyIndex>(column_ids);
+
+  const auto pos_list = std::make_shared<PosList>();
+  for (auto chunk_offset = ChunkOffset{6}; chunk_offset > 1; --chunk_offset) {
+    pos_list->emplace_back(RowID{ChunkID{0}, chunk_offset});
+  }
+  auto reference_table = std::make_shared<Table>(_data_table->column_definitions(), TableType::References);
+  reference_table->append_chunk({std::make_shared<ReferenceSegment>(_data_table, ColumnID{0}, pos_list),
+                                 std::make_shared<ReferenceSegment>(_data_table, ColumnID{1}, pos_list)});
+  const auto references = std::make_shared<TableWrapper>(reference_table);
+  references->execute();
+
+  auto scan = std::make_shared<IndexScan>(references, SegmentIndexType::GroupKey, column_ids,
+                                          PredicateCondition::GreaterThan, std::vector<AllTypeVariant>{8});
+  scan->execute();
+
+  const auto output = scan->get_output();
+  ASSERT_EQ(output->row_count(), 3u);
+  EXPECT_EQ(output->get_value<int32_t>(ColumnID{1}, 0u), 110);
+  EXPECT_EQ(output->get_value<int32_t>(ColumnID{1}, 1u), 112);
+  EXPECT_EQ(output->get_value<int32_t>(ColumnID{1}, 2u), 110);
+}
+
+TEST_F(OperatorsIndexScanReferenceTest, SearchValuesAreCastToColumnType) {
+  const auto column_ids = std::vector<ColumnID>{ColumnID{0}};
+  _data_table->get_chunk(ChunkID{0})->create_index<GroupKeyIndex>(column_ids);
+
+  // Values of other types are cast to int, as long as nothing is lost
+  for (const auto& value : {AllTypeVariant{int64_t{8}}, AllTypeVariant{8.0f}, AllTypeVariant{8.0}}) {
+    auto scan = std::make_shared<IndexScan>(_references, SegmentIndexType::GroupKey, column_ids,
+                                            PredicateCondition::GreaterThan, std::vector<AllTypeVariant>{value});
+    scan->execute();
+    EXPECT_EQ(scan->get_output()->row_count(), 4u);
+  }
+
+  // Values that cannot be cast without loss are compared without the index
+  auto scan_fraction = std::make_shared<IndexScan>(_references, SegmentIndexType::GroupKey, column_ids,
+                                                   PredicateCondition::GreaterThan, std::vector<AllTypeVariant>{8.5f});
+  scan_fraction->execute();
+  EXPECT_EQ(scan_fraction->get_output()->row_count(), 4u);
+
+  auto scan_fraction_equals = std::make_shared<IndexScan>(_references, SegmentIndexType::GroupKey, column_ids,
+                                                          PredicateCondition::Equals, std::vector<AllTypeVariant>{8.5});
+  scan_fraction_equals->execute();
+  EXPECT_EQ(scan_fraction_equals->get_output()->row_count(), 0u);
+}
+
+TEST_F(OperatorsIndexScanReferenceTest, CompositePredicate) {
+  const auto column_ids = std::vector<ColumnID>{ColumnID{0}, ColumnID{1}};
+  _data_table->get_chunk(ChunkID{0})->create_index<CompositeGroupKeyIndex>(column_ids);
+
+  auto scan = std::make_shared<IndexScan>(_references, SegmentIndexType::CompositeGroupKey, column_ids,
+                                          PredicateCondition::Equals, std::vector<AllTypeVariant>{4, 104});
+  scan->execute();
+  EXPECT_EQ(scan->get_output()->row_count(), 2u);
+
+  auto scan_no_match = std::make_shared<IndexScan>(_references, SegmentIndexType::CompositeGroupKey, column_ids,
+                                                   PredicateCondition::Equals, std::vector<AllTypeVariant>{4, 106});
+  scan_no_match->execute();
+  EXPECT_EQ(scan_no_match->get_output()->row_count(), 0u);
+
+  // Without an index, only Equals can be evaluated for multiple columns
+  auto scan_less_than = std::make_shared<IndexScan>(_references, SegmentIndexType::CompositeGroupKey, column_ids,
+                                                    PredicateCondition::LessThan, std::vector<AllTypeVariant>{4, 104});
+  EXPECT_THROW(scan_less_than->execute(), std::logic_error);
+}
+
 }  // namespace opossum
@@ -1,3 +1,4 @@
+#include <limits>
 #include <map>
 #include <memory>
 #include <numeric>
@@ -533,4 +534,117 @@ TYPED_TEST(JoinIndexTest, LeftJoinEmptyRefSegment) {
                          JoinMode::Left, "resources/test_data/tbl/join_operators/int_join_empty_left.tbl", 1);
 }
 
+TYPED_TEST(JoinIndexTest, DuplicateProbeValuesShareLookup) {
+  TableColumnDefinitions column_definitions;
+  column_definitions.emplace_back("a", DataType::Int, true);
+
+  const auto table_left = std::make_shared<Table>(column_definitions, TableType::Data, 10);
+  for (const auto& value : std::vector<AllTypeVariant>{2, 1, 2, NullValue{}, 1, 2}) {
+    table_left->append({value});
+  }
+  const auto table_right = std::make_shared<Table>(column_definitions, TableType::Data, 2);
+  for (const auto value : {1, 2, 3}) {
+    table_right->append({value});
+  }
+  ChunkEncoder::encode_all_chunks(table_right, SegmentEncodingSpec{EncodingType::Dictionary});
+  for (ChunkID chunk_id{0}; chunk_id < table_right->chunk_count(); ++chunk_id) {
+    table_right->get_chunk(chunk_id)->template create_index<TypeParam>(std::vector<ColumnID>{ColumnID{0}});
+  }
+
+  const auto table_wrapper_left = std::make_shared<TableWrapper>(table_left);
+  const auto table_wrapper_right = std::make_shared<TableWrapper>(table_right);
+  table_wrapper_left->execute();
+  table_wrapper_right->execute();
+
+  const auto join = std::make_shared<JoinIndex>(table_wrapper_left, table_wrapper_right, JoinMode::Inner,
+                                                OperatorJoinPredicate{{ColumnID{0}, ColumnID{0}},
+                                                                      PredicateCondition::Equals});
+  join->execute();
+  EXPECT_EQ(join->get_output()->row_count(), 5u);
+
+  // NULLs are not probed, the five other values need one lookup per distinct value and right chunk
+  const auto& performance_data = static_cast<const JoinIndex::PerformanceData&>(join->performance_data());
+  EXPECT_EQ(performance_data.probe_values, 10u);
+  EXPECT_EQ(performance_data.index_lookups, 4u);
+}
+
+TYPED_TEST(JoinIndexTest, SemiAndAntiJoinWithDuplicateProbeValues) {
+  TableColumnDefinitions column_definitions;
+  column_definitions.emplace_back("a", DataType::Int);
+
+  const auto table_left = std::make_shared<Table>(column_definitions, TableType::Data, 10);
+  for (const auto value : {2, 1, 2, 4, 1, 2, 4}) {
+    table_left->append({value});
+  }
+  const auto table_right = std::make_shared<Table>(column_definitions, TableType::Data, 2);
+  for (const auto value : {1, 2, 3}) {
+    table_right->append({value});
+  }
+  ChunkEncoder::encode_all_chunks(table_right, SegmentEncodingSpec{EncodingType::Dictionary});
+  for (ChunkID chunk_id{0}; chunk_id < table_right->chunk_count(); ++chunk_id) {
+    table_right->get_chunk(chunk_id)->template create_index<TypeParam>(std::vector<ColumnID>{ColumnID{0}});
+  }
+
+  const auto table_wrapper_left = std::make_shared<TableWrapper>(table_left);
+  const auto table_wrapper_right = std::make_shared<TableWrapper>(table_right);
+  table_wrapper_left->execute();
+  table_wrapper_right->execute();
+
+  const auto predicate = OperatorJoinPredicate{{ColumnID{0}, ColumnID{0}}, PredicateCondition::Equals};
+
+  // Every left row is emitted once, no matter how many rows share its value
+  const auto semi_join =
+      std::make_shared<JoinIndex>(table_wrapper_left, table_wrapper_right, JoinMode::Semi, predicate);
+  semi_join->execute();
+  const auto semi_output = semi_join->get_output();
+  ASSERT_EQ(semi_output->row_count(), 5u);
+  for (auto row = size_t{0}; row < semi_output->row_count(); ++row) {
+    EXPECT_NE(semi_output->template get_value<int32_t>(ColumnID{0}, row), 4);
+  }
+
+  const auto anti_join =
+      std::make_shared<JoinIndex>(table_wrapper_left, table_wrapper_right, JoinMode::AntiNullAsFalse, predicate);
+  anti_join->execute();
+  const auto anti_output = anti_join->get_output();
+  ASSERT_EQ(anti_output->row_count(), 2u);
+  EXPECT_EQ(anti_output->template get_value<int32_t>(ColumnID{0}, 0u), 4);
+  EXPECT_EQ(anti_output->template get_value<int32_t>(ColumnID{0}, 1u), 4);
+}
+
+TYPED_TEST(JoinIndexTest, NanProbeValues) {
+  TableColumnDefinitions column_definitions;
+  column_definitions.emplace_back("a", DataType::Float);
+
+  const auto nan = std::numeric_limits<float>::quiet_NaN();
+  const auto table_left = std::make_shared<Table>(column_definitions, TableType::Data, 10);
+  for (const auto value : {nan, 1.0f, nan, 2.0f}) {
+    table_left->append({value});
+  }
+  const auto table_right = std::make_shared<Table>(column_definitions, TableType::Data, 10);
+  for (const auto value : {1.0f, 2.0f, 3.0f}) {
+    table_right->append({value});
+  }
+  ChunkEncoder::encode_all_chunks(table_right, SegmentEncodingSpec{EncodingType::Dictionary});
+  table_right->get_chunk(ChunkID{0})->template create_index<TypeParam>(std::vector<ColumnID>{ColumnID{0}});
+
+  const auto table_wrapper_left = std::make_shared<TableWrapper>(table_left);
+  const auto table_wrapper_right = std::make_shared<TableWrapper>(table_right);
+  table_wrapper_left->execute();
+  table_wrapper_right->execute();
+
+  // NaN is not equal to any value
+  const auto equals_join = std::make_shared<JoinIndex>(
+      table_wrapper_left, table_wrapper_right, JoinMode::Inner,
+      OperatorJoinPredicate{{ColumnID{0}, ColumnID{0}}, PredicateCondition::Equals});
+  equals_join->execute();
+  EXPECT_EQ(equals_join->get_output()->row_count(), 2u);
+
+  // ... but unequal to all of them
+  const auto not_equals_join = std::make_shared<JoinIndex>(
+      table_wrapper_left, table_wrapper_right, JoinMode::Inner,
+      OperatorJoinPredicate{{ColumnID{0}, ColumnID{0}}, PredicateCondition::NotEquals});
+  not_equals_join->execute();
+  EXPECT_EQ(not_equals_join->get_output()->row_count(), 10u);
+}
+
 }  // namespace opossum
@@ -0,0 +1,155 @@
+#include <atomic>
+#include <memory>
+#include <numeric>
+#include <thread>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "expression/expression_functional.hpp"
+#include "expression/pqp_column_expression.hpp"
+#include "operators/morsel.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "scheduler/topology.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class MorselTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // A small chunk followed by a chunk that is large enough to be split into three morsels
+    const auto column_definitions = TableColumnDefinitions{{"a", DataType::Int, false}};
+    _table = std::make_shared<Table>(column_definitions, TableType::Data, 250'000);
+
+    for (const auto chunk_size : {10, 250'000}) {
+      auto values = pmr_concurrent_vector<int32_t>(chunk_size);
+      std::iota(values.begin(), values.end(), 0);
+      _table->append_chunk({std::make_shared<ValueSegment<int32_t>>(std::move(values))});
+    }
+  }
+
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(MorselTest, SplitIntoMorsels) {
+  const auto chunk_ids = std::vector<ChunkID>{ChunkID{1}, ChunkID{0}};
+
+  const auto unsplit_morsels = split_into_morsels(*_table, chunk_ids);
+  ASSERT_EQ(unsplit_morsels.size(), 2u);
+  EXPECT_EQ(unsplit_morsels[0].chunk_id, ChunkID{1});
+  EXPECT_EQ(unsplit_morsels[0].size(), 250'000u);
+  EXPECT_EQ(unsplit_morsels[1].chunk_id, ChunkID{0});
+  EXPECT_EQ(unsplit_morsels[1].size(), 10u);
+
+  const auto morsels = split_into_morsels(*_table, chunk_ids, true);
+  ASSERT_EQ(morsels.size(), 4u);
+  auto next_offset = ChunkOffset{0};
+  for (auto morsel_idx = size_t{0}; morsel_idx < 3; ++morsel_idx) {
+    EXPECT_EQ(morsels[morsel_idx].chunk_id, ChunkID{1});
+    EXPECT_EQ(morsels[morsel_idx].begin_offset, next_offset);
+    EXPECT_LE(morsels[morsel_idx].size(), MAX_ROWS_PER_MORSEL);
+    next_offset = morsels[morsel_idx].end_offset;
+  }
+  EXPECT_EQ(next_offset, 250'000u);
+  EXPECT_EQ(morsels[3].chunk_id, ChunkID{0});
+  EXPECT_EQ(morsels[3].size(), 10u);
+}
+
+TEST_F(MorselTest, SmallInputIsProcessedOnCallingThread) {
+  Topology::use_fake_numa_topology(4, 2);
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+
+  const auto morsels = split_into_morsels(*_table, {ChunkID{0}, ChunkID{0}});
+  const auto calling_thread = std::this_thread::get_id();
+  auto processed_morsels = std::vector<size_t>{};
+  process_morsels(morsels, [&](const size_t morsel_idx) {
+    EXPECT_EQ(std::this_thread::get_id(), calling_thread);
+    processed_morsels.emplace_back(morsel_idx);
+  });
+  EXPECT_EQ(processed_morsels, std::vector<size_t>({0, 1}));
+
+  CurrentScheduler::get()->finish();
+}
+
+TEST_F(MorselTest, EachMorselIsProcessedOnce) {
+  Topology::use_fake_numa_topology(4, 2);
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+
+  const auto morsels = split_into_morsels(*_table, {ChunkID{0}, ChunkID{1}, ChunkID{0}}, true);
+  auto process_counts = std::vector<std::atomic_uint>(morsels.size());
+  process_morsels(morsels, [&](const size_t morsel_idx) { ++process_counts[morsel_idx]; });
+  for (const auto& process_count : process_counts) {
+    EXPECT_EQ(process_count, 1u);
+  }
+
+  CurrentScheduler::get()->finish();
+}
+
+TEST_F(MorselTest, MorselsKeepNodeOfChunk) {
+  Topology::use_fake_numa_topology(4, 2);
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+
+  // The node of the second chunk is unknown to the scheduler, its morsels are processed nonetheless
+  _table->get_chunk(ChunkID{0})->set_node_id(NodeID{1});
+  _table->get_chunk(ChunkID{1})->set_node_id(NodeID{100});
+
+  const auto morsels = split_into_morsels(*_table, {ChunkID{0}, ChunkID{1}}, true);
+  EXPECT_EQ(morsels.front().node_id, NodeID{1});
+  EXPECT_EQ(morsels.back().node_id, NodeID{100});
+
+  auto process_counts = std::vector<std::atomic_uint>(morsels.size());
+  process_morsels(morsels, [&](const size_t morsel_idx) { ++process_counts[morsel_idx]; });
+  for (const auto& process_count : process_counts) {
+    EXPECT_EQ(process_count, 1u);
+  }
+
+  // Chunks of the TableScan's output inherit the node of their input chunk
+  const auto table_wrapper = std::make_shared<TableWrapper>(_table);
+  table_wrapper->execute();
+  const auto a = PQPColumnExpression::from_table(*_table, "a");
+  const auto table_scan = std::make_shared<TableScan>(table_wrapper, greater_than_equals_(a, 5));
+  table_scan->execute();
+  const auto& output = table_scan->get_output();
+  EXPECT_EQ(output->get_chunk(ChunkID{0})->node_id(), NodeID{1});
+  EXPECT_EQ(output->get_chunk(ChunkID{1})->node_id(), NodeID{100});
+
+  CurrentScheduler::get()->finish();
+}
+
+TEST_F(MorselTest, TableScanSplitsLargeChunks) {
+  Topology::use_fake_numa_topology(4, 2);
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+
+  const auto table_wrapper = std::make_shared<TableWrapper>(_table);
+  table_wrapper->execute();
+  const auto a = PQPColumnExpression::from_table(*_table, "a");
+  const auto table_scan = std::make_shared<TableScan>(table_wrapper, greater_than_equals_(a, 5));
+  table_scan->execute();
+
+  // Each morsel of the large chunk results in its own output chunk
+  const auto& output = table_scan->get_output();
+  EXPECT_EQ(output->chunk_count(), 4u);
+  // The first five rows of each chunk are filtered out
+  EXPECT_EQ(output->row_count(), 5u + 249'995u);
+
+  auto value_sum = int64_t{0};
+  for (auto chunk_id = ChunkID{0}; chunk_id < output->chunk_count(); ++chunk_id) {
+    const auto& segment = *output->get_chunk(chunk_id)->get_segment(ColumnID{0});
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < segment.size(); ++chunk_offset) {
+      value_sum += boost::get<int32_t>(segment[chunk_offset]);
+    }
+  }
+  EXPECT_EQ(value_sum, int64_t{249'999} * 250'000 / 2 - 10 + (5 + 6 + 7 + 8 + 9));
+
+  CurrentScheduler::get()->finish();
+}
+
+}  // namespace opossum
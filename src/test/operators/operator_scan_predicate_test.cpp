@@ -61,6 +61,14 @@ TEST_F(OperatorScanPredicateTest, FromExpressionColumnRight) {
   EXPECT_EQ(operator_predicate_a.value, AllParameterVariant{5});
 }
 
+TEST_F(OperatorScanPredicateTest, FromExpressionPlaceholder) {
+  const auto operator_predicates =
+      OperatorScanPredicate::from_expression(*equals_(a, placeholder_(ParameterID{3})), *node);
+  ASSERT_TRUE(operator_predicates);
+  ASSERT_EQ(operator_predicates->size(), 1u);
+  EXPECT_EQ(operator_predicates->at(0), OperatorScanPredicate(ColumnID{0}, PredicateCondition::Equals, ParameterID{3}));
+}
+
 TEST_F(OperatorScanPredicateTest, SimpleBetweenInclusive) {
   const auto between_inclusive = OperatorScanPredicate::from_expression(*between_inclusive_(a, 5, 7), *node);
   ASSERT_TRUE(between_inclusive);
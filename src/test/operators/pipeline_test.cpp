@@ -0,0 +1,184 @@
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "concurrency/transaction_context.hpp"
+#include "expression/expression_functional.hpp"
+#include "expression/pqp_column_expression.hpp"
+#include "operators/pipeline.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "operators/validate.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class OperatorsPipelineTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // 20 rows in five chunks, of which the second and the fourth are dictionary encoded
+    const auto column_definitions = TableColumnDefinitions{{"a", DataType::Int, false}, {"b", DataType::Int, true}};
+    _table = std::make_shared<Table>(column_definitions, TableType::Data, 4);
+    for (auto row = 0; row < 20; ++row) {
+      _table->append({row, row % 3 == 0 ? AllTypeVariant{NullValue{}} : AllTypeVariant{row % 5}});
+    }
+    ChunkEncoder::encode_chunks(_table, {ChunkID{1}, ChunkID{3}});
+
+    _table_wrapper = std::make_shared<TableWrapper>(_table);
+    _table_wrapper->execute();
+
+    _a = PQPColumnExpression::from_table(*_table, "a");
+    _b = PQPColumnExpression::from_table(*_table, "b");
+  }
+
+  std::shared_ptr<Pipeline> create_pipeline(const std::vector<std::shared_ptr<AbstractExpression>>& predicates) const {
+    auto stages = std::vector<std::shared_ptr<AbstractOperator>>{};
+    for (const auto& predicate : predicates) {
+      stages.emplace_back(std::make_shared<TableScan>(_table_wrapper, predicate));
+    }
+    return std::make_shared<Pipeline>(_table_wrapper, stages);
+  }
+
+  // The result the Pipeline has to reproduce
+  std::shared_ptr<const Table> scan_sequentially(
+      const std::vector<std::shared_ptr<AbstractExpression>>& predicates) const {
+    auto input = std::shared_ptr<AbstractOperator>{_table_wrapper};
+    for (const auto& predicate : predicates) {
+      input = std::make_shared<TableScan>(input, predicate);
+      input->execute();
+    }
+    return input->get_output();
+  }
+
+  std::shared_ptr<Table> _table;
+  std::shared_ptr<TableWrapper> _table_wrapper;
+  std::shared_ptr<PQPColumnExpression> _a, _b;
+};
+
+TEST_F(OperatorsPipelineTest, ScansMatchTableScans) {
+  const auto predicate_chains = std::vector<std::vector<std::shared_ptr<AbstractExpression>>>{
+      {greater_than_(_a, 2), less_than_(_b, 3)},
+      {between_inclusive_(_a, 5, 14), equals_(_b, 1), less_than_(_a, 12)},
+      // Scans that fall back to the default implementation of scan_chunk_filtered()
+      {less_than_(_b, _a), is_not_null_(_b), greater_than_(add_(_a, _b), 10)},
+      {greater_than_(add_(_a, _b), 10), less_than_(_b, _a)}};
+
+  for (const auto& predicates : predicate_chains) {
+    const auto pipeline = create_pipeline(predicates);
+    pipeline->execute();
+
+    EXPECT_TABLE_EQ_ORDERED(pipeline->get_output(), scan_sequentially(predicates));
+  }
+}
+
+TEST_F(OperatorsPipelineTest, OnlyMaterializesTheLastStage) {
+  const auto pipeline = create_pipeline({greater_than_equals_(_a, 3), less_than_(_a, 17)});
+  pipeline->execute();
+
+  // Chunk 0 and chunk 4 contain one match each, the other chunks only contain matches
+  const auto& output = pipeline->get_output();
+  EXPECT_EQ(output->type(), TableType::References);
+  ASSERT_EQ(output->chunk_count(), 5u);
+  EXPECT_EQ(output->row_count(), 14u);
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < output->chunk_count(); ++chunk_id) {
+    const auto chunk = output->get_chunk(chunk_id);
+    const auto segment_a = std::dynamic_pointer_cast<const ReferenceSegment>(chunk->get_segment(ColumnID{0}));
+    const auto segment_b = std::dynamic_pointer_cast<const ReferenceSegment>(chunk->get_segment(ColumnID{1}));
+    ASSERT_TRUE(segment_a && segment_b);
+
+    // Both segments point directly into the input table and share their positions
+    EXPECT_EQ(segment_a->referenced_table(), _table);
+    EXPECT_EQ(segment_a->pos_list(), segment_b->pos_list());
+    EXPECT_TRUE(segment_a->pos_list()->references_single_chunk());
+    EXPECT_EQ(segment_a->pos_list()->common_chunk_id(), chunk_id);
+  }
+}
+
+TEST_F(OperatorsPipelineTest, EmptyResult) {
+  const auto pipeline = create_pipeline({greater_than_(_a, 5), less_than_(_a, 5)});
+  pipeline->execute();
+
+  EXPECT_EQ(pipeline->get_output()->chunk_count(), 0u);
+  EXPECT_EQ(pipeline->get_output()->column_count(), 2u);
+}
+
+TEST_F(OperatorsPipelineTest, ValidateStages) {
+  const auto table = load_table("resources/test_data/tbl/validate_input.tbl", 2u);
+  for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+    const auto chunk = table->get_chunk(chunk_id);
+    auto mvcc_data = chunk->get_scoped_mvcc_data_lock();
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk->size(); ++chunk_offset) {
+      mvcc_data->begin_cids[chunk_offset] = 0u;
+      mvcc_data->end_cids[chunk_offset] = MvccData::MAX_COMMIT_ID;
+    }
+  }
+  table->get_chunk(ChunkID{1})->get_scoped_mvcc_data_lock()->end_cids[0] = 2u;
+
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  const auto expected_result = load_table("resources/test_data/tbl/validate_output_validated_scanned.tbl", 2u);
+  const auto a = PQPColumnExpression::from_table(*table, "a");
+
+  // The Validate can run before or after the scan
+  for (const auto validate_first : {true, false}) {
+    auto stages = std::vector<std::shared_ptr<AbstractOperator>>{
+        std::make_shared<Validate>(table_wrapper),
+        std::make_shared<TableScan>(table_wrapper, greater_than_equals_(a, 2))};
+    if (!validate_first) std::swap(stages[0], stages[1]);
+
+    const auto pipeline = std::make_shared<Pipeline>(table_wrapper, stages);
+    pipeline->set_transaction_context(std::make_shared<TransactionContext>(1u, 3u));
+    pipeline->execute();
+
+    EXPECT_TABLE_EQ_UNORDERED(pipeline->get_output(), expected_result);
+  }
+
+  const auto pipeline_without_context = std::make_shared<Pipeline>(
+      table_wrapper, std::vector<std::shared_ptr<AbstractOperator>>{std::make_shared<Validate>(table_wrapper)});
+  EXPECT_THROW(pipeline_without_context->execute(), std::logic_error);
+}
+
+TEST_F(OperatorsPipelineTest, StagesHaveToOperateOnTheInput) {
+  const auto other_table_wrapper = std::make_shared<TableWrapper>(_table);
+  const auto stages = std::vector<std::shared_ptr<AbstractOperator>>{
+      std::make_shared<TableScan>(other_table_wrapper, greater_than_(_a, 2))};
+
+  EXPECT_THROW(std::make_shared<Pipeline>(_table_wrapper, stages), std::logic_error);
+  EXPECT_THROW(std::make_shared<Pipeline>(_table_wrapper, std::vector<std::shared_ptr<AbstractOperator>>{}),
+               std::logic_error);
+}
+
+TEST_F(OperatorsPipelineTest, DeepCopy) {
+  const auto predicates = std::vector<std::shared_ptr<AbstractExpression>>{greater_than_(_a, 2), less_than_(_b, 3)};
+  const auto pipeline = create_pipeline(predicates);
+
+  const auto copied_pipeline = std::dynamic_pointer_cast<Pipeline>(pipeline->deep_copy());
+  ASSERT_TRUE(copied_pipeline);
+  ASSERT_EQ(copied_pipeline->stages().size(), 2u);
+  for (const auto& stage : copied_pipeline->stages()) {
+    EXPECT_EQ(stage->input_left(), copied_pipeline->input_left());
+  }
+
+  copied_pipeline->mutable_input_left()->execute();
+  copied_pipeline->execute();
+  EXPECT_TABLE_EQ_ORDERED(copied_pipeline->get_output(), scan_sequentially(predicates));
+}
+
+TEST_F(OperatorsPipelineTest, Description) {
+  const auto pipeline = create_pipeline({greater_than_(_a, 2), less_than_(_b, 3)});
+
+  EXPECT_EQ(pipeline->description(DescriptionMode::SingleLine), "Pipeline TableScan a > 2 TableScan b < 3");
+  EXPECT_EQ(pipeline->description(DescriptionMode::MultiLine), "Pipeline\nTableScan a > 2\nTableScan b < 3");
+}
+
+}  // namespace opossum
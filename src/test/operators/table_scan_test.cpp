@@ -1,4 +1,5 @@
 #include <algorithm>
+#include <functional>
 #include <iostream>
 #include <map>
 #include <memory>
@@ -23,6 +24,7 @@
 #include "operators/table_scan/column_vs_value_table_scan_impl.hpp"
 #include "operators/table_scan/expression_evaluator_table_scan_impl.hpp"
 #include "operators/table_wrapper.hpp"
+#include "statistics/chunk_statistics/chunk_statistics.hpp"
 #include "storage/chunk_encoder.hpp"
 #include "storage/encoding_type.hpp"
 #include "storage/reference_segment.hpp"
@@ -787,6 +789,45 @@ TEST_P(OperatorsTableScanTest, ScanWithExcludedFirstChunk) {
   ASSERT_COLUMN_EQ(scan->get_output(), ColumnID{1}, expected);
 }
 
+TEST_P(OperatorsTableScanTest, OutputPreservesChunkOrder) {
+  // Every chunk of the input contains a match, so the output must have one chunk per input chunk, in input order.
+  auto scan = create_table_scan(_int_int_compressed, ColumnID{0}, PredicateCondition::GreaterThanEquals, 0);
+  scan->execute();
+
+  const auto in_table = _int_int_compressed->get_output();
+  const auto out_table = scan->get_output();
+  ASSERT_EQ(out_table->chunk_count(), in_table->chunk_count());
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < out_table->chunk_count(); ++chunk_id) {
+    const auto segment = std::dynamic_pointer_cast<const ReferenceSegment>(
+        out_table->get_chunk(chunk_id)->get_segment(ColumnID{0}));
+    ASSERT_TRUE(segment);
+    for (const auto& row_id : *segment->pos_list()) {
+      EXPECT_EQ(row_id.chunk_id, chunk_id);
+    }
+  }
+}
+
+TEST_P(OperatorsTableScanTest, OutputPreservesOrderedBy) {
+  const auto ordered_by = std::make_pair(ColumnID{0}, OrderByMode::Ascending);
+
+  auto scan_a = create_table_scan(get_int_sorted_op(), ColumnID{0}, PredicateCondition::GreaterThanEquals, 2);
+  scan_a->execute();
+
+  for (const auto& chunk : scan_a->get_output()->chunks()) {
+    EXPECT_EQ(chunk->ordered_by(), ordered_by);
+  }
+
+  // The sort order is carried through a second scan on the reference table
+  auto scan_b = create_table_scan(scan_a, ColumnID{0}, PredicateCondition::LessThan, 4);
+  scan_b->execute();
+
+  ASSERT_COLUMN_EQ(scan_b->get_output(), ColumnID{0}, {2, 2});
+  for (const auto& chunk : scan_b->get_output()->chunks()) {
+    EXPECT_EQ(chunk->ordered_by(), ordered_by);
+  }
+}
+
 TEST_P(OperatorsTableScanTest, BinaryScanOnNullable) {
   auto predicates = std::vector<std::tuple<ColumnID, PredicateCondition, AllTypeVariant, std::vector<AllTypeVariant>>>{
       {ColumnID{0}, PredicateCondition::Equals, 1234, {1234}},
@@ -847,6 +888,43 @@ TEST_P(OperatorsTableScanTest, SetParameters) {
   EXPECT_EQ(*scan_c->predicate(), *greater_than_equals_(column, placeholder_(ParameterID{4})));
 }
 
+TEST_P(OperatorsTableScanTest, PruneChunksAfterSettingParameters) {
+  // One chunk per row: 12345, 123, 1234
+  const auto table_wrapper = load_and_encode_table("resources/test_data/tbl/int_float.tbl", 1);
+  const auto column = get_column_expression(table_wrapper, ColumnID{0});
+
+  const auto scan = std::make_shared<TableScan>(table_wrapper, equals_(column, placeholder_(ParameterID{0})));
+  scan->set_parameters({{ParameterID{0}, AllTypeVariant{1234}}});
+
+  const auto impl = scan->create_impl();
+  EXPECT_TRUE(impl->can_prune_chunk(ChunkID{0}));
+  EXPECT_TRUE(impl->can_prune_chunk(ChunkID{1}));
+  EXPECT_FALSE(impl->can_prune_chunk(ChunkID{2}));
+
+  scan->execute();
+  ASSERT_EQ(scan->get_output()->row_count(), 1u);
+  EXPECT_EQ(scan->get_output()->get_value<int32_t>(ColumnID{0}, 0u), 1234);
+
+  const auto between_scan = std::make_shared<TableScan>(
+      table_wrapper, between_inclusive_(column, placeholder_(ParameterID{0}), placeholder_(ParameterID{1})));
+  between_scan->set_parameters({{ParameterID{0}, AllTypeVariant{100}}, {ParameterID{1}, AllTypeVariant{200}}});
+
+  const auto between_impl = between_scan->create_impl();
+  EXPECT_TRUE(between_impl->can_prune_chunk(ChunkID{0}));
+  EXPECT_FALSE(between_impl->can_prune_chunk(ChunkID{1}));
+  EXPECT_TRUE(between_impl->can_prune_chunk(ChunkID{2}));
+
+  between_scan->execute();
+  ASSERT_EQ(between_scan->get_output()->row_count(), 1u);
+  EXPECT_EQ(between_scan->get_output()->get_value<int32_t>(ColumnID{0}, 0u), 123);
+
+  // Chunks of reference tables are never pruned, as they have no statistics
+  const auto scan_on_references =
+      std::make_shared<TableScan>(scan, equals_(get_column_expression(scan, ColumnID{0}), placeholder_(ParameterID{0})));
+  scan_on_references->set_parameters({{ParameterID{0}, AllTypeVariant{5}}});
+  EXPECT_FALSE(scan_on_references->create_impl()->can_prune_chunk(ChunkID{0}));
+}
+
 TEST_P(OperatorsTableScanTest, GetImpl) {
   /**
    * Test that the correct scanning backend is chosen
@@ -933,4 +1011,60 @@ TEST_P(OperatorsTableScanTest, TwoBigScans) {
   }
 }
 
+TEST_P(OperatorsTableScanTest, ScanWithZoneMaps) {
+  // The single chunk spans multiple zone map blocks. Column a is clustered (a = i), so that zone maps can skip blocks
+  // and add blocks without evaluating the predicate. The last block contains NULLs.
+  const auto row_count = 5 * BaseZoneMap::DEFAULT_BLOCK_SIZE - 100;
+  const auto null_begin = 4 * BaseZoneMap::DEFAULT_BLOCK_SIZE;
+  const auto is_null = [&](const int32_t i) { return i >= static_cast<int32_t>(null_begin) && i % 7 == 0; };
+
+  auto column_definitions = TableColumnDefinitions{{"a", DataType::Int, true}};
+  const auto data_table = std::make_shared<Table>(column_definitions, TableType::Data, row_count);
+  for (auto i = 0; i < static_cast<int32_t>(row_count); ++i) {
+    if (is_null(i)) {
+      data_table->append({NullValue{}});
+    } else {
+      data_table->append({i});
+    }
+  }
+  ChunkEncoder::encode_chunk(data_table->get_chunk(ChunkID{0}), {DataType::Int}, SegmentEncodingSpec{_encoding_type});
+
+  const auto& segment_statistics = data_table->get_chunk(ChunkID{0})->statistics()->statistics()[0];
+  ASSERT_TRUE(segment_statistics->zone_map());
+  EXPECT_EQ(segment_statistics->zone_map()->block_count(), 5u);
+
+  auto data_table_wrapper = std::make_shared<TableWrapper>(data_table);
+  data_table_wrapper->execute();
+
+  const auto column_a = pqp_column_(ColumnID{0}, DataType::Int, true, "a");
+
+  const auto expect_row_count = [&](const std::shared_ptr<AbstractExpression>& predicate,
+                                    const std::function<bool(int32_t)>& filter) {
+    const auto scan = std::make_shared<TableScan>(data_table_wrapper, predicate);
+    scan->execute();
+
+    auto expected_row_count = size_t{0};
+    for (auto i = 0; i < static_cast<int32_t>(row_count); ++i) {
+      if (!is_null(i) && filter(i)) ++expected_row_count;
+    }
+    EXPECT_EQ(scan->get_output()->row_count(), expected_row_count) << predicate->as_column_name();
+
+    const auto& output_table = scan->get_output();
+    for (auto row_id = size_t{0}; row_id < output_table->row_count(); ++row_id) {
+      const auto value = output_table->get_value<int32_t>(ColumnID{0}, row_id);
+      ASSERT_TRUE(filter(value)) << predicate->as_column_name() << " " << value;
+    }
+  };
+
+  // clang-format off
+  expect_row_count(less_than_(column_a, 5'000), [](const auto value) { return value < 5'000; });
+  expect_row_count(greater_than_equals_(column_a, 10'000), [](const auto value) { return value >= 10'000; });
+  expect_row_count(equals_(column_a, 123), [](const auto value) { return value == 123; });
+  expect_row_count(not_equals_(column_a, 5), [](const auto value) { return value != 5; });
+  expect_row_count(greater_than_(column_a, 100'000), [](const auto value) { return value > 100'000; });
+  expect_row_count(between_inclusive_(column_a, 4'096, 8'191), [](const auto value) { return value >= 4'096 && value <= 8'191; });  // NOLINT
+  expect_row_count(between_exclusive_(column_a, 4'000, 17'000), [](const auto value) { return value > 4'000 && value < 17'000; });  // NOLINT
+  // clang-format on
+}
+
 }  // namespace opossum
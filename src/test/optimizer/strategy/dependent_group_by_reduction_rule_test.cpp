@@ -0,0 +1,132 @@
+#include "gtest/gtest.h"
+
+#include "expression/expression_functional.hpp"
+#include "logical_query_plan/aggregate_node.hpp"
+#include "logical_query_plan/join_node.hpp"
+#include "logical_query_plan/projection_node.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "logical_query_plan/validate_node.hpp"
+#include "optimizer/strategy/dependent_group_by_reduction_rule.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "utils/load_table.hpp"
+
+#include "strategy_base_test.hpp"
+#include "testing_assert.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class DependentGroupByReductionRuleTest : public StrategyBaseTest {
+ public:
+  void SetUp() override {
+    const auto table_a = load_table("resources/test_data/tbl/int_int_int.tbl");
+    table_a->add_unique_constraint({ColumnID{0}}, IsPrimaryKey::Yes);
+    StorageManager::get().add_table("table_a", table_a);
+
+    const auto table_b = load_table("resources/test_data/tbl/int_int3.tbl");
+    table_b->add_unique_constraint({ColumnID{0}, ColumnID{1}}, IsPrimaryKey::Yes);
+    StorageManager::get().add_table("table_b", table_b);
+
+    stored_table_node_a = StoredTableNode::make("table_a");
+    a_a = stored_table_node_a->get_column("a");
+    a_b = stored_table_node_a->get_column("b");
+    a_c = stored_table_node_a->get_column("c");
+
+    stored_table_node_b = StoredTableNode::make("table_b");
+    b_a = stored_table_node_b->get_column("a");
+    b_b = stored_table_node_b->get_column("b");
+
+    rule = std::make_shared<DependentGroupByReductionRule>();
+  }
+
+  std::shared_ptr<DependentGroupByReductionRule> rule;
+  std::shared_ptr<StoredTableNode> stored_table_node_a, stored_table_node_b;
+  LQPColumnReference a_a, a_b, a_c, b_a, b_b;
+};
+
+TEST_F(DependentGroupByReductionRuleTest, MoveDependentColumnsToAny) {
+  // clang-format off
+  const auto input_lqp =
+  AggregateNode::make(expression_vector(a_a, a_b), expression_vector(sum_(a_c)),
+    ValidateNode::make(
+      stored_table_node_a));
+
+  const auto expected_lqp =
+  ProjectionNode::make(expression_vector(a_a, a_b, sum_(a_c)),
+    AggregateNode::make(expression_vector(a_a), expression_vector(sum_(a_c), any_(a_b)),
+      ValidateNode::make(
+        stored_table_node_a)));
+  // clang-format on
+
+  const auto actual_lqp = apply_rule(rule, input_lqp);
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+}
+
+TEST_F(DependentGroupByReductionRuleTest, AcrossJoin) {
+  // clang-format off
+  const auto input_lqp =
+  AggregateNode::make(expression_vector(a_b, a_a, b_b), expression_vector(count_(b_a)),
+    JoinNode::make(JoinMode::Inner, equals_(a_a, b_a),
+      ValidateNode::make(stored_table_node_a),
+      ValidateNode::make(stored_table_node_b)));
+
+  const auto expected_lqp =
+  ProjectionNode::make(expression_vector(a_b, a_a, b_b, count_(b_a)),
+    AggregateNode::make(expression_vector(a_a, b_b), expression_vector(count_(b_a), any_(a_b)),
+      JoinNode::make(JoinMode::Inner, equals_(a_a, b_a),
+        ValidateNode::make(stored_table_node_a),
+        ValidateNode::make(stored_table_node_b))));
+  // clang-format on
+
+  const auto actual_lqp = apply_rule(rule, input_lqp);
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+}
+
+TEST_F(DependentGroupByReductionRuleTest, RemoveAggregateIfInputIsUnique) {
+  // E.g., SELECT DISTINCT a, b FROM table_a
+  // clang-format off
+  const auto input_lqp =
+  AggregateNode::make(expression_vector(a_a, a_b), expression_vector(),
+    ValidateNode::make(
+      stored_table_node_a));
+
+  const auto expected_lqp =
+  ProjectionNode::make(expression_vector(a_a, a_b),
+    ValidateNode::make(
+      stored_table_node_a));
+  // clang-format on
+
+  const auto actual_lqp = apply_rule(rule, input_lqp);
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+}
+
+TEST_F(DependentGroupByReductionRuleTest, NoConstraintCovered) {
+  // clang-format off
+  const auto lqp =
+  AggregateNode::make(expression_vector(a_b, b_a), expression_vector(sum_(a_c)),
+    JoinNode::make(JoinMode::Inner, equals_(a_a, b_a),
+      ValidateNode::make(stored_table_node_a),
+      ValidateNode::make(stored_table_node_b)));
+  // clang-format on
+
+  const auto expected_lqp = lqp->deep_copy();
+  const auto actual_lqp = apply_rule(rule, lqp);
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+}
+
+TEST_F(DependentGroupByReductionRuleTest, RequiresValidation) {
+  // Without a ValidateNode, deleted rows might share their key with visible rows
+  // clang-format off
+  const auto lqp =
+  AggregateNode::make(expression_vector(a_a, a_b), expression_vector(sum_(a_c)),
+    stored_table_node_a);
+  // clang-format on
+
+  const auto expected_lqp = lqp->deep_copy();
+  const auto actual_lqp = apply_rule(rule, lqp);
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+}
+
+}  // namespace opossum
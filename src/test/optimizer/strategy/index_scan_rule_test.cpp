@@ -12,6 +12,7 @@
 #include "logical_query_plan/mock_node.hpp"
 #include "logical_query_plan/predicate_node.hpp"
 #include "logical_query_plan/stored_table_node.hpp"
+#include "logical_query_plan/validate_node.hpp"
 #include "optimizer/strategy/index_scan_rule.hpp"
 #include "optimizer/strategy/strategy_base_test.hpp"
 #include "statistics/column_statistics.hpp"
@@ -19,9 +20,11 @@
 #include "storage/chunk_encoder.hpp"
 #include "storage/dictionary_segment.hpp"
 #include "storage/index/adaptive_radix_tree/adaptive_radix_tree_index.hpp"
+#include "storage/index/adaptive_radix_tree/string_adaptive_radix_tree_index.hpp"
 #include "storage/index/group_key/composite_group_key_index.hpp"
 #include "storage/index/group_key/group_key_index.hpp"
 #include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
 #include "utils/assert.hpp"
 
 using namespace opossum::expression_functional;  // NOLINT
@@ -168,4 +171,140 @@ TEST_F(IndexScanRuleTest, IndexScanOnlyOnOutputOfStoredTableNode) {
   EXPECT_EQ(predicate_node_1->scan_type, ScanType::TableScan);
 }
 
+TEST_F(IndexScanRuleTest, IndexScanAboveOtherPredicate) {
+  table->create_index<GroupKeyIndex>({ColumnID{2}});
+
+  auto statistics_mock = generate_mock_statistics(1'000'000);
+  table->set_table_statistics(statistics_mock);
+
+  // The IndexScan then searches the indexes of the chunks referenced by its input
+  auto predicate_node_0 = PredicateNode::make(less_than_(b, 15));
+  predicate_node_0->set_left_input(stored_table_node);
+
+  auto predicate_node_1 = PredicateNode::make(greater_than_(c, 19'900));
+  predicate_node_1->set_left_input(predicate_node_0);
+
+  auto reordered = StrategyBaseTest::apply_rule(rule, predicate_node_1);
+  EXPECT_EQ(predicate_node_0->scan_type, ScanType::TableScan);
+  EXPECT_EQ(predicate_node_1->scan_type, ScanType::IndexScan);
+}
+
+TEST_F(IndexScanRuleTest, IndexScanWithPlaceholder) {
+  table->create_index<GroupKeyIndex>({ColumnID{2}});
+
+  auto statistics_mock = generate_mock_statistics(1'000'000);
+  table->set_table_statistics(statistics_mock);
+
+  auto predicate_node_0 = PredicateNode::make(equals_(c, placeholder_(ParameterID{0})));
+  predicate_node_0->set_left_input(stored_table_node);
+
+  auto reordered = StrategyBaseTest::apply_rule(rule, predicate_node_0);
+  EXPECT_EQ(predicate_node_0->scan_type, ScanType::IndexScan);
+}
+
+TEST_F(IndexScanRuleTest, CompositeIndexScanMergesPredicates) {
+  table->create_index<CompositeGroupKeyIndex>({ColumnID{2}, ColumnID{1}});
+
+  std::vector<std::shared_ptr<const BaseColumnStatistics>> column_statistics;
+  column_statistics.emplace_back(std::make_shared<ColumnStatistics<int32_t>>(0.0f, 1'000, 0, 20'000));
+  column_statistics.emplace_back(std::make_shared<ColumnStatistics<int32_t>>(0.0f, 1'000, 0, 20'000));
+  column_statistics.emplace_back(std::make_shared<ColumnStatistics<int32_t>>(0.0f, 1'000, 0, 20'000));
+  table->set_table_statistics(
+      std::make_shared<TableStatistics>(TableStatistics{TableType::Data, 1'000'000, column_statistics}));
+
+  auto predicate_node_0 = PredicateNode::make(equals_(c, 10));
+  predicate_node_0->set_left_input(stored_table_node);
+
+  auto predicate_node_1 = PredicateNode::make(greater_than_(a, 5));
+  predicate_node_1->set_left_input(predicate_node_0);
+
+  auto predicate_node_2 = PredicateNode::make(equals_(b, 5));
+  predicate_node_2->set_left_input(predicate_node_1);
+
+  auto reordered = StrategyBaseTest::apply_rule(rule, predicate_node_2);
+
+  // The predicates on the indexed columns are merged, ordered like the index
+  EXPECT_EQ(predicate_node_2->scan_type, ScanType::IndexScan);
+  EXPECT_EQ(*predicate_node_2->predicate(), *and_(equals_(c, 10), equals_(b, 5)));
+  EXPECT_EQ(predicate_node_2->left_input(), predicate_node_1);
+  EXPECT_EQ(predicate_node_1->left_input(), stored_table_node);
+  EXPECT_EQ(predicate_node_1->scan_type, ScanType::TableScan);
+}
+
+TEST_F(IndexScanRuleTest, TableHashIndexScanBelowValidate) {
+  table->create_table_hash_index(ColumnID{2});
+
+  std::vector<std::shared_ptr<const BaseColumnStatistics>> column_statistics;
+  column_statistics.emplace_back(std::make_shared<ColumnStatistics<int32_t>>(0.0f, 1'000, 0, 20'000));
+  column_statistics.emplace_back(std::make_shared<ColumnStatistics<int32_t>>(0.0f, 1'000, 0, 20'000));
+  column_statistics.emplace_back(std::make_shared<ColumnStatistics<int32_t>>(0.0f, 1'000, 0, 20'000));
+  table->set_table_statistics(
+      std::make_shared<TableStatistics>(TableStatistics{TableType::Data, 1'000'000, column_statistics}));
+
+  // The point lookup is placed on a Validate, as the SQLTranslator does it
+  auto validate_node = ValidateNode::make();
+  validate_node->set_left_input(stored_table_node);
+
+  auto predicate_node_0 = PredicateNode::make(equals_(c, 10));
+  predicate_node_0->set_left_input(validate_node);
+
+  auto reordered = StrategyBaseTest::apply_rule(rule, predicate_node_0);
+
+  // The predicate is moved below the Validate, so that the table-wide hash index can be searched
+  EXPECT_EQ(predicate_node_0->scan_type, ScanType::IndexScan);
+  EXPECT_EQ(reordered, validate_node);
+  EXPECT_EQ(validate_node->left_input(), predicate_node_0);
+  EXPECT_EQ(predicate_node_0->left_input(), stored_table_node);
+
+  // Range predicates cannot use the hash index and stay above the Validate
+  auto validate_node_1 = ValidateNode::make();
+  validate_node_1->set_left_input(stored_table_node);
+
+  auto predicate_node_1 = PredicateNode::make(greater_than_(c, 19'990));
+  predicate_node_1->set_left_input(validate_node_1);
+
+  reordered = StrategyBaseTest::apply_rule(rule, predicate_node_1);
+  EXPECT_EQ(predicate_node_1->scan_type, ScanType::TableScan);
+  EXPECT_EQ(reordered, predicate_node_1);
+  EXPECT_EQ(predicate_node_1->left_input(), validate_node_1);
+}
+
+TEST_F(IndexScanRuleTest, IndexScanForLikePrefix) {
+  // 10 of the 2'000 rows start with "rare"
+  const auto string_table =
+      std::make_shared<Table>(TableColumnDefinitions{{"s", DataType::String}}, TableType::Data, 500);
+  for (auto row = 0; row < 2'000; ++row) {
+    string_table->append({pmr_string{(row < 10 ? "rare" : "common") + std::to_string(row)}});
+  }
+  ChunkEncoder::encode_all_chunks(string_table);
+  string_table->create_index<StringAdaptiveRadixTreeIndex>({ColumnID{0}});
+
+  // The statistics do not estimate LIKE predicates, the rule counts the matching rows on the indexes instead
+  std::vector<std::shared_ptr<const BaseColumnStatistics>> column_statistics;
+  column_statistics.emplace_back(std::make_shared<ColumnStatistics<pmr_string>>(0.0f, 2'000, "common10", "rare9"));
+  string_table->set_table_statistics(
+      std::make_shared<TableStatistics>(TableStatistics{TableType::Data, 2'000, column_statistics}));
+  StorageManager::get().add_table("strings", string_table);
+
+  const auto strings_node = StoredTableNode::make("strings");
+  const auto s = strings_node->get_column("s");
+
+  auto predicate_node_0 = PredicateNode::make(like_(s, "rare%"));
+  predicate_node_0->set_left_input(strings_node);
+  StrategyBaseTest::apply_rule(rule, predicate_node_0);
+  EXPECT_EQ(predicate_node_0->scan_type, ScanType::IndexScan);
+
+  // Not selective enough
+  auto predicate_node_1 = PredicateNode::make(like_(s, "common%"));
+  predicate_node_1->set_left_input(strings_node);
+  StrategyBaseTest::apply_rule(rule, predicate_node_1);
+  EXPECT_EQ(predicate_node_1->scan_type, ScanType::TableScan);
+
+  // No constant prefix
+  auto predicate_node_2 = PredicateNode::make(like_(s, "%rare"));
+  predicate_node_2->set_left_input(strings_node);
+  StrategyBaseTest::apply_rule(rule, predicate_node_2);
+  EXPECT_EQ(predicate_node_2->scan_type, ScanType::TableScan);
+}
+
 }  // namespace opossum
@@ -0,0 +1,114 @@
+#include <memory>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "expression/expression_functional.hpp"
+#include "logical_query_plan/join_node.hpp"
+#include "logical_query_plan/predicate_node.hpp"
+#include "logical_query_plan/projection_node.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "logical_query_plan/validate_node.hpp"
+#include "optimizer/strategy/join_elimination_rule.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "utils/load_table.hpp"
+
+#include "strategy_base_test.hpp"
+#include "testing_assert.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class JoinEliminationRuleTest : public StrategyBaseTest {
+ public:
+  void SetUp() override {
+    StorageManager::get().add_table("table_a", load_table("resources/test_data/tbl/int_int_int.tbl"));
+
+    const auto table_b = load_table("resources/test_data/tbl/int_int3.tbl");
+    table_b->add_unique_constraint({ColumnID{0}}, IsPrimaryKey::Yes);
+    StorageManager::get().add_table("table_b", table_b);
+
+    stored_table_node_a = StoredTableNode::make("table_a");
+    a_a = stored_table_node_a->get_column("a");
+    a_b = stored_table_node_a->get_column("b");
+
+    stored_table_node_b = StoredTableNode::make("table_b");
+    b_a = stored_table_node_b->get_column("a");
+    b_b = stored_table_node_b->get_column("b");
+
+    rule = std::make_shared<JoinEliminationRule>();
+  }
+
+  std::shared_ptr<JoinEliminationRule> rule;
+  std::shared_ptr<StoredTableNode> stored_table_node_a, stored_table_node_b;
+  LQPColumnReference a_a, a_b, b_a, b_b;
+};
+
+TEST_F(JoinEliminationRuleTest, EliminateLeftJoin) {
+  // clang-format off
+  const auto input_lqp =
+  ProjectionNode::make(expression_vector(a_a),
+    PredicateNode::make(greater_than_(a_b, 5),
+      JoinNode::make(JoinMode::Left, equals_(a_a, b_a),
+        ValidateNode::make(stored_table_node_a),
+        PredicateNode::make(greater_than_(b_b, 2),
+          ValidateNode::make(stored_table_node_b)))));
+
+  const auto expected_lqp =
+  ProjectionNode::make(expression_vector(a_a),
+    PredicateNode::make(greater_than_(a_b, 5),
+      ValidateNode::make(stored_table_node_a)));
+  // clang-format on
+
+  const auto actual_lqp = apply_rule(rule, input_lqp);
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+}
+
+TEST_F(JoinEliminationRuleTest, RightColumnUsed) {
+  // clang-format off
+  const auto projection_lqp =
+  ProjectionNode::make(expression_vector(a_a),
+    PredicateNode::make(greater_than_(b_b, 5),
+      JoinNode::make(JoinMode::Left, equals_(a_a, b_a),
+        ValidateNode::make(stored_table_node_a),
+        ValidateNode::make(stored_table_node_b))));
+
+  const auto output_lqp =
+  JoinNode::make(JoinMode::Left, equals_(a_a, b_a),
+    ValidateNode::make(stored_table_node_a),
+    ValidateNode::make(stored_table_node_b));
+  // clang-format on
+
+  for (const auto& lqp : std::vector<std::shared_ptr<AbstractLQPNode>>{projection_lqp, output_lqp}) {
+    const auto expected_lqp = lqp->deep_copy();
+    const auto actual_lqp = apply_rule(rule, lqp);
+    EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+  }
+}
+
+TEST_F(JoinEliminationRuleTest, KeepJoinsThatFilterOrDuplicate) {
+  // Inner Joins remove left rows without a match, non-unique right inputs duplicate left rows
+  // clang-format off
+  const auto inner_join_lqp =
+  ProjectionNode::make(expression_vector(a_a),
+    JoinNode::make(JoinMode::Inner, equals_(a_a, b_a),
+      ValidateNode::make(stored_table_node_a),
+      ValidateNode::make(stored_table_node_b)));
+
+  const auto non_unique_lqp =
+  ProjectionNode::make(expression_vector(a_a),
+    JoinNode::make(JoinMode::Left, equals_(a_a, b_b),
+      ValidateNode::make(stored_table_node_a),
+      ValidateNode::make(stored_table_node_b)));
+  // clang-format on
+
+  for (const auto& lqp : {inner_join_lqp, non_unique_lqp}) {
+    const auto expected_lqp = lqp->deep_copy();
+    const auto actual_lqp = apply_rule(rule, lqp);
+    EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+  }
+}
+
+}  // namespace opossum
@@ -0,0 +1,103 @@
+#include "gtest/gtest.h"
+
+#include "expression/expression_functional.hpp"
+#include "logical_query_plan/aggregate_node.hpp"
+#include "logical_query_plan/join_node.hpp"
+#include "logical_query_plan/predicate_node.hpp"
+#include "logical_query_plan/projection_node.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "logical_query_plan/validate_node.hpp"
+#include "optimizer/strategy/semi_to_inner_join_rule.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "utils/load_table.hpp"
+
+#include "strategy_base_test.hpp"
+#include "testing_assert.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class SemiToInnerJoinRuleTest : public StrategyBaseTest {
+ public:
+  void SetUp() override {
+    StorageManager::get().add_table("table_a", load_table("resources/test_data/tbl/int_int_int.tbl"));
+
+    const auto table_b = load_table("resources/test_data/tbl/int_int3.tbl");
+    table_b->add_unique_constraint({ColumnID{0}}, IsPrimaryKey::Yes);
+    StorageManager::get().add_table("table_b", table_b);
+
+    stored_table_node_a = StoredTableNode::make("table_a");
+    a_a = stored_table_node_a->get_column("a");
+    a_b = stored_table_node_a->get_column("b");
+    a_c = stored_table_node_a->get_column("c");
+
+    stored_table_node_b = StoredTableNode::make("table_b");
+    b_a = stored_table_node_b->get_column("a");
+    b_b = stored_table_node_b->get_column("b");
+
+    rule = std::make_shared<SemiToInnerJoinRule>();
+  }
+
+  std::shared_ptr<SemiToInnerJoinRule> rule;
+  std::shared_ptr<StoredTableNode> stored_table_node_a, stored_table_node_b;
+  LQPColumnReference a_a, a_b, a_c, b_a, b_b;
+};
+
+TEST_F(SemiToInnerJoinRuleTest, UniqueRightInput) {
+  // E.g., SELECT * FROM table_a WHERE b IN (SELECT a FROM table_b WHERE b > 5)
+  // clang-format off
+  const auto input_lqp =
+  JoinNode::make(JoinMode::Semi, equals_(a_b, b_a),
+    ValidateNode::make(stored_table_node_a),
+    PredicateNode::make(greater_than_(b_b, 5),
+      ValidateNode::make(stored_table_node_b)));
+
+  const auto expected_lqp =
+  ProjectionNode::make(expression_vector(a_a, a_b, a_c),
+    JoinNode::make(JoinMode::Inner, equals_(a_b, b_a),
+      ValidateNode::make(stored_table_node_a),
+      PredicateNode::make(greater_than_(b_b, 5),
+        ValidateNode::make(stored_table_node_b))));
+  // clang-format on
+
+  const auto actual_lqp = apply_rule(rule, input_lqp);
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+}
+
+TEST_F(SemiToInnerJoinRuleTest, UniqueAggregate) {
+  // The right input is unique on its GROUP BY column, even though table_a has no constraints
+  // clang-format off
+  const auto input_lqp =
+  JoinNode::make(JoinMode::Semi, equals_(b_a, a_c),
+    ValidateNode::make(stored_table_node_b),
+    AggregateNode::make(expression_vector(a_c), expression_vector(),
+      ValidateNode::make(stored_table_node_a)));
+
+  const auto expected_lqp =
+  ProjectionNode::make(expression_vector(b_a, b_b),
+    JoinNode::make(JoinMode::Inner, equals_(b_a, a_c),
+      ValidateNode::make(stored_table_node_b),
+      AggregateNode::make(expression_vector(a_c), expression_vector(),
+        ValidateNode::make(stored_table_node_a))));
+  // clang-format on
+
+  const auto actual_lqp = apply_rule(rule, input_lqp);
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+}
+
+TEST_F(SemiToInnerJoinRuleTest, NonUniqueRightInput) {
+  // clang-format off
+  const auto lqp =
+  JoinNode::make(JoinMode::Semi, equals_(a_a, b_b),
+    ValidateNode::make(stored_table_node_a),
+    ValidateNode::make(stored_table_node_b));
+  // clang-format on
+
+  const auto expected_lqp = lqp->deep_copy();
+  const auto actual_lqp = apply_rule(rule, lqp);
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+}
+
+}  // namespace opossum
@@ -0,0 +1,111 @@
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../../plugins/index_advisor_plugin.hpp"
+#include "sql/sql_pipeline_builder.hpp"
+#include "sql/sql_plan_cache.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/index/group_key/group_key_index.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+class IndexAdvisorPluginTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    TableColumnDefinitions column_definitions;
+    column_definitions.emplace_back("a", DataType::Int);
+    column_definitions.emplace_back("b", DataType::Int);
+
+    _table = std::make_shared<Table>(column_definitions, TableType::Data, 1000, UseMvcc::Yes);
+    for (auto value = 0; value < 2000; ++value) {
+      _table->append({value, value % 2});
+    }
+    ChunkEncoder::encode_all_chunks(_table, SegmentEncodingSpec{EncodingType::Dictionary});
+    StorageManager::get().add_table("table_a", _table);
+  }
+
+  void TearDown() override {
+    // The plugin is a singleton, stop() clears the collected workload
+    auto& plugin = IndexAdvisorPlugin::get();
+    plugin.stop();
+    plugin.set_memory_budget(IndexAdvisorPlugin::DEFAULT_MEMORY_BUDGET);
+  }
+
+  static void run_query(const std::string& sql) { SQLPipelineBuilder{sql}.create_pipeline().get_result_table(); }
+
+  bool has_index(const ColumnID column_id) const {
+    const auto index_infos = _table->get_indexes();
+    return std::any_of(index_infos.cbegin(), index_infos.cend(), [&](const auto& index_info) {
+      return index_info.column_ids == std::vector<ColumnID>{column_id};
+    });
+  }
+
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(IndexAdvisorPluginTest, AssessCandidates) {
+  run_query("SELECT * FROM table_a WHERE a = 5");
+  run_query("SELECT * FROM table_a WHERE a = 5");
+  run_query("SELECT * FROM table_a WHERE b = 1");
+
+  const auto assessments = IndexAdvisorPlugin::get().assess_candidates();
+  ASSERT_EQ(assessments.size(), 2u);
+
+  // Only the selective scan benefits from an index
+  EXPECT_EQ(assessments[0].candidate, IndexAdvisorPlugin::IndexCandidate("table_a", ColumnID{0}));
+  EXPECT_GT(assessments[0].benefit, 0.0);
+  EXPECT_GT(assessments[0].memory_cost, 0u);
+  EXPECT_FALSE(assessments[0].exists);
+
+  EXPECT_EQ(assessments[1].candidate, IndexAdvisorPlugin::IndexCandidate("table_a", ColumnID{1}));
+  EXPECT_EQ(assessments[1].benefit, 0.0);
+}
+
+TEST_F(IndexAdvisorPluginTest, CreateAndDropIndexes) {
+  auto& plugin = IndexAdvisorPlugin::get();
+
+  run_query("SELECT * FROM table_a WHERE a = 5");
+  run_query("SELECT * FROM table_a WHERE b = 1");
+  plugin.tune();
+
+  EXPECT_TRUE(has_index(ColumnID{0}));
+  EXPECT_FALSE(has_index(ColumnID{1}));
+  EXPECT_TRUE(_table->get_chunk(ChunkID{0})->get_index(SegmentIndexType::GroupKey, std::vector<ColumnID>{ColumnID{0}}));
+
+  // Plans have to be optimized again to use the index
+  EXPECT_EQ(SQLPhysicalPlanCache::get().size(), 0u);
+
+  // The workload is kept after the caches were cleared
+  run_query("SELECT * FROM table_a WHERE a = 5");
+  const auto assessments = plugin.assess_candidates();
+  ASSERT_FALSE(assessments.empty());
+  EXPECT_EQ(assessments[0].candidate, IndexAdvisorPlugin::IndexCandidate("table_a", ColumnID{0}));
+  EXPECT_TRUE(assessments[0].exists);
+
+  // Indexes that exceed the budget are dropped
+  plugin.set_memory_budget(0);
+  plugin.tune();
+  EXPECT_FALSE(has_index(ColumnID{0}));
+  EXPECT_FALSE(
+      _table->get_chunk(ChunkID{0})->get_index(SegmentIndexType::GroupKey, std::vector<ColumnID>{ColumnID{0}}));
+}
+
+TEST_F(IndexAdvisorPluginTest, IgnoreForeignIndexes) {
+  _table->create_index<GroupKeyIndex>({ColumnID{0}});
+
+  run_query("SELECT * FROM table_a WHERE a = 5");
+  EXPECT_TRUE(IndexAdvisorPlugin::get().assess_candidates().empty());
+
+  IndexAdvisorPlugin::get().set_memory_budget(0);
+  IndexAdvisorPlugin::get().tune();
+  EXPECT_TRUE(has_index(ColumnID{0}));
+}
+
+}  // namespace opossum
@@ -1,4 +1,11 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <functional>
 #include <memory>
+#include <mutex>
+#include <set>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -258,4 +265,227 @@ TEST_F(SchedulerTest, SingleWorkerGuaranteeProgress) {
   CurrentScheduler::get()->finish();
 }
 
+TEST_F(SchedulerTest, NestedJobTasksAreStolen) {
+  // Jobs spawned by a worker are pushed to its deque, the other workers (including those of the other node) have to
+  // steal them
+  Topology::use_fake_numa_topology(8, 4);
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+
+  std::atomic_uint counter{0};
+  std::mutex thread_ids_mutex;
+  std::set<std::thread::id> thread_ids;
+
+  auto task = std::make_shared<JobTask>([&]() {
+    std::vector<std::shared_ptr<AbstractTask>> jobs;
+    for (auto job_index = 0; job_index < 1'000; ++job_index) {
+      jobs.emplace_back(std::make_shared<JobTask>([&]() {
+        std::this_thread::sleep_for(std::chrono::microseconds(10));
+        counter++;
+
+        std::lock_guard<std::mutex> lock(thread_ids_mutex);
+        thread_ids.emplace(std::this_thread::get_id());
+      }));
+    }
+    CurrentScheduler::schedule_and_wait_for_tasks(jobs);
+  });
+
+  task->schedule();
+  CurrentScheduler::wait_for_tasks(std::vector<std::shared_ptr<AbstractTask>>{task});
+
+  EXPECT_EQ(counter, 1'000u);
+  EXPECT_GT(thread_ids.size(), 1u);
+
+  CurrentScheduler::get()->finish();
+}
+
+TEST_F(SchedulerTest, NonStealableTasks) {
+  Topology::use_fake_numa_topology(8, 4);
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+
+  std::atomic_uint counter{0};
+  std::vector<std::shared_ptr<AbstractTask>> tasks;
+  for (auto task_index = 0; task_index < 100; ++task_index) {
+    tasks.emplace_back(std::make_shared<JobTask>([&]() { counter++; }, SchedulePriority::Default, false));
+  }
+  CurrentScheduler::schedule_and_wait_for_tasks(tasks);
+
+  for (const auto& task : tasks) {
+    EXPECT_EQ(task->node_id(), NodeID{0});
+  }
+  EXPECT_EQ(counter, 100u);
+
+  CurrentScheduler::get()->finish();
+}
+
+TEST_F(SchedulerTest, PooledJobTasksAreRecycled) {
+  auto task = JobTask::make([]() {});
+  const auto* const address = task.get();
+  task = nullptr;
+
+  // The memory of the destroyed task is reused by the next task that is created on this thread
+  task = JobTask::make([]() {});
+  EXPECT_EQ(task.get(), address);
+
+  auto executed = false;
+  JobTask::make([&]() { executed = true; })->schedule();
+  EXPECT_TRUE(executed);
+}
+
+TEST_F(SchedulerTest, ScheduleTasksInBulk) {
+  Topology::use_fake_numa_topology(8, 4);
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+
+  // Tasks scheduled from outside the workers are pushed to the TaskQueue of the preferred node
+  std::atomic_uint counter{0};
+  auto tasks = std::vector<std::shared_ptr<AbstractTask>>{};
+  for (auto task_index = 0; task_index < 100; ++task_index) {
+    tasks.emplace_back(JobTask::make([&]() { counter++; }, SchedulePriority::Default, false));
+  }
+  CurrentScheduler::schedule_tasks(tasks, NodeID{1});
+  CurrentScheduler::wait_for_tasks(tasks);
+
+  for (const auto& task : tasks) {
+    EXPECT_EQ(task->node_id(), NodeID{1});
+  }
+  EXPECT_EQ(counter, 100u);
+
+  // Tasks scheduled by a worker go to its deque. Tasks that are not ready yet are executed once their predecessors
+  // are done.
+  const auto task = std::make_shared<JobTask>([&]() {
+    auto jobs = std::vector<std::shared_ptr<JobTask>>{};
+    for (auto job_index = 0; job_index < 100; ++job_index) {
+      jobs.emplace_back(JobTask::make([&]() { counter++; }));
+    }
+    jobs[0]->set_as_predecessor_of(jobs[1]);
+    jobs[1]->set_as_predecessor_of(jobs[2]);
+    CurrentScheduler::schedule_and_wait_for_tasks(jobs);
+  });
+  task->schedule();
+  CurrentScheduler::wait_for_tasks(std::vector<std::shared_ptr<AbstractTask>>{task});
+  EXPECT_EQ(counter, 200u);
+
+  CurrentScheduler::get()->finish();
+}
+
+TEST_F(SchedulerTest, ContinuationIsExecutedAfterTasks) {
+  auto test_continuation = [&]() {
+    std::atomic_uint counter{0};
+    auto continuation_counter = 0u;
+    auto tasks = std::vector<std::shared_ptr<JobTask>>{};
+    for (auto task_index = 0; task_index < 10; ++task_index) {
+      tasks.emplace_back(JobTask::make([&]() { counter++; }));
+    }
+    const auto continuation = std::make_shared<JobTask>([&]() { continuation_counter = counter; });
+
+    CurrentScheduler::schedule_tasks_with_continuation(tasks, continuation);
+    CurrentScheduler::wait_for_tasks(std::vector<std::shared_ptr<AbstractTask>>{continuation});
+    EXPECT_EQ(continuation_counter, 10u);
+  };
+
+  test_continuation();
+
+  Topology::use_fake_numa_topology(8, 4);
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+
+  test_continuation();
+
+  // A task that hands its remaining work to a continuation does not wait for the tasks it spawns
+  auto spawned_tasks = std::vector<std::shared_ptr<JobTask>>{};
+  const auto continuation = std::make_shared<JobTask>([]() {});
+  const auto task = std::make_shared<JobTask>([&]() {
+    for (auto task_index = 0; task_index < 10; ++task_index) {
+      spawned_tasks.emplace_back(JobTask::make([]() { std::this_thread::sleep_for(std::chrono::milliseconds(1)); }));
+    }
+    CurrentScheduler::schedule_tasks_with_continuation(spawned_tasks, continuation);
+  });
+  task->schedule();
+  // The continuation is only scheduled by the task, so it cannot be waited for before the task is done
+  CurrentScheduler::wait_for_tasks(std::vector<std::shared_ptr<JobTask>>{task});
+  CurrentScheduler::wait_for_tasks(std::vector<std::shared_ptr<JobTask>>{continuation});
+  for (const auto& spawned_task : spawned_tasks) {
+    EXPECT_TRUE(spawned_task->is_done());
+  }
+
+  CurrentScheduler::get()->finish();
+}
+
+TEST_F(SchedulerTest, DeeplyNestedWaits) {
+  // Each task waits for the two tasks it spawns, so the waits are nested deeper than Worker::MAX_NESTED_WAIT_DEPTH
+  Topology::use_fake_numa_topology(4, 2);
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+
+  std::atomic_uint leaf_count{0};
+  std::function<void(size_t)> spawn_tasks = [&](const size_t depth) {
+    if (depth == 0) {
+      ++leaf_count;
+      return;
+    }
+    auto tasks = std::vector<std::shared_ptr<JobTask>>{};
+    tasks.emplace_back(JobTask::make([&, depth]() { spawn_tasks(depth - 1); }));
+    tasks.emplace_back(JobTask::make([&, depth]() { spawn_tasks(depth - 1); }));
+    CurrentScheduler::schedule_and_wait_for_tasks(tasks);
+  };
+
+  const auto depth = Worker::MAX_NESTED_WAIT_DEPTH + 4;
+  const auto task = std::make_shared<JobTask>([&]() { spawn_tasks(depth); });
+  task->schedule();
+  CurrentScheduler::wait_for_tasks(std::vector<std::shared_ptr<AbstractTask>>{task});
+  EXPECT_EQ(leaf_count, 1u << depth);
+
+  CurrentScheduler::get()->finish();
+}
+
+TEST_F(SchedulerTest, NestedWaitsBeyondLimitOnlyExecuteAwaitedTasks) {
+  // Each waiter waits for a task that is queued behind the other waiters. The only worker executes the waiters while
+  // it waits, but beyond Worker::MAX_NESTED_WAIT_DEPTH, it only executes the task it waits for.
+  Topology::use_fake_numa_topology(1, 1);
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+
+  auto nesting_depth = size_t{0};
+  auto max_nesting_depth = size_t{0};
+  auto waiters = std::vector<std::shared_ptr<JobTask>>{};
+  for (auto waiter_index = size_t{0}; waiter_index < Worker::MAX_NESTED_WAIT_DEPTH * 2; ++waiter_index) {
+    waiters.emplace_back(std::make_shared<JobTask>([&]() {
+      max_nesting_depth = std::max(max_nesting_depth, ++nesting_depth);
+      // Tasks that must not be stolen are queued in the TaskQueue, behind the remaining waiters
+      const auto task = std::make_shared<JobTask>([]() {}, SchedulePriority::Default, false);
+      CurrentScheduler::schedule_and_wait_for_tasks(std::vector<std::shared_ptr<JobTask>>{task});
+      --nesting_depth;
+    }));
+  }
+  CurrentScheduler::schedule_and_wait_for_tasks(waiters);
+
+  EXPECT_EQ(max_nesting_depth, Worker::MAX_NESTED_WAIT_DEPTH + 1);
+
+  CurrentScheduler::get()->finish();
+}
+
+TEST_F(SchedulerTest, ManyThreadsJoinTasks) {
+  // Client threads join their tasks concurrently. Each one must be woken up once its tasks are done, even if tasks of
+  // other threads finish at the same time.
+  Topology::use_fake_numa_topology(4, 2);
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+
+  std::atomic_uint counter{0};
+  auto threads = std::vector<std::thread>{};
+  for (auto thread_index = 0; thread_index < 16; ++thread_index) {
+    threads.emplace_back([&]() {
+      for (auto round = 0; round < 100; ++round) {
+        auto tasks = std::vector<std::shared_ptr<AbstractTask>>{};
+        for (auto task_index = 0; task_index < 4; ++task_index) {
+          tasks.emplace_back(std::make_shared<JobTask>([&]() { ++counter; }));
+        }
+        CurrentScheduler::schedule_and_wait_for_tasks(tasks);
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  EXPECT_EQ(counter, 16u * 100u * 4u);
+
+  CurrentScheduler::get()->finish();
+}
+
 }  // namespace opossum
@@ -0,0 +1,299 @@
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "scheduler/abstract_scheduler.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "scheduler/task_group.hpp"
+#include "scheduler/task_queue.hpp"
+#include "scheduler/topology.hpp"
+#include "sql/sql_pipeline_builder.hpp"
+#include "storage/storage_manager.hpp"
+
+namespace opossum {
+
+class TaskGroupTest : public BaseTest {
+ protected:
+  std::shared_ptr<AbstractTask> make_task(const std::shared_ptr<TaskGroup>& group) {
+    const auto task = std::make_shared<JobTask>([]() {});
+    task->set_group(group);
+    return task;
+  }
+};
+
+TEST_F(TaskGroupTest, Scope) {
+  const auto group_a = std::make_shared<TaskGroup>("a");
+  const auto group_b = std::make_shared<TaskGroup>("b");
+
+  EXPECT_EQ(TaskGroup::current(), TaskGroup::default_group());
+  {
+    const auto scope_a = TaskGroup::Scope{group_a};
+    EXPECT_EQ(TaskGroup::current(), group_a);
+    {
+      const auto scope_b = TaskGroup::Scope{group_b};
+      EXPECT_EQ(TaskGroup::current(), group_b);
+    }
+    EXPECT_EQ(TaskGroup::current(), group_a);
+  }
+  EXPECT_EQ(TaskGroup::current(), TaskGroup::default_group());
+}
+
+TEST_F(TaskGroupTest, VirtualRuntime) {
+  const auto group = std::make_shared<TaskGroup>("a", TaskGroup::DEFAULT_WEIGHT * 2);
+
+  group->record_execution(std::chrono::nanoseconds{10}, std::chrono::nanoseconds{1'000});
+  EXPECT_EQ(group->virtual_runtime(), 500u);
+  EXPECT_EQ(group->executed_task_count(), 1u);
+  EXPECT_EQ(group->execution_duration(), std::chrono::nanoseconds{1'000});
+  EXPECT_EQ(group->wait_duration(), std::chrono::nanoseconds{10});
+
+  group->record_execution(std::chrono::nanoseconds{30}, std::chrono::nanoseconds{1'000});
+  EXPECT_EQ(group->virtual_runtime(), 1'000u);
+  EXPECT_EQ(group->wait_duration(), std::chrono::nanoseconds{40});
+  EXPECT_EQ(group->max_wait_duration(), std::chrono::nanoseconds{30});
+
+  // Catching up never lowers the virtual runtime
+  group->catch_up_virtual_runtime(800u);
+  EXPECT_EQ(group->virtual_runtime(), 1'000u);
+  group->catch_up_virtual_runtime(1'200u);
+  EXPECT_EQ(group->virtual_runtime(), 1'200u);
+
+  EXPECT_THROW(TaskGroup("b", 0u), std::logic_error);
+}
+
+TEST_F(TaskGroupTest, QueuePrefersGroupWithLowestVirtualRuntime) {
+  auto queue = TaskQueue{NodeID{0}};
+  const auto group_a = std::make_shared<TaskGroup>("a");
+  const auto group_b = std::make_shared<TaskGroup>("b");
+  group_a->record_execution(std::chrono::nanoseconds{0}, std::chrono::nanoseconds{100});
+
+  const auto task_a1 = make_task(group_a);
+  const auto task_a2 = make_task(group_a);
+  const auto task_b = make_task(group_b);
+  const auto task_high = make_task(group_a);
+  queue.push(task_a1, static_cast<uint32_t>(SchedulePriority::Default));
+  queue.push(task_a2, static_cast<uint32_t>(SchedulePriority::Default));
+
+  // group_b enters the queue after group_a, so it catches up to the queue's virtual runtime, which is still 0
+  queue.push(task_b, static_cast<uint32_t>(SchedulePriority::Default));
+  EXPECT_EQ(group_b->virtual_runtime(), 0u);
+  EXPECT_TRUE(queue.has_group_behind(*group_a));
+  EXPECT_FALSE(queue.has_group_behind(*group_b));
+
+  // High priority tasks bypass the groups
+  queue.push(task_high, static_cast<uint32_t>(SchedulePriority::High));
+
+  EXPECT_EQ(queue.pull(), task_high);
+  EXPECT_EQ(queue.pull(), task_b);
+  EXPECT_EQ(queue.pull(), task_a1);
+  EXPECT_EQ(queue.pull(), task_a2);
+  EXPECT_EQ(queue.pull(), nullptr);
+  EXPECT_TRUE(queue.empty());
+
+  // A group that enters the queue again cannot make up for the time it was inactive
+  queue.push(make_task(group_b), static_cast<uint32_t>(SchedulePriority::Default));
+  EXPECT_EQ(group_b->virtual_runtime(), 100u);
+  queue.pull();
+}
+
+TEST_F(TaskGroupTest, QueueSkipsPendingGroups) {
+  auto queue = TaskQueue{NodeID{0}};
+  const auto group = std::make_shared<TaskGroup>("a");
+  group->set_admission_state(TaskGroup::AdmissionState::Pending);
+
+  const auto task = make_task(group);
+  queue.push(task, static_cast<uint32_t>(SchedulePriority::Default));
+  EXPECT_FALSE(queue.empty());
+  EXPECT_EQ(queue.pull(), nullptr);
+
+  group->set_admission_state(TaskGroup::AdmissionState::Admitted);
+  queue.notify_group_admitted();
+  EXPECT_EQ(queue.steal(), task);
+}
+
+TEST_F(TaskGroupTest, TasksJoinTheCurrentGroup) {
+  Topology::use_fake_numa_topology(4, 2);
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+
+  const auto group = std::make_shared<TaskGroup>("a");
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  const auto task = std::make_shared<JobTask>([&]() {
+    EXPECT_EQ(TaskGroup::current(), group);
+    for (auto job_index = 0; job_index < 10; ++job_index) {
+      jobs.emplace_back(std::make_shared<JobTask>([&]() { EXPECT_EQ(TaskGroup::current(), group); }));
+    }
+    CurrentScheduler::schedule_and_wait_for_tasks(jobs);
+  });
+
+  {
+    const auto scope = TaskGroup::Scope{group};
+    task->schedule();
+  }
+  CurrentScheduler::wait_for_tasks(std::vector<std::shared_ptr<AbstractTask>>{task});
+
+  EXPECT_EQ(task->group(), group);
+  for (const auto& job : jobs) {
+    EXPECT_EQ(job->group(), group);
+  }
+  EXPECT_EQ(group->executed_task_count(), 11u);
+
+  CurrentScheduler::get()->finish();
+}
+
+TEST_F(TaskGroupTest, ShortGroupIsNotStarved) {
+  // The single worker is busy with the jobs of group_a, which are in its own deque. A task of group_b has to be
+  // executed before all of them are done.
+  Topology::use_default_topology(1);
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+
+  const auto group_a = std::make_shared<TaskGroup>("a");
+  const auto group_b = std::make_shared<TaskGroup>("b");
+  constexpr auto JOB_COUNT = 100u;
+
+  std::atomic_uint finished_jobs_a{0};
+  const auto task_a = std::make_shared<JobTask>([&]() {
+    auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+    for (auto job_index = 0u; job_index < JOB_COUNT; ++job_index) {
+      jobs.emplace_back(std::make_shared<JobTask>([&]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        ++finished_jobs_a;
+      }));
+    }
+    CurrentScheduler::schedule_and_wait_for_tasks(jobs);
+  });
+  task_a->set_group(group_a);
+  task_a->schedule();
+
+  while (finished_jobs_a < 5) std::this_thread::yield();
+
+  auto finished_jobs_a_before_b = JOB_COUNT;
+  const auto task_b = std::make_shared<JobTask>([&]() { finished_jobs_a_before_b = finished_jobs_a; });
+  task_b->set_group(group_b);
+  task_b->schedule();
+
+  CurrentScheduler::wait_for_tasks(std::vector<std::shared_ptr<AbstractTask>>{task_a, task_b});
+  EXPECT_LT(finished_jobs_a_before_b, JOB_COUNT);
+
+  CurrentScheduler::get()->finish();
+}
+
+TEST_F(TaskGroupTest, AdmissionControl) {
+  Topology::use_fake_numa_topology(4, 2);
+  const auto scheduler = std::make_shared<NodeQueueScheduler>();
+  CurrentScheduler::set(scheduler);
+  scheduler->set_max_admitted_groups(1);
+
+  const auto group_a = std::make_shared<TaskGroup>("a");
+  const auto group_b = std::make_shared<TaskGroup>("b");
+  scheduler->request_admission(group_a);
+  scheduler->request_admission(group_b);
+  EXPECT_EQ(group_a->admission_state(), TaskGroup::AdmissionState::Admitted);
+  EXPECT_EQ(group_b->admission_state(), TaskGroup::AdmissionState::Pending);
+  EXPECT_EQ(scheduler->admitted_group_count(), 1u);
+  EXPECT_EQ(scheduler->pending_group_count(), 1u);
+
+  std::atomic_bool task_b_done{false};
+  const auto task_b = std::make_shared<JobTask>([&]() { task_b_done = true; });
+  task_b->set_group(group_b);
+  task_b->schedule();
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  EXPECT_FALSE(task_b_done);
+
+  scheduler->release_admission(group_a);
+  EXPECT_EQ(group_a->admission_state(), TaskGroup::AdmissionState::Unrestricted);
+  EXPECT_EQ(group_b->admission_state(), TaskGroup::AdmissionState::Admitted);
+  CurrentScheduler::wait_for_tasks(std::vector<std::shared_ptr<AbstractTask>>{task_b});
+  EXPECT_TRUE(task_b_done);
+  EXPECT_GT(group_b->admission_wait_duration(), std::chrono::nanoseconds{0});
+
+  scheduler->release_admission(group_b);
+  EXPECT_EQ(scheduler->admitted_group_count(), 0u);
+  EXPECT_EQ(scheduler->pending_group_count(), 0u);
+
+  CurrentScheduler::get()->finish();
+}
+
+TEST_F(TaskGroupTest, AdmissionIsReleasedIfTasksThrow) {
+  Topology::use_fake_numa_topology(4, 2);
+  const auto scheduler = std::make_shared<NodeQueueScheduler>();
+  CurrentScheduler::set(scheduler);
+  scheduler->set_max_admitted_groups(1);
+
+  const auto group = std::make_shared<TaskGroup>("group");
+  try {
+    const auto admission = AbstractScheduler::Admission{scheduler, group};
+    EXPECT_EQ(group->admission_state(), TaskGroup::AdmissionState::Admitted);
+    throw std::logic_error("Operator failed");
+  } catch (const std::logic_error&) {
+  }
+  EXPECT_EQ(group->admission_state(), TaskGroup::AdmissionState::Unrestricted);
+  EXPECT_EQ(scheduler->admitted_group_count(), 0u);
+
+  CurrentScheduler::get()->finish();
+}
+
+TEST_F(TaskGroupTest, WorkerDoesNotStartStatementsWhileWaitingForAdmittedGroup) {
+  // Like the tasks of the server, each task executes a statement in the default group. While the only worker waits
+  // for the first statement, it must not start the second one, which would wait for admission behind the first.
+  Topology::use_fake_numa_topology(1, 1);
+  const auto scheduler = std::make_shared<NodeQueueScheduler>();
+  CurrentScheduler::set(scheduler);
+  scheduler->set_max_admitted_groups(1);
+
+  StorageManager::get().add_table("table_a", load_table("resources/test_data/tbl/int_float.tbl", 2));
+
+  auto tasks = std::vector<std::shared_ptr<AbstractTask>>{};
+  std::atomic<size_t> executed_statement_count{0};
+  for (auto task_index = 0; task_index < 2; ++task_index) {
+    tasks.emplace_back(std::make_shared<JobTask>([&]() {
+      auto sql_pipeline = SQLPipelineBuilder{"SELECT * FROM table_a WHERE a > 1000"}.create_pipeline_statement();
+      sql_pipeline.get_result_table();
+      ++executed_statement_count;
+    }));
+  }
+  CurrentScheduler::schedule_and_wait_for_tasks(tasks);
+
+  EXPECT_EQ(executed_statement_count, 2u);
+  EXPECT_EQ(scheduler->admitted_group_count(), 0u);
+  EXPECT_EQ(scheduler->pending_group_count(), 0u);
+
+  CurrentScheduler::get()->finish();
+}
+
+TEST_F(TaskGroupTest, SQLPipelineStatementsExecuteInTheirOwnGroup) {
+  Topology::use_fake_numa_topology(4, 2);
+  const auto scheduler = std::make_shared<NodeQueueScheduler>();
+  CurrentScheduler::set(scheduler);
+  scheduler->set_max_admitted_groups(1);
+
+  StorageManager::get().add_table("table_a", load_table("resources/test_data/tbl/int_float.tbl", 2));
+
+  const auto session_group = std::make_shared<TaskGroup>("session", TaskGroup::DEFAULT_WEIGHT * 3);
+  auto sql_pipeline = SQLPipelineBuilder{"SELECT * FROM table_a WHERE a > 1000"}.create_pipeline_statement();
+  {
+    const auto scope = TaskGroup::Scope{session_group};
+    sql_pipeline.get_result_table();
+  }
+
+  const auto& task_group = sql_pipeline.task_group();
+  ASSERT_TRUE(task_group);
+  EXPECT_NE(task_group, session_group);
+  EXPECT_EQ(task_group->weight(), session_group->weight());
+  EXPECT_EQ(task_group->admission_state(), TaskGroup::AdmissionState::Unrestricted);
+  // The JobTasks of the TableScan also belong to the group
+  EXPECT_GE(task_group->executed_task_count(), sql_pipeline.get_tasks().size());
+  EXPECT_EQ(scheduler->admitted_group_count(), 0u);
+
+  CurrentScheduler::get()->finish();
+}
+
+}  // namespace opossum
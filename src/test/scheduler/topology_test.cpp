@@ -0,0 +1,102 @@
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <thread>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "scheduler/topology.hpp"
+
+namespace opossum {
+
+class TopologyTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // Two physical cores with two hardware threads each, where the CPUs 0 and 1 as well as 2 and 3 are SMT siblings.
+    // Each core has its own L2 and L3 cache.
+    _sysfs_cpu_path = std::filesystem::path{test_data_path} / "sysfs_cpu";
+    for (auto cpu_id = 0; cpu_id < 4; ++cpu_id) {
+      const auto cpu_path = _sysfs_cpu_path / ("cpu" + std::to_string(cpu_id));
+      const auto core_cpus = cpu_id < 2 ? std::string{"0-1"} : std::string{"2-3"};
+      _write_file(cpu_path / "topology" / "thread_siblings_list", core_cpus);
+      _write_cache(cpu_path / "cache" / "index0", "1", "Instruction", "32K", std::to_string(cpu_id));
+      _write_cache(cpu_path / "cache" / "index1", "2", "Unified", "1M", core_cpus);
+      _write_cache(cpu_path / "cache" / "index2", "3", "Unified", "16384K", core_cpus);
+    }
+  }
+
+  void TearDown() override {
+    std::filesystem::remove_all(_sysfs_cpu_path);
+    Topology::set_sysfs_cpu_path(Topology::DEFAULT_SYSFS_CPU_PATH);
+    Topology::use_default_topology();
+  }
+
+  void _write_file(const std::filesystem::path& path, const std::string& content) {
+    std::filesystem::create_directories(path.parent_path());
+    auto file = std::ofstream{path};
+    file << content << '\n';
+  }
+
+  void _write_cache(const std::filesystem::path& path, const std::string& level, const std::string& type,
+                    const std::string& size, const std::string& shared_cpus) {
+    _write_file(path / "level", level);
+    _write_file(path / "type", type);
+    _write_file(path / "size", size);
+    _write_file(path / "shared_cpu_list", shared_cpus);
+  }
+
+  std::filesystem::path _sysfs_cpu_path;
+};
+
+TEST_F(TopologyTest, CoresAndCacheDomains) {
+  if (std::thread::hardware_concurrency() < 4) {
+    // The topology cannot have more CPUs than the machine
+    GTEST_SKIP();
+  }
+
+  Topology::set_sysfs_cpu_path(_sysfs_cpu_path);
+  Topology::use_fake_numa_topology(4, 4);
+
+  ASSERT_EQ(Topology::get().nodes().size(), 1u);
+  const auto& cpus = Topology::get().nodes()[0].cpus;
+  ASSERT_EQ(cpus.size(), 4u);
+  for (auto cpu_id = CpuID{0}; cpu_id < 4; ++cpu_id) {
+    EXPECT_EQ(cpus[cpu_id].cpu_id, cpu_id);
+    EXPECT_EQ(cpus[cpu_id].core_id, cpu_id - cpu_id % 2);
+    EXPECT_EQ(cpus[cpu_id].cache_domain_id, cpu_id - cpu_id % 2);
+  }
+  EXPECT_EQ(Topology::get().l2_cache_size(), 1024u * 1024u);
+}
+
+TEST_F(TopologyTest, SmtSiblingsAreUsedLast) {
+  if (std::thread::hardware_concurrency() < 4) {
+    GTEST_SKIP();
+  }
+
+  // Instead of the siblings 0 and 1, the first hardware threads of both cores are used
+  Topology::set_sysfs_cpu_path(_sysfs_cpu_path);
+  Topology::use_non_numa_topology(2);
+
+  ASSERT_EQ(Topology::get().num_cpus(), 2u);
+  const auto& cpus = Topology::get().nodes()[0].cpus;
+  ASSERT_EQ(cpus.size(), 2u);
+  EXPECT_EQ(cpus[0].cpu_id, CpuID{0});
+  EXPECT_EQ(cpus[1].cpu_id, CpuID{2});
+}
+
+TEST_F(TopologyTest, MissingSysfs) {
+  Topology::set_sysfs_cpu_path(_sysfs_cpu_path / "does_not_exist");
+  Topology::use_fake_numa_topology(4, 2);
+
+  // Each CPU is its own core and all CPUs of a node share a cache domain
+  for (const auto& node : Topology::get().nodes()) {
+    for (const auto& cpu : node.cpus) {
+      EXPECT_EQ(cpu.core_id, cpu.cpu_id);
+      EXPECT_EQ(cpu.cache_domain_id, node.cpus.front().cpu_id);
+    }
+  }
+  EXPECT_EQ(Topology::get().l2_cache_size(), Topology::DEFAULT_L2_CACHE_SIZE);
+}
+
+}  // namespace opossum
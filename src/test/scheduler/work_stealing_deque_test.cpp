@@ -0,0 +1,125 @@
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "scheduler/job_task.hpp"
+#include "scheduler/work_stealing_deque.hpp"
+
+namespace opossum {
+
+class WorkStealingDequeTest : public BaseTest {
+ protected:
+  static std::vector<std::shared_ptr<AbstractTask>> create_tasks(const size_t task_count) {
+    auto tasks = std::vector<std::shared_ptr<AbstractTask>>{};
+    for (auto task_index = size_t{0}; task_index < task_count; ++task_index) {
+      tasks.emplace_back(std::make_shared<JobTask>([]() {}));
+    }
+    return tasks;
+  }
+};
+
+TEST_F(WorkStealingDequeTest, PopIsLifoStealIsFifo) {
+  auto deque = WorkStealingDeque{};
+  EXPECT_TRUE(deque.empty());
+  EXPECT_EQ(deque.pop(), nullptr);
+  EXPECT_EQ(deque.steal(), nullptr);
+
+  const auto tasks = create_tasks(4);
+  for (const auto& task : tasks) {
+    deque.push(task);
+  }
+  EXPECT_FALSE(deque.empty());
+
+  EXPECT_EQ(deque.pop(), tasks[3]);
+  EXPECT_EQ(deque.steal(), tasks[0]);
+  EXPECT_EQ(deque.pop(), tasks[2]);
+  EXPECT_EQ(deque.steal(), tasks[1]);
+  EXPECT_EQ(deque.pop(), nullptr);
+  EXPECT_TRUE(deque.empty());
+}
+
+TEST_F(WorkStealingDequeTest, KeepsTasksAlive) {
+  auto deque = WorkStealingDeque{};
+
+  auto task = std::make_shared<JobTask>([]() {});
+  const auto weak_task = std::weak_ptr<AbstractTask>{task};
+  deque.push(task);
+  task = nullptr;
+  EXPECT_FALSE(weak_task.expired());
+
+  // The popped task is only referenced by the returned pointer
+  auto popped_task = deque.pop();
+  EXPECT_EQ(popped_task.use_count(), 1);
+  popped_task = nullptr;
+  EXPECT_TRUE(weak_task.expired());
+}
+
+TEST_F(WorkStealingDequeTest, Grow) {
+  auto deque = WorkStealingDeque{};
+
+  const auto tasks = create_tasks(WorkStealingDeque::INITIAL_CAPACITY * 4 + 1);
+  for (const auto& task : tasks) {
+    deque.push(task);
+  }
+
+  EXPECT_EQ(deque.steal(), tasks.front());
+  for (auto task_iter = tasks.rbegin(); task_iter != tasks.rend() - 1; ++task_iter) {
+    EXPECT_EQ(deque.pop(), *task_iter);
+  }
+  EXPECT_TRUE(deque.empty());
+}
+
+TEST_F(WorkStealingDequeTest, ConcurrentSteal) {
+  // The owner pushes and pops while thieves steal. Every task has to be taken exactly once.
+  constexpr auto TASK_COUNT = size_t{20'000};
+  constexpr auto THIEF_COUNT = size_t{4};
+
+  auto deque = WorkStealingDeque{};
+  auto taken_counts = std::vector<std::atomic_uint>(TASK_COUNT);
+  auto taken_task_count = std::atomic<size_t>{0};
+
+  auto tasks = std::vector<std::shared_ptr<AbstractTask>>{};
+  for (auto task_index = size_t{0}; task_index < TASK_COUNT; ++task_index) {
+    tasks.emplace_back(std::make_shared<JobTask>([&taken_counts, task_index]() { ++taken_counts[task_index]; }));
+  }
+
+  auto thieves = std::vector<std::thread>{};
+  for (auto thief_index = size_t{0}; thief_index < THIEF_COUNT; ++thief_index) {
+    thieves.emplace_back([&]() {
+      while (taken_task_count < TASK_COUNT) {
+        if (const auto task = deque.steal()) {
+          task->execute();
+          ++taken_task_count;
+        }
+      }
+    });
+  }
+
+  for (auto task_index = size_t{0}; task_index < TASK_COUNT; ++task_index) {
+    deque.push(tasks[task_index]);
+    if (task_index % 3 == 0) {
+      if (const auto task = deque.pop()) {
+        task->execute();
+        ++taken_task_count;
+      }
+    }
+  }
+  while (const auto task = deque.pop()) {
+    task->execute();
+    ++taken_task_count;
+  }
+
+  for (auto& thief : thieves) {
+    thief.join();
+  }
+
+  EXPECT_EQ(taken_task_count, TASK_COUNT);
+  for (const auto& taken_count : taken_counts) {
+    EXPECT_EQ(taken_count, 1u);
+  }
+}
+
+}  // namespace opossum
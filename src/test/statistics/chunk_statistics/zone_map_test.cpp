@@ -0,0 +1,127 @@
+#include <cmath>
+#include <memory>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "statistics/chunk_statistics/zone_map.hpp"
+#include "storage/value_segment.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class ZoneMapTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // Three blocks of four rows: [1, 4], [5, 5] with a NULL, and [8, 9] (the last block only holds two rows)
+    _segment = std::make_shared<ValueSegment<int32_t>>(true);
+    for (const auto& value : std::vector<AllTypeVariant>{1, 2, 3, 4, 5, NullValue{}, 5, 5, 9, 8}) {
+      _segment->append(value);
+    }
+    _zone_map = ZoneMap<int32_t>::build(*_segment, ChunkOffset{4});
+  }
+
+  std::shared_ptr<ValueSegment<int32_t>> _segment;
+  std::shared_ptr<ZoneMap<int32_t>> _zone_map;
+};
+
+TEST_F(ZoneMapTest, Build) {
+  ASSERT_TRUE(_zone_map);
+  EXPECT_EQ(_zone_map->row_count(), 10u);
+  EXPECT_EQ(_zone_map->block_size(), 4u);
+  ASSERT_EQ(_zone_map->block_count(), 3u);
+
+  const auto& blocks = _zone_map->blocks();
+  EXPECT_EQ(blocks[0].min, 1);
+  EXPECT_EQ(blocks[0].max, 4);
+  EXPECT_EQ(blocks[0].null_value_count, 0u);
+  EXPECT_EQ(blocks[1].min, 5);
+  EXPECT_EQ(blocks[1].max, 5);
+  EXPECT_EQ(blocks[1].null_value_count, 1u);
+  EXPECT_EQ(blocks[2].min, 8);
+  EXPECT_EQ(blocks[2].max, 9);
+  EXPECT_EQ(blocks[2].null_value_count, 0u);
+}
+
+TEST_F(ZoneMapTest, NoZoneMapForSingleBlock) {
+  EXPECT_FALSE(ZoneMap<int32_t>::build(*_segment, ChunkOffset{10}));
+  EXPECT_TRUE(ZoneMap<int32_t>::build(*_segment, ChunkOffset{9}));
+}
+
+TEST_F(ZoneMapTest, LeadingNullValues) {
+  auto segment = ValueSegment<int32_t>{true};
+  for (const auto& value : std::vector<AllTypeVariant>{NullValue{}, NullValue{}, 7, 3, NullValue{}}) {
+    segment.append(value);
+  }
+  const auto zone_map = ZoneMap<int32_t>::build(segment, ChunkOffset{2});
+
+  ASSERT_TRUE(zone_map);
+  const auto& blocks = zone_map->blocks();
+  EXPECT_EQ(blocks[0].null_value_count, 2u);
+  EXPECT_EQ(blocks[1].min, 3);
+  EXPECT_EQ(blocks[1].max, 7);
+  EXPECT_EQ(blocks[2].null_value_count, 1u);
+
+  // Blocks that only hold NULLs never match
+  EXPECT_EQ(zone_map->evaluate(PredicateCondition::NotEquals, 8),
+            (std::vector{ZoneMapBlockMatch::None, ZoneMapBlockMatch::All, ZoneMapBlockMatch::None}));
+}
+
+TEST_F(ZoneMapTest, NanValues) {
+  using M = ZoneMapBlockMatch;
+
+  // The NaN is neither the first value of its block nor part of the value range
+  auto segment = ValueSegment<float>{false};
+  for (const auto value : {1.0f, 2.0f, 3.0f, std::nanf(""), 4.0f, 5.0f}) {
+    segment.append(value);
+  }
+  const auto zone_map = ZoneMap<float>::build(segment, ChunkOffset{3});
+
+  ASSERT_TRUE(zone_map);
+  const auto& blocks = zone_map->blocks();
+  EXPECT_FALSE(blocks[0].contains_nan);
+  EXPECT_TRUE(blocks[1].contains_nan);
+  EXPECT_EQ(blocks[1].min, 4.0f);
+  EXPECT_EQ(blocks[1].max, 5.0f);
+
+  // Even though all other values of the block match, the NaN row does not
+  EXPECT_EQ(zone_map->evaluate(PredicateCondition::GreaterThan, 3.5f), (std::vector{M::None, M::Some}));
+  EXPECT_EQ(zone_map->evaluate(PredicateCondition::NotEquals, 6.0f), (std::vector{M::All, M::Some}));
+  EXPECT_EQ(zone_map->evaluate(PredicateCondition::LessThan, 4.0f), (std::vector{M::All, M::Some}));
+}
+
+TEST_F(ZoneMapTest, EvaluateComparisons) {
+  using M = ZoneMapBlockMatch;
+
+  // The block with the NULL value is never reported as matching entirely
+  EXPECT_EQ(_zone_map->evaluate(PredicateCondition::Equals, 5), (std::vector{M::None, M::Some, M::None}));
+  EXPECT_EQ(_zone_map->evaluate(PredicateCondition::Equals, 3), (std::vector{M::Some, M::None, M::None}));
+  EXPECT_EQ(_zone_map->evaluate(PredicateCondition::NotEquals, 5), (std::vector{M::All, M::None, M::All}));
+  EXPECT_EQ(_zone_map->evaluate(PredicateCondition::LessThan, 5), (std::vector{M::All, M::None, M::None}));
+  EXPECT_EQ(_zone_map->evaluate(PredicateCondition::LessThanEquals, 8), (std::vector{M::All, M::Some, M::Some}));
+  EXPECT_EQ(_zone_map->evaluate(PredicateCondition::GreaterThan, 4), (std::vector{M::None, M::Some, M::All}));
+  EXPECT_EQ(_zone_map->evaluate(PredicateCondition::GreaterThanEquals, 2), (std::vector{M::Some, M::Some, M::All}));
+  EXPECT_EQ(_zone_map->evaluate(PredicateCondition::GreaterThanEquals, 10), (std::vector{M::None, M::None, M::None}));
+}
+
+TEST_F(ZoneMapTest, EvaluateBetween) {
+  using M = ZoneMapBlockMatch;
+
+  EXPECT_EQ(_zone_map->evaluate(PredicateCondition::BetweenInclusive, 1, 4), (std::vector{M::All, M::None, M::None}));
+  EXPECT_EQ(_zone_map->evaluate(PredicateCondition::BetweenExclusive, 1, 4), (std::vector{M::Some, M::None, M::None}));
+  EXPECT_EQ(_zone_map->evaluate(PredicateCondition::BetweenLowerExclusive, 4, 9),
+            (std::vector{M::None, M::Some, M::All}));
+  EXPECT_EQ(_zone_map->evaluate(PredicateCondition::BetweenUpperExclusive, 2, 9),
+            (std::vector{M::Some, M::Some, M::Some}));
+  EXPECT_EQ(_zone_map->evaluate(PredicateCondition::BetweenInclusive, 6, 7), (std::vector{M::None, M::None, M::None}));
+}
+
+TEST_F(ZoneMapTest, EvaluateUnsupported) {
+  using M = ZoneMapBlockMatch;
+
+  EXPECT_EQ(_zone_map->evaluate(PredicateCondition::Equals, NullValue{}), (std::vector{M::Some, M::Some, M::Some}));
+  EXPECT_EQ(_zone_map->evaluate(PredicateCondition::IsNull, 5), (std::vector{M::Some, M::Some, M::Some}));
+}
+
+}  // namespace opossum
@@ -10,6 +10,7 @@
 
 #include "storage/base_segment.hpp"
 #include "storage/chunk.hpp"
+#include "storage/chunk_encoder.hpp"
 #include "storage/index/b_tree/b_tree_index.hpp"
 #include "types.hpp"
 
@@ -26,6 +27,11 @@ class BTreeIndexTest : public BaseTest {
     chunk_offsets = &(index->_impl->_chunk_offsets);
   }
 
+  template <typename DataType>
+  static size_t inner_level_count(const std::shared_ptr<BTreeIndex>& btree_index) {
+    return std::static_pointer_cast<BTreeIndexImpl<DataType>>(btree_index->_impl)->_inner_levels.size();
+  }
+
   std::vector<pmr_string> values;
   std::vector<pmr_string> sorted;
   std::shared_ptr<BTreeIndex> index = nullptr;
@@ -65,9 +71,75 @@ TEST_F(BTreeIndexTest, IndexProbes) {
   EXPECT_EQ(index->upper_bound({"inbox"}) - begin, 8);
 }
 
+TEST_F(BTreeIndexTest, MultiLevelTree) {
+  // Enough distinct values for a tree with two inner levels
+  auto int_values = pmr_concurrent_vector<int32_t>{};
+  for (auto value = int32_t{0}; value < 3'000; ++value) {
+    int_values.push_back((value * 7) % 1'500);
+  }
+  const auto int_segment = std::make_shared<ValueSegment<int32_t>>(std::move(int_values));
+  const auto int_index = std::make_shared<BTreeIndex>(std::vector<std::shared_ptr<const BaseSegment>>({int_segment}));
+  ASSERT_EQ(inner_level_count<int32_t>(int_index), 2u);
+
+  const auto begin = int_index->cbegin();
+  EXPECT_EQ(int_index->lower_bound({-1}) - begin, 0);
+  EXPECT_EQ(int_index->upper_bound({-1}) - begin, 0);
+  for (auto value = int32_t{0}; value < 1'500; ++value) {
+    EXPECT_EQ(int_index->lower_bound({value}) - begin, value * 2);
+    EXPECT_EQ(int_index->upper_bound({value}) - begin, value * 2 + 2);
+    EXPECT_EQ((*int_segment)[*(int_index->lower_bound({value}))], AllTypeVariant{value});
+  }
+  EXPECT_EQ(int_index->lower_bound({1'500}), int_index->cend());
+  EXPECT_EQ(int_index->upper_bound({1'500}), int_index->cend());
+}
+
+TEST_F(BTreeIndexTest, DictionarySegment) {
+  const auto dictionary_segment = encode_segment(EncodingType::Dictionary, DataType::String, segment);
+  const auto dictionary_index =
+      std::make_shared<BTreeIndex>(std::vector<std::shared_ptr<const BaseSegment>>({dictionary_segment}));
+
+  EXPECT_EQ(std::vector<ChunkOffset>(dictionary_index->cbegin(), dictionary_index->cend()), *chunk_offsets);
+
+  const auto begin = dictionary_index->cbegin();
+  EXPECT_EQ(dictionary_index->lower_bound({"charlie"}) - begin, 1);
+  EXPECT_EQ(dictionary_index->upper_bound({"charlie"}) - begin, 3);
+  EXPECT_EQ(dictionary_index->lower_bound({"dog"}) - begin, 5);
+  EXPECT_EQ(dictionary_index->upper_bound({"zebra"}), dictionary_index->cend());
+}
+
+TEST_F(BTreeIndexTest, NullValues) {
+  auto int_values = pmr_concurrent_vector<int32_t>{3, 0, 1, 0, 3};
+  auto null_values = pmr_concurrent_vector<bool>{false, true, false, true, false};
+  const auto int_segment = std::make_shared<ValueSegment<int32_t>>(std::move(int_values), std::move(null_values));
+
+  const auto dictionary_segment = encode_segment(EncodingType::Dictionary, DataType::Int, int_segment);
+  for (const auto& indexed_segment : std::vector<std::shared_ptr<const BaseSegment>>{int_segment, dictionary_segment}) {
+    const auto int_index =
+        std::make_shared<BTreeIndex>(std::vector<std::shared_ptr<const BaseSegment>>({indexed_segment}));
+    EXPECT_EQ(std::vector<ChunkOffset>(int_index->cbegin(), int_index->cend()), std::vector<ChunkOffset>({2, 0, 4}));
+    EXPECT_EQ(int_index->lower_bound({0}) - int_index->cbegin(), 0);
+    EXPECT_EQ(int_index->lower_bound({3}) - int_index->cbegin(), 1);
+  }
+
+  const auto empty_segment = std::make_shared<ValueSegment<int32_t>>(pmr_concurrent_vector<int32_t>{0, 0},
+                                                                     pmr_concurrent_vector<bool>{true, true});
+  const auto empty_index =
+      std::make_shared<BTreeIndex>(std::vector<std::shared_ptr<const BaseSegment>>({empty_segment}));
+  EXPECT_EQ(empty_index->cbegin(), empty_index->cend());
+  EXPECT_EQ(empty_index->lower_bound({0}), empty_index->cend());
+  EXPECT_EQ(empty_index->upper_bound({0}), empty_index->cend());
+}
+
+TEST_F(BTreeIndexTest, EstimateMemoryConsumption) {
+  // 20 int keys need two leaves of 16 keys and a root: 100 * 4 bytes + 2 * 16 * (4 + 4) bytes + 16 * 4 bytes
+  EXPECT_EQ(BTreeIndex::estimate_memory_consumption(100, 20, 4), 720u);
+  EXPECT_EQ(BTreeIndex::estimate_memory_consumption(0, 0, 4), 0u);
+}
+
 // The following tests contain switches for different implementations of the stdlib.
 // Short String Optimization (SSO) stores strings of a certain size in the pmr_string object itself.
 // Only strings exceeding this size (15 for libstdc++ and 22 for libc++) are stored on the heap.
+// All of them fit into a single leaf, so that the tree has no inner nodes.
 
 TEST_F(BTreeIndexTest, MemoryConsumptionVeryShortString) {
   values = {"h", "d", "f", "d", "a", "c", "c", "i", "b", "z", "x"};
@@ -77,18 +149,18 @@ TEST_F(BTreeIndexTest, MemoryConsumptionVeryShortString) {
 // Index memory consumption depends on implementation of pmr_string.
 #ifdef __GLIBCXX__
   // libstdc++:
-  //   840 (reported by cpp_btree implementation)
-  // +  24 std::vector<ChunkOffset> object overhead
+  //    96 BTreeIndexImpl object
   // +  44 number of elements (11) * sizeof(ChunkOffset) (4)
-  // =  908
-  EXPECT_EQ(index->memory_consumption(), 908u);
+  // + 704 one leaf: 16 keys * sizeof(pmr_string) (40) + 16 positions * sizeof(ChunkOffset) (4)
+  // = 844
+  EXPECT_EQ(index->memory_consumption(), 844u);
 #else
   // libc++:
-  //   848 (reported by cpp_btree implementation)
-  // +  24 std::vector<ChunkOffset> object overhead
+  //    96 BTreeIndexImpl object
   // +  44 number of elements (11) * sizeof(ChunkOffset) (4)
-  // =  916
-  EXPECT_EQ(index->memory_consumption(), 916u);
+  // + 576 one leaf: 16 keys * sizeof(pmr_string) (32) + 16 positions * sizeof(ChunkOffset) (4)
+  // = 716
+  EXPECT_EQ(index->memory_consumption(), 716u);
 #endif
 }
 
@@ -99,18 +171,18 @@ TEST_F(BTreeIndexTest, MemoryConsumptionShortString) {
 // Index memory consumption depends on implementation of pmr_string.
 #ifdef __GLIBCXX__
   // libstdc++:
-  //   841 (reported by cpp_btree implementation)
-  // +  24 std::vector<ChunkOffset> object overhead
+  //    96 BTreeIndexImpl object
   // +  32 number of elements (8) * sizeof(ChunkOffset) (4)
-  // =  896
-  EXPECT_EQ(index->memory_consumption(), 896u);
+  // + 704 one leaf: 16 keys * sizeof(pmr_string) (40) + 16 positions * sizeof(ChunkOffset) (4)
+  // = 832
+  EXPECT_EQ(index->memory_consumption(), 832u);
 #else
   // libc++:
-  //   264 (reported by cpp_btree implementation)
-  // +  24 std::vector<ChunkOffset> object overhead
+  //    96 BTreeIndexImpl object
   // +  32 number of elements (8) * sizeof(ChunkOffset) (4)
-  // =  320
-  EXPECT_EQ(index->memory_consumption(), 320u);
+  // + 576 one leaf: 16 keys * sizeof(pmr_string) (32) + 16 positions * sizeof(ChunkOffset) (4)
+  // = 704
+  EXPECT_EQ(index->memory_consumption(), 704u);
 #endif
 }
 
@@ -126,25 +198,25 @@ TEST_F(BTreeIndexTest, MemoryConsumptionLongString) {
 // Index memory consumption depends on implementation of pmr_string.
 #ifdef __GLIBCXX__
   // libstdc++:
-  //    576 (reported by cpp_btree implementation)
-  // +   24 std::vector<ChunkOffset> object overhead
-  // +   32 number of elements (8) * sizeof(ChunkOffset) (4)
-  // +   20 "appleappleappleapple"
-  // +   21 "charliecharliecharlie"
-  // +   20 "deltadeltadeltadelta"
-  // +   20 "frankfrankfrankfrank"
-  // +   20 "inboxinboxinboxinbox"
-  // +   25 "hotelhotelhotelhotelhotel"
-  // =   446
-  EXPECT_EQ(index->memory_consumption(), 1022u);
+  //    96 BTreeIndexImpl object
+  // +  32 number of elements (8) * sizeof(ChunkOffset) (4)
+  // + 704 one leaf: 16 keys * sizeof(pmr_string) (40) + 16 positions * sizeof(ChunkOffset) (4)
+  // +  20 "appleappleappleapple"
+  // +  21 "charliecharliecharlie"
+  // +  20 "deltadeltadeltadelta"
+  // +  20 "frankfrankfrankfrank"
+  // +  20 "inboxinboxinboxinbox"
+  // +  25 "hotelhotelhotelhotelhotel"
+  // = 958
+  EXPECT_EQ(index->memory_consumption(), 958u);
 #else
   // libc++ Only one string exceeds the reserved space (22 characters) for small strings:
-  //   264 (reported by cpp_btree implementation)
-  // +  24 std::vector<ChunkOffset> object overhead
+  //    96 BTreeIndexImpl object
   // +  32 number of elements (8) * sizeof(ChunkOffset) (4)
+  // + 576 one leaf: 16 keys * sizeof(pmr_string) (32) + 16 positions * sizeof(ChunkOffset) (4)
   // +  25 "hotelhotelhotelhotelhotel"
-  // =  345
-  EXPECT_EQ(index->memory_consumption(), 345u);
+  // = 729
+  EXPECT_EQ(index->memory_consumption(), 729u);
 #endif
 }
 
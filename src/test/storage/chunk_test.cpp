@@ -1,4 +1,6 @@
+#include <atomic>
 #include <memory>
+#include <thread>
 
 #include "base_test.hpp"
 #include "gtest/gtest.h"
@@ -203,6 +205,31 @@ TEST_F(StorageChunkTest, RemoveIndex) {
             indices_for_segment_0.cend());
 }
 
+TEST_F(StorageChunkTest, AddAndRemoveIndexesConcurrently) {
+  chunk = std::make_shared<Chunk>(Segments({ds_int, ds_str}));
+  const auto index_str = chunk->create_index<GroupKeyIndex>(std::vector<ColumnID>{ColumnID{1}});
+
+  // Readers always see a consistent list of indexes, while another thread adds and removes an index
+  auto done = std::atomic_bool{false};
+  auto writer = std::thread([&]() {
+    for (auto iteration = 0; iteration < 100; ++iteration) {
+      const auto index_int = chunk->create_index<GroupKeyIndex>(std::vector<ColumnID>{ColumnID{0}});
+      chunk->remove_index(index_int);
+    }
+    done = true;
+  });
+
+  while (!done) {
+    EXPECT_EQ(chunk->get_index(SegmentIndexType::GroupKey, std::vector<ColumnID>{ColumnID{1}}), index_str);
+    const auto indices = chunk->indices();
+    EXPECT_GE(indices.size(), 1u);
+    EXPECT_LE(indices.size(), 2u);
+  }
+  writer.join();
+
+  EXPECT_EQ(chunk->indices().size(), 1u);
+}
+
 TEST_F(StorageChunkTest, OrderedBy) {
   EXPECT_EQ(chunk->ordered_by(), std::nullopt);
   const auto ordered_by = std::make_pair(ColumnID(0), OrderByMode::Ascending);
@@ -124,4 +124,15 @@ TEST_F(CompositeGroupKeyIndexTest, PositionList) {
   EXPECT_POSITION_LIST_EQ(expected_str_int, *_position_list_str_int);
 }
 
+TEST_F(CompositeGroupKeyIndexTest, BoundsForMissingLeadingValue) {
+  const auto existing_values = std::vector<AllTypeVariant>{pmr_string{"charlie"}, 2};
+  EXPECT_EQ(std::distance(_index_str_int->lower_bound(existing_values), _index_str_int->upper_bound(existing_values)),
+            1);
+
+  // "bravo" is not part of the dictionary, so ("charlie", 2), which directly follows it, must not be found
+  const auto missing_values = std::vector<AllTypeVariant>{pmr_string{"bravo"}, 2};
+  EXPECT_EQ(_index_str_int->lower_bound(missing_values), _index_str_int->upper_bound(missing_values));
+  EXPECT_EQ(_index_str_int->lower_bound(missing_values), _index_str_int->lower_bound(existing_values));
+}
+
 }  // namespace opossum
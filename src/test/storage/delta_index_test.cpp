@@ -0,0 +1,175 @@
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "concurrency/transaction_context.hpp"
+#include "concurrency/transaction_manager.hpp"
+#include "operators/get_table.hpp"
+#include "operators/index_scan.hpp"
+#include "operators/insert.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/index/delta/delta_index.hpp"
+#include "storage/index/group_key/composite_group_key_index.hpp"
+#include "storage/index/group_key/group_key_index.hpp"
+#include "storage/index/table_hash/table_hash_index.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+
+namespace opossum {
+
+class DeltaIndexTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    segment = std::make_shared<ValueSegment<int32_t>>(std::vector<int32_t>{5, 3, 8, 3, 1, 0},
+                                                      std::vector<bool>{false, false, false, false, false, true});
+    index = BaseDeltaIndex::create(DataType::Int, ColumnID{0}, SegmentIndexType::GroupKey);
+    index->insert(*segment, ChunkOffset{0}, ChunkOffset{3});
+    index->insert(*segment, ChunkOffset{3}, ChunkOffset{6});
+  }
+
+  std::vector<ChunkOffset> scan(const PredicateCondition predicate_condition, const AllTypeVariant& value,
+                                const std::optional<AllTypeVariant>& value2 = std::nullopt) {
+    return index->scan(predicate_condition, value, value2);
+  }
+
+  std::shared_ptr<ValueSegment<int32_t>> segment;
+  std::shared_ptr<BaseDeltaIndex> index;
+};
+
+TEST_F(DeltaIndexTest, Scan) {
+  using Offsets = std::vector<ChunkOffset>;
+
+  EXPECT_EQ(index->size(), 5u);
+  EXPECT_EQ(index->column_id(), ColumnID{0});
+  EXPECT_EQ(index->target_index_type(), SegmentIndexType::GroupKey);
+
+  // Results are ordered by value, equal values by their position
+  EXPECT_EQ(scan(PredicateCondition::Equals, 3), Offsets({1, 3}));
+  EXPECT_EQ(scan(PredicateCondition::Equals, 4), Offsets({}));
+  EXPECT_EQ(scan(PredicateCondition::NotEquals, 3), Offsets({4, 0, 2}));
+  EXPECT_EQ(scan(PredicateCondition::LessThan, 5), Offsets({4, 1, 3}));
+  EXPECT_EQ(scan(PredicateCondition::LessThanEquals, 5), Offsets({4, 1, 3, 0}));
+  EXPECT_EQ(scan(PredicateCondition::GreaterThan, 3), Offsets({0, 2}));
+  EXPECT_EQ(scan(PredicateCondition::GreaterThanEquals, 8), Offsets({2}));
+  EXPECT_EQ(scan(PredicateCondition::BetweenInclusive, 3, 5), Offsets({1, 3, 0}));
+  EXPECT_EQ(scan(PredicateCondition::BetweenLowerExclusive, 3, 5), Offsets({0}));
+  EXPECT_EQ(scan(PredicateCondition::BetweenUpperExclusive, 3, 5), Offsets({1, 3}));
+  EXPECT_EQ(scan(PredicateCondition::BetweenExclusive, 1, 8), Offsets({1, 3, 0}));
+  EXPECT_EQ(scan(PredicateCondition::BetweenInclusive, 3, 3), Offsets({1, 3}));
+  EXPECT_EQ(scan(PredicateCondition::BetweenExclusive, 3, 3), Offsets({}));
+  EXPECT_EQ(scan(PredicateCondition::BetweenInclusive, 5, 3), Offsets({}));
+
+  // NULL never matches
+  EXPECT_EQ(scan(PredicateCondition::Equals, NullValue{}), Offsets({}));
+  EXPECT_EQ(scan(PredicateCondition::NotEquals, NullValue{}), Offsets({}));
+
+  EXPECT_THROW(scan(PredicateCondition::Like, 3), std::logic_error);
+}
+
+TEST_F(DeltaIndexTest, MaintainedForMutableChunks) {
+  TableColumnDefinitions column_definitions;
+  column_definitions.emplace_back("a", DataType::Int, true);
+  const auto table = std::make_shared<Table>(column_definitions, TableType::Data, 3, UseMvcc::Yes);
+  for (const auto value : {5, 3, 8, 3, 1}) {
+    table->append({value});
+  }
+  StorageManager::get().add_table("table_a", table);
+  const auto column_ids = std::vector<ColumnID>{ColumnID{0}};
+
+  // The full chunk is encoded and gets a GroupKeyIndex, the mutable one a delta index
+  ChunkEncoder::encode_chunks(table, {ChunkID{0}}, EncodingType::Dictionary);
+  table->create_index<GroupKeyIndex>(column_ids);
+  EXPECT_TRUE(table->get_chunk(ChunkID{0})->get_index(SegmentIndexType::GroupKey, column_ids));
+  EXPECT_FALSE(table->get_chunk(ChunkID{0})->get_delta_index(ColumnID{0}));
+  ASSERT_TRUE(table->get_chunk(ChunkID{1})->get_delta_index(ColumnID{0}));
+  EXPECT_EQ(table->get_chunk(ChunkID{1})->get_delta_index(ColumnID{0})->size(), 2u);
+
+  // Inserted rows are added to the delta index, chunks appended by the Insert get one as well
+  const auto values_to_insert = std::make_shared<Table>(column_definitions, TableType::Data);
+  values_to_insert->append({3});
+  values_to_insert->append({NullValue{}});
+  values_to_insert->append({3});
+  auto table_wrapper = std::make_shared<TableWrapper>(values_to_insert);
+  table_wrapper->execute();
+
+  auto insert = std::make_shared<Insert>("table_a", table_wrapper);
+  auto context = TransactionManager::get().new_transaction_context();
+  insert->set_transaction_context(context);
+  insert->execute();
+  context->commit();
+
+  ASSERT_EQ(table->chunk_count(), 3u);
+  EXPECT_EQ(table->get_chunk(ChunkID{1})->get_delta_index(ColumnID{0})->size(), 3u);
+  ASSERT_TRUE(table->get_chunk(ChunkID{2})->get_delta_index(ColumnID{0}));
+  EXPECT_EQ(table->get_chunk(ChunkID{2})->get_delta_index(ColumnID{0})->size(), 1u);
+
+  // IndexScans cover the encoded as well as the mutable chunks
+  auto get_table = std::make_shared<TableWrapper>(table);
+  get_table->execute();
+  auto index_scan = std::make_shared<IndexScan>(get_table, SegmentIndexType::GroupKey, column_ids,
+                                                PredicateCondition::Equals, std::vector<AllTypeVariant>{3});
+  index_scan->execute();
+  EXPECT_EQ(index_scan->get_output()->row_count(), 4u);
+
+  // Once encoded, the delta index is replaced by the regular index - unless the encoding is not supported by it
+  ChunkEncoder::encode_chunks(table, {ChunkID{1}}, EncodingType::Dictionary);
+  EXPECT_FALSE(table->get_chunk(ChunkID{1})->get_delta_index(ColumnID{0}));
+  EXPECT_TRUE(table->get_chunk(ChunkID{1})->get_index(SegmentIndexType::GroupKey, column_ids));
+
+  ChunkEncoder::encode_chunks(table, {ChunkID{2}}, EncodingType::LZ4);
+  EXPECT_TRUE(table->get_chunk(ChunkID{2})->get_delta_index(ColumnID{0}));
+  EXPECT_FALSE(table->get_chunk(ChunkID{2})->get_index(SegmentIndexType::GroupKey, column_ids));
+
+  index_scan = std::make_shared<IndexScan>(get_table, SegmentIndexType::GroupKey, column_ids,
+                                           PredicateCondition::Equals, std::vector<AllTypeVariant>{3});
+  index_scan->execute();
+  EXPECT_EQ(index_scan->get_output()->row_count(), 4u);
+}
+
+TEST_F(DeltaIndexTest, MaintainedByTableAppend) {
+  TableColumnDefinitions column_definitions;
+  column_definitions.emplace_back("a", DataType::Int);
+  const auto table = std::make_shared<Table>(column_definitions, TableType::Data, 3);
+  table->append({5});
+  StorageManager::get().add_table("table_a", table);
+  const auto column_ids = std::vector<ColumnID>{ColumnID{0}};
+
+  table->create_index<GroupKeyIndex>(column_ids);
+  table->create_table_hash_index(ColumnID{0});
+
+  // Rows appended after the indexes were created are added to them, also in chunks created by the append
+  for (const auto value : {3, 8, 3, 1}) {
+    table->append({value});
+  }
+  ASSERT_EQ(table->chunk_count(), 2u);
+  EXPECT_EQ(table->get_chunk(ChunkID{0})->get_delta_index(ColumnID{0})->size(), 3u);
+  EXPECT_EQ(table->get_chunk(ChunkID{1})->get_delta_index(ColumnID{0})->size(), 2u);
+
+  auto get_table = std::make_shared<GetTable>("table_a");
+  get_table->execute();
+
+  auto index_scan = std::make_shared<IndexScan>(get_table, SegmentIndexType::GroupKey, column_ids,
+                                                PredicateCondition::Equals, std::vector<AllTypeVariant>{3});
+  index_scan->execute();
+  EXPECT_EQ(index_scan->get_output()->row_count(), 2u);
+
+  auto table_hash_scan = std::make_shared<IndexScan>(get_table, SegmentIndexType::TableHash, column_ids,
+                                                     PredicateCondition::Equals, std::vector<AllTypeVariant>{3});
+  table_hash_scan->execute();
+  EXPECT_EQ(table_hash_scan->get_output()->row_count(), 2u);
+}
+
+TEST_F(DeltaIndexTest, MultiColumnIndexRequiresImmutableChunks) {
+  const auto table = load_table("resources/test_data/tbl/int_int_int.tbl", 2);
+  ChunkEncoder::encode_chunks(table, {ChunkID{0}}, EncodingType::Dictionary);
+
+  const auto column_ids = std::vector<ColumnID>{ColumnID{0}, ColumnID{1}};
+  EXPECT_THROW(table->create_index<CompositeGroupKeyIndex>(column_ids), std::logic_error);
+}
+
+}  // namespace opossum
@@ -9,6 +9,7 @@
 #include "storage/chunk.hpp"
 #include "storage/chunk_encoder.hpp"
 #include "storage/lz4_segment.hpp"
+#include "storage/lz4_segment/lz4_block_cache.hpp"
 #include "storage/lz4_segment/lz4_encoder.hpp"
 #include "storage/segment_encoding_utils.hpp"
 #include "storage/value_segment.hpp"
@@ -344,4 +345,47 @@ TEST_F(StorageLZ4SegmentTest, CompressDictionaryIntSegment) {
   EXPECT_EQ(decompressed_data[20124], 40248);
 }
 
+TEST_F(StorageLZ4SegmentTest, DecompressedBlocksAreCached) {
+  auto& block_cache = LZ4BlockCache::get();
+  block_cache.clear();
+
+  const auto num_rows = 10'000;
+  for (auto index = 0; index < num_rows; ++index) {
+    vs_int->append(index);
+  }
+  auto lz4_segment = compress(vs_int, DataType::Int);
+  const auto num_blocks = (num_rows * sizeof(int32_t) + LZ4Encoder::_block_size - 1) / LZ4Encoder::_block_size;
+  ASSERT_GT(num_blocks, 1u);
+  EXPECT_EQ(block_cache.size(), 0u);
+
+  // A point access only caches the accessed block.
+  EXPECT_EQ(lz4_segment->decompress(ChunkOffset{5000u}), 5000);
+  EXPECT_EQ(block_cache.size(), 1u);
+
+  // Decompressing the whole segment caches all blocks. The already cached block is copied from the cache.
+  auto decompressed_data = lz4_segment->decompress();
+  EXPECT_EQ(block_cache.size(), num_blocks);
+  for (auto index = 0; index < num_rows; ++index) {
+    ASSERT_EQ(decompressed_data[index], index);
+  }
+
+  // Decompressing again is served from the cache and yields the same result.
+  EXPECT_EQ(lz4_segment->decompress(), decompressed_data);
+  EXPECT_EQ(lz4_segment->decompress(ChunkOffset{num_rows - 1}), num_rows - 1);
+  EXPECT_EQ(block_cache.size(), num_blocks);
+
+  // Blocks of a copied segment are cached separately.
+  auto copied_segment = std::dynamic_pointer_cast<LZ4Segment<int>>(lz4_segment->copy_using_allocator({}));
+  EXPECT_EQ(copied_segment->decompress(ChunkOffset{0u}), 0);
+  EXPECT_EQ(block_cache.size(), num_blocks + 1);
+
+  // A capacity of zero disables the cache.
+  block_cache.resize(0);
+  EXPECT_EQ(block_cache.size(), 0u);
+  EXPECT_EQ(lz4_segment->decompress(), decompressed_data);
+  EXPECT_EQ(block_cache.size(), 0u);
+
+  block_cache.resize(LZ4BlockCache::DEFAULT_CAPACITY_IN_BYTES);
+}
+
 }  // namespace opossum
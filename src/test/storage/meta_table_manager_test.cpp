@@ -0,0 +1,163 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/get_table.hpp"
+#include "operators/index_scan.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "scheduler/operator_task.hpp"
+#include "scheduler/topology.hpp"
+#include "sql/sql_pipeline_builder.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/index/group_key/group_key_index.hpp"
+#include "storage/meta_table_manager.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "utils/invalid_input_exception.hpp"
+
+namespace opossum {
+
+class MetaTableManagerTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table = load_table("resources/test_data/tbl/int_float.tbl", 2);
+    ChunkEncoder::encode_all_chunks(_table);
+    _table->create_index<GroupKeyIndex>({ColumnID{0}}, "index_a");
+
+    StorageManager::get().add_table("table_a", _table);
+  }
+
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(MetaTableManagerTest, TableNames) {
+  const auto& meta_table_manager = MetaTableManager::get();
+  EXPECT_EQ(meta_table_manager.table_names(),
+            std::vector<std::string>({"meta_indexes", "meta_operator_tasks", "meta_task_queues", "meta_workers"}));
+
+  EXPECT_TRUE(MetaTableManager::is_meta_table_name("meta_indexes"));
+  EXPECT_TRUE(MetaTableManager::is_meta_table_name("meta_unknown"));
+  EXPECT_FALSE(MetaTableManager::is_meta_table_name("meta_"));
+  EXPECT_FALSE(MetaTableManager::is_meta_table_name("table_a"));
+
+  EXPECT_TRUE(meta_table_manager.has_table("meta_indexes"));
+  EXPECT_FALSE(meta_table_manager.has_table("meta_unknown"));
+  EXPECT_FALSE(meta_table_manager.has_table("indexes"));
+
+  // Meta tables are accessed through the StorageManager, but are not stored
+  auto& storage_manager = StorageManager::get();
+  EXPECT_TRUE(storage_manager.has_table("meta_indexes"));
+  EXPECT_EQ(storage_manager.table_names(), std::vector<std::string>{"table_a"});
+  EXPECT_THROW(storage_manager.add_table("meta_table", load_table("resources/test_data/tbl/int_float.tbl")),
+               std::logic_error);
+}
+
+TEST_F(MetaTableManagerTest, IndexesTable) {
+  auto meta_table = StorageManager::get().get_table("meta_indexes");
+  ASSERT_EQ(meta_table->row_count(), 1u);
+  EXPECT_EQ(meta_table->get_value<pmr_string>(ColumnID{0}, 0), "table_a");
+  EXPECT_EQ(meta_table->get_value<pmr_string>(ColumnID{1}, 0), "index_a");
+  EXPECT_EQ(meta_table->get_value<pmr_string>(ColumnID{2}, 0), "a");
+  EXPECT_EQ(meta_table->get_value<pmr_string>(ColumnID{3}, 0), "GroupKey");
+  EXPECT_EQ(meta_table->get_value<int32_t>(ColumnID{4}, 0), 2);
+
+  const auto index_0 = _table->get_chunk(ChunkID{0})->get_index(SegmentIndexType::GroupKey, std::vector{ColumnID{0}});
+  const auto index_1 = _table->get_chunk(ChunkID{1})->get_index(SegmentIndexType::GroupKey, std::vector{ColumnID{0}});
+  EXPECT_EQ(meta_table->get_value<int64_t>(ColumnID{5}, 0),
+            static_cast<int64_t>(index_0->memory_consumption() + index_1->memory_consumption()));
+  EXPECT_EQ(meta_table->get_value<int64_t>(ColumnID{6}, 0),
+            (index_0->build_duration() + index_1->build_duration()).count());
+  EXPECT_EQ(meta_table->get_value<int64_t>(ColumnID{7}, 0), 0);
+  EXPECT_EQ(meta_table->get_value<int64_t>(ColumnID{8}, 0), 0);
+
+  // Each chunk index is looked up once. Of the two rows of the first chunk, one matches, the single row of the second
+  // chunk does not match.
+  const auto get_table = std::make_shared<GetTable>("table_a");
+  get_table->execute();
+  const auto index_scan = std::make_shared<IndexScan>(get_table, SegmentIndexType::GroupKey, std::vector{ColumnID{0}},
+                                                      PredicateCondition::Equals, std::vector<AllTypeVariant>{123});
+  index_scan->execute();
+  EXPECT_EQ(index_scan->get_output()->row_count(), 1u);
+
+  meta_table = StorageManager::get().get_table("meta_indexes");
+  EXPECT_EQ(meta_table->get_value<int64_t>(ColumnID{7}, 0), 2);
+  EXPECT_EQ(meta_table->get_value<int64_t>(ColumnID{8}, 0), 2);
+}
+
+TEST_F(MetaTableManagerTest, UnnamedChunkIndex) {
+  _table->get_chunk(ChunkID{1})->create_index<GroupKeyIndex>(std::vector<ColumnID>{ColumnID{1}});
+
+  const auto meta_table = StorageManager::get().get_table("meta_indexes");
+  ASSERT_EQ(meta_table->row_count(), 2u);
+  EXPECT_EQ(meta_table->get_value<pmr_string>(ColumnID{1}, 1), "");
+  EXPECT_EQ(meta_table->get_value<pmr_string>(ColumnID{2}, 1), "b");
+  EXPECT_EQ(meta_table->get_value<int32_t>(ColumnID{4}, 1), 1);
+}
+
+TEST_F(MetaTableManagerTest, SchedulerTables) {
+  // Without a scheduler, there are neither workers nor queues
+  EXPECT_EQ(StorageManager::get().get_table("meta_workers")->row_count(), 0u);
+  EXPECT_EQ(StorageManager::get().get_table("meta_task_queues")->row_count(), 0u);
+
+  Topology::use_fake_numa_topology(4, 2);
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+
+  const auto operator_tasks_before = OperatorTask::execution_statistics();
+  const auto get_table = std::make_shared<GetTable>("table_a");
+  const auto tasks = OperatorTask::make_tasks_from_operator(get_table, CleanupTemporaries::No);
+  CurrentScheduler::schedule_and_wait_for_tasks(tasks);
+
+  const auto workers_table = StorageManager::get().get_table("meta_workers");
+  ASSERT_EQ(workers_table->row_count(), 4u);
+  auto executed_task_count = int64_t{0};
+  for (auto row = size_t{0}; row < workers_table->row_count(); ++row) {
+    EXPECT_EQ(workers_table->get_value<int32_t>(ColumnID{0}, row), static_cast<int32_t>(row));
+    executed_task_count += workers_table->get_value<int64_t>(ColumnID{4}, row);
+  }
+  EXPECT_GE(executed_task_count, 1);
+
+  const auto task_queues_table = StorageManager::get().get_table("meta_task_queues");
+  ASSERT_EQ(task_queues_table->row_count(), 2u);
+  EXPECT_EQ(task_queues_table->get_value<int32_t>(ColumnID{0}, 1), 1);
+  EXPECT_EQ(task_queues_table->get_value<int32_t>(ColumnID{1}, 0), 2);
+  EXPECT_EQ(task_queues_table->get_value<int64_t>(ColumnID{3}, 0), 0);
+  EXPECT_GE(task_queues_table->get_value<int64_t>(ColumnID{4}, 0), 1);
+
+  // The operator tasks are counted since the start of the program
+  const auto operator_tasks_table = StorageManager::get().get_table("meta_operator_tasks");
+  auto get_table_count = int64_t{0};
+  for (auto row = size_t{0}; row < operator_tasks_table->row_count(); ++row) {
+    if (operator_tasks_table->get_value<pmr_string>(ColumnID{0}, row) == "GetTable") {
+      get_table_count = operator_tasks_table->get_value<int64_t>(ColumnID{1}, row);
+    }
+  }
+  const auto get_table_count_before = operator_tasks_before.count("GetTable")
+                                          ? operator_tasks_before.at("GetTable").executed_task_count
+                                          : uint64_t{0};
+  EXPECT_EQ(get_table_count, static_cast<int64_t>(get_table_count_before + 1));
+
+  CurrentScheduler::get()->finish();
+}
+
+TEST_F(MetaTableManagerTest, SQL) {
+  const auto sql = std::string{"SELECT table_name, SUM(memory_bytes) FROM meta_indexes GROUP BY table_name"};
+  auto pipeline = SQLPipelineBuilder{sql}.create_pipeline();
+  const auto result_table = pipeline.get_result_table();
+  ASSERT_EQ(result_table->row_count(), 1u);
+  EXPECT_EQ(result_table->get_value<pmr_string>(ColumnID{0}, 0), "table_a");
+  EXPECT_GT(result_table->get_value<int64_t>(ColumnID{1}, 0), 0);
+
+  // Meta tables are read-only
+  EXPECT_THROW(SQLPipelineBuilder{"INSERT INTO meta_indexes SELECT * FROM meta_indexes"}
+                   .create_pipeline()
+                   .get_result_table(),
+               InvalidInputException);
+  EXPECT_THROW(SQLPipelineBuilder{"DELETE FROM meta_indexes"}.create_pipeline().get_result_table(),
+               InvalidInputException);
+}
+
+}  // namespace opossum
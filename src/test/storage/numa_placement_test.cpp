@@ -0,0 +1,67 @@
+#include <memory>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "scheduler/topology.hpp"
+#include "storage/chunk.hpp"
+#include "storage/numa_placement.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+class NUMAPlacementTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    Topology::use_fake_numa_topology(4, 1);
+    NUMAPlacement::reset_next_node_id();
+  }
+};
+
+TEST_F(NUMAPlacementTest, InterleavesChunksAcrossNodes) {
+  const auto node_count = Topology::get().nodes().size();
+
+  const auto table = load_table("resources/test_data/tbl/int_float4.tbl", 1);
+  StorageManager::get().add_table("table_a", table);
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+    const auto expected_node_id =
+        node_count > 1 ? NodeID{static_cast<NodeID::base_type>(chunk_id % node_count)} : INVALID_NODE_ID;
+    EXPECT_EQ(table->get_chunk(chunk_id)->node_id(), expected_node_id);
+  }
+}
+
+TEST_F(NUMAPlacementTest, ContinuesAcrossTables) {
+  const auto node_count = Topology::get().nodes().size();
+  if (node_count <= 1) return;
+
+  const auto table_a = load_table("resources/test_data/tbl/int_float4.tbl", 5);
+  const auto table_b = load_table("resources/test_data/tbl/int_float4.tbl", 5);
+  NUMAPlacement::place_chunks(*table_a);
+  NUMAPlacement::place_chunks(*table_b);
+
+  // table_a has two chunks, so the first chunk of table_b goes to the third node
+  EXPECT_EQ(table_b->get_chunk(ChunkID{0})->node_id(), NodeID{static_cast<NodeID::base_type>(2 % node_count)});
+}
+
+TEST_F(NUMAPlacementTest, KeepsExistingPlacement) {
+  const auto table = load_table("resources/test_data/tbl/int_float4.tbl", 5);
+  table->get_chunk(ChunkID{0})->set_node_id(NodeID{3});
+  NUMAPlacement::place_chunks(*table);
+  EXPECT_EQ(table->get_chunk(ChunkID{0})->node_id(), NodeID{3});
+}
+
+TEST_F(NUMAPlacementTest, IgnoresReferenceTables) {
+  const auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, false}},
+                                             TableType::References);
+  const auto pos_list = std::make_shared<PosList>();
+  const auto referenced_table = load_table("resources/test_data/tbl/int_float4.tbl", 5);
+  table->append_chunk({std::make_shared<ReferenceSegment>(referenced_table, ColumnID{0}, pos_list)});
+
+  NUMAPlacement::place_chunks(*table);
+  EXPECT_EQ(table->get_chunk(ChunkID{0})->node_id(), INVALID_NODE_ID);
+}
+
+}  // namespace opossum
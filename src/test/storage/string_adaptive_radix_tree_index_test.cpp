@@ -0,0 +1,166 @@
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/get_table.hpp"
+#include "operators/index_scan.hpp"
+#include "storage/base_segment.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/index/adaptive_radix_tree/string_adaptive_radix_tree_index.hpp"
+#include "storage/storage_manager.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class StringAdaptiveRadixTreeIndexTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    values = {"abd", "b", "abc", "", "ab", "abc", "abcde", "a", "ab"};
+    segment = std::make_shared<ValueSegment<pmr_string>>(pmr_concurrent_vector<pmr_string>{values});
+    index = std::make_shared<StringAdaptiveRadixTreeIndex>(std::vector<std::shared_ptr<const BaseSegment>>({segment}));
+  }
+
+  // Checks the bounds of all probes against a binary search on the sorted values
+  static void check_probes(const StringAdaptiveRadixTreeIndex& index, std::vector<pmr_string> sorted_values,
+                           const std::vector<pmr_string>& probes) {
+    std::sort(sorted_values.begin(), sorted_values.end());
+    for (const auto& probe : probes) {
+      EXPECT_EQ(index.lower_bound({probe}) - index.cbegin(),
+                std::lower_bound(sorted_values.cbegin(), sorted_values.cend(), probe) - sorted_values.cbegin())
+          << probe;
+      EXPECT_EQ(index.upper_bound({probe}) - index.cbegin(),
+                std::upper_bound(sorted_values.cbegin(), sorted_values.cend(), probe) - sorted_values.cbegin())
+          << probe;
+    }
+  }
+
+  size_t node_count() const { return index->_nodes.size(); }
+  const std::string& root_prefix() const { return index->_nodes.front().prefix; }
+  bool has_dense_root() const { return !index->_nodes.front().child_positions.empty(); }
+
+  pmr_concurrent_vector<pmr_string> values;
+  std::shared_ptr<ValueSegment<pmr_string>> segment;
+  std::shared_ptr<StringAdaptiveRadixTreeIndex> index;
+};
+
+TEST_F(StringAdaptiveRadixTreeIndexTest, ChunkOffsets) {
+  const auto expected_chunk_offsets = std::vector<ChunkOffset>{3, 7, 4, 8, 2, 5, 6, 0, 1};
+  EXPECT_EQ(std::vector<ChunkOffset>(index->cbegin(), index->cend()), expected_chunk_offsets);
+}
+
+TEST_F(StringAdaptiveRadixTreeIndexTest, IndexProbes) {
+  const auto begin = index->cbegin();
+  EXPECT_EQ(index->lower_bound({"ab"}) - begin, 2);
+  EXPECT_EQ(index->upper_bound({"ab"}) - begin, 4);
+  EXPECT_EQ(index->lower_bound({"abc"}) - begin, 4);
+  EXPECT_EQ(index->upper_bound({"abc"}) - begin, 6);
+  EXPECT_EQ(index->lower_bound({""}) - begin, 0);
+  EXPECT_EQ(index->upper_bound({""}) - begin, 1);
+
+  // LIKE 'ab%' is searched as ["ab", "ac")
+  EXPECT_EQ(index->lower_bound({"ab"}) - begin, 2);
+  EXPECT_EQ(index->lower_bound({"ac"}) - begin, 8);
+
+  check_probes(*index, {values.cbegin(), values.cend()},
+               {"", "a", "aa", "ab", "aba", "abc", "abcd", "abcde", "abcdef", "abd", "abe", "ac", "b", "ba", "c"});
+}
+
+TEST_F(StringAdaptiveRadixTreeIndexTest, PathCompression) {
+  const auto shared_prefix_values =
+      pmr_concurrent_vector<pmr_string>{"compression", "compressed", "compress", "compressing"};
+  segment = std::make_shared<ValueSegment<pmr_string>>(pmr_concurrent_vector<pmr_string>{shared_prefix_values});
+  index = std::make_shared<StringAdaptiveRadixTreeIndex>(std::vector<std::shared_ptr<const BaseSegment>>({segment}));
+
+  // The root holds the common prefix and "compress" ends there. Its child 'i' branches into "ng" and "on".
+  EXPECT_EQ(root_prefix(), "compress");
+  EXPECT_EQ(node_count(), 5u);
+
+  check_probes(*index, {shared_prefix_values.cbegin(), shared_prefix_values.cend()},
+               {"c", "compre", "compress", "compresse", "compressed", "compressedx", "compressh", "compressing",
+                "compressio", "compression", "compressions", "compressz", "d"});
+}
+
+TEST_F(StringAdaptiveRadixTreeIndexTest, ManyChildren) {
+  // A node with more than 16 children maps each byte to its child, including bytes >= 0x80
+  auto many_values = pmr_concurrent_vector<pmr_string>{};
+  for (auto byte = 1; byte < 256; byte += 5) {
+    many_values.emplace_back(pmr_string{"x"} + static_cast<char>(byte) + "y");
+  }
+  segment = std::make_shared<ValueSegment<pmr_string>>(pmr_concurrent_vector<pmr_string>{many_values});
+  index = std::make_shared<StringAdaptiveRadixTreeIndex>(std::vector<std::shared_ptr<const BaseSegment>>({segment}));
+
+  EXPECT_TRUE(has_dense_root());
+
+  auto probes = std::vector<pmr_string>{"", "x", "y"};
+  for (auto byte = 0; byte < 256; ++byte) {
+    probes.emplace_back(pmr_string{"x"} + static_cast<char>(byte));
+    probes.emplace_back(pmr_string{"x"} + static_cast<char>(byte) + "y");
+    probes.emplace_back(pmr_string{"x"} + static_cast<char>(byte) + "z");
+  }
+  check_probes(*index, {many_values.cbegin(), many_values.cend()}, probes);
+}
+
+TEST_F(StringAdaptiveRadixTreeIndexTest, NullValues) {
+  const auto nullable_segment = std::make_shared<ValueSegment<pmr_string>>(
+      pmr_concurrent_vector<pmr_string>{"b", "", "a", "c"}, pmr_concurrent_vector<bool>{false, true, false, true});
+  index = std::make_shared<StringAdaptiveRadixTreeIndex>(
+      std::vector<std::shared_ptr<const BaseSegment>>({nullable_segment}));
+
+  EXPECT_EQ(std::vector<ChunkOffset>(index->cbegin(), index->cend()), (std::vector<ChunkOffset>{2, 0}));
+  EXPECT_EQ(index->lower_bound({""}) - index->cbegin(), 0);
+  EXPECT_EQ(index->upper_bound({"c"}) - index->cbegin(), 2);
+}
+
+TEST_F(StringAdaptiveRadixTreeIndexTest, EmptySegment) {
+  segment = std::make_shared<ValueSegment<pmr_string>>(pmr_concurrent_vector<pmr_string>{});
+  index = std::make_shared<StringAdaptiveRadixTreeIndex>(std::vector<std::shared_ptr<const BaseSegment>>({segment}));
+
+  EXPECT_EQ(index->cbegin(), index->cend());
+  EXPECT_EQ(index->lower_bound({"a"}), index->cend());
+  EXPECT_EQ(index->upper_bound({"a"}), index->cend());
+}
+
+TEST_F(StringAdaptiveRadixTreeIndexTest, DictionarySegment) {
+  const auto dictionary_segment =
+      create_dict_segment_by_type<pmr_string>(DataType::String, {values.cbegin(), values.cend()});
+  const auto dictionary_index = std::make_shared<StringAdaptiveRadixTreeIndex>(
+      std::vector<std::shared_ptr<const BaseSegment>>({dictionary_segment}));
+
+  EXPECT_EQ(std::vector<ChunkOffset>(dictionary_index->cbegin(), dictionary_index->cend()),
+            std::vector<ChunkOffset>(index->cbegin(), index->cend()));
+}
+
+TEST_F(StringAdaptiveRadixTreeIndexTest, MemoryConsumption) {
+  EXPECT_GT(index->memory_consumption(), values.size() * sizeof(ChunkOffset) + node_count() * sizeof(std::string));
+  EXPECT_GT(StringAdaptiveRadixTreeIndex::estimate_memory_consumption(9, 6, 3), 9 * sizeof(ChunkOffset));
+}
+
+TEST_F(StringAdaptiveRadixTreeIndexTest, IndexScanPrefix) {
+  const auto table = load_table("resources/test_data/tbl/int_string_like.tbl", 3);
+  ChunkEncoder::encode_all_chunks(table);
+  table->create_index<StringAdaptiveRadixTreeIndex>({ColumnID{1}});
+  StorageManager::get().add_table("table_like", table);
+
+  const auto get_table = std::make_shared<GetTable>("table_like");
+  get_table->execute();
+
+  // b LIKE 'Dampf%'
+  const auto index_scan =
+      std::make_shared<IndexScan>(get_table, SegmentIndexType::StringAdaptiveRadixTree, std::vector{ColumnID{1}},
+                                  PredicateCondition::BetweenUpperExclusive, std::vector<AllTypeVariant>{"Dampf"},
+                                  std::vector<AllTypeVariant>{"Dampg"});
+  index_scan->execute();
+
+  const auto& result = index_scan->get_output();
+  ASSERT_EQ(result->row_count(), 3u);
+  for (auto row = size_t{0}; row < result->row_count(); ++row) {
+    EXPECT_EQ(result->get_value<pmr_string>(ColumnID{1}, row).substr(0, 5), "Dampf");
+  }
+}
+
+}  // namespace opossum
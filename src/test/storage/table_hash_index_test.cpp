@@ -0,0 +1,124 @@
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "concurrency/transaction_context.hpp"
+#include "concurrency/transaction_manager.hpp"
+#include "operators/insert.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/index/table_hash/table_hash_index.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+class TableHashIndexTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    TableColumnDefinitions column_definitions;
+    column_definitions.emplace_back("a", DataType::Int, true);
+    column_definitions.emplace_back("b", DataType::String, false);
+
+    _table = std::make_shared<Table>(column_definitions, TableType::Data, 3, UseMvcc::Yes);
+    _table->append({4, "four"});
+    _table->append({2, "two"});
+    _table->append({NullValue{}, "null"});
+    _table->append({4, "four"});
+    _table->append({7, "seven"});
+    _table->append({2, "two"});
+    _table->append({4, "four"});
+  }
+
+  static PosList sorted(PosList pos_list) {
+    std::sort(pos_list.begin(), pos_list.end());
+    return pos_list;
+  }
+
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(TableHashIndexTest, LookupAcrossChunks) {
+  ChunkEncoder::encode_chunks(_table, {ChunkID{0}}, EncodingType::Dictionary);
+  _table->create_table_hash_index(ColumnID{0}, "a_hash");
+  _table->create_table_hash_index(ColumnID{1});
+
+  const auto index_a = _table->get_table_hash_index(ColumnID{0});
+  ASSERT_TRUE(index_a);
+  EXPECT_EQ(index_a->column_id(), ColumnID{0});
+  EXPECT_EQ(index_a->size(), 6u);
+
+  EXPECT_EQ(sorted(index_a->lookup(4)), PosList({RowID{ChunkID{0}, ChunkOffset{0}}, RowID{ChunkID{1}, ChunkOffset{0}},
+                                                 RowID{ChunkID{2}, ChunkOffset{0}}}));
+  EXPECT_EQ(sorted(index_a->lookup(2)),
+            PosList({RowID{ChunkID{0}, ChunkOffset{1}}, RowID{ChunkID{1}, ChunkOffset{2}}}));
+  EXPECT_TRUE(index_a->lookup(5).empty());
+
+  // NULL never matches, neither do values that cannot be represented in the column's type
+  EXPECT_TRUE(index_a->lookup(NullValue{}).empty());
+  EXPECT_TRUE(index_a->lookup(4.5).empty());
+  EXPECT_EQ(index_a->lookup(int64_t{7}), PosList({RowID{ChunkID{1}, ChunkOffset{1}}}));
+
+  const auto index_b = _table->get_table_hash_index(ColumnID{1});
+  ASSERT_TRUE(index_b);
+  EXPECT_EQ(index_b->lookup(pmr_string{"null"}), PosList({RowID{ChunkID{0}, ChunkOffset{2}}}));
+
+  const auto& indexes = _table->get_indexes();
+  ASSERT_EQ(indexes.size(), 2u);
+  EXPECT_EQ(indexes[0].name, "a_hash");
+  EXPECT_EQ(indexes[0].type, SegmentIndexType::TableHash);
+  EXPECT_EQ(indexes[0].column_ids, std::vector<ColumnID>{ColumnID{0}});
+
+  EXPECT_THROW(_table->create_table_hash_index(ColumnID{0}), std::logic_error);
+}
+
+TEST_F(TableHashIndexTest, InsertAndRollback) {
+  _table->create_table_hash_index(ColumnID{0});
+  StorageManager::get().add_table("table_a", _table);
+  const auto index = _table->get_table_hash_index(ColumnID{0});
+
+  const auto values_to_insert = std::make_shared<Table>(_table->column_definitions(), TableType::Data);
+  values_to_insert->append({7, "seven"});
+  values_to_insert->append({NullValue{}, "null"});
+  auto table_wrapper = std::make_shared<TableWrapper>(values_to_insert);
+  table_wrapper->execute();
+
+  auto insert = std::make_shared<Insert>("table_a", table_wrapper);
+  auto context = TransactionManager::get().new_transaction_context();
+  insert->set_transaction_context(context);
+  insert->execute();
+  context->commit();
+
+  EXPECT_EQ(index->size(), 7u);
+  EXPECT_EQ(sorted(index->lookup(7)), PosList({RowID{ChunkID{1}, ChunkOffset{1}}, RowID{ChunkID{2}, ChunkOffset{1}}}));
+
+  auto rolled_back_insert = std::make_shared<Insert>("table_a", table_wrapper);
+  auto rolled_back_context = TransactionManager::get().new_transaction_context();
+  rolled_back_insert->set_transaction_context(rolled_back_context);
+  rolled_back_insert->execute();
+  EXPECT_EQ(index->lookup(7).size(), 3u);
+  rolled_back_context->rollback();
+
+  EXPECT_EQ(index->size(), 7u);
+  EXPECT_EQ(index->lookup(7).size(), 2u);
+}
+
+TEST_F(TableHashIndexTest, RemoveChunk) {
+  _table->create_table_hash_index(ColumnID{0});
+  const auto index = _table->get_table_hash_index(ColumnID{0});
+
+  // Physically deleting a chunk requires all of its rows to be invalidated
+  _table->get_chunk(ChunkID{0})->increase_invalid_row_count(3);
+
+  _table->remove_chunk(ChunkID{0});
+
+  EXPECT_EQ(index->size(), 4u);
+  EXPECT_EQ(sorted(index->lookup(4)), PosList({RowID{ChunkID{1}, ChunkOffset{0}}, RowID{ChunkID{2}, ChunkOffset{0}}}));
+  EXPECT_EQ(index->lookup(2), PosList({RowID{ChunkID{1}, ChunkOffset{2}}}));
+}
+
+}  // namespace opossum
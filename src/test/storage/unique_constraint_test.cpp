@@ -0,0 +1,140 @@
+#include <memory>
+#include <string>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "concurrency/transaction_context.hpp"
+#include "concurrency/transaction_manager.hpp"
+#include "operators/insert.hpp"
+#include "operators/table_wrapper.hpp"
+#include "sql/sql_pipeline_builder.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "storage/unique_constraint_checker.hpp"
+
+namespace opossum {
+
+class UniqueConstraintTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    TableColumnDefinitions column_definitions;
+    column_definitions.emplace_back("a", DataType::Int, false);
+    column_definitions.emplace_back("b", DataType::Int, true);
+
+    _table = std::make_shared<Table>(column_definitions, TableType::Data, 2, UseMvcc::Yes);
+    _table->append({1, 1});
+    _table->append({2, NULL_VALUE});
+    _table->append({3, 3});
+
+    _table->add_unique_constraint({ColumnID{0}}, IsPrimaryKey::Yes);
+    _table->add_unique_constraint({ColumnID{1}});
+
+    StorageManager::get().add_table("table_a", _table);
+  }
+
+  // Executes the statement in its own transaction and returns whether it was committed
+  static bool execute(const std::string& sql) {
+    const auto transaction_context = TransactionManager::get().new_transaction_context();
+    auto pipeline = SQLPipelineBuilder{sql}.with_transaction_context(transaction_context).create_pipeline();
+    pipeline.get_result_tables();
+
+    if (transaction_context->aborted()) return false;
+
+    transaction_context->commit();
+    return true;
+  }
+
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(UniqueConstraintTest, AddUniqueConstraint) {
+  const auto& constraints = _table->get_unique_constraints();
+  ASSERT_EQ(constraints.size(), 2u);
+  EXPECT_EQ(constraints[0].column_ids, std::vector<ColumnID>{ColumnID{0}});
+  EXPECT_EQ(constraints[0].is_primary_key, IsPrimaryKey::Yes);
+  EXPECT_EQ(constraints[1].column_ids, std::vector<ColumnID>{ColumnID{1}});
+  EXPECT_EQ(constraints[1].is_primary_key, IsPrimaryKey::No);
+
+  EXPECT_TRUE(unique_constraint_satisfied(*_table, constraints[0]));
+  EXPECT_TRUE(unique_constraint_satisfied(*_table, constraints[1]));
+}
+
+TEST_F(UniqueConstraintTest, InvalidConstraints) {
+  // A second primary key
+  EXPECT_THROW(_table->add_unique_constraint({ColumnID{0}, ColumnID{1}}, IsPrimaryKey::Yes), std::logic_error);
+
+  auto table = std::make_shared<Table>(_table->column_definitions(), TableType::Data);
+  EXPECT_THROW(table->add_unique_constraint({}), std::logic_error);
+  EXPECT_THROW(table->add_unique_constraint({ColumnID{2}}), std::logic_error);
+  EXPECT_THROW(table->add_unique_constraint({ColumnID{0}, ColumnID{0}}), std::logic_error);
+  EXPECT_THROW(table->add_unique_constraint({ColumnID{1}}, IsPrimaryKey::Yes), std::logic_error);
+}
+
+TEST_F(UniqueConstraintTest, InsertDuplicateFails) {
+  EXPECT_FALSE(execute("INSERT INTO table_a VALUES (2, 4)"));
+  EXPECT_FALSE(execute("INSERT INTO table_a VALUES (4, 3)"));
+  EXPECT_TRUE(execute("INSERT INTO table_a VALUES (4, 4)"));
+  EXPECT_FALSE(execute("INSERT INTO table_a VALUES (4, 5)"));
+
+  // Rolled back rows do not count
+  EXPECT_TRUE(execute("INSERT INTO table_a VALUES (5, 5)"));
+
+  for (const auto& constraint : _table->get_unique_constraints()) {
+    EXPECT_TRUE(unique_constraint_satisfied(*_table, constraint));
+  }
+}
+
+TEST_F(UniqueConstraintTest, DuplicateWithinInsertFails) {
+  auto values = std::make_shared<Table>(_table->column_definitions(), TableType::Data);
+  values->append({7, 7});
+  values->append({7, 8});
+
+  const auto table_wrapper = std::make_shared<TableWrapper>(values);
+  table_wrapper->execute();
+
+  const auto transaction_context = TransactionManager::get().new_transaction_context();
+  const auto insert = std::make_shared<Insert>("table_a", table_wrapper);
+  insert->set_transaction_context(transaction_context);
+  insert->execute();
+
+  EXPECT_TRUE(insert->execute_failed());
+  transaction_context->rollback();
+}
+
+TEST_F(UniqueConstraintTest, NullsAreNotDuplicates) {
+  EXPECT_TRUE(execute("INSERT INTO table_a VALUES (6, NULL)"));
+  EXPECT_TRUE(execute("INSERT INTO table_a VALUES (7, NULL)"));
+}
+
+TEST_F(UniqueConstraintTest, UpdateAndDelete) {
+  // The Update deletes the old version of the row in the same transaction
+  EXPECT_TRUE(execute("UPDATE table_a SET b = 10 WHERE a = 1"));
+
+  EXPECT_TRUE(execute("DELETE FROM table_a WHERE a = 3"));
+  EXPECT_TRUE(execute("INSERT INTO table_a VALUES (3, 3)"));
+}
+
+TEST_F(UniqueConstraintTest, UncommittedInsertConflicts) {
+  const auto transaction_context = TransactionManager::get().new_transaction_context();
+  SQLPipelineBuilder{"INSERT INTO table_a VALUES (8, 8)"}
+      .with_transaction_context(transaction_context)
+      .create_pipeline()
+      .get_result_tables();
+  ASSERT_FALSE(transaction_context->aborted());
+
+  EXPECT_FALSE(execute("INSERT INTO table_a VALUES (8, 9)"));
+
+  transaction_context->commit();
+  EXPECT_TRUE(execute("INSERT INTO table_a VALUES (9, 9)"));
+}
+
+TEST_F(UniqueConstraintTest, TableHashIndex) {
+  _table->create_table_hash_index(ColumnID{0});
+
+  EXPECT_FALSE(execute("INSERT INTO table_a VALUES (1, 11)"));
+  EXPECT_TRUE(execute("INSERT INTO table_a VALUES (11, 11)"));
+  EXPECT_FALSE(execute("INSERT INTO table_a VALUES (11, 12)"));
+}
+
+}  // namespace opossum
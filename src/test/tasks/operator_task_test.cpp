@@ -98,19 +98,19 @@ TEST_F(OperatorTaskTest, MakeDiamondShape) {
   EXPECT_EQ(tasks[3]->get_operator(), scan_c);
   EXPECT_EQ(tasks[4]->get_operator(), union_positions);
 
-  std::vector<std::shared_ptr<AbstractTask>> expected_successors_0({tasks[1]});
+  AbstractTask::Successors expected_successors_0({tasks[1]});
   EXPECT_EQ(tasks[0]->successors(), expected_successors_0);
 
-  std::vector<std::shared_ptr<AbstractTask>> expected_successors_1({tasks[2], tasks[3]});
+  AbstractTask::Successors expected_successors_1({tasks[2], tasks[3]});
   EXPECT_EQ(tasks[1]->successors(), expected_successors_1);
 
-  std::vector<std::shared_ptr<AbstractTask>> expected_successors_2({tasks[4]});
+  AbstractTask::Successors expected_successors_2({tasks[4]});
   EXPECT_EQ(tasks[2]->successors(), expected_successors_2);
 
-  std::vector<std::shared_ptr<AbstractTask>> expected_successors_3({tasks[4]});
+  AbstractTask::Successors expected_successors_3({tasks[4]});
   EXPECT_EQ(tasks[3]->successors(), expected_successors_3);
 
-  std::vector<std::shared_ptr<AbstractTask>> expected_successors_4{};
+  AbstractTask::Successors expected_successors_4{};
   EXPECT_EQ(tasks[4]->successors(), expected_successors_4);
 
   for (auto& task : tasks) {
@@ -0,0 +1,58 @@
+#include <chrono>
+
+#include "gtest/gtest.h"
+
+#include "utils/duration_histogram.hpp"
+
+using namespace std::chrono_literals;  // NOLINT
+
+namespace opossum {
+
+TEST(DurationHistogramTest, Percentiles) {
+  auto histogram = DurationHistogram{};
+  EXPECT_EQ(histogram.count(), 0u);
+  EXPECT_EQ(histogram.percentile(50.0), 0ns);
+
+  // Small durations have a bucket each
+  histogram.record(3ns);
+  EXPECT_EQ(histogram.percentile(0.0), 3ns);
+  EXPECT_EQ(histogram.percentile(100.0), 3ns);
+
+  // 1'000 durations from 1µs to 1ms
+  histogram.reset();
+  for (auto microseconds = 1; microseconds <= 1'000; ++microseconds) {
+    histogram.record(std::chrono::microseconds{microseconds});
+  }
+  EXPECT_EQ(histogram.count(), 1'000u);
+
+  // A percentile is the upper bound of its bucket, which is at most 1/8 larger than the actual duration
+  const auto expected_percentiles = {std::pair{50.0, 500us}, std::pair{99.0, 990us}, std::pair{100.0, 1000us}};
+  for (const auto& [percentile, duration] : expected_percentiles) {
+    EXPECT_GE(histogram.percentile(percentile), duration);
+    EXPECT_LE(histogram.percentile(percentile), duration + duration / 8);
+  }
+
+  // Negative durations (e.g., caused by clock adjustments) count as zero
+  histogram.reset();
+  histogram.record(-5ns);
+  EXPECT_EQ(histogram.percentile(100.0), 0ns);
+
+  EXPECT_THROW(histogram.percentile(101.0), std::logic_error);
+}
+
+TEST(DurationHistogramTest, Merge) {
+  auto histogram_a = DurationHistogram{};
+  auto histogram_b = DurationHistogram{};
+  histogram_a.record(10ns);
+  histogram_b.record(20s);
+  histogram_b.record(30s);
+
+  histogram_a.merge(histogram_b);
+  EXPECT_EQ(histogram_a.count(), 3u);
+  EXPECT_EQ(histogram_b.count(), 2u);
+  EXPECT_EQ(histogram_a.percentile(10.0), 10ns);
+  EXPECT_GE(histogram_a.percentile(100.0), 30s);
+  EXPECT_LE(histogram_a.percentile(100.0), 30s + 30s / 8);
+}
+
+}  // namespace opossum